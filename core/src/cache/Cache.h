@@ -11,22 +11,29 @@
 
 #pragma once
 
-#include "LRU.h"
+#include "CachePolicy.h"
 #include "utils/Log.h"
 
 #include <atomic>
+#include <functional>
 #include <mutex>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace milvus {
 namespace cache {
 
+static const char* CACHE_POLICY_LRU = "lru";
+static const char* CACHE_POLICY_SLRU = "slru";
+
 template <typename ItemObj>
 class Cache {
  public:
+    using EvictCallback = std::function<void(const std::string& key)>;
+
     // mem_capacity, units:GB
-    Cache(int64_t capacity_gb, uint64_t cache_max_count);
+    Cache(int64_t capacity_gb, uint64_t cache_max_count, const std::string& policy = CACHE_POLICY_LRU);
     ~Cache() = default;
 
     int64_t
@@ -54,6 +61,12 @@ class Cache {
         freemem_percent_ = percent;
     }
 
+    // called for every item removed to make room, not for erase() or clear()
+    void
+    set_evict_callback(const EvictCallback& callback) {
+        evict_callback_ = callback;
+    }
+
     size_t
     size() const;
 
@@ -69,6 +82,10 @@ class Cache {
     void
     erase(const std::string& key);
 
+    // snapshot of the cached keys, most valuable first
+    std::vector<std::string>
+    keys() const;
+
     void
     print();
 
@@ -84,7 +101,8 @@ class Cache {
     int64_t capacity_;
     double freemem_percent_;
 
-    LRU<std::string, ItemObj> lru_;
+    CachePolicyPtr<ItemObj> policy_;
+    EvictCallback evict_callback_;
     mutable std::mutex mutex_;
 };
 
@@ -15,9 +15,14 @@ namespace cache {
 constexpr double DEFAULT_THRESHHOLD_PERCENT = 0.85;
 
 template <typename ItemObj>
-Cache<ItemObj>::Cache(int64_t capacity, uint64_t cache_max_count)
-    : usage_(0), capacity_(capacity), freemem_percent_(DEFAULT_THRESHHOLD_PERCENT), lru_(cache_max_count) {
+Cache<ItemObj>::Cache(int64_t capacity, uint64_t cache_max_count, const std::string& policy)
+    : usage_(0), capacity_(capacity), freemem_percent_(DEFAULT_THRESHHOLD_PERCENT) {
     //    AGENT_LOG_DEBUG << "Construct Cache with capacity " << std::to_string(mem_capacity)
+    if (policy == CACHE_POLICY_SLRU) {
+        policy_ = std::make_unique<SLRUPolicy<ItemObj>>(capacity);
+    } else {
+        policy_ = std::make_unique<LRUPolicy<ItemObj>>(cache_max_count);
+    }
 }
 
 template <typename ItemObj>
@@ -25,6 +30,10 @@ void
 Cache<ItemObj>::set_capacity(int64_t capacity) {
     if (capacity > 0) {
         capacity_ = capacity;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            policy_->set_capacity(capacity);
+        }
         free_memory();
     }
 }
@@ -33,25 +42,34 @@ template <typename ItemObj>
 size_t
 Cache<ItemObj>::size() const {
     std::lock_guard<std::mutex> lock(mutex_);
-    return lru_.size();
+    return policy_->size();
+}
+
+template <typename ItemObj>
+std::vector<std::string>
+Cache<ItemObj>::keys() const {
+    std::vector<std::string> keys;
+    std::lock_guard<std::mutex> lock(mutex_);
+    policy_->keys(keys);
+    return keys;
 }
 
 template <typename ItemObj>
 bool
 Cache<ItemObj>::exists(const std::string& key) {
     std::lock_guard<std::mutex> lock(mutex_);
-    return lru_.exists(key);
+    return policy_->exists(key);
 }
 
 template <typename ItemObj>
 ItemObj
 Cache<ItemObj>::get(const std::string& key) {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (!lru_.exists(key)) {
+    if (!policy_->exists(key)) {
         return nullptr;
     }
 
-    return lru_.get(key);
+    return policy_->get(key);
 }
 
 template <typename ItemObj>
@@ -72,8 +90,8 @@ Cache<ItemObj>::insert(const std::string& key, const ItemObj& item) {
         std::lock_guard<std::mutex> lock(mutex_);
 
         // if key already exist, subtract old item size
-        if (lru_.exists(key)) {
-            const ItemObj& old_item = lru_.get(key);
+        if (policy_->exists(key)) {
+            const ItemObj& old_item = policy_->peek(key);
             usage_ -= old_item->Size();
         }
 
@@ -92,7 +110,7 @@ Cache<ItemObj>::insert(const std::string& key, const ItemObj& item) {
     {
         std::lock_guard<std::mutex> lock(mutex_);
 
-        lru_.put(key, item);
+        policy_->put(key, item);
         SERVER_LOG_DEBUG << "Insert " << key << " size: " << item->Size() << " bytes into cache, usage: " << usage_
                          << " bytes," << " capacity: " << capacity_ << " bytes";
     }
@@ -102,24 +120,24 @@ template <typename ItemObj>
 void
 Cache<ItemObj>::erase(const std::string& key) {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (!lru_.exists(key)) {
+    if (!policy_->exists(key)) {
         return;
     }
 
-    const ItemObj& old_item = lru_.get(key);
+    const ItemObj& old_item = policy_->peek(key);
     usage_ -= old_item->Size();
 
     SERVER_LOG_DEBUG << "Erase " << key << " size: " << old_item->Size() << " bytes from cache, usage: " << usage_
                      << " bytes," << " capacity: " << capacity_ << " bytes";
 
-    lru_.erase(key);
+    policy_->erase(key);
 }
 
 template <typename ItemObj>
 void
 Cache<ItemObj>::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
-    lru_.clear();
+    policy_->clear();
     usage_ = 0;
     SERVER_LOG_DEBUG << "Clear cache !";
 }
@@ -137,20 +155,14 @@ Cache<ItemObj>::free_memory() {
         delta_size = 1;  // ensure at least one item erased
     }
 
-    std::set<std::string> key_array;
+    std::vector<std::string> key_array;
     int64_t released_size = 0;
 
     {
         std::lock_guard<std::mutex> lock(mutex_);
-
-        auto it = lru_.rbegin();
-        while (it != lru_.rend() && released_size < delta_size) {
-            auto& key = it->first;
-            auto& obj_ptr = it->second;
-
-            key_array.emplace(key);
-            released_size += obj_ptr->Size();
-            ++it;
+        policy_->victims(delta_size, key_array);
+        for (auto& key : key_array) {
+            released_size += policy_->peek(key)->Size();
         }
     }
 
@@ -158,6 +170,9 @@ Cache<ItemObj>::free_memory() {
 
     for (auto& key : key_array) {
         erase(key);
+        if (evict_callback_) {
+            evict_callback_(key);
+        }
     }
 
     print();
@@ -169,12 +184,7 @@ Cache<ItemObj>::print() {
     size_t cache_count = 0;
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        cache_count = lru_.size();
-#if 0
-        for (auto it = lru_.begin(); it != lru_.end(); ++it) {
-            SERVER_LOG_DEBUG << it->first;
-        }
-#endif
+        cache_count = policy_->size();
     }
 
     SERVER_LOG_DEBUG << "[Cache item count]: " << cache_count;
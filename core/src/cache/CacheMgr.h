@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace milvus {
 namespace cache {
@@ -30,6 +31,9 @@ class CacheMgr {
     virtual bool
     ItemExists(const std::string& key);
 
+    virtual std::vector<std::string>
+    ItemKeys() const;
+
     virtual ItemObj
     GetItem(const std::string& key);
 
@@ -31,6 +31,17 @@ CacheMgr<ItemObj>::ItemCount() const {
     return (uint64_t)(cache_->size());
 }
 
+template <typename ItemObj>
+std::vector<std::string>
+CacheMgr<ItemObj>::ItemKeys() const {
+    if (cache_ == nullptr) {
+        SERVER_LOG_ERROR << "Cache doesn't exist";
+        return std::vector<std::string>();
+    }
+
+    return cache_->keys();
+}
+
 template <typename ItemObj>
 bool
 CacheMgr<ItemObj>::ItemExists(const std::string& key) {
@@ -0,0 +1,321 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cache/LRU.h"
+
+namespace milvus {
+namespace cache {
+
+/*
+ * Bookkeeping of which cached items to keep. Not thread safe, Cache serializes all calls.
+ */
+template <typename ItemObj>
+class CachePolicy {
+ public:
+    virtual ~CachePolicy() = default;
+
+    virtual bool
+    exists(const std::string& key) const = 0;
+
+    // counts as an access
+    virtual const ItemObj&
+    get(const std::string& key) = 0;
+
+    // does not count as an access
+    virtual const ItemObj&
+    peek(const std::string& key) = 0;
+
+    virtual void
+    put(const std::string& key, const ItemObj& item) = 0;
+
+    virtual void
+    erase(const std::string& key) = 0;
+
+    virtual size_t
+    size() const = 0;
+
+    virtual void
+    clear() = 0;
+
+    // unit: BYTE
+    virtual void
+    set_capacity(int64_t capacity) {
+    }
+
+    // keys to evict, in eviction order, until their sizes add up to delta_size
+    virtual void
+    victims(int64_t delta_size, std::vector<std::string>& keys) = 0;
+
+    // all keys, most valuable first
+    virtual void
+    keys(std::vector<std::string>& keys) = 0;
+};
+
+template <typename ItemObj>
+using CachePolicyPtr = std::unique_ptr<CachePolicy<ItemObj>>;
+
+/*
+ * Plain least recently used.
+ */
+template <typename ItemObj>
+class LRUPolicy : public CachePolicy<ItemObj> {
+ public:
+    explicit LRUPolicy(size_t max_count) : lru_(max_count) {
+    }
+
+    bool
+    exists(const std::string& key) const override {
+        return lru_.exists(key);
+    }
+
+    const ItemObj&
+    get(const std::string& key) override {
+        return lru_.get(key);
+    }
+
+    const ItemObj&
+    peek(const std::string& key) override {
+        return lru_.peek(key);
+    }
+
+    void
+    put(const std::string& key, const ItemObj& item) override {
+        lru_.put(key, item);
+    }
+
+    void
+    erase(const std::string& key) override {
+        lru_.erase(key);
+    }
+
+    size_t
+    size() const override {
+        return lru_.size();
+    }
+
+    void
+    clear() override {
+        lru_.clear();
+    }
+
+    void
+    victims(int64_t delta_size, std::vector<std::string>& keys) override {
+        int64_t released_size = 0;
+        for (auto it = lru_.rbegin(); it != lru_.rend() && released_size < delta_size; ++it) {
+            keys.push_back(it->first);
+            released_size += it->second->Size();
+        }
+    }
+
+    void
+    keys(std::vector<std::string>& keys) override {
+        for (auto it = lru_.begin(); it != lru_.end(); ++it) {
+            keys.push_back(it->first);
+        }
+    }
+
+ private:
+    LRU<std::string, ItemObj> lru_;
+};
+
+/*
+ * Segmented LRU: new items enter a probation segment and are promoted to a protected segment on their
+ * second access. Victims come from probation first, so a single pass over cold data (a full scan, a
+ * preload) cannot push out items that are used repeatedly. The protected segment is capped at a share
+ * of the capacity, its least recent items fall back to probation.
+ *
+ * Among the least recent items of a segment the one with the lowest reload cost per byte goes first,
+ * a large index fetched from S3 is kept over a small raw file of the same age.
+ */
+template <typename ItemObj>
+class SLRUPolicy : public CachePolicy<ItemObj> {
+ public:
+    static constexpr double PROTECTED_PERCENT = 0.8;
+    static constexpr size_t EVICT_WINDOW = 8;
+
+    explicit SLRUPolicy(int64_t capacity) : protected_capacity_(capacity * PROTECTED_PERCENT) {
+    }
+
+    void
+    set_capacity(int64_t capacity) override {
+        protected_capacity_ = capacity * PROTECTED_PERCENT;
+        demote();
+    }
+
+    bool
+    exists(const std::string& key) const override {
+        return map_.find(key) != map_.end();
+    }
+
+    const ItemObj&
+    get(const std::string& key) override {
+        auto it = map_.find(key);
+        if (it == map_.end()) {
+            throw std::range_error("There is no such key in cache");
+        }
+
+        auto& entry = it->second;
+        if (entry.is_protected_) {
+            protected_.splice(protected_.begin(), protected_, entry.iter_);
+        } else {
+            protected_.splice(protected_.begin(), probation_, entry.iter_);
+            entry.is_protected_ = true;
+            protected_size_ += entry.iter_->second->Size();
+            demote();
+        }
+        return entry.iter_->second;
+    }
+
+    const ItemObj&
+    peek(const std::string& key) override {
+        auto it = map_.find(key);
+        if (it == map_.end()) {
+            throw std::range_error("There is no such key in cache");
+        }
+        return it->second.iter_->second;
+    }
+
+    void
+    put(const std::string& key, const ItemObj& item) override {
+        auto it = map_.find(key);
+        if (it != map_.end()) {
+            // replaced items keep their segment
+            auto& entry = it->second;
+            if (entry.is_protected_) {
+                protected_size_ += item->Size() - entry.iter_->second->Size();
+                entry.iter_->second = item;
+                protected_.splice(protected_.begin(), protected_, entry.iter_);
+                demote();
+            } else {
+                entry.iter_->second = item;
+                probation_.splice(probation_.begin(), probation_, entry.iter_);
+            }
+            return;
+        }
+
+        probation_.push_front(std::make_pair(key, item));
+        map_[key] = Entry{probation_.begin(), false};
+    }
+
+    void
+    erase(const std::string& key) override {
+        auto it = map_.find(key);
+        if (it == map_.end()) {
+            return;
+        }
+
+        auto& entry = it->second;
+        if (entry.is_protected_) {
+            protected_size_ -= entry.iter_->second->Size();
+            protected_.erase(entry.iter_);
+        } else {
+            probation_.erase(entry.iter_);
+        }
+        map_.erase(it);
+    }
+
+    size_t
+    size() const override {
+        return map_.size();
+    }
+
+    void
+    clear() override {
+        probation_.clear();
+        protected_.clear();
+        map_.clear();
+        protected_size_ = 0;
+    }
+
+    void
+    victims(int64_t delta_size, std::vector<std::string>& keys) override {
+        int64_t released_size = 0;
+        pick(probation_, delta_size, released_size, keys);
+        pick(protected_, delta_size, released_size, keys);
+    }
+
+    void
+    keys(std::vector<std::string>& keys) override {
+        for (auto& item : protected_) {
+            keys.push_back(item.first);
+        }
+        for (auto& item : probation_) {
+            keys.push_back(item.first);
+        }
+    }
+
+ private:
+    using ItemList = std::list<std::pair<std::string, ItemObj>>;
+
+    struct Entry {
+        typename ItemList::iterator iter_;
+        bool is_protected_;
+    };
+
+    void
+    demote() {
+        while (protected_size_ > protected_capacity_ && !protected_.empty()) {
+            auto last = std::prev(protected_.end());
+            protected_size_ -= last->second->Size();
+            map_[last->first].is_protected_ = false;
+            probation_.splice(probation_.begin(), protected_, last);
+        }
+    }
+
+    static double
+    cost_density(const ItemObj& item) {
+        int64_t size = item->Size();
+        return size > 0 ? static_cast<double>(item->ReloadCost()) / size : 0.0;
+    }
+
+    void
+    pick(ItemList& list, int64_t delta_size, int64_t& released_size, std::vector<std::string>& keys) {
+        // window of least recent candidates, the cheapest to reload per byte is evicted first
+        std::vector<typename ItemList::reverse_iterator> window;
+        auto next = list.rbegin();
+        while (released_size < delta_size) {
+            while (window.size() < EVICT_WINDOW && next != list.rend()) {
+                window.push_back(next++);
+            }
+            if (window.empty()) {
+                break;
+            }
+
+            auto cheapest = std::min_element(window.begin(), window.end(), [](const auto& a, const auto& b) {
+                return cost_density(a->second) < cost_density(b->second);
+            });
+            keys.push_back((*cheapest)->first);
+            released_size += (*cheapest)->second->Size();
+            window.erase(cheapest);
+        }
+    }
+
+ private:
+    ItemList probation_;
+    ItemList protected_;
+    std::unordered_map<std::string, Entry> map_;
+    int64_t protected_size_ = 0;
+    int64_t protected_capacity_;
+};
+
+}  // namespace cache
+}  // namespace milvus
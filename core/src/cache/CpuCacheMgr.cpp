@@ -21,7 +21,19 @@ namespace cache {
 
 namespace {
 constexpr int64_t unit = 1024 * 1024 * 1024;
+
+// cached files are keyed by location, ".../tables/<table_id>/<date>/<file_id>"
+std::string
+TableOfKey(const std::string& key) {
+    static const std::string TABLES_FOLDER = "/tables/";
+    auto pos = key.find(TABLES_FOLDER);
+    if (pos == std::string::npos) {
+        return "";
+    }
+    pos += TABLES_FOLDER.size();
+    return key.substr(pos, key.find('/', pos) - pos);
 }
+}  // namespace
 
 CpuCacheMgr::CpuCacheMgr() {
     // All config values have been checked in Config::ValidateConfig()
@@ -30,7 +42,12 @@ CpuCacheMgr::CpuCacheMgr() {
     int64_t cpu_cache_cap;
     config.GetCacheConfigCpuCacheCapacity(cpu_cache_cap);
     int64_t cap = cpu_cache_cap * unit;
-    cache_ = std::make_shared<Cache<DataObjPtr>>(cap, 1UL << 32);
+
+    std::string cpu_cache_policy;
+    config.GetCacheConfigCpuCachePolicy(cpu_cache_policy);
+    cache_ = std::make_shared<Cache<DataObjPtr>>(cap, 1UL << 32, cpu_cache_policy);
+    cache_->set_evict_callback(
+        [](const std::string& key) { server::Metrics::GetInstance().CpuCacheEvictCounterIncrement(TableOfKey(key)); });
 
     float cpu_cache_threshold;
     config.GetCacheConfigCpuCacheThreshold(cpu_cache_threshold);
@@ -43,6 +60,17 @@ CpuCacheMgr::GetInstance() {
     return &s_mgr;
 }
 
+DataObjPtr
+CpuCacheMgr::GetItem(const std::string& key) {
+    DataObjPtr obj = CacheMgr<DataObjPtr>::GetItem(key);
+    if (obj != nullptr) {
+        server::Metrics::GetInstance().CpuCacheHitCounterIncrement(TableOfKey(key));
+    } else {
+        server::Metrics::GetInstance().CpuCacheMissCounterIncrement(TableOfKey(key));
+    }
+    return obj;
+}
+
 DataObjPtr
 CpuCacheMgr::GetIndex(const std::string& key) {
     DataObjPtr obj = GetItem(key);
@@ -29,6 +29,10 @@ class CpuCacheMgr : public CacheMgr<DataObjPtr> {
     static CpuCacheMgr*
     GetInstance();
 
+    // also counts hits and misses per table
+    DataObjPtr
+    GetItem(const std::string& key) override;
+
     DataObjPtr
     GetIndex(const std::string& key);
 };
@@ -20,6 +20,12 @@ class DataObj {
  public:
     virtual int64_t
     Size() = 0;
+
+    // estimated cost of loading the object again once evicted, in bytes read from local disk
+    virtual int64_t
+    ReloadCost() {
+        return Size();
+    }
 };
 
 using DataObjPtr = std::shared_ptr<DataObj>;
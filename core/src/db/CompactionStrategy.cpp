@@ -0,0 +1,148 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "db/CompactionStrategy.h"
+#include "utils/Log.h"
+
+#include <algorithm>
+
+namespace milvus {
+namespace engine {
+
+SimpleCompactionStrategy::SimpleCompactionStrategy(uint16_t merge_trigger_number)
+    : merge_trigger_number_(merge_trigger_number) {
+}
+
+void
+SimpleCompactionStrategy::GroupRawFiles(const meta::TableFilesSchema& files,
+                                        std::vector<meta::TableFilesSchema>& groups) {
+    if (files.size() < merge_trigger_number_) {
+        ENGINE_LOG_TRACE << "Files number not greater equal than merge trigger number, skip merge action";
+        return;
+    }
+    groups.push_back(files);
+}
+
+bool
+SimpleCompactionStrategy::RebuildIndexFiles(const meta::TableFilesSchema& index_files,
+                                            const meta::TableFilesSchema& backup_files, int64_t index_file_size) {
+    return false;
+}
+
+SizeTieredCompactionStrategy::SizeTieredCompactionStrategy(int64_t fan_in, double write_amp)
+    : fan_in_(std::max<int64_t>(fan_in, 2)), write_amp_(write_amp) {
+}
+
+bool
+SizeTieredCompactionStrategy::WriteAmpAllowed(const meta::TableFilesSchema& group) const {
+    int64_t total = 0, largest = 0;
+    for (auto& file : group) {
+        total += file.file_size_;
+        largest = std::max<int64_t>(largest, file.file_size_);
+    }
+    if (total <= largest) {
+        return false;
+    }
+    return static_cast<double>(total) / (total - largest) <= write_amp_;
+}
+
+void
+SizeTieredCompactionStrategy::GroupRawFiles(const meta::TableFilesSchema& files,
+                                            std::vector<meta::TableFilesSchema>& groups) {
+    if (files.size() < 2) {
+        return;
+    }
+
+    meta::TableFilesSchema sorted = files;
+    std::sort(sorted.begin(), sorted.end(), [](const meta::TableFileSchema& a, const meta::TableFileSchema& b) {
+        return a.file_size_ < b.file_size_;
+    });
+
+    // a tier holds files within a factor of fan_in of its smallest file
+    std::vector<meta::TableFilesSchema> tiers;
+    for (auto& file : sorted) {
+        if (tiers.empty() ||
+            file.file_size_ > std::max<int64_t>(tiers.back().front().file_size_, 1) * fan_in_) {
+            tiers.emplace_back();
+        }
+        tiers.back().push_back(file);
+    }
+
+    // fan_in files of a tier make one merge, fewer are enough when they fill a whole file
+    for (auto& tier : tiers) {
+        meta::TableFilesSchema group;
+        int64_t group_size = 0;
+        for (auto& file : tier) {
+            group.push_back(file);
+            group_size += file.file_size_;
+            int64_t group_count = group.size();
+            if (group_count >= fan_in_ || (group_count > 1 && group_size >= file.index_file_size_)) {
+                if (WriteAmpAllowed(group)) {
+                    groups.push_back(group);
+                }
+                group.clear();
+                group_size = 0;
+            }
+        }
+    }
+}
+
+bool
+SizeTieredCompactionStrategy::RebuildIndexFiles(const meta::TableFilesSchema& index_files,
+                                                const meta::TableFilesSchema& backup_files, int64_t index_file_size) {
+    if (static_cast<int64_t>(index_files.size()) < fan_in_) {
+        return false;
+    }
+
+    // every index file has exactly one raw backup, the rows have to add up before the index files can go
+    int64_t index_rows = 0, backup_rows = 0, backup_bytes = 0;
+    for (auto& file : index_files) {
+        index_rows += file.row_count_;
+    }
+    for (auto& file : backup_files) {
+        backup_rows += file.row_count_;
+        backup_bytes += file.file_size_;
+    }
+    if (backup_rows == 0 || index_rows != backup_rows) {
+        return false;
+    }
+
+    // a rebuild that can't fill one whole file leaves the data unindexed
+    if (backup_bytes < index_file_size) {
+        return false;
+    }
+
+    // raw size of an index file estimated from its rows, undersized ones are less than half full
+    double row_bytes = static_cast<double>(backup_bytes) / backup_rows;
+    int64_t small_count = 0;
+    double small_bytes = 0.0;
+    for (auto& file : index_files) {
+        double raw_bytes = file.row_count_ * row_bytes;
+        if (raw_bytes * 2 < index_file_size) {
+            ++small_count;
+            small_bytes += raw_bytes;
+        }
+    }
+
+    return small_count >= fan_in_ && backup_bytes <= small_bytes * write_amp_;
+}
+
+CompactionStrategyPtr
+CompactionStrategyFactory::Build(const DBOptions& options) {
+    if (options.compaction_policy_ == "size_tiered") {
+        return std::make_shared<SizeTieredCompactionStrategy>(options.compaction_fan_in_,
+                                                              options.compaction_write_amp_);
+    }
+    return std::make_shared<SimpleCompactionStrategy>(options.merge_trigger_number_);
+}
+
+}  // namespace engine
+}  // namespace milvus
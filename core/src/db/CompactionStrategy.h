@@ -0,0 +1,92 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include "db/Options.h"
+#include "db/meta/MetaTypes.h"
+
+#include <memory>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+
+/*
+ * Decides which files of a table are compacted, DBImpl asks it once per date partition and carries it out.
+ */
+class CompactionStrategy {
+ public:
+    virtual ~CompactionStrategy() = default;
+
+    // split the small raw files of a date into groups, each group is merged into one new file
+    virtual void
+    GroupRawFiles(const meta::TableFilesSchema& files, std::vector<meta::TableFilesSchema>& groups) = 0;
+
+    // whether the index files of a date are dropped and their raw backups merged and indexed again
+    virtual bool
+    RebuildIndexFiles(const meta::TableFilesSchema& index_files, const meta::TableFilesSchema& backup_files,
+                      int64_t index_file_size) = 0;
+};
+
+using CompactionStrategyPtr = std::shared_ptr<CompactionStrategy>;
+
+/*
+ * Merges all small raw files of a date once there are merge_trigger_number of them, never touches index files.
+ */
+class SimpleCompactionStrategy : public CompactionStrategy {
+ public:
+    explicit SimpleCompactionStrategy(uint16_t merge_trigger_number);
+
+    void
+    GroupRawFiles(const meta::TableFilesSchema& files, std::vector<meta::TableFilesSchema>& groups) override;
+
+    bool
+    RebuildIndexFiles(const meta::TableFilesSchema& index_files, const meta::TableFilesSchema& backup_files,
+                      int64_t index_file_size) override;
+
+ private:
+    uint16_t merge_trigger_number_;
+};
+
+/*
+ * Merges raw files of similar size, fan_in at a time, so each row is rewritten about log(fan_in) times on its
+ * way to a full size file. A merge writing more than write_amp bytes per byte of the files other than the
+ * largest one is skipped. A date whose index files are mostly undersized is rebuilt from its raw backups.
+ */
+class SizeTieredCompactionStrategy : public CompactionStrategy {
+ public:
+    SizeTieredCompactionStrategy(int64_t fan_in, double write_amp);
+
+    void
+    GroupRawFiles(const meta::TableFilesSchema& files, std::vector<meta::TableFilesSchema>& groups) override;
+
+    bool
+    RebuildIndexFiles(const meta::TableFilesSchema& index_files, const meta::TableFilesSchema& backup_files,
+                      int64_t index_file_size) override;
+
+ private:
+    bool
+    WriteAmpAllowed(const meta::TableFilesSchema& group) const;
+
+ private:
+    int64_t fan_in_;
+    double write_amp_;
+};
+
+class CompactionStrategyFactory {
+ public:
+    static CompactionStrategyPtr
+    Build(const DBOptions& options);
+};
+
+}  // namespace engine
+}  // namespace milvus
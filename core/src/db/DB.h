@@ -61,6 +61,17 @@ class DB {
     virtual Status
     PreloadTable(const std::string& table_id) = 0;
 
+    // reload the index files recorded in the hot set manifest, if warm start is enabled
+    virtual Status
+    WarmStart() = 0;
+
+    // make a running or later warm start return once the files being loaded are done
+    virtual void
+    StopWarmStart() = 0;
+
+    virtual Status
+    GetPreloadProgress(std::vector<PreloadProgress>& progress) = 0;
+
     virtual Status
     UpdateTableFlag(const std::string& table_id, int64_t flag) = 0;
 
@@ -80,20 +91,34 @@ class DB {
     virtual Status
     InsertVectors(const std::string& table_id, const std::string& partition_tag, VectorsData& vectors) = 0;
 
+    // deleted_count is the number of vectors newly deleted, also of those deleted before a failure stopped it
+    virtual Status
+    DeleteVectors(const std::string& table_id, const IDNumbers& ids, int64_t& deleted_count) = 0;
+
+    // refine_factor: candidates per result re-ranked by *_REFINE index files, 0 for the default, 1 turns it off
     virtual Status
     Query(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-          const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-          ResultIds& result_ids, ResultDistances& result_distances) = 0;
+          const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+          const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) = 0;
 
     virtual Status
     Query(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-          const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-          const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) = 0;
+          const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+          const VectorsData& vectors, const meta::DatesT& dates, ResultIds& result_ids,
+          ResultDistances& result_distances) = 0;
 
     virtual Status
     QueryByFileID(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-                  const std::vector<std::string>& file_ids, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-                  const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) = 0;
+                  const std::vector<std::string>& file_ids, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+                  const VectorsData& vectors, const meta::DatesT& dates, ResultIds& result_ids,
+                  ResultDistances& result_distances) = 0;
+
+    // all vectors within radius of each query, the results of query i are in [result_lims[i], result_lims[i + 1])
+    virtual Status
+    RangeQuery(const std::shared_ptr<server::Context>& context, const std::string& table_id,
+               const std::vector<std::string>& partition_tags, float radius, uint64_t nprobe,
+               const VectorsData& vectors, std::vector<int64_t>& result_lims, ResultIds& result_ids,
+               ResultDistances& result_distances) = 0;
 
     virtual Status
     Size(uint64_t& result) = 0;
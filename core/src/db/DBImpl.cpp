@@ -17,8 +17,12 @@
 #include <boost/filesystem.hpp>
 #include <chrono>
 #include <cstring>
+#include <deque>
+#include <fstream>
+#include <future>
 #include <iostream>
 #include <set>
+#include <shared_mutex>
 #include <thread>
 #include <utility>
 
@@ -26,6 +30,7 @@
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
 #include "engine/EngineFactory.h"
+#include "engine/ExecutionEngineImpl.h"
 #include "insert/MemMenagerFactory.h"
 #include "meta/MetaConsts.h"
 #include "meta/MetaFactory.h"
@@ -38,6 +43,7 @@
 #include "utils/Log.h"
 #include "utils/StringHelpFunctions.h"
 #include "utils/TimeRecorder.h"
+#include "wrapper/VecIndex.h"
 
 namespace milvus {
 namespace engine {
@@ -47,6 +53,10 @@ namespace {
 constexpr uint64_t METRIC_ACTION_INTERVAL = 1;
 constexpr uint64_t COMPACT_ACTION_INTERVAL = 1;
 constexpr uint64_t INDEX_ACTION_INTERVAL = 1;
+constexpr uint64_t HOT_SET_ACTION_INTERVAL = 60;
+
+static const char* HOT_SET_MANIFEST = "/hot_set.manifest";
+static const char* WARM_START_NAME = "warm_start";
 
 static const Status SHUTDOWN_ERROR = Status(DB_ERROR, "Milvus server is shutdown!");
 
@@ -59,12 +69,69 @@ TraverseFiles(const meta::DatePartionedTableFilesSchema& date_files, meta::Table
     }
 }
 
+ExecutionEnginePtr
+BuildFileEngine(const meta::TableFileSchema& file) {
+    return EngineFactory::Build(file.dimension_, file.location_, (EngineType)file.engine_type_,
+                                (MetricType)file.metric_type_, file.nlist_, file.table_created_on_);
+}
+
+// ids deleted from the files, their location_ must be set
+Status
+CollectDeletedIds(const meta::TableFilesSchema& files, std::vector<int64_t>& deleted_ids) {
+    deleted_ids.clear();
+    for (auto& file : files) {
+        ExecutionEnginePtr engine = BuildFileEngine(file);
+        if (engine == nullptr) {
+            return Status(DB_ERROR, "Failed to build engine for file " + file.file_id_);
+        }
+
+        std::vector<int64_t> file_deleted_ids;
+        auto status = engine->GetDeletedIds(file_deleted_ids);
+        if (!status.ok()) {
+            return status;
+        }
+        deleted_ids.insert(deleted_ids.end(), file_deleted_ids.begin(), file_deleted_ids.end());
+    }
+    return Status::OK();
+}
+
+// raw backups aren't marked by deletions, they take over the ones of the index files before replacing them.
+// ids are unique in a table, the deletions of all the index files go to every backup
+Status
+HandOverDeletions(const meta::TableFilesSchema& index_files, const meta::TableFilesSchema& backup_files) {
+    std::vector<int64_t> deleted_ids;
+    auto status = CollectDeletedIds(index_files, deleted_ids);
+    if (!status.ok() || deleted_ids.empty()) {
+        return status;
+    }
+
+    for (auto& file : backup_files) {
+        ExecutionEnginePtr engine = BuildFileEngine(file);
+        if (engine == nullptr) {
+            return Status(DB_ERROR, "Failed to build engine for file " + file.file_id_);
+        }
+        int64_t deleted_count = 0;
+        status = engine->DeleteIds(deleted_ids, deleted_count);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    return Status::OK();
+}
+
 }  // namespace
 
 DBImpl::DBImpl(const DBOptions& options)
-    : options_(options), initialized_(false), compact_thread_pool_(1, 1), index_thread_pool_(1, 1) {
+    : options_(options),
+      initialized_(false),
+      compact_thread_pool_(1, 1),
+      ongoing_search_count_(0),
+      index_thread_pool_(1, 1),
+      search_batch_count_(0),
+      warm_start_stopped_(false) {
     meta_ptr_ = MetaFactory::Build(options.meta_, options.mode_);
     mem_mgr_ = MemManagerFactory::Build(meta_ptr_, options_);
+    compaction_strategy_ = CompactionStrategyFactory::Build(options_);
     Start();
 }
 
@@ -107,6 +174,10 @@ DBImpl::Stop() {
     // wait compaction/buildindex finish
     bg_timer_thread_.join();
 
+    if (options_.warm_start_enable_) {
+        SaveHotSetManifest();
+    }
+
     if (options_.mode_ != DBOptions::MODE::CLUSTER_READONLY) {
         meta_ptr_->CleanUpShadowFiles();
     }
@@ -202,18 +273,99 @@ DBImpl::PreloadTable(const std::string& table_id) {
         status = GetFilesToSearch(schema.table_id_, ids, dates, files_array);
     }
 
+    return PreloadFiles(table_id, files_array);
+}
+
+Status
+DBImpl::WarmStart() {
+    if (!initialized_.load(std::memory_order_acquire)) {
+        return SHUTDOWN_ERROR;
+    }
+
+    if (!options_.warm_start_enable_) {
+        return Status::OK();
+    }
+
+    // step 1: read the hot set, hottest file first
+    std::ifstream manifest(options_.meta_.path_ + HOT_SET_MANIFEST);
+    if (!manifest.is_open()) {
+        ENGINE_LOG_DEBUG << "No hot set manifest, skip warm start";
+        return Status::OK();
+    }
+
+    std::unordered_map<std::string, size_t> hot_rank;
+    std::string location;
+    while (std::getline(manifest, location)) {
+        if (!location.empty()) {
+            hot_rank.emplace(location, hot_rank.size());
+        }
+    }
+    if (hot_rank.empty()) {
+        return Status::OK();
+    }
+
+    // step 2: pick the searchable files of all tables and partitions still in the hot set
+    std::vector<meta::TableSchema> all_tables;
+    auto status = meta_ptr_->AllTables(all_tables);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::vector<size_t> ids;
+    meta::DatesT dates;
+    meta::TableFilesSchema hot_files;
+    for (auto& schema : all_tables) {
+        meta::TableFilesSchema files_array;
+        status = GetFilesToSearch(schema.table_id_, ids, dates, files_array);
+        if (!status.ok()) {
+            continue;
+        }
+        for (auto& file : files_array) {
+            if (hot_rank.find(file.location_) != hot_rank.end()) {
+                hot_files.push_back(file);
+            }
+        }
+    }
+    std::sort(hot_files.begin(), hot_files.end(),
+              [&](const meta::TableFileSchema& a, const meta::TableFileSchema& b) {
+                  return hot_rank[a.location_] < hot_rank[b.location_];
+              });
+
+    ENGINE_LOG_DEBUG << "Warm start with " << hot_files.size() << " of " << hot_rank.size() << " hot set files";
+    return PreloadFiles(WARM_START_NAME, hot_files, &warm_start_stopped_);
+}
+
+void
+DBImpl::StopWarmStart() {
+    warm_start_stopped_.store(true, std::memory_order_release);
+}
+
+Status
+DBImpl::GetPreloadProgress(std::vector<PreloadProgress>& progress) {
+    progress.clear();
+    std::lock_guard<std::mutex> lock(preload_mutex_);
+    for (auto& pair : preload_progress_) {
+        progress.push_back(pair.second);
+    }
+    return Status::OK();
+}
+
+Status
+DBImpl::PreloadFiles(const std::string& name, const meta::TableFilesSchema& files, const std::atomic<bool>* stop) {
+    auto stopped = [stop]() { return stop != nullptr && stop->load(std::memory_order_acquire); };
+
     int64_t size = 0;
     int64_t cache_total = cache::CpuCacheMgr::GetInstance()->CacheCapacity();
     int64_t cache_usage = cache::CpuCacheMgr::GetInstance()->CacheUsage();
     int64_t available_size = cache_total - cache_usage;
 
-    // step 3: load file one by one
-    ENGINE_LOG_DEBUG << "Begin pre-load table:" + table_id + ", totally " << files_array.size()
-                     << " files need to be pre-loaded";
-    TimeRecorderAuto rc("Pre-load table:" + table_id);
-    for (auto& file : files_array) {
-        ExecutionEnginePtr engine = EngineFactory::Build(file.dimension_, file.location_, (EngineType)file.engine_type_,
-                                                         (MetricType)file.metric_type_, file.nlist_);
+    // step 1: pick the files the cache can hold
+    bool cache_full = false;
+    std::vector<ExecutionEnginePtr> engines;
+    for (auto& file : files) {
+        ExecutionEnginePtr engine =
+            EngineFactory::Build(file.dimension_, file.location_, (EngineType)file.engine_type_,
+                                 (MetricType)file.metric_type_, file.nlist_, file.table_created_on_);
         fiu_do_on("DBImpl.PreloadTable.null_engine", engine = nullptr);
         if (engine == nullptr) {
             ENGINE_LOG_ERROR << "Invalid engine type";
@@ -224,21 +376,124 @@ DBImpl::PreloadTable(const std::string& table_id) {
         fiu_do_on("DBImpl.PreloadTable.exceed_cache", size = available_size + 1);
         if (size > available_size) {
             ENGINE_LOG_DEBUG << "Pre-load canceled since cache almost full";
-            return Status(SERVER_CACHE_FULL, "Cache is full");
+            size -= engine->PhysicalSize();
+            cache_full = true;
+            break;
+        }
+        engines.push_back(engine);
+    }
+
+    PreloadProgress progress;
+    progress.name_ = name;
+    progress.total_files_ = engines.size();
+    progress.total_bytes_ = size;
+    {
+        std::lock_guard<std::mutex> lock(preload_mutex_);
+        preload_progress_[name] = progress;
+    }
+
+    // step 2: read files on a pool of io threads, deserialize the files already read on another pool
+    ENGINE_LOG_DEBUG << "Begin pre-load " + name + ", totally " << engines.size() << " files need to be pre-loaded";
+    TimeRecorderAuto rc("Pre-load " + name);
+    auto start = std::chrono::steady_clock::now();
+    auto update_progress = [&](int64_t loaded_bytes, bool failed) {
+        std::lock_guard<std::mutex> lock(preload_mutex_);
+        auto& progress = preload_progress_[name];
+        if (failed) {
+            progress.failed_files_++;
         } else {
-            try {
-                fiu_do_on("DBImpl.PreloadTable.engine_throw_exception", throw std::exception());
-                std::string msg = "Pre-loaded file: " + file.file_id_ + " size: " + std::to_string(file.file_size_);
-                TimeRecorderAuto rc_1(msg);
-                engine->Load(true);
-            } catch (std::exception& ex) {
-                std::string msg = "Pre-load table encounter exception: " + std::string(ex.what());
-                ENGINE_LOG_ERROR << msg;
-                return Status(DB_ERROR, msg);
+            progress.loaded_files_++;
+            progress.loaded_bytes_ += loaded_bytes;
+        }
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        progress.elapsed_ms_ = elapsed.count();
+    };
+    auto load_file = [&](const ExecutionEnginePtr& engine) -> Status {
+        try {
+            fiu_do_on("DBImpl.PreloadTable.engine_throw_exception", throw std::exception());
+            TimeRecorderAuto rc_1("Pre-loaded file: " + engine->GetLocation());
+            auto status = engine->Load(true);
+            update_progress(engine->PhysicalSize(), !status.ok());
+            if (!status.ok()) {
+                ENGINE_LOG_ERROR << "Failed to pre-load file " << engine->GetLocation() << ": " << status.message();
+                return status;
+            }
+        } catch (std::exception& ex) {
+            std::string msg = "Pre-load table encounter exception: " + std::string(ex.what());
+            ENGINE_LOG_ERROR << msg;
+            update_progress(0, true);
+            return Status(DB_ERROR, msg);
+        }
+        return Status::OK();
+    };
+
+    Status status;
+    {
+        size_t thread_num = std::min<int64_t>(std::max<int64_t>(options_.preload_thread_num_, 1), MAX_THREADS_NUM);
+        // files read but not deserialized yet are held in memory, bound their number
+        size_t max_pending = thread_num * 2;
+        ThreadPool read_pool(thread_num, max_pending);
+        ThreadPool load_pool(thread_num, max_pending);
+        std::deque<std::pair<ExecutionEnginePtr, std::future<Status>>> reading;
+        std::deque<std::future<Status>> loading;
+
+        size_t next = 0;
+        while (status.ok() && (next < engines.size() || !reading.empty())) {
+            if (stopped()) {
+                ENGINE_LOG_DEBUG << "Pre-load " << name << " stopped after " << next << " of " << engines.size()
+                                 << " files";
+                status = Status(DB_ERROR, "Pre-load " + name + " stopped");
+                break;
+            }
+            while (next < engines.size() && reading.size() + loading.size() < max_pending) {
+                auto& engine = engines[next++];
+                reading.emplace_back(engine, read_pool.enqueue([engine]() { return engine->Prefetch(); }));
+            }
+
+            if (!reading.empty()) {
+                auto engine = reading.front().first;
+                auto read_status = reading.front().second.get();
+                reading.pop_front();
+                if (read_status.ok()) {
+                    loading.push_back(load_pool.enqueue(load_file, engine));
+                } else {
+                    update_progress(0, true);
+                }
+            }
+
+            while (!loading.empty() && (reading.size() + loading.size() >= max_pending ||
+                                        loading.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready)) {
+                status = loading.front().get();
+                loading.pop_front();
+                if (!status.ok()) {
+                    break;
+                }
+            }
+        }
+
+        // files already read or being read are dropped without being loaded
+        for (auto& iter : reading) {
+            iter.second.wait();
+        }
+        for (auto& iter : loading) {
+            auto load_status = iter.get();
+            if (status.ok()) {
+                status = load_status;
             }
         }
     }
 
+    {
+        std::lock_guard<std::mutex> lock(preload_mutex_);
+        preload_progress_[name].finished_ = true;
+    }
+
+    if (!status.ok()) {
+        return status;
+    }
+    if (cache_full) {
+        return Status(SERVER_CACHE_FULL, "Cache is full");
+    }
     return Status::OK();
 }
 
@@ -339,6 +594,71 @@ DBImpl::InsertVectors(const std::string& table_id, const std::string& partition_
     return status;
 }
 
+Status
+DBImpl::DeleteVectors(const std::string& table_id, const IDNumbers& ids, int64_t& deleted_count) {
+    if (!initialized_.load(std::memory_order_acquire)) {
+        return SHUTDOWN_ERROR;
+    }
+
+    deleted_count = 0;
+
+    // vectors still in the insert buffer are flushed first, deletion only marks files on disk
+    std::set<std::string> sync_table_ids;
+    auto status = SyncMemData(sync_table_ids);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::vector<meta::TableSchema> tables;
+    meta::TableSchema table_schema;
+    table_schema.table_id_ = table_id;
+    status = meta_ptr_->DescribeTable(table_schema);
+    if (!status.ok()) {
+        return status;
+    }
+    tables.push_back(table_schema);
+
+    std::vector<meta::TableSchema> partition_array;
+    status = meta_ptr_->ShowPartitions(table_id, partition_array);
+    if (!status.ok()) {
+        return status;
+    }
+    tables.insert(tables.end(), partition_array.begin(), partition_array.end());
+
+    // raw backups of index files aren't searched, they take over the deletions of their index when it is dropped
+    std::unique_lock<std::shared_timed_mutex> lock(deletion_mutex_);
+    std::vector<int> file_types = {(int)meta::TableFileSchema::RAW, (int)meta::TableFileSchema::TO_INDEX,
+                                   (int)meta::TableFileSchema::INDEX};
+    for (auto& schema : tables) {
+        meta::TableFilesSchema files;
+        status = meta_ptr_->FilesByType(schema.table_id_, file_types, files);
+        if (!status.ok()) {
+            return status;
+        }
+
+        for (auto& file : files) {
+            file.dimension_ = schema.dimension_;
+            file.metric_type_ = schema.metric_type_;
+            file.nlist_ = schema.nlist_;
+            file.table_created_on_ = schema.created_on_;
+            utils::GetTableFilePath(options_.meta_, file);
+
+            ExecutionEnginePtr engine = BuildFileEngine(file);
+            int64_t file_deleted = 0;
+            status = (engine == nullptr) ? Status(DB_ERROR, "Failed to build engine for file " + file.file_id_)
+                                         : engine->DeleteIds(ids, file_deleted);
+            if (!status.ok()) {
+                // the files marked so far stay marked, deleting the same ids again marks the rest
+                return Status(status.code(), status.message() + ", " + std::to_string(deleted_count) +
+                                                 " vectors were deleted before the failure");
+            }
+            deleted_count += file_deleted;
+        }
+    }
+
+    return Status::OK();
+}
+
 Status
 DBImpl::CreateIndex(const std::string& table_id, const TableIndex& index) {
     if (!initialized_.load(std::memory_order_acquire)) {
@@ -403,58 +723,56 @@ DBImpl::DropIndex(const std::string& table_id) {
 
 Status
 DBImpl::Query(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-              const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-              ResultIds& result_ids, ResultDistances& result_distances) {
+              const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+              const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) {
     if (!initialized_.load(std::memory_order_acquire)) {
         return SHUTDOWN_ERROR;
     }
 
     meta::DatesT dates = {utils::GetDate()};
-    Status result = Query(context, table_id, partition_tags, k, nprobe, vectors, dates, result_ids, result_distances);
+    Status result = Query(context, table_id, partition_tags, k, nprobe, refine_factor, vectors, dates, result_ids,
+                          result_distances);
     return result;
 }
 
 Status
 DBImpl::Query(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-              const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-              const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) {
-    auto query_ctx = context->Child("Query");
-
+              const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+              const VectorsData& vectors, const meta::DatesT& dates, ResultIds& result_ids,
+              ResultDistances& result_distances) {
     if (!initialized_.load(std::memory_order_acquire)) {
         return SHUTDOWN_ERROR;
     }
 
-    ENGINE_LOG_DEBUG << "Query by dates for table: " << table_id << " date range count: " << dates.size();
+    if (options_.search_batch_wait_ms_ > 0 && vectors.vector_count_ > 0 &&
+        vectors.vector_count_ < static_cast<uint64_t>(options_.search_batch_max_nq_)) {
+        return QueryBatched(context, table_id, partition_tags, k, nprobe, refine_factor, vectors, dates, result_ids,
+                            result_distances);
+    }
 
-    Status status;
-    std::vector<size_t> ids;
-    meta::TableFilesSchema files_array;
+    return QueryTable(context, table_id, partition_tags, k, nprobe, refine_factor, vectors, dates, result_ids,
+                      result_distances);
+}
 
-    if (partition_tags.empty()) {
-        // no partition tag specified, means search in whole table
-        // get all table files from parent table
-        status = GetFilesToSearch(table_id, ids, dates, files_array);
-        if (!status.ok()) {
-            return status;
-        }
+Status
+DBImpl::QueryTable(const std::shared_ptr<server::Context>& context, const std::string& table_id,
+                   const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe,
+                   uint64_t refine_factor, const VectorsData& vectors, const meta::DatesT& dates,
+                   ResultIds& result_ids, ResultDistances& result_distances) {
+    auto query_ctx = context->Child("Query");
 
-        std::vector<meta::TableSchema> partition_array;
-        status = meta_ptr_->ShowPartitions(table_id, partition_array);
-        for (auto& schema : partition_array) {
-            status = GetFilesToSearch(schema.table_id_, ids, dates, files_array);
-        }
-    } else {
-        // get files from specified partitions
-        std::set<std::string> partition_name_array;
-        GetPartitionsByTags(table_id, partition_tags, partition_name_array);
+    ENGINE_LOG_DEBUG << "Query by dates for table: " << table_id << " date range count: " << dates.size();
 
-        for (auto& partition_name : partition_name_array) {
-            status = GetFilesToSearch(partition_name, ids, dates, files_array);
-        }
+    meta::TableFilesSchema files_array;
+    std::vector<MemTableFilePtr> mem_files;
+    auto status = GetTableFilesToSearch(table_id, partition_tags, dates, files_array, mem_files);
+    if (!status.ok()) {
+        return status;
     }
 
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(query_ctx, table_id, files_array, k, nprobe, vectors, result_ids, result_distances);
+    status = QueryAsync(query_ctx, table_id, files_array, mem_files, k, nprobe, refine_factor, vectors, result_ids,
+                        result_distances);
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
 
     query_ctx->GetTraceContext()->GetSpan()->Finish();
@@ -464,8 +782,9 @@ DBImpl::Query(const std::shared_ptr<server::Context>& context, const std::string
 
 Status
 DBImpl::QueryByFileID(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-                      const std::vector<std::string>& file_ids, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-                      const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) {
+                      const std::vector<std::string>& file_ids, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+                      const VectorsData& vectors, const meta::DatesT& dates, ResultIds& result_ids,
+                      ResultDistances& result_distances) {
     auto query_ctx = context->Child("Query by file id");
 
     if (!initialized_.load(std::memory_order_acquire)) {
@@ -495,7 +814,8 @@ DBImpl::QueryByFileID(const std::shared_ptr<server::Context>& context, const std
     }
 
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info before query
-    status = QueryAsync(query_ctx, table_id, files_array, k, nprobe, vectors, result_ids, result_distances);
+    status = QueryAsync(query_ctx, table_id, files_array, {}, k, nprobe, refine_factor, vectors, result_ids,
+                        result_distances);
     cache::CpuCacheMgr::GetInstance()->PrintInfo();  // print cache info after query
 
     query_ctx->GetTraceContext()->GetSpan()->Finish();
@@ -512,13 +832,175 @@ DBImpl::Size(uint64_t& result) {
     return meta_ptr_->Size(result);
 }
 
+uint64_t
+DBImpl::SearchBatchCount() const {
+    return search_batch_count_.load();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // internal methods
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+Status
+DBImpl::GetTableFilesToSearch(const std::string& table_id, const std::vector<std::string>& partition_tags,
+                              const meta::DatesT& dates, meta::TableFilesSchema& files_array,
+                              std::vector<MemTableFilePtr>& mem_files) {
+    Status status;
+    std::vector<size_t> ids;
+
+    // the insert buffer must be collected before meta files, a buffer file is removed from memory only after
+    // it is visible in meta, so every vector is searched at least once, duplicated files are skipped by SearchJob
+    if (partition_tags.empty()) {
+        // no partition tag specified, means search in whole table
+        // get all table files from parent table
+        GetMemFilesToSearch(table_id, dates, mem_files);
+        status = GetFilesToSearch(table_id, ids, dates, files_array);
+        if (!status.ok()) {
+            return status;
+        }
+
+        std::vector<meta::TableSchema> partition_array;
+        status = meta_ptr_->ShowPartitions(table_id, partition_array);
+        for (auto& schema : partition_array) {
+            GetMemFilesToSearch(schema.table_id_, dates, mem_files);
+            status = GetFilesToSearch(schema.table_id_, ids, dates, files_array);
+        }
+    } else {
+        // get files from specified partitions
+        std::set<std::string> partition_name_array;
+        GetPartitionsByTags(table_id, partition_tags, partition_name_array);
+
+        for (auto& partition_name : partition_name_array) {
+            GetMemFilesToSearch(partition_name, dates, mem_files);
+            status = GetFilesToSearch(partition_name, ids, dates, files_array);
+        }
+    }
+
+    return Status::OK();
+}
+
+Status
+DBImpl::QueryBatched(const std::shared_ptr<server::Context>& context, const std::string& table_id,
+                     const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe,
+                     uint64_t refine_factor, const VectorsData& vectors, const meta::DatesT& dates,
+                     ResultIds& result_ids, ResultDistances& result_distances) {
+    // only searches which can share one job are merged: same target, same parameters, same vector type and size
+    bool is_binary = vectors.float_data_.empty();
+    uint64_t vector_size = is_binary ? vectors.binary_data_.size() : vectors.float_data_.size();
+    vector_size /= vectors.vector_count_;
+
+    std::string key = table_id + "|" + std::to_string(k) + "|" + std::to_string(nprobe) + "|" +
+                      std::to_string(refine_factor) + "|" + (is_binary ? "b" : "f") + std::to_string(vector_size) +
+                      "|";
+    std::vector<std::string> tags = partition_tags;
+    std::sort(tags.begin(), tags.end());
+    for (auto& tag : tags) {
+        key += tag + ",";
+    }
+    key += "|";
+    for (auto& date : dates) {
+        key += std::to_string(date) + ",";
+    }
+
+    uint64_t max_nq = options_.search_batch_max_nq_;
+    SearchBatchPtr batch;
+    uint64_t offset = 0;
+    bool is_leader = false;
+    {
+        std::unique_lock<std::mutex> lock(search_batch_mutex_);
+        auto iter = search_batches_.find(key);
+        if (iter != search_batches_.end() && iter->second->nq_ + vectors.vector_count_ > max_nq) {
+            // no room left, let the leader send it now
+            iter->second->closed_ = true;
+            iter->second->cv_.notify_all();
+            search_batches_.erase(iter);
+            iter = search_batches_.end();
+        }
+
+        if (iter == search_batches_.end()) {
+            batch = std::make_shared<SearchBatch>();
+            search_batches_[key] = batch;
+            is_leader = true;
+        } else {
+            batch = iter->second;
+        }
+
+        offset = batch->nq_;
+        batch->nq_ += vectors.vector_count_;
+        batch->vectors_.push_back(&vectors);
+
+        if (is_leader) {
+            batch->cv_.wait_for(lock, std::chrono::milliseconds(options_.search_batch_wait_ms_),
+                                [&] { return batch->closed_; });
+            if (!batch->closed_) {
+                batch->closed_ = true;
+                search_batches_.erase(key);
+            }
+        } else {
+            if (batch->nq_ >= max_nq) {
+                batch->closed_ = true;
+                batch->cv_.notify_all();
+                search_batches_.erase(key);
+            }
+            batch->cv_.wait(lock, [&] { return batch->done_; });
+        }
+    }
+
+    if (is_leader) {
+        ++search_batch_count_;
+
+        // the batch is closed, no one else touches vectors_ now
+        Status status;
+        ResultIds ids;
+        ResultDistances distances;
+        if (batch->vectors_.size() == 1) {
+            status = QueryTable(context, table_id, partition_tags, k, nprobe, refine_factor, vectors, dates, ids,
+                                distances);
+        } else {
+            VectorsData merged;
+            merged.vector_count_ = batch->nq_;
+            if (is_binary) {
+                merged.binary_data_.reserve(batch->nq_ * vector_size);
+            } else {
+                merged.float_data_.reserve(batch->nq_ * vector_size);
+            }
+            for (auto data : batch->vectors_) {
+                merged.float_data_.insert(merged.float_data_.end(), data->float_data_.begin(),
+                                          data->float_data_.end());
+                merged.binary_data_.insert(merged.binary_data_.end(), data->binary_data_.begin(),
+                                           data->binary_data_.end());
+            }
+            ENGINE_LOG_DEBUG << "Merge " << batch->vectors_.size() << " searches into one, nq = " << batch->nq_;
+            status = QueryTable(context, table_id, partition_tags, k, nprobe, refine_factor, merged, dates, ids,
+                                distances);
+        }
+
+        std::lock_guard<std::mutex> lock(search_batch_mutex_);
+        batch->status_ = status;
+        batch->result_ids_.swap(ids);
+        batch->result_distances_.swap(distances);
+        batch->done_ = true;
+        batch->cv_.notify_all();
+    }
+
+    if (!batch->status_.ok()) {
+        return batch->status_;
+    }
+
+    // results are laid out as nq rows of the same width
+    uint64_t width = batch->result_ids_.size() / batch->nq_;
+    auto begin = offset * width;
+    auto end = begin + vectors.vector_count_ * width;
+    result_ids.assign(batch->result_ids_.begin() + begin, batch->result_ids_.begin() + end);
+    result_distances.assign(batch->result_distances_.begin() + begin, batch->result_distances_.begin() + end);
+
+    return Status::OK();
+}
+
 Status
 DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-                   const meta::TableFilesSchema& files, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-                   ResultIds& result_ids, ResultDistances& result_distances) {
+                   const meta::TableFilesSchema& files, const std::vector<MemTableFilePtr>& mem_files, uint64_t k,
+                   uint64_t nprobe, uint64_t refine_factor, const VectorsData& vectors, ResultIds& result_ids,
+                   ResultDistances& result_distances) {
     auto query_async_ctx = context->Child("Query Async");
 
     server::CollectQueryMetrics metrics(vectors.vector_count_);
@@ -526,22 +1008,13 @@ DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, const std::s
     TimeRecorder rc("");
 
     // step 1: construct search job
-    auto status = ongoing_files_checker_.MarkOngoingFiles(files);
-
-    ENGINE_LOG_DEBUG << "Engine query begin, index file count: " << files.size();
     scheduler::SearchJobPtr job = std::make_shared<scheduler::SearchJob>(query_async_ctx, k, nprobe, vectors);
-    for (auto& file : files) {
-        scheduler::TableFileSchemaPtr file_ptr = std::make_shared<meta::TableFileSchema>(file);
-        job->AddIndexFile(file_ptr);
-    }
+    job->SetRefineFactor(refine_factor);
 
     // step 2: put search job to scheduler and wait result
-    scheduler::JobMgrInst::GetInstance()->Put(job);
-    job->WaitResult();
-
-    status = ongoing_files_checker_.UnmarkOngoingFiles(files);
-    if (!job->GetStatus().ok()) {
-        return job->GetStatus();
+    auto status = ExecuteSearchJob(job, files, mem_files);
+    if (!status.ok()) {
+        return status;
     }
 
     // step 3: construct results
@@ -554,6 +1027,74 @@ DBImpl::QueryAsync(const std::shared_ptr<server::Context>& context, const std::s
     return Status::OK();
 }
 
+Status
+DBImpl::RangeQuery(const std::shared_ptr<server::Context>& context, const std::string& table_id,
+                   const std::vector<std::string>& partition_tags, float radius, uint64_t nprobe,
+                   const VectorsData& vectors, std::vector<int64_t>& result_lims, ResultIds& result_ids,
+                   ResultDistances& result_distances) {
+    if (!initialized_.load(std::memory_order_acquire)) {
+        return SHUTDOWN_ERROR;
+    }
+
+    auto query_ctx = context->Child("Range query");
+
+    server::CollectQueryMetrics metrics(vectors.vector_count_);
+
+    TimeRecorder rc("");
+
+    meta::DatesT dates = {utils::GetDate()};
+    meta::TableFilesSchema files_array;
+    std::vector<MemTableFilePtr> mem_files;
+    auto status = GetTableFilesToSearch(table_id, partition_tags, dates, files_array, mem_files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // range search jobs are never batched, the result sizes of the queries are unknown before search
+    scheduler::SearchJobPtr job = std::make_shared<scheduler::SearchJob>(query_ctx, 0, nprobe, vectors);
+    job->SetRangeSearch(radius, options_.max_range_results_);
+    status = ExecuteSearchJob(job, files_array, mem_files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    result_lims.swap(job->GetResultLims());
+    result_ids.swap(job->GetResultIds());
+    result_distances.swap(job->GetResultDistances());
+    if (result_lims.empty()) {
+        result_lims.assign(vectors.vector_count_ + 1, 0);
+    }
+    rc.ElapseFromBegin("Engine range query totally cost");
+
+    query_ctx->GetTraceContext()->GetSpan()->Finish();
+
+    return Status::OK();
+}
+
+Status
+DBImpl::ExecuteSearchJob(const scheduler::SearchJobPtr& job, const meta::TableFilesSchema& files,
+                         const std::vector<MemTableFilePtr>& mem_files) {
+    auto status = ongoing_files_checker_.MarkOngoingFiles(files);
+
+    ENGINE_LOG_DEBUG << "Engine query begin, index file count: " << files.size()
+                     << ", insert buffer file count: " << mem_files.size();
+    for (auto& file : files) {
+        scheduler::TableFileSchemaPtr file_ptr = std::make_shared<meta::TableFileSchema>(file);
+        job->AddIndexFile(file_ptr);
+    }
+    for (auto& mem_file : mem_files) {
+        job->AddMemFile(mem_file);
+    }
+
+    ++ongoing_search_count_;
+    scheduler::JobMgrInst::GetInstance()->Put(job);
+    job->WaitResult();
+    --ongoing_search_count_;
+
+    status = ongoing_files_checker_.UnmarkOngoingFiles(files);
+    return job->GetStatus();
+}
+
 void
 DBImpl::BackgroundTimerTask() {
     Status status;
@@ -572,6 +1113,7 @@ DBImpl::BackgroundTimerTask() {
         StartMetricTask();
         StartCompactionTask();
         StartBuildIndexTask();
+        StartHotSetTask();
     }
 }
 
@@ -643,6 +1185,44 @@ DBImpl::SyncMemData(std::set<std::string>& sync_table_ids) {
     return Status::OK();
 }
 
+void
+DBImpl::StartHotSetTask() {
+    static uint64_t hot_set_clock_tick = 0;
+    ++hot_set_clock_tick;
+    if (!options_.warm_start_enable_ || hot_set_clock_tick % HOT_SET_ACTION_INTERVAL != 0) {
+        return;
+    }
+
+    SaveHotSetManifest();
+}
+
+Status
+DBImpl::SaveHotSetManifest() {
+    // written aside and renamed, a crash never leaves a truncated manifest behind
+    std::string manifest_path = options_.meta_.path_ + HOT_SET_MANIFEST;
+    std::string temp_path = manifest_path + ".tmp";
+    {
+        std::ofstream manifest(temp_path, std::ios::out | std::ios::trunc);
+        if (!manifest.is_open()) {
+            std::string msg = "Failed to write hot set manifest: " + temp_path;
+            ENGINE_LOG_ERROR << msg;
+            return Status(DB_ERROR, msg);
+        }
+        for (auto& key : cache::CpuCacheMgr::GetInstance()->ItemKeys()) {
+            manifest << key << "\n";
+        }
+    }
+
+    boost::system::error_code err;
+    boost::filesystem::rename(temp_path, manifest_path, err);
+    if (err) {
+        std::string msg = "Failed to write hot set manifest: " + err.message();
+        ENGINE_LOG_ERROR << msg;
+        return Status(DB_ERROR, msg);
+    }
+    return Status::OK();
+}
+
 void
 DBImpl::StartCompactionTask() {
     static uint64_t compact_clock_tick = 0;
@@ -707,10 +1287,12 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::DateT& date, const m
     // step 2: merge files
     ExecutionEnginePtr index =
         EngineFactory::Build(table_file.dimension_, table_file.location_, (EngineType)table_file.engine_type_,
-                             (MetricType)table_file.metric_type_, table_file.nlist_);
+                             (MetricType)table_file.metric_type_, table_file.nlist_, table_file.table_created_on_);
 
     meta::TableFilesSchema updated;
     int64_t index_size = 0;
+    int64_t merged_size = 0;
+    auto merge_start = std::chrono::steady_clock::now();
 
     for (auto& file : files) {
         server::CollectMergeFilesMetrics metrics;
@@ -724,6 +1306,16 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::DateT& date, const m
         if (index_size >= file_schema.index_file_size_) {
             break;
         }
+
+        // give way to searches, pace the merge to compaction_throttle MB/s while any is running
+        merged_size += file.file_size_;
+        if (options_.compaction_throttle_ > 0 && ongoing_search_count_.load() > 0) {
+            double expect_us = merged_size * 1000000.0 / (options_.compaction_throttle_ * ONE_MB);
+            std::chrono::duration<double, std::micro> spent = std::chrono::steady_clock::now() - merge_start;
+            if (expect_us > spent.count()) {
+                std::this_thread::sleep_for(std::chrono::microseconds((int64_t)(expect_us - spent.count())));
+            }
+        }
     }
 
     // step 3: serialize to disk
@@ -764,8 +1356,26 @@ DBImpl::MergeFiles(const std::string& table_id, const meta::DateT& date, const m
     }
     table_file.file_size_ = index->PhysicalSize();
     table_file.row_count_ = index->Count();
-    updated.push_back(table_file);
-    status = meta_ptr_->UpdateTableFiles(updated);
+    {
+        // vectors deleted from the merged files meanwhile are deleted from the new file before it replaces them,
+        // no deletion runs until the meta is updated
+        std::shared_lock<std::shared_timed_mutex> deletion_lock(deletion_mutex_);
+        std::vector<int64_t> deleted_ids;
+        int64_t deleted_count = 0;
+        status = CollectDeletedIds(updated, deleted_ids);
+        if (status.ok() && !deleted_ids.empty()) {
+            status = index->DeleteIds(deleted_ids, deleted_count);
+        }
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Failed to keep the deletions of the merged files: " << status.message();
+            table_file.file_type_ = meta::TableFileSchema::TO_DELETE;
+            meta_ptr_->UpdateTableFile(table_file);
+            return status;
+        }
+
+        updated.push_back(table_file);
+        status = meta_ptr_->UpdateTableFilesAsync(updated).get();
+    }
     ENGINE_LOG_DEBUG << "New merged file " << table_file.file_id_ << " of size " << index->PhysicalSize() << " bytes";
 
     if (options_.insert_cache_immediately_) {
@@ -784,17 +1394,40 @@ DBImpl::BackgroundMergeFiles(const std::string& table_id) {
         return status;
     }
 
+    std::vector<int> file_types = {(int)meta::TableFileSchema::RAW, (int)meta::TableFileSchema::TO_INDEX,
+                                   (int)meta::TableFileSchema::INDEX};
+    meta::TableFilesSchema searchable_files;
+    meta_ptr_->FilesByType(table_id, file_types, searchable_files);
+
+    // step 1: let the compaction policy pick the merges of every date
+    int64_t segment_count = searchable_files.size(), debt = 0;
+    std::vector<std::pair<meta::DateT, meta::TableFilesSchema>> merges;
     for (auto& kv : raw_files) {
-        meta::TableFilesSchema& files = kv.second;
-        if (files.size() < options_.merge_trigger_number_) {
-            ENGINE_LOG_TRACE << "Files number not greater equal than merge trigger number, skip merge action";
-            continue;
+        for (auto& file : kv.second) {
+            debt += file.file_size_;
         }
 
+        std::vector<meta::TableFilesSchema> groups;
+        compaction_strategy_->GroupRawFiles(kv.second, groups);
+        for (auto& group : groups) {
+            merges.emplace_back(kv.first, group);
+        }
+    }
+    UpdateCompactionStats(table_id, segment_count, debt);
+
+    // step 2: merge
+    for (auto& merge : merges) {
+        meta::TableFilesSchema& files = merge.second;
         status = ongoing_files_checker_.MarkOngoingFiles(files);
-        MergeFiles(table_id, kv.first, kv.second);
+        MergeFiles(table_id, merge.first, files);
         status = ongoing_files_checker_.UnmarkOngoingFiles(files);
 
+        segment_count -= files.size() - 1;
+        for (auto& file : files) {
+            debt -= file.file_size_;
+        }
+        UpdateCompactionStats(table_id, segment_count, debt);
+
         if (!initialized_.load(std::memory_order_acquire)) {
             ENGINE_LOG_DEBUG << "Server will shutdown, skip merge action for table: " << table_id;
             break;
@@ -804,6 +1437,221 @@ DBImpl::BackgroundMergeFiles(const std::string& table_id) {
     return Status::OK();
 }
 
+Status
+DBImpl::BackgroundRebuildIndexFiles(const std::string& table_id) {
+    // an index build in progress changes index and backup files, leave them to the next round
+    std::unique_lock<std::mutex> lock(build_index_mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return Status::OK();
+    }
+
+    meta::TableSchema table_schema;
+    table_schema.table_id_ = table_id;
+    auto status = meta_ptr_->DescribeTable(table_schema);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::vector<int> file_types = {(int)meta::TableFileSchema::INDEX, (int)meta::TableFileSchema::BACKUP};
+    meta::TableFilesSchema files;
+    status = meta_ptr_->FilesByType(table_id, file_types, files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::map<meta::DateT, std::pair<meta::TableFilesSchema, meta::TableFilesSchema>> date_files;
+    for (auto& file : files) {
+        auto& pair = date_files[file.date_];
+        if (file.file_type_ == (int)meta::TableFileSchema::INDEX) {
+            pair.first.push_back(file);
+        } else {
+            pair.second.push_back(file);
+        }
+    }
+
+    // drop the index files of a date and put their raw backups back, they are merged and indexed again
+    for (auto& kv : date_files) {
+        auto& index_files = kv.second.first;
+        auto& backup_files = kv.second.second;
+        if (!compaction_strategy_->RebuildIndexFiles(index_files, backup_files, table_schema.index_file_size_)) {
+            continue;
+        }
+
+        for (auto& file : index_files) {
+            utils::GetTableFilePath(options_.meta_, file);
+        }
+        for (auto& file : backup_files) {
+            utils::GetTableFilePath(options_.meta_, file);
+        }
+
+        std::shared_lock<std::shared_timed_mutex> deletion_lock(deletion_mutex_);
+        status = RestoreBackupFiles(index_files, backup_files);
+        if (!status.ok()) {
+            return status;
+        }
+        ENGINE_LOG_DEBUG << "Rebuild " << index_files.size() << " undersized index files of table " << table_id
+                         << " from " << backup_files.size() << " raw files";
+    }
+
+    return Status::OK();
+}
+
+Status
+DBImpl::RestoreBackupFiles(const meta::TableFilesSchema& index_files, const meta::TableFilesSchema& backup_files) {
+    auto status = HandOverDeletions(index_files, backup_files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    meta::TableFilesSchema updated;
+    for (auto file : backup_files) {
+        file.file_type_ = meta::TableFileSchema::RAW;
+        updated.push_back(file);
+    }
+    for (auto file : index_files) {
+        file.file_type_ = meta::TableFileSchema::TO_DELETE;
+        updated.push_back(file);
+    }
+    return meta_ptr_->UpdateTableFiles(updated);
+}
+
+Status
+DBImpl::BackgroundPurgeDeletedVectors(const std::string& table_id) {
+    // same as rebuilding index files, leave them to the next round while an index is being built
+    std::unique_lock<std::mutex> lock(build_index_mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return Status::OK();
+    }
+
+    std::vector<int> file_types = {(int)meta::TableFileSchema::RAW, (int)meta::TableFileSchema::TO_INDEX,
+                                   (int)meta::TableFileSchema::INDEX};
+    meta::TableFilesSchema files;
+    auto status = meta_ptr_->FilesByType(table_id, file_types, files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    // step 1: raw files with too many deletions are merged on their own, which drops the deleted vectors
+    meta::TableFilesSchema rebuild_files;
+    for (auto& file : files) {
+        if (file.row_count_ <= 0) {
+            continue;
+        }
+
+        utils::GetTableFilePath(options_.meta_, file);
+        BitsetPtr bitset;
+        status = read_bitset(file.location_, bitset);
+        if (!status.ok() || bitset == nullptr) {
+            continue;
+        }
+
+        int64_t deleted = CountDeleted(*bitset);
+        if (deleted <= file.row_count_ * options_.compaction_deleted_ratio_) {
+            continue;
+        }
+
+        if (file.file_type_ == (int)meta::TableFileSchema::INDEX) {
+            rebuild_files.push_back(file);
+            continue;
+        } else if (deleted >= file.row_count_) {
+            file.file_type_ = meta::TableFileSchema::TO_DELETE;
+            status = meta_ptr_->UpdateTableFile(file);
+        } else {
+            meta::TableFilesSchema purge_files = {file};
+            status = ongoing_files_checker_.MarkOngoingFiles(purge_files);
+            status = MergeFiles(table_id, file.date_, purge_files);
+            ongoing_files_checker_.UnmarkOngoingFiles(purge_files);
+        }
+        if (!status.ok()) {
+            return status;
+        }
+        ENGINE_LOG_DEBUG << "Purge " << deleted << " deleted vectors from file " << file.file_id_;
+    }
+
+    if (rebuild_files.empty()) {
+        return Status::OK();
+    }
+
+    // step 2: index files can't drop vectors, they are rebuilt from their raw backups.
+    // an index is built from a single raw file, the backup of the same date that holds its ids
+    file_types = {(int)meta::TableFileSchema::BACKUP};
+    meta::TableFilesSchema backup_files;
+    status = meta_ptr_->FilesByType(table_id, file_types, backup_files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    for (auto& file : rebuild_files) {
+        std::vector<int64_t> ids;
+        ExecutionEnginePtr engine = BuildFileEngine(file);
+        status = (engine == nullptr) ? Status(DB_ERROR, "Failed to build engine for file " + file.file_id_)
+                                     : engine->GetIds(ids);
+        if (!status.ok()) {
+            return status;
+        }
+
+        meta::TableFilesSchema origin_files;
+        for (auto& backup : backup_files) {
+            if (backup.date_ != file.date_ || ids.empty()) {
+                continue;
+            }
+            utils::GetTableFilePath(options_.meta_, backup);
+            std::vector<int64_t> backup_ids;
+            ExecutionEnginePtr backup_engine = BuildFileEngine(backup);
+            status = (backup_engine == nullptr)
+                         ? Status(DB_ERROR, "Failed to build engine for file " + backup.file_id_)
+                         : backup_engine->GetIds(backup_ids);
+            if (!status.ok()) {
+                return status;
+            }
+            if (std::find(backup_ids.begin(), backup_ids.end(), ids.front()) != backup_ids.end()) {
+                origin_files.push_back(backup);
+                break;
+            }
+        }
+        if (origin_files.empty()) {
+            ENGINE_LOG_WARNING << "No raw backup of index file " << file.file_id_ << ", its deleted vectors stay";
+            continue;
+        }
+
+        std::shared_lock<std::shared_timed_mutex> deletion_lock(deletion_mutex_);
+        status = RestoreBackupFiles({file}, origin_files);
+        if (!status.ok()) {
+            return status;
+        }
+        ENGINE_LOG_DEBUG << "Rebuild index file " << file.file_id_ << " from raw file " << origin_files[0].file_id_
+                         << " to purge its deleted vectors";
+    }
+
+    return Status::OK();
+}
+
+void
+DBImpl::UpdateCompactionStats(const std::string& table_id, int64_t segment_count, int64_t debt) {
+    std::lock_guard<std::mutex> lock(compaction_stats_mutex_);
+    compaction_stats_[table_id] = std::make_pair(segment_count, debt);
+    PublishCompactionStats();
+}
+
+void
+DBImpl::EraseCompactionStats(const std::string& table_id) {
+    std::lock_guard<std::mutex> lock(compaction_stats_mutex_);
+    if (compaction_stats_.erase(table_id) > 0) {
+        PublishCompactionStats();
+    }
+}
+
+void
+DBImpl::PublishCompactionStats() {
+    int64_t total_count = 0, total_debt = 0;
+    for (auto& kv : compaction_stats_) {
+        total_count += kv.second.first;
+        total_debt += kv.second.second;
+    }
+    server::Metrics::GetInstance().SegmentCountGaugeSet(total_count);
+    server::Metrics::GetInstance().CompactionDebtBytesGaugeSet(total_debt);
+}
+
 void
 DBImpl::BackgroundCompaction(std::set<std::string> table_ids) {
     // ENGINE_LOG_TRACE << " Background compaction thread start";
@@ -815,6 +1663,16 @@ DBImpl::BackgroundCompaction(std::set<std::string> table_ids) {
             ENGINE_LOG_ERROR << "Merge files for table " << table_id << " failed: " << status.ToString();
         }
 
+        status = BackgroundRebuildIndexFiles(table_id);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Rebuild index files for table " << table_id << " failed: " << status.ToString();
+        }
+
+        status = BackgroundPurgeDeletedVectors(table_id);
+        if (!status.ok()) {
+            ENGINE_LOG_ERROR << "Purge deleted vectors for table " << table_id << " failed: " << status.ToString();
+        }
+
         if (!initialized_.load(std::memory_order_acquire)) {
             ENGINE_LOG_DEBUG << "Server will shutdown, skip merge action";
             break;
@@ -877,7 +1735,7 @@ DBImpl::BackgroundBuildIndex() {
         // step 2: put build index task to scheduler
         std::vector<std::pair<scheduler::BuildIndexJobPtr, scheduler::TableFileSchemaPtr>> job2file_map;
         for (auto& file : to_index_files) {
-            scheduler::BuildIndexJobPtr job = std::make_shared<scheduler::BuildIndexJob>(meta_ptr_, options_);
+            scheduler::BuildIndexJobPtr job = std::make_shared<scheduler::BuildIndexJob>(meta_ptr_, options_, &deletion_mutex_);
             scheduler::TableFileSchemaPtr file_ptr = std::make_shared<meta::TableFileSchema>(file);
             job->AddToIndexFiles(file_ptr);
             scheduler::JobMgrInst::GetInstance()->Put(job);
@@ -940,6 +1798,24 @@ DBImpl::GetFilesToSearch(const std::string& table_id, const std::vector<size_t>&
     return Status::OK();
 }
 
+Status
+DBImpl::GetMemFilesToSearch(const std::string& table_id, const meta::DatesT& dates,
+                            std::vector<MemTableFilePtr>& mem_files) {
+    std::vector<MemTableFilePtr> table_mem_files;
+    auto status = mem_mgr_->GetFilesToSearch(table_id, table_mem_files);
+    if (!status.ok()) {
+        return status;
+    }
+
+    for (auto& mem_file : table_mem_files) {
+        auto file_date = mem_file->GetTableFileSchema().date_;
+        if (dates.empty() || std::find(dates.begin(), dates.end(), file_date) != dates.end()) {
+            mem_files.push_back(mem_file);
+        }
+    }
+    return Status::OK();
+}
+
 Status
 DBImpl::GetPartitionsByTags(const std::string& table_id, const std::vector<std::string>& partition_tags,
                             std::set<std::string>& partition_name_array) {
@@ -971,6 +1847,8 @@ DBImpl::DropTableRecursively(const std::string& table_id, const meta::DatesT& da
         status = mem_mgr_->EraseMemVector(table_id);  // not allow insert
         status = meta_ptr_->DropTable(table_id);      // soft delete table
         index_failed_checker_.CleanFailedIndexFileOfTable(table_id);
+        ExecutionEngineImpl::EraseSharedQuantizers(table_id);
+        EraseCompactionStats(table_id);
 
         // scheduler will determine when to delete table files
         auto nres = scheduler::ResMgrInst::GetInstance()->GetNumOfComputeResource();
@@ -1083,14 +1961,46 @@ Status
 DBImpl::DropTableIndexRecursively(const std::string& table_id) {
     ENGINE_LOG_DEBUG << "Drop index for table: " << table_id;
     index_failed_checker_.CleanFailedIndexFileOfTable(table_id);
-    auto status = meta_ptr_->DropTableIndex(table_id);
-    if (!status.ok()) {
-        return status;
+    {
+        // the raw backups put back in place of the index files keep their deletions
+        std::shared_lock<std::shared_timed_mutex> deletion_lock(deletion_mutex_);
+        std::vector<int> file_types = {(int)meta::TableFileSchema::INDEX, (int)meta::TableFileSchema::BACKUP};
+        meta::TableFilesSchema files;
+        auto status = meta_ptr_->FilesByType(table_id, file_types, files);
+        if (!status.ok()) {
+            return status;
+        }
+
+        meta::TableFilesSchema index_files, backup_files;
+        for (auto& file : files) {
+            utils::GetTableFilePath(options_.meta_, file);
+            if (file.file_type_ == (int)meta::TableFileSchema::INDEX) {
+                index_files.push_back(file);
+            } else {
+                backup_files.push_back(file);
+            }
+        }
+        status = HandOverDeletions(index_files, backup_files);
+        if (!status.ok()) {
+            return status;
+        }
+
+        status = meta_ptr_->DropTableIndex(table_id);
+        if (!status.ok()) {
+            return status;
+        }
+
+        // a later index of the table trains its quantizer again
+        std::vector<std::string> locations;
+        for (auto& file : index_files) {
+            locations.push_back(file.location_);
+        }
+        ExecutionEngineImpl::DropSharedQuantizers(table_id, locations);
     }
 
     // drop partition index
     std::vector<meta::TableSchema> partition_array;
-    status = meta_ptr_->ShowPartitions(table_id, partition_array);
+    auto status = meta_ptr_->ShowPartitions(table_id, partition_array);
     for (auto& schema : partition_array) {
         status = DropTableIndexRecursively(schema.table_id_);
         fiu_do_on("DBImpl.DropTableIndexRecursively.fail_drop_table_Index_for_partition",
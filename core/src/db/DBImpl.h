@@ -18,15 +18,19 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "DB.h"
+#include "db/CompactionStrategy.h"
 #include "db/IndexFailedChecker.h"
 #include "db/OngoingFileChecker.h"
 #include "db/Types.h"
 #include "db/insert/MemManager.h"
+#include "scheduler/job/SearchJob.h"
 #include "utils/ThreadPool.h"
 
 namespace milvus {
@@ -66,6 +70,15 @@ class DBImpl : public DB {
     Status
     PreloadTable(const std::string& table_id) override;
 
+    Status
+    WarmStart() override;
+
+    void
+    StopWarmStart() override;
+
+    Status
+    GetPreloadProgress(std::vector<PreloadProgress>& progress) override;
+
     Status
     UpdateTableFlag(const std::string& table_id, int64_t flag);
 
@@ -88,6 +101,9 @@ class DBImpl : public DB {
     Status
     InsertVectors(const std::string& table_id, const std::string& partition_tag, VectorsData& vectors) override;
 
+    Status
+    DeleteVectors(const std::string& table_id, const IDNumbers& ids, int64_t& deleted_count) override;
+
     Status
     CreateIndex(const std::string& table_id, const TableIndex& index) override;
 
@@ -99,27 +115,76 @@ class DBImpl : public DB {
 
     Status
     Query(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-          const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-          ResultIds& result_ids, ResultDistances& result_distances) override;
+          const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+          const VectorsData& vectors, ResultIds& result_ids, ResultDistances& result_distances) override;
 
     Status
     Query(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-          const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-          const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) override;
+          const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+          const VectorsData& vectors, const meta::DatesT& dates, ResultIds& result_ids,
+          ResultDistances& result_distances) override;
 
     Status
     QueryByFileID(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-                  const std::vector<std::string>& file_ids, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-                  const meta::DatesT& dates, ResultIds& result_ids, ResultDistances& result_distances) override;
+                  const std::vector<std::string>& file_ids, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+                  const VectorsData& vectors, const meta::DatesT& dates, ResultIds& result_ids,
+                  ResultDistances& result_distances) override;
+
+    Status
+    RangeQuery(const std::shared_ptr<server::Context>& context, const std::string& table_id,
+               const std::vector<std::string>& partition_tags, float radius, uint64_t nprobe,
+               const VectorsData& vectors, std::vector<int64_t>& result_lims, ResultIds& result_ids,
+               ResultDistances& result_distances) override;
 
     Status
     Size(uint64_t& result) override;
 
+    // number of queries sent on behalf of merged searches, one of them serves every search of its batch
+    uint64_t
+    SearchBatchCount() const;
+
  private:
+    // concurrent searches with the same table, partitions, dates, topk, nprobe and refine factor merged into one query
+    struct SearchBatch {
+        uint64_t nq_ = 0;
+        std::vector<const VectorsData*> vectors_;
+        bool closed_ = false;
+        bool done_ = false;
+        Status status_;
+        ResultIds result_ids_;
+        ResultDistances result_distances_;
+        std::condition_variable cv_;
+    };
+    using SearchBatchPtr = std::shared_ptr<SearchBatch>;
+
+    // index files and insert buffer files of the table or of the given partitions
+    Status
+    GetTableFilesToSearch(const std::string& table_id, const std::vector<std::string>& partition_tags,
+                          const meta::DatesT& dates, meta::TableFilesSchema& files,
+                          std::vector<MemTableFilePtr>& mem_files);
+
+    Status
+    QueryTable(const std::shared_ptr<server::Context>& context, const std::string& table_id,
+               const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+               const VectorsData& vectors, const meta::DatesT& dates, ResultIds& result_ids,
+               ResultDistances& result_distances);
+
+    Status
+    QueryBatched(const std::shared_ptr<server::Context>& context, const std::string& table_id,
+                 const std::vector<std::string>& partition_tags, uint64_t k, uint64_t nprobe, uint64_t refine_factor,
+                 const VectorsData& vectors, const meta::DatesT& dates, ResultIds& result_ids,
+                 ResultDistances& result_distances);
+
     Status
     QueryAsync(const std::shared_ptr<server::Context>& context, const std::string& table_id,
-               const meta::TableFilesSchema& files, uint64_t k, uint64_t nprobe, const VectorsData& vectors,
-               ResultIds& result_ids, ResultDistances& result_distances);
+               const meta::TableFilesSchema& files, const std::vector<MemTableFilePtr>& mem_files, uint64_t k,
+               uint64_t nprobe, uint64_t refine_factor, const VectorsData& vectors, ResultIds& result_ids,
+               ResultDistances& result_distances);
+
+    // hand the files to the job, put it to the scheduler and wait until all of them are searched
+    Status
+    ExecuteSearchJob(const scheduler::SearchJobPtr& job, const meta::TableFilesSchema& files,
+                     const std::vector<MemTableFilePtr>& mem_files);
 
     void
     BackgroundTimerTask();
@@ -131,12 +196,37 @@ class DBImpl : public DB {
     void
     StartMetricTask();
 
+    void
+    StartHotSetTask();
+    Status
+    SaveHotSetManifest();
+
+    // no file is started once stop is set
+    Status
+    PreloadFiles(const std::string& name, const meta::TableFilesSchema& files,
+                 const std::atomic<bool>* stop = nullptr);
+
     void
     StartCompactionTask();
     Status
     MergeFiles(const std::string& table_id, const meta::DateT& date, const meta::TableFilesSchema& files);
     Status
     BackgroundMergeFiles(const std::string& table_id);
+    Status
+    BackgroundRebuildIndexFiles(const std::string& table_id);
+    // drop the index files and put their raw backups back, with the deletions of the index files.
+    // the caller holds deletion_mutex_
+    Status
+    RestoreBackupFiles(const meta::TableFilesSchema& index_files, const meta::TableFilesSchema& backup_files);
+    Status
+    BackgroundPurgeDeletedVectors(const std::string& table_id);
+    void
+    UpdateCompactionStats(const std::string& table_id, int64_t segment_count, int64_t debt);
+    void
+    EraseCompactionStats(const std::string& table_id);
+    // sum the stats of all tables into the gauges, the caller holds compaction_stats_mutex_
+    void
+    PublishCompactionStats();
     void
     BackgroundCompaction(std::set<std::string> table_ids);
 
@@ -156,6 +246,10 @@ class DBImpl : public DB {
     GetFilesToSearch(const std::string& table_id, const std::vector<size_t>& file_ids, const meta::DatesT& dates,
                      meta::TableFilesSchema& files);
 
+    Status
+    GetMemFilesToSearch(const std::string& table_id, const meta::DatesT& dates,
+                        std::vector<MemTableFilePtr>& mem_files);
+
     Status
     GetPartitionsByTags(const std::string& table_id, const std::vector<std::string>& partition_tags,
                         std::set<std::string>& partition_name_array);
@@ -190,15 +284,32 @@ class DBImpl : public DB {
     std::mutex compact_result_mutex_;
     std::list<std::future<void>> compact_thread_results_;
     std::set<std::string> compact_table_ids_;
+    CompactionStrategyPtr compaction_strategy_;
+    // searches in flight, compaction is throttled while there are any
+    std::atomic<int64_t> ongoing_search_count_;
+
+    std::mutex compaction_stats_mutex_;
+    std::map<std::string, std::pair<int64_t, int64_t>> compaction_stats_;  // table id -> (segments, debt bytes)
 
     ThreadPool index_thread_pool_;
     std::mutex index_result_mutex_;
     std::list<std::future<void>> index_thread_results_;
 
     std::mutex build_index_mutex_;
+    // held exclusively while deletions mark files, shared while a merge, an index build or a restore of raw
+    // backups hands the deletions of the replaced files over to their successors and commits them
+    std::shared_timed_mutex deletion_mutex_;
 
     IndexFailedChecker index_failed_checker_;
     OngoingFileChecker ongoing_files_checker_;
+
+    std::mutex search_batch_mutex_;
+    std::unordered_map<std::string, SearchBatchPtr> search_batches_;
+    std::atomic<uint64_t> search_batch_count_;
+
+    std::mutex preload_mutex_;
+    std::map<std::string, PreloadProgress> preload_progress_;
+    std::atomic<bool> warm_start_stopped_;
 };  // DBImpl
 
 }  // namespace engine
@@ -59,6 +59,8 @@ struct DBMetaOptions {
     std::vector<std::string> slave_paths_;
     std::string backend_uri_;
     ArchiveConf archive_conf_ = ArchiveConf("delete");
+    bool cache_enable_ = false;
+    int64_t commit_delay_ = 5;  // ms
 };  // DBMetaOptions
 
 struct DBOptions {
@@ -70,6 +72,28 @@ struct DBOptions {
 
     size_t insert_buffer_size_ = 4 * ONE_GB;
     bool insert_cache_immediately_ = false;
+
+    // 0 disables search batching
+    int64_t search_batch_wait_ms_ = 0;
+    int64_t search_batch_max_nq_ = 1024;
+
+    // total results of a range search request, one matching more vectors fails
+    int64_t max_range_results_ = 1000000;
+
+    // "simple" or "size_tiered", see CompactionStrategy
+    std::string compaction_policy_ = "simple";
+    int64_t compaction_fan_in_ = 4;
+    double compaction_write_amp_ = 3.0;
+    // MB/s of compaction while searches are running, 0 means no limit
+    int64_t compaction_throttle_ = 64;
+    // a file with more than this share of its vectors deleted is rewritten without them
+    float compaction_deleted_ratio_ = 0.2;
+
+    int64_t preload_thread_num_ = 4;
+    // threads writing immutable tables to disk on flush
+    int64_t flush_thread_num_ = 4;
+    // record the cached index files and reload them at startup
+    bool warm_start_enable_ = false;
 };  // Options
 
 }  // namespace engine
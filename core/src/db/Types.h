@@ -44,6 +44,18 @@ struct VectorsData {
     IDNumbers id_array_;
 };
 
+// progress of the latest preload of a table, or of the warm start
+struct PreloadProgress {
+    std::string name_;
+    int64_t total_files_ = 0;
+    int64_t loaded_files_ = 0;
+    int64_t failed_files_ = 0;
+    int64_t total_bytes_ = 0;
+    int64_t loaded_bytes_ = 0;
+    double elapsed_ms_ = 0.0;
+    bool finished_ = false;
+};
+
 using File2ErrArray = std::map<std::string, std::vector<std::string>>;
 using Table2FileErr = std::map<std::string, File2ErrArray>;
 using File2RefCount = std::map<std::string, int64_t>;
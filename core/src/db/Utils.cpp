@@ -14,6 +14,7 @@
 #include "storage/s3/S3ClientWrapper.h"
 #include "utils/CommonUtil.h"
 #include "utils/Log.h"
+#include "wrapper/VecIndex.h"
 
 #include <fiu-local.h>
 #include <boost/filesystem.hpp>
@@ -189,6 +190,8 @@ Status
 DeleteTableFilePath(const DBMetaOptions& options, meta::TableFileSchema& table_file) {
     utils::GetTableFilePath(options, table_file);
     boost::filesystem::remove(table_file.location_);
+    boost::filesystem::remove(bitset_location(table_file.location_));
+    boost::filesystem::remove(ids_location(table_file.location_));
     return Status::OK();
 }
 
@@ -20,7 +20,7 @@ namespace engine {
 
 ExecutionEnginePtr
 EngineFactory::Build(uint16_t dimension, const std::string& location, EngineType index_type, MetricType metric_type,
-                     int32_t nlist) {
+                     int32_t nlist, int64_t table_created_on) {
     if (index_type == EngineType::INVALID) {
         ENGINE_LOG_ERROR << "Unsupported engine type";
         return nullptr;
@@ -28,7 +28,7 @@ EngineFactory::Build(uint16_t dimension, const std::string& location, EngineType
 
     ENGINE_LOG_DEBUG << "EngineFactory index type: " << (int)index_type;
     ExecutionEnginePtr execution_engine_ptr =
-        std::make_shared<ExecutionEngineImpl>(dimension, location, index_type, metric_type, nlist);
+        std::make_shared<ExecutionEngineImpl>(dimension, location, index_type, metric_type, nlist, table_created_on);
 
     execution_engine_ptr->Init();
     return execution_engine_ptr;
@@ -21,9 +21,10 @@ namespace engine {
 
 class EngineFactory {
  public:
+    // table_created_on tells a table from an earlier one dropped under the same name
     static ExecutionEnginePtr
     Build(uint16_t dimension, const std::string& location, EngineType index_type, MetricType metric_type,
-          int32_t nlist);
+          int32_t nlist, int64_t table_created_on = 0);
 };
 
 }  // namespace engine
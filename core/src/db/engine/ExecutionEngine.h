@@ -34,7 +34,12 @@ enum class EngineType {
     FAISS_BIN_IDMAP,
     FAISS_BIN_IVFFLAT,
     HNSW,
-    MAX_VALUE = HNSW,
+    FAISS_IVFFLAT_FP16,  // IVF_FLAT and its raw files in half precision
+    FAISS_IVFFLAT_BF16,
+    FAISS_PQ_FASTSCAN,    // 4-bit IVF_PQ scanned with SIMD lookup tables
+    FAISS_IVFSQ8_REFINE,  // IVF_SQ8 keeping the raw vectors to re-rank search results exactly
+    FAISS_PQ_REFINE,
+    MAX_VALUE = FAISS_PQ_REFINE,
 };
 
 enum class MetricType {
@@ -57,6 +62,10 @@ class ExecutionEngine {
     virtual size_t
     Count() const = 0;
 
+    // vectors marked deleted, they are part of Count() but never returned by a search
+    virtual size_t
+    DeletedCount() const = 0;
+
     virtual size_t
     Size() const = 0;
 
@@ -72,6 +81,10 @@ class ExecutionEngine {
     virtual Status
     Load(bool to_cache = true) = 0;
 
+    // read the index file ahead of Load(), so disk io and deserialization of different files can overlap
+    virtual Status
+    Prefetch() = 0;
+
     virtual Status
     CopyToGpu(uint64_t device_id, bool hybrid) = 0;
 
@@ -94,6 +107,33 @@ class ExecutionEngine {
     Search(int64_t n, const uint8_t* data, int64_t k, int64_t nprobe, float* distances, int64_t* labels,
            bool hybrid) = 0;
 
+    // all vectors within radius of each query, the results of query i are in [lims[i], lims[i + 1])
+    virtual Status
+    RangeSearch(int64_t n, const float* data, float radius, int64_t nprobe, std::vector<int64_t>& lims,
+                std::vector<int64_t>& labels, std::vector<float>& distances, bool hybrid) = 0;
+
+    // per query distance a result of the following float searches must beat, size n, nullptr to reset
+    virtual void
+    SetDistanceBound(const float* bound) = 0;
+
+    // candidates per result the following float searches re-rank with the raw vectors of a *_REFINE index,
+    // 0 for the default, 1 turns re-ranking off
+    virtual void
+    SetRefineFactor(int64_t refine_factor) = 0;
+
+    // mark the vectors with the given ids deleted, searches of this file skip them from now on and
+    // merges and index builds drop them. deleted_count is the number of vectors newly marked
+    virtual Status
+    DeleteIds(const std::vector<int64_t>& ids, int64_t& deleted_count) = 0;
+
+    // ids of the file in the order of its deletion bitset, read from next to the file when they are stored there
+    virtual Status
+    GetIds(std::vector<int64_t>& ids) = 0;
+
+    // ids of the vectors marked deleted in the file on disk
+    virtual Status
+    GetDeletedIds(std::vector<int64_t>& deleted_ids) = 0;
+
     virtual std::shared_ptr<ExecutionEngine>
     BuildIndex(const std::string& location, EngineType engine_type) = 0;
 
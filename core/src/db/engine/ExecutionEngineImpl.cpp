@@ -12,13 +12,22 @@
 #include "db/engine/ExecutionEngineImpl.h"
 
 #include <fiu-local.h>
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <mutex>
+#include <set>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "cache/CpuCacheMgr.h"
 #include "cache/GpuCacheMgr.h"
 #include "knowhere/common/Config.h"
+#include "knowhere/index/vector_index/IndexIVF.h"
 #include "metrics/Metrics.h"
 #include "scheduler/Utils.h"
 #include "server/Config.h"
@@ -64,11 +73,66 @@ MappingMetricType(MetricType metric_type, knowhere::METRICTYPE& kw_type) {
     return Status::OK();
 }
 
+// precision of the vectors kept by raw files and the index of a table
+knowhere::StorageType
+MappingStorageType(EngineType engine_type) {
+    switch (engine_type) {
+        case EngineType::FAISS_IVFFLAT_FP16:
+            return knowhere::StorageType::FP16;
+        case EngineType::FAISS_IVFFLAT_BF16:
+            return knowhere::StorageType::BF16;
+        default:
+            return knowhere::StorageType::FP32;
+    }
+}
+
 bool
 IsBinaryIndexType(IndexType type) {
     return type == IndexType::FAISS_BIN_IDMAP || type == IndexType::FAISS_BIN_IVFLAT_CPU;
 }
 
+// weights of the cache reload cost, relative to reading the same bytes from local disk
+constexpr int64_t S3_RELOAD_FACTOR = 4;
+constexpr int64_t INDEX_RELOAD_FACTOR = 2;
+
+int64_t
+EstimateReloadCost(const VecIndexPtr& index, int64_t file_size) {
+    int64_t cost = file_size;
+
+    bool s3_enable = false;
+    server::Config::GetInstance().GetStorageConfigS3Enable(s3_enable);
+    if (s3_enable) {
+        cost *= S3_RELOAD_FACTOR;
+    }
+
+    // raw files are replaced by the index built from them soon, built indexes stay
+    auto type = index->GetType();
+    if (type != IndexType::FAISS_IDMAP && type != IndexType::FAISS_BIN_IDMAP) {
+        cost *= INDEX_RELOAD_FACTOR;
+    }
+    return cost;
+}
+
+// copy the rows not set in the bitset, returns false and copies nothing when there is no bitset
+bool
+CopyLiveRows(const BitsetPtr& bitset, int64_t count, int64_t dim, const float* vectors, const int64_t* ids,
+             std::vector<float>& live_vectors, std::vector<int64_t>& live_ids) {
+    if (bitset == nullptr) {
+        return false;
+    }
+
+    live_vectors.clear();
+    live_ids.clear();
+    for (int64_t i = 0; i < count; ++i) {
+        if (((*bitset)[i >> 3] >> (i & 7)) & 1) {
+            continue;
+        }
+        live_vectors.insert(live_vectors.end(), vectors + i * dim, vectors + (i + 1) * dim);
+        live_ids.push_back(ids[i]);
+    }
+    return true;
+}
+
 }  // namespace
 
 class CachedQuantizer : public cache::DataObj {
@@ -90,9 +154,195 @@ class CachedQuantizer : public cache::DataObj {
     knowhere::QuantizerPtr data_;
 };
 
+namespace {
+
+// a shared quantizer is trained once samples of this many segments are pooled, the segments built before train
+// their own quantizer
+constexpr int64_t SHARED_QUANTIZER_SAMPLE_SEGMENTS = 3;
+// training vectors per list of a shared quantizer
+constexpr int64_t SHARED_QUANTIZER_TRAIN_POINTS = 256;
+
+struct QuantizerSample {
+    int64_t segments = 0;
+    std::vector<float> vectors;
+};
+
+std::mutex shared_quantizer_mutex;
+// cache keys of the shared quantizers of each table, guarded by shared_quantizer_mutex
+std::unordered_map<std::string, std::set<std::string>> shared_quantizer_keys;
+// samples pooled for the shared quantizers not trained yet, by quantizer path, guarded by shared_quantizer_mutex
+std::unordered_map<std::string, QuantizerSample> quantizer_samples;
+
+// quantized indexes keeping their raw vectors to re-rank search results
+bool
+IsRefineEngineType(EngineType engine_type) {
+    return engine_type == EngineType::FAISS_IVFSQ8_REFINE || engine_type == EngineType::FAISS_PQ_REFINE;
+}
+
+bool
+IsShareQuantizerEnabled(EngineType engine_type, MetricType metric_type) {
+    bool enable = false;
+    server::Config::GetInstance().GetEngineConfigShareIvfQuantizer(enable);
+    if (!enable || server::ValidationUtil::IsBinaryMetricType((int32_t)metric_type)) {
+        return false;
+    }
+    return engine_type == EngineType::FAISS_IVFFLAT || engine_type == EngineType::FAISS_IVFSQ8 ||
+           engine_type == EngineType::FAISS_PQ || engine_type == EngineType::FAISS_IVFFLAT_FP16 ||
+           engine_type == EngineType::FAISS_IVFFLAT_BF16 || engine_type == EngineType::FAISS_PQ_FASTSCAN ||
+           IsRefineEngineType(engine_type);
+}
+
+// the quantizer is stored in the table folder, ".../tables/<table_id>/<date>/<file_id>"; the creation time of the
+// table is part of the name, so a table created again under a dropped name never picks up the old centroids
+std::string
+SharedQuantizerPath(const std::string& location, int64_t table_created_on, EngineType engine_type,
+                    MetricType metric_type, int32_t nlist, int64_t dim) {
+    auto table_path = boost::filesystem::path(location).parent_path().parent_path();
+    std::string name = "ivf_" + std::to_string(table_created_on) + "_" + std::to_string((int)engine_type) + "_" +
+                       std::to_string(nlist) + "_" + std::to_string((int)metric_type) + "_" + std::to_string(dim) +
+                       ".quantizer";
+    return (table_path / name).string();
+}
+
+// must hold shared_quantizer_mutex
+void
+CacheSharedQuantizer(const std::string& path, const knowhere::QuantizerPtr& quantizer) {
+    cache::CpuCacheMgr::GetInstance()->InsertItem(path, std::make_shared<CachedQuantizer>(quantizer));
+    auto table_id = boost::filesystem::path(path).parent_path().filename().string();
+    shared_quantizer_keys[table_id].insert(path);
+}
+
+knowhere::QuantizerPtr
+GetSharedQuantizer(const std::string& path) {
+    if (auto cached_quantizer = cache::CpuCacheMgr::GetInstance()->GetIndex(path)) {
+        return std::static_pointer_cast<CachedQuantizer>(cached_quantizer)->Data();
+    }
+
+    std::lock_guard<std::mutex> lock(shared_quantizer_mutex);
+    if (auto cached_quantizer = cache::CpuCacheMgr::GetInstance()->GetIndex(path)) {
+        return std::static_pointer_cast<CachedQuantizer>(cached_quantizer)->Data();
+    }
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return nullptr;
+    }
+
+    try {
+        int64_t length = file.tellg();
+        if (length <= 0) {
+            return nullptr;
+        }
+        file.seekg(0, std::ios::beg);
+        auto data = std::shared_ptr<uint8_t>(new uint8_t[length], std::default_delete<uint8_t[]>());
+        if (!file.read(reinterpret_cast<char*>(data.get()), length)) {
+            ENGINE_LOG_WARNING << "Failed to read shared quantizer: " << path;
+            return nullptr;
+        }
+
+        knowhere::BinarySet binary_set;
+        binary_set.Append("QUANTIZER", data, length);
+        auto quantizer = std::make_shared<knowhere::IVFCoarseQuantizer>();
+        quantizer->Load(binary_set);
+        CacheSharedQuantizer(path, quantizer);
+        return quantizer;
+    } catch (std::exception& e) {
+        ENGINE_LOG_WARNING << "Failed to load shared quantizer: " << path << " reason: " << e.what();
+        return nullptr;
+    }
+}
+
+// add an evenly strided sample of a segment to the pool of its shared quantizer; the segment completing the pool
+// takes the pooled vectors to train the quantizer on and returns true
+bool
+PoolQuantizerSample(const std::string& path, const float* vectors, int64_t count, int64_t dim, int32_t nlist,
+                    std::vector<float>& training_vectors) {
+    if (vectors == nullptr || count <= 0 || nlist <= 0) {
+        return false;
+    }
+
+    int64_t rows = std::min(count, SHARED_QUANTIZER_TRAIN_POINTS * nlist / SHARED_QUANTIZER_SAMPLE_SEGMENTS);
+    std::lock_guard<std::mutex> lock(shared_quantizer_mutex);
+    auto& sample = quantizer_samples[path];
+    for (int64_t i = 0; i < rows; ++i) {
+        const float* row = vectors + (i * count / rows) * dim;
+        sample.vectors.insert(sample.vectors.end(), row, row + dim);
+    }
+    if (++sample.segments < SHARED_QUANTIZER_SAMPLE_SEGMENTS) {
+        return false;
+    }
+
+    // k-means needs a vector per list at least, tiny segments start over
+    bool enough = static_cast<int64_t>(sample.vectors.size()) >= nlist * dim;
+    if (enough) {
+        training_vectors.swap(sample.vectors);
+    }
+    quantizer_samples.erase(path);
+    return enough;
+}
+
+// must hold shared_quantizer_mutex
+void
+EraseSharedQuantizersOfTable(const std::string& table_id) {
+    auto iter = shared_quantizer_keys.find(table_id);
+    if (iter != shared_quantizer_keys.end()) {
+        for (auto& key : iter->second) {
+            cache::CpuCacheMgr::GetInstance()->EraseItem(key);
+            ENGINE_LOG_DEBUG << "Erase shared quantizer: " << key;
+        }
+        shared_quantizer_keys.erase(iter);
+    }
+
+    for (auto sample = quantizer_samples.begin(); sample != quantizer_samples.end();) {
+        if (boost::filesystem::path(sample->first).parent_path().filename().string() == table_id) {
+            sample = quantizer_samples.erase(sample);
+        } else {
+            ++sample;
+        }
+    }
+}
+
+// best effort, segments just keep training their own quantizer when the file can't be written
+void
+SaveSharedQuantizer(const std::string& path, const knowhere::QuantizerPtr& quantizer) {
+    auto coarse_quantizer = std::dynamic_pointer_cast<knowhere::IVFCoarseQuantizer>(quantizer);
+    if (coarse_quantizer == nullptr) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(shared_quantizer_mutex);
+    if (boost::filesystem::exists(path)) {
+        return;
+    }
+
+    try {
+        auto binary = coarse_quantizer->Serialize().GetByName("QUANTIZER");
+        std::string temp_path = path + ".tmp";
+        {
+            std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open() || !file.write(reinterpret_cast<const char*>(binary->data.get()), binary->size)) {
+                ENGINE_LOG_WARNING << "Failed to write shared quantizer: " << path;
+                return;
+            }
+        }
+        boost::filesystem::rename(temp_path, path);
+        CacheSharedQuantizer(path, quantizer);
+        ENGINE_LOG_DEBUG << "Save shared quantizer: " << path;
+    } catch (std::exception& e) {
+        ENGINE_LOG_WARNING << "Failed to save shared quantizer: " << path << " reason: " << e.what();
+    }
+}
+
+}  // namespace
+
 ExecutionEngineImpl::ExecutionEngineImpl(uint16_t dimension, const std::string& location, EngineType index_type,
-                                         MetricType metric_type, int32_t nlist)
-    : location_(location), dim_(dimension), index_type_(index_type), metric_type_(metric_type), nlist_(nlist) {
+                                         MetricType metric_type, int32_t nlist, int64_t table_created_on)
+    : location_(location),
+      dim_(dimension),
+      index_type_(index_type),
+      metric_type_(metric_type),
+      nlist_(nlist),
+      table_created_on_(table_created_on) {
     EngineType tmp_index_type = server::ValidationUtil::IsBinaryMetricType((int32_t)metric_type)
                                     ? EngineType::FAISS_BIN_IDMAP
                                     : EngineType::FAISS_IDMAP;
@@ -104,6 +354,7 @@ ExecutionEngineImpl::ExecutionEngineImpl(uint16_t dimension, const std::string&
     TempMetaConf temp_conf;
     temp_conf.gpu_id = gpu_num_;
     temp_conf.dim = dimension;
+    temp_conf.storage_type = MappingStorageType(index_type);
     auto status = MappingMetricType(metric_type, temp_conf.metric_type);
     if (!status.ok()) {
         throw Exception(DB_ERROR, status.message());
@@ -124,8 +375,39 @@ ExecutionEngineImpl::ExecutionEngineImpl(uint16_t dimension, const std::string&
 }
 
 ExecutionEngineImpl::ExecutionEngineImpl(VecIndexPtr index, const std::string& location, EngineType index_type,
-                                         MetricType metric_type, int32_t nlist)
-    : index_(std::move(index)), location_(location), index_type_(index_type), metric_type_(metric_type), nlist_(nlist) {
+                                         MetricType metric_type, int32_t nlist, int64_t table_created_on)
+    : index_(std::move(index)),
+      location_(location),
+      index_type_(index_type),
+      metric_type_(metric_type),
+      nlist_(nlist),
+      table_created_on_(table_created_on) {
+}
+
+void
+ExecutionEngineImpl::EraseSharedQuantizers(const std::string& table_id) {
+    std::lock_guard<std::mutex> lock(shared_quantizer_mutex);
+    EraseSharedQuantizersOfTable(table_id);
+}
+
+void
+ExecutionEngineImpl::DropSharedQuantizers(const std::string& table_id, const std::vector<std::string>& locations) {
+    std::lock_guard<std::mutex> lock(shared_quantizer_mutex);
+    EraseSharedQuantizersOfTable(table_id);
+
+    std::set<boost::filesystem::path> table_paths;
+    for (auto& location : locations) {
+        table_paths.insert(boost::filesystem::path(location).parent_path().parent_path());
+    }
+    for (auto& table_path : table_paths) {
+        boost::system::error_code ec;
+        for (boost::filesystem::directory_iterator iter(table_path, ec), end; !ec && iter != end; iter.increment(ec)) {
+            if (iter->path().extension() == ".quantizer") {
+                boost::filesystem::remove(iter->path(), ec);
+                ENGINE_LOG_DEBUG << "Remove shared quantizer: " << iter->path().string();
+            }
+        }
+    }
 }
 
 VecIndexPtr
@@ -199,6 +481,29 @@ ExecutionEngineImpl::CreatetVecIndex(EngineType type) {
             index = GetVecIndexFactory(IndexType::HNSW);
             break;
         }
+        case EngineType::FAISS_IVFFLAT_FP16: {
+            // no gpu kernels for half precision storage
+            index = GetVecIndexFactory(IndexType::FAISS_IVFFLAT_FP16_CPU);
+            break;
+        }
+        case EngineType::FAISS_IVFFLAT_BF16: {
+            index = GetVecIndexFactory(IndexType::FAISS_IVFFLAT_BF16_CPU);
+            break;
+        }
+        case EngineType::FAISS_PQ_FASTSCAN: {
+            // the lookup table scan has no gpu version
+            index = GetVecIndexFactory(IndexType::FAISS_IVFPQ_FASTSCAN_CPU);
+            break;
+        }
+        case EngineType::FAISS_IVFSQ8_REFINE: {
+            // the raw vectors are only kept by cpu builds, searches can still run on gpu copies
+            index = GetVecIndexFactory(IndexType::FAISS_IVFSQ8_CPU);
+            break;
+        }
+        case EngineType::FAISS_PQ_REFINE: {
+            index = GetVecIndexFactory(IndexType::FAISS_IVFPQ_CPU);
+            break;
+        }
         case EngineType::FAISS_BIN_IDMAP: {
             index = GetVecIndexFactory(IndexType::FAISS_BIN_IDMAP);
             break;
@@ -316,6 +621,14 @@ ExecutionEngineImpl::Count() const {
     return index_->Count();
 }
 
+size_t
+ExecutionEngineImpl::DeletedCount() const {
+    if (index_ == nullptr) {
+        return 0;
+    }
+    return index_->DeletedCount();
+}
+
 size_t
 ExecutionEngineImpl::Size() const {
     if (IsBinaryIndexType(index_->GetType())) {
@@ -343,6 +656,15 @@ Status
 ExecutionEngineImpl::Serialize() {
     auto status = write_index(index_, location_);
 
+    // deletions read the ids from here instead of loading the file
+    std::vector<int64_t> ids;
+    if (status.ok() && index_->GetIds(ids).ok()) {
+        auto ids_status = write_ids(ids, location_);
+        if (!ids_status.ok()) {
+            ENGINE_LOG_WARNING << "Failed to store the ids of " << location_ << ": " << ids_status.message();
+        }
+    }
+
     // here we reset index size by file size,
     // since some index type(such as SQ8) data size become smaller after serialized
     index_->set_size(PhysicalSize());
@@ -364,13 +686,44 @@ ExecutionEngineImpl::Load(bool to_cache) {
         try {
             double physical_size = PhysicalSize();
             server::CollectExecutionEngineMetrics metrics(physical_size);
-            index_ = read_index(location_);
+            if (prefetch_length_ > 0) {
+                index_ = LoadVecIndex(prefetch_type_, prefetch_binary_, prefetch_length_);
+                prefetch_binary_ = knowhere::BinarySet();
+                prefetch_length_ = 0;
+            } else {
+                index_ = read_index(location_);
+            }
             if (index_ == nullptr) {
                 std::string msg = "Failed to load index from " + location_;
                 ENGINE_LOG_ERROR << msg;
                 return Status(DB_ERROR, msg);
             } else {
                 ENGINE_LOG_DEBUG << "Disk io from: " << location_;
+                index_->set_reload_cost(EstimateReloadCost(index_, physical_size));
+            }
+
+            // vectors deleted after the file was written
+            BitsetPtr bitset;
+            auto status = read_bitset(location_, bitset);
+            if (!status.ok()) {
+                ENGINE_LOG_ERROR << status.message();
+                return status;
+            }
+            if (bitset != nullptr) {
+                if (bitset->size() != static_cast<size_t>((index_->Count() + 7) / 8)) {
+                    std::string msg = "Deletion bitset doesn't match index " + location_;
+                    ENGINE_LOG_ERROR << msg;
+                    return Status(DB_ERROR, msg);
+                }
+                index_->SetBitset(bitset);
+            }
+
+            if (IsShareQuantizerEnabled(index_type_, metric_type_)) {
+                auto path = SharedQuantizerPath(location_, table_created_on_, index_type_, metric_type_, nlist_,
+                                                index_->Dimension());
+                if (auto quantizer = GetSharedQuantizer(path)) {
+                    index_->SetCoarseQuantizer(quantizer);
+                }
             }
         } catch (std::exception& e) {
             ENGINE_LOG_ERROR << e.what();
@@ -384,6 +737,30 @@ ExecutionEngineImpl::Load(bool to_cache) {
     return Status::OK();
 }
 
+Status
+ExecutionEngineImpl::Prefetch() {
+    if (cache::CpuCacheMgr::GetInstance()->ItemExists(location_)) {
+        return Status::OK();
+    }
+
+    try {
+        auto status = read_index_binary(location_, prefetch_type_, prefetch_binary_, prefetch_length_);
+        if (!status.ok()) {
+            prefetch_binary_ = knowhere::BinarySet();
+            prefetch_length_ = 0;
+            std::string msg = "Failed to read index from " + location_;
+            ENGINE_LOG_ERROR << msg;
+            return Status(DB_ERROR, msg);
+        }
+    } catch (std::exception& e) {
+        prefetch_binary_ = knowhere::BinarySet();
+        prefetch_length_ = 0;
+        ENGINE_LOG_ERROR << e.what();
+        return Status(DB_ERROR, e.what());
+    }
+    return Status::OK();
+}
+
 Status
 ExecutionEngineImpl::CopyToGpu(uint64_t device_id, bool hybrid) {
 #if 0
@@ -441,6 +818,11 @@ ExecutionEngineImpl::CopyToGpu(uint64_t device_id, bool hybrid) {
 #endif
 
 #ifdef MILVUS_GPU_VERSION
+    // gpu indexes can't skip deleted vectors, a file with deletions is searched on cpu
+    if (index_ != nullptr && index_->GetBitset() != nullptr) {
+        return Status::OK();
+    }
+
     auto index = std::static_pointer_cast<VecIndex>(cache::GpuCacheMgr::GetInstance(device_id)->GetIndex(location_));
     bool already_in_cache = (index != nullptr);
     if (already_in_cache) {
@@ -527,12 +909,20 @@ ExecutionEngineImpl::Merge(const std::string& location) {
     }
     ENGINE_LOG_DEBUG << "Merge index file: " << location << " to: " << location_;
 
-    auto to_merge = cache::CpuCacheMgr::GetInstance()->GetIndex(location);
+    auto to_merge = std::static_pointer_cast<VecIndex>(cache::CpuCacheMgr::GetInstance()->GetIndex(location));
     if (!to_merge) {
         try {
             double physical_size = server::CommonUtil::GetFileSize(location);
             server::CollectExecutionEngineMetrics metrics(physical_size);
             to_merge = read_index(location);
+            BitsetPtr bitset;
+            auto status = read_bitset(location, bitset);
+            if (!status.ok()) {
+                return status;
+            }
+            if (to_merge != nullptr) {
+                to_merge->SetBitset(bitset);
+            }
         } catch (std::exception& e) {
             ENGINE_LOG_ERROR << e.what();
             return Status(DB_ERROR, e.what());
@@ -545,7 +935,18 @@ ExecutionEngineImpl::Merge(const std::string& location) {
     }
 
     if (auto file_index = std::dynamic_pointer_cast<BFIndex>(to_merge)) {
-        auto status = index_->Add(file_index->Count(), file_index->GetRawVectors(), file_index->GetRawIds());
+        // deleted vectors are dropped here
+        Status status;
+        std::vector<float> decoded_vectors;
+        std::vector<float> live_vectors;
+        std::vector<int64_t> live_ids;
+        auto raw_vectors = file_index->GetRawVectors(decoded_vectors);
+        if (CopyLiveRows(file_index->GetBitset(), file_index->Count(), file_index->Dimension(), raw_vectors,
+                         file_index->GetRawIds(), live_vectors, live_ids)) {
+            status = index_->Add(live_ids.size(), live_vectors.data(), live_ids.data());
+        } else {
+            status = index_->Add(file_index->Count(), raw_vectors, file_index->GetRawIds());
+        }
         if (!status.ok()) {
             ENGINE_LOG_ERROR << "Failed to merge: " << location << " to: " << location_;
         } else {
@@ -581,11 +982,21 @@ ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_t
         throw Exception(DB_ERROR, "Unsupported index type");
     }
 
+    // deleted vectors don't make it into the index
+    std::vector<float> decoded_vectors;
+    std::vector<float> live_vectors;
+    std::vector<int64_t> live_ids;
+    const float* raw_vectors = from_index ? from_index->GetRawVectors(decoded_vectors) : nullptr;
+    bool filtered = from_index && CopyLiveRows(from_index->GetBitset(), Count(), Dimension(), raw_vectors,
+                                               from_index->GetRawIds(), live_vectors, live_ids);
+
     TempMetaConf temp_conf;
     temp_conf.gpu_id = gpu_num_;
     temp_conf.dim = Dimension();
     temp_conf.nlist = nlist_;
-    temp_conf.size = Count();
+    temp_conf.size = filtered ? live_ids.size() : Count();
+    temp_conf.storage_type = MappingStorageType(engine_type);
+    temp_conf.refine = IsRefineEngineType(engine_type);
     auto status = MappingMetricType(metric_type_, temp_conf.metric_type);
     if (!status.ok()) {
         throw Exception(DB_ERROR, status.message());
@@ -594,8 +1005,34 @@ ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_t
     auto adapter = AdapterMgr::GetInstance().GetAdapter(to_index->GetType());
     auto conf = adapter->Match(temp_conf);
 
+    // segments of one table are added to the centroids trained on a sample of the first segments built
+    std::string quantizer_path;
+    knowhere::QuantizerPtr shared_quantizer = nullptr;
+    std::vector<float> training_vectors;
+    if (from_index && IsShareQuantizerEnabled(engine_type, metric_type_)) {
+        quantizer_path =
+            SharedQuantizerPath(location, table_created_on_, engine_type, metric_type_, nlist_, Dimension());
+        shared_quantizer = GetSharedQuantizer(quantizer_path);
+        if (shared_quantizer) {
+            to_index->SetCoarseQuantizer(shared_quantizer);
+        } else if (!PoolQuantizerSample(quantizer_path, filtered ? live_vectors.data() : raw_vectors,
+                                        filtered ? live_ids.size() : Count(), Dimension(), nlist_,
+                                        training_vectors)) {
+            quantizer_path.clear();
+        }
+    }
+
     if (from_index) {
-        status = to_index->BuildAll(Count(), from_index->GetRawVectors(), from_index->GetRawIds(), conf);
+        int64_t nt = training_vectors.size() / Dimension();
+        const float* xt = training_vectors.empty() ? nullptr : training_vectors.data();
+        if (filtered) {
+            status = to_index->BuildAll(live_ids.size(), live_vectors.data(), live_ids.data(), conf, nt, xt);
+        } else {
+            status = to_index->BuildAll(Count(), raw_vectors, from_index->GetRawIds(), conf, nt, xt);
+        }
+        if (status.ok() && !quantizer_path.empty() && shared_quantizer == nullptr) {
+            SaveSharedQuantizer(quantizer_path, to_index->GetCoarseQuantizer());
+        }
     } else if (bin_from_index) {
         status = to_index->BuildAll(Count(), bin_from_index->GetRawVectors(), bin_from_index->GetRawIds(), conf);
     }
@@ -604,7 +1041,8 @@ ExecutionEngineImpl::BuildIndex(const std::string& location, EngineType engine_t
     }
 
     ENGINE_LOG_DEBUG << "Finish build index file: " << location << " size: " << to_index->Size();
-    return std::make_shared<ExecutionEngineImpl>(to_index, location, engine_type, metric_type_, nlist_);
+    return std::make_shared<ExecutionEngineImpl>(to_index, location, engine_type, metric_type_, nlist_,
+                                                 table_created_on_);
 }
 
 Status
@@ -676,6 +1114,9 @@ ExecutionEngineImpl::Search(int64_t n, const float* data, int64_t k, int64_t npr
     TempMetaConf temp_conf;
     temp_conf.k = k;
     temp_conf.nprobe = nprobe;
+    temp_conf.nq = n;
+    temp_conf.distance_bound = distance_bound_;
+    temp_conf.refine_factor = refine_factor_;
 
     auto adapter = AdapterMgr::GetInstance().GetAdapter(index_->GetType());
     auto conf = adapter->MatchSearch(temp_conf, index_->GetType());
@@ -730,6 +1171,172 @@ ExecutionEngineImpl::Search(int64_t n, const uint8_t* data, int64_t k, int64_t n
     return status;
 }
 
+Status
+ExecutionEngineImpl::RangeSearch(int64_t n, const float* data, float radius, int64_t nprobe,
+                                 std::vector<int64_t>& lims, std::vector<int64_t>& labels,
+                                 std::vector<float>& distances, bool hybrid) {
+    if (index_ == nullptr) {
+        ENGINE_LOG_ERROR << "ExecutionEngineImpl: index is null, failed to search";
+        return Status(DB_ERROR, "index is null");
+    }
+
+    ENGINE_LOG_DEBUG << "RangeSearch Params: [radius]  " << radius << " [nprobe] " << nprobe;
+
+    TempMetaConf temp_conf;
+    temp_conf.nprobe = nprobe;
+    temp_conf.nq = n;
+
+    auto adapter = AdapterMgr::GetInstance().GetAdapter(index_->GetType());
+    auto conf = adapter->MatchSearch(temp_conf, index_->GetType());
+    conf->radius = radius;
+
+    if (hybrid) {
+        HybridLoad();
+    }
+
+    auto status = index_->RangeSearch(n, data, lims, labels, distances, conf);
+
+    if (hybrid) {
+        HybridUnset();
+    }
+
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "RangeSearch error:" << status.message();
+    }
+    return status;
+}
+
+void
+ExecutionEngineImpl::SetDistanceBound(const float* bound) {
+    distance_bound_ = bound;
+}
+
+void
+ExecutionEngineImpl::SetRefineFactor(int64_t refine_factor) {
+    refine_factor_ = refine_factor;
+}
+
+Status
+ExecutionEngineImpl::DeleteIds(const std::vector<int64_t>& ids, int64_t& deleted_count) {
+    deleted_count = 0;
+
+    // only the ids and the bitset are read, a file that isn't loaded yet picks the deletions up when it is
+    std::vector<int64_t> index_ids;
+    auto status = GetIds(index_ids);
+    if (!status.ok()) {
+        return status;
+    }
+
+    BitsetPtr old_bitset;
+    status = read_bitset(location_, old_bitset);
+    if (!status.ok()) {
+        return status;
+    }
+
+    std::unordered_set<int64_t> to_delete(ids.begin(), ids.end());
+    auto bitset =
+        old_bitset ? std::make_shared<Bitset>(*old_bitset) : std::make_shared<Bitset>((index_ids.size() + 7) / 8);
+    if (bitset->size() != (index_ids.size() + 7) / 8) {
+        std::string msg = "Deletion bitset doesn't match index " + location_;
+        ENGINE_LOG_ERROR << msg;
+        return Status(DB_ERROR, msg);
+    }
+    for (size_t i = 0; i < index_ids.size(); ++i) {
+        uint8_t mask = 1 << (i & 7);
+        if (((*bitset)[i >> 3] & mask) == 0 && to_delete.find(index_ids[i]) != to_delete.end()) {
+            (*bitset)[i >> 3] |= mask;
+            ++deleted_count;
+        }
+    }
+    if (deleted_count == 0) {
+        return Status::OK();
+    }
+
+    status = write_bitset(*bitset, location_);
+    if (!status.ok()) {
+        ENGINE_LOG_ERROR << "Failed to persist deletion bitset of " << location_ << ": " << status.message();
+        return status;
+    }
+
+    // searches of the copies in memory skip the vectors from now on
+    if (index_ != nullptr) {
+        index_->SetBitset(bitset);
+    }
+    auto cached = std::static_pointer_cast<VecIndex>(cache::CpuCacheMgr::GetInstance()->GetIndex(location_));
+    if (cached != nullptr && cached != index_) {
+        cached->SetBitset(bitset);
+    }
+
+#ifdef MILVUS_GPU_VERSION
+    // gpu copies don't know about the deletions, the file is searched on cpu from now on
+    server::Config& config = server::Config::GetInstance();
+    std::vector<int64_t> gpus;
+    config.GetGpuResourceConfigSearchResources(gpus);
+    for (auto& gpu : gpus) {
+        cache::GpuCacheMgr::GetInstance(gpu)->EraseItem(location_);
+    }
+#endif
+
+    ENGINE_LOG_DEBUG << "Delete " << deleted_count << " vectors from " << location_;
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::GetIds(std::vector<int64_t>& ids) {
+    bool found = false;
+    auto status = read_ids(location_, ids, found);
+    if (!status.ok() || found) {
+        return status;
+    }
+
+    // files written before their ids were stored, the index is read once without being cached
+    if (index_ == nullptr) {
+        status = Load(false);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    status = index_->GetIds(ids);
+    if (!status.ok()) {
+        return status;
+    }
+
+    auto ids_status = write_ids(ids, location_);
+    if (!ids_status.ok()) {
+        ENGINE_LOG_WARNING << "Failed to store the ids of " << location_ << ": " << ids_status.message();
+    }
+    return Status::OK();
+}
+
+Status
+ExecutionEngineImpl::GetDeletedIds(std::vector<int64_t>& deleted_ids) {
+    deleted_ids.clear();
+
+    BitsetPtr bitset;
+    auto status = read_bitset(location_, bitset);
+    if (!status.ok() || bitset == nullptr) {
+        return status;
+    }
+
+    std::vector<int64_t> ids;
+    status = GetIds(ids);
+    if (!status.ok()) {
+        return status;
+    }
+    if (bitset->size() != (ids.size() + 7) / 8) {
+        std::string msg = "Deletion bitset doesn't match index " + location_;
+        ENGINE_LOG_ERROR << msg;
+        return Status(DB_ERROR, msg);
+    }
+
+    for (size_t i = 0; i < ids.size(); ++i) {
+        if ((*bitset)[i >> 3] & (1 << (i & 7))) {
+            deleted_ids.push_back(ids[i]);
+        }
+    }
+    return Status::OK();
+}
+
 Status
 ExecutionEngineImpl::Cache() {
     cache::DataObjPtr obj = std::static_pointer_cast<cache::DataObj>(index_);
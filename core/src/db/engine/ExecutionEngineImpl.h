@@ -16,6 +16,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace milvus {
 namespace engine {
@@ -23,10 +24,19 @@ namespace engine {
 class ExecutionEngineImpl : public ExecutionEngine {
  public:
     ExecutionEngineImpl(uint16_t dimension, const std::string& location, EngineType index_type, MetricType metric_type,
-                        int32_t nlist);
+                        int32_t nlist, int64_t table_created_on = 0);
 
     ExecutionEngineImpl(VecIndexPtr index, const std::string& location, EngineType index_type, MetricType metric_type,
-                        int32_t nlist);
+                        int32_t nlist, int64_t table_created_on = 0);
+
+    // drop the coarse quantizers shared by the segments of a table from cache, called when the table is dropped
+    static void
+    EraseSharedQuantizers(const std::string& table_id);
+
+    // drop them from cache and remove their files, which are next to the index files at locations; called when
+    // the index of the table is dropped
+    static void
+    DropSharedQuantizers(const std::string& table_id, const std::vector<std::string>& locations);
 
     Status
     AddWithIds(int64_t n, const float* xdata, const int64_t* xids) override;
@@ -37,6 +47,9 @@ class ExecutionEngineImpl : public ExecutionEngine {
     size_t
     Count() const override;
 
+    size_t
+    DeletedCount() const override;
+
     size_t
     Size() const override;
 
@@ -52,6 +65,9 @@ class ExecutionEngineImpl : public ExecutionEngine {
     Status
     Load(bool to_cache) override;
 
+    Status
+    Prefetch() override;
+
     Status
     CopyToGpu(uint64_t device_id, bool hybrid = false) override;
 
@@ -75,6 +91,25 @@ class ExecutionEngineImpl : public ExecutionEngine {
     Search(int64_t n, const uint8_t* data, int64_t k, int64_t nprobe, float* distances, int64_t* labels,
            bool hybrid = false) override;
 
+    Status
+    RangeSearch(int64_t n, const float* data, float radius, int64_t nprobe, std::vector<int64_t>& lims,
+                std::vector<int64_t>& labels, std::vector<float>& distances, bool hybrid) override;
+
+    void
+    SetDistanceBound(const float* bound) override;
+
+    void
+    SetRefineFactor(int64_t refine_factor) override;
+
+    Status
+    DeleteIds(const std::vector<int64_t>& ids, int64_t& deleted_count) override;
+
+    Status
+    GetIds(std::vector<int64_t>& ids) override;
+
+    Status
+    GetDeletedIds(std::vector<int64_t>& deleted_ids) override;
+
     ExecutionEnginePtr
     BuildIndex(const std::string& location, EngineType engine_type) override;
 
@@ -125,6 +160,15 @@ class ExecutionEngineImpl : public ExecutionEngine {
 
     int64_t nlist_ = 0;
     int64_t gpu_num_ = 0;
+    int64_t table_created_on_ = 0;
+
+    const float* distance_bound_ = nullptr;
+    int64_t refine_factor_ = 0;
+
+    // index file read by Prefetch(), consumed by the next Load()
+    IndexType prefetch_type_ = IndexType::INVALID;
+    knowhere::BinarySet prefetch_binary_;
+    int64_t prefetch_length_ = 0;
 };
 
 }  // namespace engine
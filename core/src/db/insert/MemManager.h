@@ -12,11 +12,13 @@
 #pragma once
 
 #include "db/Types.h"
+#include "db/insert/MemTableFile.h"
 #include "utils/Status.h"
 
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace milvus {
 namespace engine {
@@ -29,6 +31,9 @@ class MemManager {
     virtual Status
     Serialize(std::set<std::string>& table_ids) = 0;
 
+    virtual Status
+    GetFilesToSearch(const std::string& table_id, std::vector<MemTableFilePtr>& files) = 0;
+
     virtual Status
     EraseMemVector(const std::string& table_id) = 0;
 
@@ -12,41 +12,56 @@
 #include "db/insert/MemManagerImpl.h"
 #include "VectorSource.h"
 #include "db/Constants.h"
+#include "metrics/Metrics.h"
 #include "utils/Log.h"
 
-#include <thread>
+#include <chrono>
+#include <functional>
+#include <vector>
 
 namespace milvus {
 namespace engine {
 
+MemManagerImpl::MemShard&
+MemManagerImpl::GetShard(const std::string& table_id) {
+    return shards_[std::hash<std::string>()(table_id) % MEM_SHARD_NUM];
+}
+
 MemTablePtr
-MemManagerImpl::GetMemByTable(const std::string& table_id) {
-    auto memIt = mem_id_map_.find(table_id);
-    if (memIt != mem_id_map_.end()) {
+MemManagerImpl::GetMemByTable(MemShard& shard, const std::string& table_id) {
+    auto memIt = shard.mem_id_map_.find(table_id);
+    if (memIt != shard.mem_id_map_.end()) {
         return memIt->second;
     }
 
-    mem_id_map_[table_id] = std::make_shared<MemTable>(table_id, meta_, options_);
-    return mem_id_map_[table_id];
+    shard.mem_id_map_[table_id] = std::make_shared<MemTable>(table_id, meta_, options_);
+    return shard.mem_id_map_[table_id];
 }
 
 Status
 MemManagerImpl::InsertVectors(const std::string& table_id, VectorsData& vectors) {
-    while (GetCurrentMem() > options_.insert_buffer_size_) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
-    }
+    size_t reserved = ReserveMem(vectors);
 
-    std::unique_lock<std::mutex> lock(mutex_);
+    Status status;
+    {
+        MemShard& shard = GetShard(table_id);
+        std::unique_lock<std::mutex> lock(shard.mutex_);
+        status = InsertVectorsNoLock(shard, table_id, vectors);
+    }
 
-    return InsertVectorsNoLock(table_id, vectors);
+    // the inserted bytes are counted by now, drop the reservation
+    ReleaseMem(reserved);
+    return status;
 }
 
 Status
-MemManagerImpl::InsertVectorsNoLock(const std::string& table_id, VectorsData& vectors) {
-    MemTablePtr mem = GetMemByTable(table_id);
+MemManagerImpl::InsertVectorsNoLock(MemShard& shard, const std::string& table_id, VectorsData& vectors) {
+    MemTablePtr mem = GetMemByTable(shard, table_id);
     VectorSourcePtr source = std::make_shared<VectorSource>(vectors);
 
+    size_t mem_before = mem->GetCurrentMem();
     auto status = mem->Add(source);
+    current_mem_ += (mem->GetCurrentMem() - mem_before);
     if (status.ok()) {
         if (vectors.id_array_.empty()) {
             vectors.id_array_ = source->GetVectorIds();
@@ -55,64 +70,158 @@ MemManagerImpl::InsertVectorsNoLock(const std::string& table_id, VectorsData& ve
     return status;
 }
 
+size_t
+MemManagerImpl::ReserveMem(const VectorsData& vectors) {
+    size_t size = vectors.float_data_.size() * sizeof(float) + vectors.binary_data_.size();
+
+    std::unique_lock<std::mutex> lock(mem_available_mtx_);
+    if (current_mem_.load() > options_.insert_buffer_size_) {
+        // woken writers re-check the limit under the lock, and see the reservations of those admitted before them
+        auto start_time = METRICS_NOW_TIME;
+        ++waiting_insert_count_;
+        mem_available_cv_.wait(lock, [this] { return current_mem_.load() <= options_.insert_buffer_size_; });
+        --waiting_insert_count_;
+        auto end_time = METRICS_NOW_TIME;
+        auto wait_time = METRICS_MICROSECONDS(start_time, end_time);
+        server::Metrics::GetInstance().InsertBufferWaitDurationHistogramObserve(wait_time);
+    }
+    current_mem_ += size;
+    return size;
+}
+
+void
+MemManagerImpl::ReleaseMem(size_t size) {
+    if (size == 0) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mem_available_mtx_);
+        current_mem_ -= size;
+    }
+    mem_available_cv_.notify_all();
+}
+
 Status
 MemManagerImpl::ToImmutable() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    MemIdMap temp_map;
-    for (auto& kv : mem_id_map_) {
-        if (kv.second->Empty()) {
-            // empty table, no need to serialize
-            temp_map.insert(kv);
-        } else {
-            immu_mem_list_.push_back(kv.second);
+    std::unique_lock<std::mutex> list_lock(immu_mem_mtx_);
+    for (auto& shard : shards_) {
+        std::unique_lock<std::mutex> lock(shard.mutex_);
+        MemIdMap temp_map;
+        for (auto& kv : shard.mem_id_map_) {
+            if (kv.second->Empty()) {
+                // empty table, no need to serialize
+                temp_map.insert(kv);
+            } else {
+                immu_mem_list_.push_back(kv.second);
+            }
         }
-    }
 
-    mem_id_map_.swap(temp_map);
+        shard.mem_id_map_.swap(temp_map);
+    }
     return Status::OK();
 }
 
 Status
 MemManagerImpl::Serialize(std::set<std::string>& table_ids) {
-    ToImmutable();
     std::unique_lock<std::mutex> lock(serialization_mtx_);
+    ToImmutable();
     table_ids.clear();
+
+    auto start_time = METRICS_NOW_TIME;
+    std::vector<size_t> mem_sizes;
+    size_t total_size = 0;
     for (auto& mem : immu_mem_list_) {
-        mem->Serialize();
+        mem_sizes.push_back(mem->GetCurrentMem());
+        total_size += mem_sizes.back();
+        mem->SerializeAsync(&flush_pool_);
         table_ids.insert(mem->GetTableId());
     }
+
+    // files of all tables are written in parallel, and their meta updates are queued as soon as each is written,
+    // so they are committed together while later files are still being written
+    for (size_t i = 0; i < immu_mem_list_.size(); ++i) {
+        immu_mem_list_[i]->WaitSerialized();
+
+        // wake up blocked writers as soon as a table is flushed
+        ReleaseMem(mem_sizes[i]);
+    }
+
+    auto end_time = METRICS_NOW_TIME;
+    auto flush_time = METRICS_MICROSECONDS(start_time, end_time);
+    if (total_size > 0) {
+        server::Metrics::GetInstance().FlushDurationHistogramObserve(flush_time);
+        if (flush_time > 0) {
+            server::Metrics::GetInstance().FlushBytesPerSecondGaugeSet(total_size * 1000000.0 / flush_time);
+        }
+    }
+
+    std::unique_lock<std::mutex> list_lock(immu_mem_mtx_);
     immu_mem_list_.clear();
     return Status::OK();
 }
 
+Status
+MemManagerImpl::GetFilesToSearch(const std::string& table_id, std::vector<MemTableFilePtr>& files) {
+    // mutable table must be collected before immutable list, a table moves from the former to the latter,
+    // and it leaves the immutable list only after its files are visible in meta
+    {
+        MemShard& shard = GetShard(table_id);
+        std::unique_lock<std::mutex> lock(shard.mutex_);
+        auto mem_it = shard.mem_id_map_.find(table_id);
+        if (mem_it != shard.mem_id_map_.end()) {
+            mem_it->second->GetMemTableFiles(files);
+        }
+    }
+
+    std::unique_lock<std::mutex> list_lock(immu_mem_mtx_);
+    for (auto& mem : immu_mem_list_) {
+        if (mem->GetTableId() == table_id) {
+            mem->GetMemTableFiles(files);
+        }
+    }
+    return Status::OK();
+}
+
 Status
 MemManagerImpl::EraseMemVector(const std::string& table_id) {
+    size_t erased_mem = 0;
     {  // erase MemVector from rapid-insert cache
-        std::unique_lock<std::mutex> lock(mutex_);
-        mem_id_map_.erase(table_id);
+        MemShard& shard = GetShard(table_id);
+        std::unique_lock<std::mutex> lock(shard.mutex_);
+        auto mem_it = shard.mem_id_map_.find(table_id);
+        if (mem_it != shard.mem_id_map_.end()) {
+            erased_mem += mem_it->second->GetCurrentMem();
+            shard.mem_id_map_.erase(mem_it);
+        }
     }
 
     {  // erase MemVector from serialize cache
         std::unique_lock<std::mutex> lock(serialization_mtx_);
+        std::unique_lock<std::mutex> list_lock(immu_mem_mtx_);
         MemList temp_list;
         for (auto& mem : immu_mem_list_) {
             if (mem->GetTableId() != table_id) {
                 temp_list.push_back(mem);
+            } else {
+                erased_mem += mem->GetCurrentMem();
             }
         }
         immu_mem_list_.swap(temp_list);
     }
 
+    ReleaseMem(erased_mem);
     return Status::OK();
 }
 
 size_t
 MemManagerImpl::GetCurrentMutableMem() {
     size_t total_mem = 0;
-    std::unique_lock<std::mutex> lock(mutex_);
-    for (auto& kv : mem_id_map_) {
-        auto memTable = kv.second;
-        total_mem += memTable->GetCurrentMem();
+    for (auto& shard : shards_) {
+        std::unique_lock<std::mutex> lock(shard.mutex_);
+        for (auto& kv : shard.mem_id_map_) {
+            total_mem += kv.second->GetCurrentMem();
+        }
     }
     return total_mem;
 }
@@ -120,7 +229,7 @@ MemManagerImpl::GetCurrentMutableMem() {
 size_t
 MemManagerImpl::GetCurrentImmutableMem() {
     size_t total_mem = 0;
-    std::unique_lock<std::mutex> lock(serialization_mtx_);
+    std::unique_lock<std::mutex> lock(immu_mem_mtx_);
     for (auto& mem_table : immu_mem_list_) {
         total_mem += mem_table->GetCurrentMem();
     }
@@ -129,7 +238,13 @@ MemManagerImpl::GetCurrentImmutableMem() {
 
 size_t
 MemManagerImpl::GetCurrentMem() {
-    return GetCurrentMutableMem() + GetCurrentImmutableMem();
+    return current_mem_.load();
+}
+
+size_t
+MemManagerImpl::GetWaitingInsertCount() {
+    std::lock_guard<std::mutex> lock(mem_available_mtx_);
+    return waiting_insert_count_;
 }
 
 }  // namespace engine
@@ -15,7 +15,12 @@
 #include "MemTable.h"
 #include "db/meta/Meta.h"
 #include "utils/Status.h"
+#include "utils/ThreadPool.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
 #include <ctime>
 #include <map>
 #include <memory>
@@ -31,7 +36,8 @@ class MemManagerImpl : public MemManager {
  public:
     using Ptr = std::shared_ptr<MemManagerImpl>;
 
-    MemManagerImpl(const meta::MetaPtr& meta, const DBOptions& options) : meta_(meta), options_(options) {
+    MemManagerImpl(const meta::MetaPtr& meta, const DBOptions& options)
+        : meta_(meta), options_(options), flush_pool_(std::max<int64_t>(options.flush_thread_num_, 1)) {
     }
 
     Status
@@ -40,6 +46,9 @@ class MemManagerImpl : public MemManager {
     Status
     Serialize(std::set<std::string>& table_ids) override;
 
+    Status
+    GetFilesToSearch(const std::string& table_id, std::vector<MemTableFilePtr>& files) override;
+
     Status
     EraseMemVector(const std::string& table_id) override;
 
@@ -52,23 +61,56 @@ class MemManagerImpl : public MemManager {
     size_t
     GetCurrentMem() override;
 
+    // inserts blocked until the insert buffer drops below its limit
+    size_t
+    GetWaitingInsertCount();
+
  private:
+    using MemIdMap = std::map<std::string, MemTablePtr>;
+    using MemList = std::vector<MemTablePtr>;
+
+    // tables are spread over shards by hash, inserts into different shards never contend
+    struct MemShard {
+        MemIdMap mem_id_map_;
+        std::mutex mutex_;
+    };
+
+    MemShard&
+    GetShard(const std::string& table_id);
+
     MemTablePtr
-    GetMemByTable(const std::string& table_id);
+    GetMemByTable(MemShard& shard, const std::string& table_id);
 
     Status
-    InsertVectorsNoLock(const std::string& table_id, VectorsData& vectors);
+    InsertVectorsNoLock(MemShard& shard, const std::string& table_id, VectorsData& vectors);
+
     Status
     ToImmutable();
 
-    using MemIdMap = std::map<std::string, MemTablePtr>;
-    using MemList = std::vector<MemTablePtr>;
-    MemIdMap mem_id_map_;
+    // blocks while the insert buffer is over its limit, then reserves the bytes of the vectors
+    size_t
+    ReserveMem(const VectorsData& vectors);
+
+    void
+    ReleaseMem(size_t size);
+
+    static constexpr size_t MEM_SHARD_NUM = 32;
+    std::array<MemShard, MEM_SHARD_NUM> shards_;
+
     MemList immu_mem_list_;
     meta::MetaPtr meta_;
     DBOptions options_;
-    std::mutex mutex_;
+    std::mutex immu_mem_mtx_;
     std::mutex serialization_mtx_;
+
+    // writes files of immutable tables on flush
+    ThreadPool flush_pool_;
+
+    // total bytes buffered in mutable and immutable tables
+    std::atomic<size_t> current_mem_{0};
+    std::mutex mem_available_mtx_;
+    std::condition_variable mem_available_cv_;
+    size_t waiting_insert_count_ = 0;  // guarded by mem_available_mtx_
 };  // NewMemManager
 
 }  // namespace engine
@@ -12,8 +12,11 @@
 #include "db/insert/MemTable.h"
 #include "utils/Log.h"
 
+#include <future>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace milvus {
 namespace engine {
@@ -35,6 +38,7 @@ MemTable::Add(VectorSourcePtr& source) {
             MemTableFilePtr new_mem_table_file = std::make_shared<MemTableFile>(table_id_, meta_, options_);
             status = new_mem_table_file->Add(source);
             if (status.ok()) {
+                std::lock_guard<std::mutex> lock(mutex_);
                 mem_table_file_list_.emplace_back(new_mem_table_file);
             }
         } else {
@@ -55,6 +59,12 @@ MemTable::GetCurrentMemTableFile(MemTableFilePtr& mem_table_file) {
     mem_table_file = mem_table_file_list_.back();
 }
 
+void
+MemTable::GetMemTableFiles(MemTableFileList& mem_table_files) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    mem_table_files.insert(mem_table_files.end(), mem_table_file_list_.begin(), mem_table_file_list_.end());
+}
+
 size_t
 MemTable::GetTableFileCount() {
     return mem_table_file_list_.size();
@@ -62,17 +72,63 @@ MemTable::GetTableFileCount() {
 
 Status
 MemTable::Serialize() {
-    for (auto mem_table_file = mem_table_file_list_.begin(); mem_table_file != mem_table_file_list_.end();) {
-        auto status = (*mem_table_file)->Serialize();
-        if (!status.ok()) {
+    auto status = SerializeAsync();
+    auto wait_status = WaitSerialized();
+    return status.ok() ? wait_status : status;
+}
+
+Status
+MemTable::SerializeAsync(ThreadPool* pool) {
+    for (size_t i = committed_list_.size(); i < mem_table_file_list_.size(); ++i) {
+        MemTableFilePtr mem_table_file = mem_table_file_list_[i];
+        auto serialize = [mem_table_file]() {
+            std::future<Status> committed;
+            auto status = mem_table_file->Serialize(committed);
+            if (!status.ok()) {
+                std::promise<Status> failed;
+                failed.set_value(status);
+                return failed.get_future();
+            }
+            return committed;
+        };
+
+        if (pool != nullptr) {
+            committed_list_.emplace_back(pool->enqueue(serialize));
+        } else {
+            std::promise<std::future<Status>> written;
+            written.set_value(serialize());
+            committed_list_.emplace_back(written.get_future());
+        }
+    }
+    return Status::OK();
+}
+
+Status
+MemTable::WaitSerialized() {
+    Status result;
+    std::vector<bool> committed(committed_list_.size(), false);
+    for (size_t i = 0; i < committed_list_.size(); ++i) {
+        auto status = committed_list_[i].get().get();
+        if (status.ok()) {
+            committed[i] = true;
+        } else {
             std::string err_msg = "Insert data serialize failed: " + status.ToString();
             ENGINE_LOG_ERROR << err_msg;
-            return Status(DB_ERROR, err_msg);
+            result = Status(DB_ERROR, err_msg);
         }
-        std::lock_guard<std::mutex> lock(mutex_);
-        mem_table_file = mem_table_file_list_.erase(mem_table_file);
     }
-    return Status::OK();
+
+    // a file leaves the buffer, and is no longer searched from memory, only once meta shows it
+    std::lock_guard<std::mutex> lock(mutex_);
+    MemTableFileList remained;
+    for (size_t i = 0; i < mem_table_file_list_.size(); ++i) {
+        if (i >= committed.size() || !committed[i]) {
+            remained.push_back(mem_table_file_list_[i]);
+        }
+    }
+    mem_table_file_list_.swap(remained);
+    committed_list_.clear();
+    return result;
 }
 
 bool
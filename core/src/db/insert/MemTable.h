@@ -14,7 +14,9 @@
 #include "MemTableFile.h"
 #include "VectorSource.h"
 #include "utils/Status.h"
+#include "utils/ThreadPool.h"
 
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -35,12 +37,25 @@ class MemTable {
     void
     GetCurrentMemTableFile(MemTableFilePtr& mem_table_file);
 
+    // append a snapshot of buffered files, used to search data not yet serialized
+    void
+    GetMemTableFiles(MemTableFileList& mem_table_files);
+
     size_t
     GetTableFileCount();
 
     Status
     Serialize();
 
+    // write every file and queue their meta updates, the files stay searchable here until WaitSerialized(),
+    // files are written on the pool when one is given
+    Status
+    SerializeAsync(ThreadPool* pool = nullptr);
+
+    // wait for the meta updates and drop the files meta shows now
+    Status
+    WaitSerialized();
+
     bool
     Empty();
 
@@ -55,6 +70,9 @@ class MemTable {
 
     MemTableFileList mem_table_file_list_;
 
+    // writes of the serialized files, in the order of mem_table_file_list_, each yields its meta update
+    std::vector<std::future<std::future<Status>>> committed_list_;
+
     meta::MetaPtr meta_;
 
     DBOptions options_;
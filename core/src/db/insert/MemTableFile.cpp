@@ -28,7 +28,8 @@ MemTableFile::MemTableFile(const std::string& table_id, const meta::MetaPtr& met
     if (status.ok()) {
         execution_engine_ = EngineFactory::Build(
             table_file_schema_.dimension_, table_file_schema_.location_, (EngineType)table_file_schema_.engine_type_,
-            (MetricType)table_file_schema_.metric_type_, table_file_schema_.nlist_);
+            (MetricType)table_file_schema_.metric_type_, table_file_schema_.nlist_,
+            table_file_schema_.table_created_on_);
     }
 }
 
@@ -61,6 +62,7 @@ MemTableFile::Add(VectorSourcePtr& source) {
     if (mem_left >= single_vector_mem_size) {
         size_t num_vectors_to_add = std::ceil(mem_left / single_vector_mem_size);
         size_t num_vectors_added;
+        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
         auto status = source->Add(execution_engine_, table_file_schema_, num_vectors_to_add, num_vectors_added);
         if (status.ok()) {
             current_mem_ += (num_vectors_added * single_vector_mem_size);
@@ -88,24 +90,43 @@ MemTableFile::IsFull() {
 
 Status
 MemTableFile::Serialize() {
+    std::future<Status> committed;
+    auto status = Serialize(committed);
+    if (!status.ok()) {
+        return status;
+    }
+    return committed.get();
+}
+
+Status
+MemTableFile::Serialize(std::future<Status>& committed) {
     size_t size = GetCurrentMem();
     server::CollectSerializeMetrics metrics(size);
 
-    execution_engine_->Serialize();
-    table_file_schema_.file_size_ = execution_engine_->PhysicalSize();
-    table_file_schema_.row_count_ = execution_engine_->Count();
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        execution_engine_->Serialize();
+    }
 
-    // if index type isn't IDMAP, set file type to TO_INDEX if file size execeed index_file_size
-    // else set file type to RAW, no need to build index
-    if (table_file_schema_.engine_type_ != (int)EngineType::FAISS_IDMAP &&
-        table_file_schema_.engine_type_ != (int)EngineType::FAISS_BIN_IDMAP) {
-        table_file_schema_.file_type_ = (size >= table_file_schema_.index_file_size_) ? meta::TableFileSchema::TO_INDEX
-                                                                                      : meta::TableFileSchema::RAW;
-    } else {
-        table_file_schema_.file_type_ = meta::TableFileSchema::RAW;
+    {
+        // the file is immutable now, only the schema is updated under exclusive lock
+        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+        table_file_schema_.file_size_ = execution_engine_->PhysicalSize();
+        table_file_schema_.row_count_ = execution_engine_->Count();
+
+        // if index type isn't IDMAP, set file type to TO_INDEX if file size execeed index_file_size
+        // else set file type to RAW, no need to build index
+        if (table_file_schema_.engine_type_ != (int)EngineType::FAISS_IDMAP &&
+            table_file_schema_.engine_type_ != (int)EngineType::FAISS_BIN_IDMAP) {
+            table_file_schema_.file_type_ = (size >= table_file_schema_.index_file_size_)
+                                                ? meta::TableFileSchema::TO_INDEX
+                                                : meta::TableFileSchema::RAW;
+        } else {
+            table_file_schema_.file_type_ = meta::TableFileSchema::RAW;
+        }
     }
 
-    auto status = meta_->UpdateTableFile(table_file_schema_);
+    committed = meta_->UpdateTableFilesAsync({table_file_schema_});
 
     ENGINE_LOG_DEBUG << "New " << ((table_file_schema_.file_type_ == meta::TableFileSchema::RAW) ? "raw" : "to_index")
                      << " file " << table_file_schema_.file_id_ << " of size " << size << " bytes";
@@ -114,7 +135,47 @@ MemTableFile::Serialize() {
         execution_engine_->Cache();
     }
 
-    return status;
+    return Status::OK();
+}
+
+Status
+MemTableFile::Search(int64_t n, const float* data, int64_t k, int64_t nprobe, float* distances, int64_t* labels) {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    if (execution_engine_ == nullptr) {
+        return Status(DB_ERROR, "Insert buffer file " + table_file_schema_.file_id_ + " is not initialized");
+    }
+    return execution_engine_->Search(n, data, k, nprobe, distances, labels, false);
+}
+
+Status
+MemTableFile::Search(int64_t n, const uint8_t* data, int64_t k, int64_t nprobe, float* distances, int64_t* labels) {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    if (execution_engine_ == nullptr) {
+        return Status(DB_ERROR, "Insert buffer file " + table_file_schema_.file_id_ + " is not initialized");
+    }
+    return execution_engine_->Search(n, data, k, nprobe, distances, labels, false);
+}
+
+Status
+MemTableFile::RangeSearch(int64_t n, const float* data, float radius, int64_t nprobe, std::vector<int64_t>& lims,
+                          std::vector<int64_t>& labels, std::vector<float>& distances) {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    if (execution_engine_ == nullptr) {
+        return Status(DB_ERROR, "Insert buffer file " + table_file_schema_.file_id_ + " is not initialized");
+    }
+    return execution_engine_->RangeSearch(n, data, radius, nprobe, lims, labels, distances, false);
+}
+
+size_t
+MemTableFile::RowCount() {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    return (execution_engine_ == nullptr) ? 0 : execution_engine_->Count();
+}
+
+meta::TableFileSchema
+MemTableFile::GetTableFileSchema() {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    return table_file_schema_;
 }
 
 }  // namespace engine
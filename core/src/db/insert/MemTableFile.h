@@ -16,8 +16,12 @@
 #include "db/meta/Meta.h"
 #include "utils/Status.h"
 
+#include <future>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <vector>
 
 namespace milvus {
 namespace engine {
@@ -41,6 +45,27 @@ class MemTableFile {
     Status
     Serialize();
 
+    // write the file and queue its meta update, committed is set once the file shows in meta
+    Status
+    Serialize(std::future<Status>& committed);
+
+    // search the vectors buffered in this file, thread-safe against concurrent Add
+    Status
+    Search(int64_t n, const float* data, int64_t k, int64_t nprobe, float* distances, int64_t* labels);
+
+    Status
+    Search(int64_t n, const uint8_t* data, int64_t k, int64_t nprobe, float* distances, int64_t* labels);
+
+    Status
+    RangeSearch(int64_t n, const float* data, float radius, int64_t nprobe, std::vector<int64_t>& lims,
+                std::vector<int64_t>& labels, std::vector<float>& distances);
+
+    size_t
+    RowCount();
+
+    meta::TableFileSchema
+    GetTableFileSchema();
+
  private:
     Status
     CreateTableFile();
@@ -53,6 +78,9 @@ class MemTableFile {
     size_t current_mem_;
 
     ExecutionEnginePtr execution_engine_;
+
+    // Add() takes exclusive lock, Search() and Serialize() share it
+    std::shared_timed_mutex mutex_;
 };  // MemTableFile
 
 using MemTableFilePtr = std::shared_ptr<MemTableFile>;
@@ -0,0 +1,357 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#include "db/meta/CachedMetaImpl.h"
+#include "db/meta/MetaConsts.h"
+
+#include <set>
+#include <utility>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+namespace {
+
+bool
+IsSearchable(int file_type) {
+    return file_type == (int)TableFileSchema::RAW || file_type == (int)TableFileSchema::TO_INDEX ||
+           file_type == (int)TableFileSchema::INDEX;
+}
+
+}  // namespace
+
+CachedMetaImpl::CachedMetaImpl(MetaPtr meta, int64_t commit_delay_ms) : meta_(std::move(meta)) {
+    write_queue_ = std::make_unique<MetaWriteQueue>([this](TableFilesSchema& files) { return UpdateTableFiles(files); },
+                                                    commit_delay_ms, MAX_WRITE_BATCH_SIZE);
+}
+
+uint64_t
+CachedMetaImpl::Version() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return version_;
+}
+
+void
+CachedMetaImpl::InvalidateTable(const std::string& table_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++version_;
+    tables_.erase(table_id);
+    files_.erase(table_id);
+    partitions_.clear();
+}
+
+void
+CachedMetaImpl::InvalidateFiles(const std::string& table_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++version_;
+    files_.erase(table_id);
+}
+
+void
+CachedMetaImpl::InvalidateAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++version_;
+    tables_.clear();
+    files_.clear();
+    partitions_.clear();
+}
+
+Status
+CachedMetaImpl::CreateTable(TableSchema& table_schema) {
+    auto status = meta_->CreateTable(table_schema);
+    InvalidateTable(table_schema.table_id_);
+    return status;
+}
+
+Status
+CachedMetaImpl::DescribeTable(TableSchema& table_schema) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = tables_.find(table_schema.table_id_);
+        if (iter != tables_.end()) {
+            table_schema = iter->second;
+            return Status::OK();
+        }
+    }
+
+    auto version = Version();
+    auto status = meta_->DescribeTable(table_schema);
+    if (status.ok()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (version == version_) {
+            tables_[table_schema.table_id_] = table_schema;
+        }
+    }
+    return status;
+}
+
+Status
+CachedMetaImpl::HasTable(const std::string& table_id, bool& has_or_not) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (tables_.find(table_id) != tables_.end()) {
+            has_or_not = true;
+            return Status::OK();
+        }
+    }
+    return meta_->HasTable(table_id, has_or_not);
+}
+
+Status
+CachedMetaImpl::AllTables(std::vector<TableSchema>& table_schema_array) {
+    return meta_->AllTables(table_schema_array);
+}
+
+Status
+CachedMetaImpl::DropTable(const std::string& table_id) {
+    auto status = meta_->DropTable(table_id);
+    InvalidateTable(table_id);
+    return status;
+}
+
+Status
+CachedMetaImpl::DeleteTableFiles(const std::string& table_id) {
+    auto status = meta_->DeleteTableFiles(table_id);
+    InvalidateFiles(table_id);
+    return status;
+}
+
+Status
+CachedMetaImpl::CreateTableFile(TableFileSchema& file_schema) {
+    auto status = meta_->CreateTableFile(file_schema);
+    // new files only become searchable through UpdateTableFile(s), unless created searchable right away
+    if (IsSearchable(file_schema.file_type_)) {
+        InvalidateFiles(file_schema.table_id_);
+    }
+    return status;
+}
+
+Status
+CachedMetaImpl::DropDataByDate(const std::string& table_id, const DatesT& dates) {
+    auto status = meta_->DropDataByDate(table_id, dates);
+    InvalidateFiles(table_id);
+    return status;
+}
+
+Status
+CachedMetaImpl::GetTableFiles(const std::string& table_id, const std::vector<size_t>& ids,
+                              TableFilesSchema& table_files) {
+    return meta_->GetTableFiles(table_id, ids, table_files);
+}
+
+Status
+CachedMetaImpl::UpdateTableIndex(const std::string& table_id, const TableIndex& index) {
+    auto status = meta_->UpdateTableIndex(table_id, index);
+    InvalidateTable(table_id);
+    return status;
+}
+
+Status
+CachedMetaImpl::UpdateTableFlag(const std::string& table_id, int64_t flag) {
+    auto status = meta_->UpdateTableFlag(table_id, flag);
+    InvalidateTable(table_id);
+    return status;
+}
+
+Status
+CachedMetaImpl::UpdateTableFile(TableFileSchema& file_schema) {
+    auto status = meta_->UpdateTableFile(file_schema);
+    InvalidateFiles(file_schema.table_id_);
+    return status;
+}
+
+Status
+CachedMetaImpl::UpdateTableFilesToIndex(const std::string& table_id) {
+    auto status = meta_->UpdateTableFilesToIndex(table_id);
+    InvalidateFiles(table_id);
+    return status;
+}
+
+Status
+CachedMetaImpl::UpdateTableFiles(TableFilesSchema& files) {
+    auto status = meta_->UpdateTableFiles(files);
+    std::set<std::string> table_ids;
+    for (auto& file : files) {
+        table_ids.insert(file.table_id_);
+    }
+    for (auto& table_id : table_ids) {
+        InvalidateFiles(table_id);
+    }
+    return status;
+}
+
+std::future<Status>
+CachedMetaImpl::UpdateTableFilesAsync(const TableFilesSchema& files) {
+    return write_queue_->Put(files);
+}
+
+Status
+CachedMetaImpl::DescribeTableIndex(const std::string& table_id, TableIndex& index) {
+    return meta_->DescribeTableIndex(table_id, index);
+}
+
+Status
+CachedMetaImpl::DropTableIndex(const std::string& table_id) {
+    auto status = meta_->DropTableIndex(table_id);
+    InvalidateTable(table_id);
+    return status;
+}
+
+Status
+CachedMetaImpl::CreatePartition(const std::string& table_id, const std::string& partition_name,
+                                const std::string& tag) {
+    auto status = meta_->CreatePartition(table_id, partition_name, tag);
+    InvalidateTable(partition_name);
+    return status;
+}
+
+Status
+CachedMetaImpl::DropPartition(const std::string& partition_name) {
+    auto status = meta_->DropPartition(partition_name);
+    InvalidateTable(partition_name);
+    return status;
+}
+
+Status
+CachedMetaImpl::ShowPartitions(const std::string& table_id, std::vector<meta::TableSchema>& partition_schema_array) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = partitions_.find(table_id);
+        if (iter != partitions_.end()) {
+            partition_schema_array.insert(partition_schema_array.end(), iter->second.begin(), iter->second.end());
+            return Status::OK();
+        }
+    }
+
+    auto version = Version();
+    std::vector<meta::TableSchema> partitions;
+    auto status = meta_->ShowPartitions(table_id, partitions);
+    if (status.ok()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (version == version_) {
+            partitions_[table_id] = partitions;
+        }
+    }
+    partition_schema_array.insert(partition_schema_array.end(), partitions.begin(), partitions.end());
+    return status;
+}
+
+Status
+CachedMetaImpl::GetPartitionName(const std::string& table_id, const std::string& tag, std::string& partition_name) {
+    return meta_->GetPartitionName(table_id, tag, partition_name);
+}
+
+Status
+CachedMetaImpl::FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, const DatesT& dates,
+                              DatePartionedTableFilesSchema& files) {
+    files.clear();
+
+    // all searchable files of the table are cached, a query by file ids or dates is answered from them
+    DatePartionedTableFilesSchema all_files;
+    Status status;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = files_.find(table_id);
+        if (iter != files_.end()) {
+            all_files = iter->second;
+            cached = true;
+        }
+    }
+
+    if (!cached) {
+        auto version = Version();
+        status = meta_->FilesToSearch(table_id, std::vector<size_t>(), DatesT(), all_files);
+        if (!status.ok() && all_files.empty()) {
+            return status;
+        }
+        if (status.ok()) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (version == version_) {
+                files_[table_id] = all_files;
+            }
+        }
+    }
+
+    std::set<size_t> id_set(ids.begin(), ids.end());
+    std::set<DateT> date_set(dates.begin(), dates.end());
+    for (auto& date_files : all_files) {
+        if (!date_set.empty() && date_set.find(date_files.first) == date_set.end()) {
+            continue;
+        }
+        for (auto& file : date_files.second) {
+            if (!id_set.empty() && id_set.find(file.id_) == id_set.end()) {
+                continue;
+            }
+            files[date_files.first].push_back(file);
+        }
+    }
+    return status;
+}
+
+Status
+CachedMetaImpl::FilesToMerge(const std::string& table_id, DatePartionedTableFilesSchema& files) {
+    return meta_->FilesToMerge(table_id, files);
+}
+
+Status
+CachedMetaImpl::FilesToIndex(TableFilesSchema& files) {
+    return meta_->FilesToIndex(files);
+}
+
+Status
+CachedMetaImpl::FilesByType(const std::string& table_id, const std::vector<int>& file_types,
+                            TableFilesSchema& table_files) {
+    return meta_->FilesByType(table_id, file_types, table_files);
+}
+
+Status
+CachedMetaImpl::Size(uint64_t& result) {
+    return meta_->Size(result);
+}
+
+Status
+CachedMetaImpl::Archive() {
+    auto status = meta_->Archive();
+    InvalidateAll();
+    return status;
+}
+
+Status
+CachedMetaImpl::CleanUpShadowFiles() {
+    auto status = meta_->CleanUpShadowFiles();
+    InvalidateAll();
+    return status;
+}
+
+Status
+CachedMetaImpl::CleanUpFilesWithTTL(uint64_t seconds, CleanUpFilter* filter) {
+    // only removes files and tables already marked TO_DELETE, none of them is cached
+    return meta_->CleanUpFilesWithTTL(seconds, filter);
+}
+
+Status
+CachedMetaImpl::DropAll() {
+    auto status = meta_->DropAll();
+    InvalidateAll();
+    return status;
+}
+
+Status
+CachedMetaImpl::Count(const std::string& table_id, uint64_t& result) {
+    return meta_->Count(table_id, result);
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,164 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#pragma once
+
+#include "Meta.h"
+#include "MetaWriteQueue.h"
+#include "db/Options.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+/*
+ * Write-through cache in front of another meta, serving table schemas, partition lists and searchable files from
+ * memory so queries are planned without a round trip to the backend. Every write goes to the backend first and
+ * then drops the cached entries it may have changed. A read filling the cache only stores its result if no write
+ * happened meanwhile, so a fill racing with a write never leaves stale data behind.
+ * Writes of other processes are not seen, the cache must only be used by the single writer of the meta.
+ */
+class CachedMetaImpl : public Meta {
+ public:
+    CachedMetaImpl(MetaPtr meta, int64_t commit_delay_ms);
+
+    Status
+    CreateTable(TableSchema& table_schema) override;
+
+    Status
+    DescribeTable(TableSchema& table_schema) override;
+
+    Status
+    HasTable(const std::string& table_id, bool& has_or_not) override;
+
+    Status
+    AllTables(std::vector<TableSchema>& table_schema_array) override;
+
+    Status
+    DropTable(const std::string& table_id) override;
+
+    Status
+    DeleteTableFiles(const std::string& table_id) override;
+
+    Status
+    CreateTableFile(TableFileSchema& file_schema) override;
+
+    Status
+    DropDataByDate(const std::string& table_id, const DatesT& dates) override;
+
+    Status
+    GetTableFiles(const std::string& table_id, const std::vector<size_t>& ids, TableFilesSchema& table_files) override;
+
+    Status
+    UpdateTableIndex(const std::string& table_id, const TableIndex& index) override;
+
+    Status
+    UpdateTableFlag(const std::string& table_id, int64_t flag) override;
+
+    Status
+    UpdateTableFile(TableFileSchema& file_schema) override;
+
+    Status
+    UpdateTableFilesToIndex(const std::string& table_id) override;
+
+    Status
+    UpdateTableFiles(TableFilesSchema& files) override;
+
+    std::future<Status>
+    UpdateTableFilesAsync(const TableFilesSchema& files) override;
+
+    Status
+    DescribeTableIndex(const std::string& table_id, TableIndex& index) override;
+
+    Status
+    DropTableIndex(const std::string& table_id) override;
+
+    Status
+    CreatePartition(const std::string& table_id, const std::string& partition_name, const std::string& tag) override;
+
+    Status
+    DropPartition(const std::string& partition_name) override;
+
+    Status
+    ShowPartitions(const std::string& table_id, std::vector<meta::TableSchema>& partition_schema_array) override;
+
+    Status
+    GetPartitionName(const std::string& table_id, const std::string& tag, std::string& partition_name) override;
+
+    Status
+    FilesToSearch(const std::string& table_id, const std::vector<size_t>& ids, const DatesT& dates,
+                  DatePartionedTableFilesSchema& files) override;
+
+    Status
+    FilesToMerge(const std::string& table_id, DatePartionedTableFilesSchema& files) override;
+
+    Status
+    FilesToIndex(TableFilesSchema&) override;
+
+    Status
+    FilesByType(const std::string& table_id, const std::vector<int>& file_types,
+                TableFilesSchema& table_files) override;
+
+    Status
+    Size(uint64_t& result) override;
+
+    Status
+    Archive() override;
+
+    Status
+    CleanUpShadowFiles() override;
+
+    Status
+    CleanUpFilesWithTTL(uint64_t seconds, CleanUpFilter* filter = nullptr) override;
+
+    Status
+    DropAll() override;
+
+    Status
+    Count(const std::string& table_id, uint64_t& result) override;
+
+ private:
+    uint64_t
+    Version();
+
+    // schema and files of the table, and every partition list since partitions carry a copy of their schema
+    void
+    InvalidateTable(const std::string& table_id);
+
+    void
+    InvalidateFiles(const std::string& table_id);
+
+    void
+    InvalidateAll();
+
+ private:
+    MetaPtr meta_;
+
+    std::mutex mutex_;
+    uint64_t version_ = 0;
+    std::unordered_map<std::string, TableSchema> tables_;
+    std::unordered_map<std::string, std::vector<TableSchema>> partitions_;
+    std::unordered_map<std::string, DatePartionedTableFilesSchema> files_;
+
+    // own group commit, the cache is invalidated once a batch is committed
+    std::unique_ptr<MetaWriteQueue> write_queue_;
+};  // CachedMetaImpl
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -17,6 +17,7 @@
 #include "utils/Status.h"
 
 #include <cstddef>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -75,6 +76,10 @@ class Meta {
     virtual Status
     UpdateTableFiles(TableFilesSchema& files) = 0;
 
+    // queue the update, updates queued close together are committed in one transaction
+    virtual std::future<Status>
+    UpdateTableFilesAsync(const TableFilesSchema& files) = 0;
+
     virtual Status
     UpdateTableIndex(const std::string& table_id, const TableIndex& index) = 0;
 
@@ -33,6 +33,10 @@ const size_t WEEK = 7 * DAY;
 // We decide the value based on a testing for small size raw/index files.
 const size_t BUILD_INDEX_THRESHOLD = 5000;
 
+// Files committed in one transaction by the meta write queue at most, a larger batch is split between updates.
+// A single update with more files is still committed whole.
+const size_t MAX_WRITE_BATCH_SIZE = 1000;
+
 }  // namespace meta
 }  // namespace engine
 }  // namespace milvus
@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "db/meta/MetaFactory.h"
+#include "CachedMetaImpl.h"
 #include "MySQLMetaImpl.h"
 #include "SqliteMetaImpl.h"
 #include "db/Utils.h"
@@ -54,16 +55,24 @@ MetaFactory::Build(const DBMetaOptions& metaOptions, const int& mode) {
         throw InvalidArgumentException("Wrong URI format ");
     }
 
+    meta::MetaPtr meta;
     if (strcasecmp(uri_info.dialect_.c_str(), "mysql") == 0) {
         ENGINE_LOG_INFO << "Using MySQL";
-        return std::make_shared<meta::MySQLMetaImpl>(metaOptions, mode);
+        meta = std::make_shared<meta::MySQLMetaImpl>(metaOptions, mode);
     } else if (strcasecmp(uri_info.dialect_.c_str(), "sqlite") == 0) {
         ENGINE_LOG_INFO << "Using SQLite";
-        return std::make_shared<meta::SqliteMetaImpl>(metaOptions);
+        meta = std::make_shared<meta::SqliteMetaImpl>(metaOptions);
     } else {
         ENGINE_LOG_ERROR << "Invalid dialect in URI: dialect = " << uri_info.dialect_;
         throw InvalidArgumentException("URI dialect is not mysql / sqlite");
     }
+
+    // a read only node doesn't see the writes of the writable one, its cache would never be invalidated
+    if (metaOptions.cache_enable_ && mode != DBOptions::MODE::CLUSTER_READONLY) {
+        ENGINE_LOG_INFO << "Using meta cache";
+        meta = std::make_shared<meta::CachedMetaImpl>(meta, metaOptions.commit_delay_);
+    }
+    return meta;
 }
 
 }  // namespace engine
@@ -0,0 +1,103 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#include "db/meta/MetaWriteQueue.h"
+#include "utils/Log.h"
+
+#include <chrono>
+#include <iterator>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+MetaWriteQueue::MetaWriteQueue(CommitFunc commit, int64_t max_delay_ms, int64_t max_batch_size)
+    : commit_(std::move(commit)), max_delay_ms_(max_delay_ms), max_batch_size_(max_batch_size) {
+}
+
+MetaWriteQueue::~MetaWriteQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (committer_.joinable()) {
+        committer_.join();
+    }
+}
+
+std::future<Status>
+MetaWriteQueue::Put(const TableFilesSchema& files) {
+    std::promise<Status> promise;
+    auto future = promise.get_future();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // the committer is started by the first write, a read only meta never runs one
+        if (!committer_.joinable()) {
+            committer_ = std::thread(&MetaWriteQueue::CommitLoop, this);
+        }
+        pending_file_count_ += files.size();
+        pending_.emplace_back(files, std::move(promise));
+    }
+    cv_.notify_all();
+    return future;
+}
+
+void
+MetaWriteQueue::CommitLoop() {
+    bool backlog = false;
+    while (true) {
+        std::vector<std::pair<TableFilesSchema, std::promise<Status>>> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [&] { return stop_ || !pending_.empty(); });
+            if (pending_.empty()) {
+                return;
+            }
+
+            // let more updates join, a full batch, a backlog left by the last batch or stopping commits at once
+            if (!backlog) {
+                auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(max_delay_ms_);
+                cv_.wait_until(lock, deadline, [&] { return stop_ || pending_file_count_ >= max_batch_size_; });
+            }
+
+            // take whole updates up to max_batch_size_ files, an update is never split over two transactions
+            int64_t batch_file_count = 0;
+            auto end = pending_.begin();
+            while (end != pending_.end() &&
+                   (end == pending_.begin() || batch_file_count + (int64_t)end->first.size() <= max_batch_size_)) {
+                batch_file_count += end->first.size();
+                ++end;
+            }
+            batch.assign(std::make_move_iterator(pending_.begin()), std::make_move_iterator(end));
+            pending_.erase(pending_.begin(), end);
+            pending_file_count_ -= batch_file_count;
+            backlog = !pending_.empty();
+        }
+
+        TableFilesSchema files;
+        for (auto& item : batch) {
+            files.insert(files.end(), item.first.begin(), item.first.end());
+        }
+        auto status = commit_(files);
+        if (batch.size() > 1) {
+            ENGINE_LOG_DEBUG << "Group commit " << files.size() << " table files of " << batch.size() << " updates";
+        }
+        for (auto& item : batch) {
+            item.second.set_value(status);
+        }
+    }
+}
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -0,0 +1,66 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+
+#pragma once
+
+#include "MetaTypes.h"
+#include "utils/Status.h"
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace milvus {
+namespace engine {
+namespace meta {
+
+/*
+ * Group commit of file updates. Updates queued by concurrent callers are handed to the commit function together,
+ * so they land in one transaction and one disk sync. The first update of a batch waits at most max_delay_ms for
+ * others to join. Each caller gets a future set to the status of the transaction its files went in.
+ */
+class MetaWriteQueue {
+ public:
+    using CommitFunc = std::function<Status(TableFilesSchema&)>;
+
+    MetaWriteQueue(CommitFunc commit, int64_t max_delay_ms, int64_t max_batch_size);
+
+    // commits what is still queued before returning
+    ~MetaWriteQueue();
+
+    std::future<Status>
+    Put(const TableFilesSchema& files);
+
+ private:
+    void
+    CommitLoop();
+
+ private:
+    CommitFunc commit_;
+    int64_t max_delay_ms_;
+    int64_t max_batch_size_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<std::pair<TableFilesSchema, std::promise<Status>>> pending_;
+    int64_t pending_file_count_ = 0;
+    bool stop_ = false;
+    std::thread committer_;
+};  // MetaWriteQueue
+
+}  // namespace meta
+}  // namespace engine
+}  // namespace milvus
@@ -167,6 +167,8 @@ static const MetaSchema TABLEFILES_SCHEMA(META_TABLEFILES, {
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 MySQLMetaImpl::MySQLMetaImpl(const DBMetaOptions& options, const int& mode) : options_(options), mode_(mode) {
     Initialize();
+    write_queue_ = std::make_unique<MetaWriteQueue>([this](TableFilesSchema& files) { return UpdateTableFiles(files); },
+                                                    options_.commit_delay_, MAX_WRITE_BATCH_SIZE);
 }
 
 MySQLMetaImpl::~MySQLMetaImpl() {
@@ -661,6 +663,7 @@ MySQLMetaImpl::CreateTableFile(TableFileSchema& file_schema) {
         file_schema.index_file_size_ = table_schema.index_file_size_;
         file_schema.engine_type_ = table_schema.engine_type_;
         file_schema.nlist_ = table_schema.nlist_;
+        file_schema.table_created_on_ = table_schema.created_on_;
         file_schema.metric_type_ = table_schema.metric_type_;
 
         std::string id = "NULL";  // auto-increment
@@ -813,6 +816,7 @@ MySQLMetaImpl::GetTableFiles(const std::string& table_id, const std::vector<size
             file_schema.index_file_size_ = table_schema.index_file_size_;
             file_schema.engine_type_ = resRow["engine_type"];
             file_schema.nlist_ = table_schema.nlist_;
+            file_schema.table_created_on_ = table_schema.created_on_;
             file_schema.metric_type_ = table_schema.metric_type_;
             resRow["file_id"].to_string(file_schema.file_id_);
             file_schema.file_type_ = resRow["file_type"];
@@ -1107,6 +1111,11 @@ MySQLMetaImpl::UpdateTableFiles(TableFilesSchema& files) {
     return Status::OK();
 }
 
+std::future<Status>
+MySQLMetaImpl::UpdateTableFilesAsync(const TableFilesSchema& files) {
+    return write_queue_->Put(files);
+}
+
 Status
 MySQLMetaImpl::DescribeTableIndex(const std::string& table_id, TableIndex& index) {
     try {
@@ -1417,6 +1426,7 @@ MySQLMetaImpl::FilesToSearch(const std::string& table_id, const std::vector<size
             table_file.index_file_size_ = table_schema.index_file_size_;
             table_file.engine_type_ = resRow["engine_type"];
             table_file.nlist_ = table_schema.nlist_;
+            table_file.table_created_on_ = table_schema.created_on_;
             table_file.metric_type_ = table_schema.metric_type_;
             resRow["file_id"].to_string(table_file.file_id_);
             table_file.file_type_ = resRow["file_type"];
@@ -1502,6 +1512,7 @@ MySQLMetaImpl::FilesToMerge(const std::string& table_id, DatePartionedTableFiles
             table_file.index_file_size_ = table_schema.index_file_size_;
             table_file.engine_type_ = resRow["engine_type"];
             table_file.nlist_ = table_schema.nlist_;
+            table_file.table_created_on_ = table_schema.created_on_;
             table_file.metric_type_ = table_schema.metric_type_;
             table_file.created_on_ = resRow["created_on"];
             table_file.dimension_ = table_schema.dimension_;
@@ -1584,6 +1595,7 @@ MySQLMetaImpl::FilesToIndex(TableFilesSchema& files) {
             table_file.dimension_ = groups[table_file.table_id_].dimension_;
             table_file.index_file_size_ = groups[table_file.table_id_].index_file_size_;
             table_file.nlist_ = groups[table_file.table_id_].nlist_;
+            table_file.table_created_on_ = groups[table_file.table_id_].created_on_;
             table_file.metric_type_ = groups[table_file.table_id_].metric_type_;
 
             auto status = utils::GetTableFilePath(options_, table_file);
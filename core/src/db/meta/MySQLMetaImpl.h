@@ -12,6 +12,7 @@
 #pragma once
 
 #include "Meta.h"
+#include "MetaWriteQueue.h"
 #include "MySQLConnectionPool.h"
 #include "db/Options.h"
 
@@ -72,6 +73,9 @@ class MySQLMetaImpl : public Meta {
     Status
     UpdateTableFiles(TableFilesSchema& files) override;
 
+    std::future<Status>
+    UpdateTableFilesAsync(const TableFilesSchema& files) override;
+
     Status
     DescribeTableIndex(const std::string& table_id, TableIndex& index) override;
 
@@ -144,6 +148,9 @@ class MySQLMetaImpl : public Meta {
 
     std::mutex genid_mutex_;
     //        std::mutex connectionMutex_;
+
+    // last member, pending writes are committed before the rest is destroyed
+    std::unique_ptr<MetaWriteQueue> write_queue_;
 };  // DBMetaImpl
 
 }  // namespace meta
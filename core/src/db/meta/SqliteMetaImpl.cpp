@@ -88,6 +88,8 @@ static std::unique_ptr<ConnectorT> ConnectorPtr;
 
 SqliteMetaImpl::SqliteMetaImpl(const DBMetaOptions& options) : options_(options) {
     Initialize();
+    write_queue_ = std::make_unique<MetaWriteQueue>([this](TableFilesSchema& files) { return UpdateTableFiles(files); },
+                                                    options_.commit_delay_, MAX_WRITE_BATCH_SIZE);
 }
 
 SqliteMetaImpl::~SqliteMetaImpl() {
@@ -387,6 +389,7 @@ SqliteMetaImpl::CreateTableFile(TableFileSchema& file_schema) {
         file_schema.index_file_size_ = table_schema.index_file_size_;
         file_schema.engine_type_ = table_schema.engine_type_;
         file_schema.nlist_ = table_schema.nlist_;
+        file_schema.table_created_on_ = table_schema.created_on_;
         file_schema.metric_type_ = table_schema.metric_type_;
 
         //multi-threads call sqlite update may get exception('bad logic', etc), so we add a lock here
@@ -498,6 +501,7 @@ SqliteMetaImpl::GetTableFiles(const std::string& table_id,
             file_schema.dimension_ = table_schema.dimension_;
             file_schema.index_file_size_ = table_schema.index_file_size_;
             file_schema.nlist_ = table_schema.nlist_;
+            file_schema.table_created_on_ = table_schema.created_on_;
             file_schema.metric_type_ = table_schema.metric_type_;
 
             utils::GetTableFilePath(options_, file_schema);
@@ -611,6 +615,11 @@ SqliteMetaImpl::UpdateTableFiles(TableFilesSchema& files) {
     return Status::OK();
 }
 
+std::future<Status>
+SqliteMetaImpl::UpdateTableFilesAsync(const TableFilesSchema& files) {
+    return write_queue_->Put(files);
+}
+
 Status
 SqliteMetaImpl::UpdateTableIndex(const std::string& table_id, const TableIndex& index) {
     try {
@@ -964,6 +973,7 @@ SqliteMetaImpl::FilesToSearch(const std::string& table_id,
             table_file.dimension_ = table_schema.dimension_;
             table_file.index_file_size_ = table_schema.index_file_size_;
             table_file.nlist_ = table_schema.nlist_;
+            table_file.table_created_on_ = table_schema.created_on_;
             table_file.metric_type_ = table_schema.metric_type_;
 
             auto status = utils::GetTableFilePath(options_, table_file);
@@ -1035,6 +1045,7 @@ SqliteMetaImpl::FilesToMerge(const std::string& table_id, DatePartionedTableFile
             table_file.dimension_ = table_schema.dimension_;
             table_file.index_file_size_ = table_schema.index_file_size_;
             table_file.nlist_ = table_schema.nlist_;
+            table_file.table_created_on_ = table_schema.created_on_;
             table_file.metric_type_ = table_schema.metric_type_;
 
             auto status = utils::GetTableFilePath(options_, table_file);
@@ -1115,6 +1126,7 @@ SqliteMetaImpl::FilesToIndex(TableFilesSchema& files) {
             table_file.dimension_ = groups[table_file.table_id_].dimension_;
             table_file.index_file_size_ = groups[table_file.table_id_].index_file_size_;
             table_file.nlist_ = groups[table_file.table_id_].nlist_;
+            table_file.table_created_on_ = groups[table_file.table_id_].created_on_;
             table_file.metric_type_ = groups[table_file.table_id_].metric_type_;
             files.push_back(table_file);
         }
@@ -12,8 +12,10 @@
 #pragma once
 
 #include "Meta.h"
+#include "MetaWriteQueue.h"
 #include "db/Options.h"
 
+#include <memory>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -72,6 +74,9 @@ class SqliteMetaImpl : public Meta {
     Status
     UpdateTableFiles(TableFilesSchema& files) override;
 
+    std::future<Status>
+    UpdateTableFilesAsync(const TableFilesSchema& files) override;
+
     Status
     DescribeTableIndex(const std::string& table_id, TableIndex& index) override;
 
@@ -139,6 +144,9 @@ class SqliteMetaImpl : public Meta {
     const DBMetaOptions options_;
     std::mutex meta_mutex_;
     std::mutex genid_mutex_;
+
+    // last member, pending writes are committed before the rest is destroyed
+    std::unique_ptr<MetaWriteQueue> write_queue_;
 };  // DBMetaImpl
 
 }  // namespace meta
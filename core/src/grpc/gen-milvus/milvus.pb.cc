@@ -103,6 +103,10 @@ class DeleteByDateParamDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DeleteByDateParam> _instance;
 } _DeleteByDateParam_default_instance_;
+class DeleteByIDParamDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DeleteByIDParam> _instance;
+} _DeleteByIDParam_default_instance_;
 }  // namespace grpc
 }  // namespace milvus
 static void InitDefaultsscc_info_BoolReply_milvus_2eproto() {
@@ -149,6 +153,20 @@ static void InitDefaultsscc_info_DeleteByDateParam_milvus_2eproto() {
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_DeleteByDateParam_milvus_2eproto}, {
       &scc_info_Range_milvus_2eproto.base,}};
 
+static void InitDefaultsscc_info_DeleteByIDParam_milvus_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::milvus::grpc::_DeleteByIDParam_default_instance_;
+    new (ptr) ::milvus::grpc::DeleteByIDParam();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::milvus::grpc::DeleteByIDParam::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DeleteByIDParam_milvus_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, InitDefaultsscc_info_DeleteByIDParam_milvus_2eproto}, {}};
+
 static void InitDefaultsscc_info_Index_milvus_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -401,7 +419,7 @@ static void InitDefaultsscc_info_VectorIds_milvus_2eproto() {
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, InitDefaultsscc_info_VectorIds_milvus_2eproto}, {
       &scc_info_Status_status_2eproto.base,}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_milvus_2eproto[20];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_milvus_2eproto[21];
 static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_milvus_2eproto = nullptr;
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_milvus_2eproto = nullptr;
 
@@ -473,6 +491,9 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROT
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertParam, row_record_array_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertParam, row_id_array_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertParam, partition_tag_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertParam, packed_float_data_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertParam, packed_binary_data_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::InsertParam, packed_dimension_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::VectorIds, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -491,6 +512,11 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROT
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::SearchParam, topk_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::SearchParam, nprobe_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::SearchParam, partition_tag_array_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::SearchParam, packed_float_data_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::SearchParam, packed_binary_data_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::SearchParam, packed_dimension_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::SearchParam, radius_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::SearchParam, refine_factor_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::SearchInFilesParam, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -507,6 +533,7 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROT
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::TopKQueryResult, row_num_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::TopKQueryResult, ids_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::TopKQueryResult, distances_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::TopKQueryResult, lims_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::StringReply, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -556,6 +583,13 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_milvus_2eproto::offsets[] PROT
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::DeleteByDateParam, range_),
   PROTOBUF_FIELD_OFFSET(::milvus::grpc::DeleteByDateParam, table_name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::DeleteByIDParam, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::DeleteByIDParam, table_name_),
+  PROTOBUF_FIELD_OFFSET(::milvus::grpc::DeleteByIDParam, id_array_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::milvus::grpc::TableName)},
@@ -567,17 +601,18 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 44, -1, sizeof(::milvus::grpc::Range)},
   { 51, -1, sizeof(::milvus::grpc::RowRecord)},
   { 58, -1, sizeof(::milvus::grpc::InsertParam)},
-  { 67, -1, sizeof(::milvus::grpc::VectorIds)},
-  { 74, -1, sizeof(::milvus::grpc::SearchParam)},
-  { 85, -1, sizeof(::milvus::grpc::SearchInFilesParam)},
-  { 92, -1, sizeof(::milvus::grpc::TopKQueryResult)},
-  { 101, -1, sizeof(::milvus::grpc::StringReply)},
-  { 108, -1, sizeof(::milvus::grpc::BoolReply)},
-  { 115, -1, sizeof(::milvus::grpc::TableRowCount)},
-  { 122, -1, sizeof(::milvus::grpc::Command)},
-  { 128, -1, sizeof(::milvus::grpc::Index)},
-  { 135, -1, sizeof(::milvus::grpc::IndexParam)},
-  { 143, -1, sizeof(::milvus::grpc::DeleteByDateParam)},
+  { 70, -1, sizeof(::milvus::grpc::VectorIds)},
+  { 77, -1, sizeof(::milvus::grpc::SearchParam)},
+  { 93, -1, sizeof(::milvus::grpc::SearchInFilesParam)},
+  { 100, -1, sizeof(::milvus::grpc::TopKQueryResult)},
+  { 110, -1, sizeof(::milvus::grpc::StringReply)},
+  { 117, -1, sizeof(::milvus::grpc::BoolReply)},
+  { 124, -1, sizeof(::milvus::grpc::TableRowCount)},
+  { 131, -1, sizeof(::milvus::grpc::Command)},
+  { 137, -1, sizeof(::milvus::grpc::Index)},
+  { 144, -1, sizeof(::milvus::grpc::IndexParam)},
+  { 152, -1, sizeof(::milvus::grpc::DeleteByDateParam)},
+  { 159, -1, sizeof(::milvus::grpc::DeleteByIDParam)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -601,6 +636,7 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_Index_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_IndexParam_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_DeleteByDateParam_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::milvus::grpc::_DeleteByIDParam_default_instance_),
 };
 
 const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -619,72 +655,83 @@ const char descriptor_table_protodef_milvus_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "(\0132\033.milvus.grpc.PartitionParam\"/\n\005Range"
   "\022\023\n\013start_value\030\001 \001(\t\022\021\n\tend_value\030\002 \001(\t"
   "\"4\n\tRowRecord\022\022\n\nfloat_data\030\001 \003(\002\022\023\n\013bin"
-  "ary_data\030\002 \001(\014\"\200\001\n\013InsertParam\022\022\n\ntable_"
+  "ary_data\030\002 \001(\014\"\321\001\n\013InsertParam\022\022\n\ntable_"
   "name\030\001 \001(\t\0220\n\020row_record_array\030\002 \003(\0132\026.m"
   "ilvus.grpc.RowRecord\022\024\n\014row_id_array\030\003 \003"
-  "(\003\022\025\n\rpartition_tag\030\004 \001(\t\"I\n\tVectorIds\022#"
-  "\n\006status\030\001 \001(\0132\023.milvus.grpc.Status\022\027\n\017v"
-  "ector_id_array\030\002 \003(\003\"\277\001\n\013SearchParam\022\022\n\n"
-  "table_name\030\001 \001(\t\0222\n\022query_record_array\030\002"
-  " \003(\0132\026.milvus.grpc.RowRecord\022-\n\021query_ra"
-  "nge_array\030\003 \003(\0132\022.milvus.grpc.Range\022\014\n\004t"
-  "opk\030\004 \001(\003\022\016\n\006nprobe\030\005 \001(\003\022\033\n\023partition_t"
-  "ag_array\030\006 \003(\t\"[\n\022SearchInFilesParam\022\025\n\r"
-  "file_id_array\030\001 \003(\t\022.\n\014search_param\030\002 \001("
-  "\0132\030.milvus.grpc.SearchParam\"g\n\017TopKQuery"
-  "Result\022#\n\006status\030\001 \001(\0132\023.milvus.grpc.Sta"
-  "tus\022\017\n\007row_num\030\002 \001(\003\022\013\n\003ids\030\003 \003(\003\022\021\n\tdis"
-  "tances\030\004 \003(\002\"H\n\013StringReply\022#\n\006status\030\001 "
-  "\001(\0132\023.milvus.grpc.Status\022\024\n\014string_reply"
-  "\030\002 \001(\t\"D\n\tBoolReply\022#\n\006status\030\001 \001(\0132\023.mi"
-  "lvus.grpc.Status\022\022\n\nbool_reply\030\002 \001(\010\"M\n\r"
-  "TableRowCount\022#\n\006status\030\001 \001(\0132\023.milvus.g"
-  "rpc.Status\022\027\n\017table_row_count\030\002 \001(\003\"\026\n\007C"
-  "ommand\022\013\n\003cmd\030\001 \001(\t\"*\n\005Index\022\022\n\nindex_ty"
-  "pe\030\001 \001(\005\022\r\n\005nlist\030\002 \001(\005\"h\n\nIndexParam\022#\n"
-  "\006status\030\001 \001(\0132\023.milvus.grpc.Status\022\022\n\nta"
-  "ble_name\030\002 \001(\t\022!\n\005index\030\003 \001(\0132\022.milvus.g"
-  "rpc.Index\"J\n\021DeleteByDateParam\022!\n\005range\030"
-  "\001 \001(\0132\022.milvus.grpc.Range\022\022\n\ntable_name\030"
-  "\002 \001(\t2\272\t\n\rMilvusService\022>\n\013CreateTable\022\030"
-  ".milvus.grpc.TableSchema\032\023.milvus.grpc.S"
-  "tatus\"\000\022<\n\010HasTable\022\026.milvus.grpc.TableN"
-  "ame\032\026.milvus.grpc.BoolReply\"\000\022C\n\rDescrib"
-  "eTable\022\026.milvus.grpc.TableName\032\030.milvus."
-  "grpc.TableSchema\"\000\022B\n\nCountTable\022\026.milvu"
-  "s.grpc.TableName\032\032.milvus.grpc.TableRowC"
-  "ount\"\000\022@\n\nShowTables\022\024.milvus.grpc.Comma"
-  "nd\032\032.milvus.grpc.TableNameList\"\000\022:\n\tDrop"
-  "Table\022\026.milvus.grpc.TableName\032\023.milvus.g"
-  "rpc.Status\"\000\022=\n\013CreateIndex\022\027.milvus.grp"
-  "c.IndexParam\032\023.milvus.grpc.Status\"\000\022B\n\rD"
-  "escribeIndex\022\026.milvus.grpc.TableName\032\027.m"
-  "ilvus.grpc.IndexParam\"\000\022:\n\tDropIndex\022\026.m"
-  "ilvus.grpc.TableName\032\023.milvus.grpc.Statu"
-  "s\"\000\022E\n\017CreatePartition\022\033.milvus.grpc.Par"
-  "titionParam\032\023.milvus.grpc.Status\"\000\022F\n\016Sh"
-  "owPartitions\022\026.milvus.grpc.TableName\032\032.m"
-  "ilvus.grpc.PartitionList\"\000\022C\n\rDropPartit"
-  "ion\022\033.milvus.grpc.PartitionParam\032\023.milvu"
-  "s.grpc.Status\"\000\022<\n\006Insert\022\030.milvus.grpc."
-  "InsertParam\032\026.milvus.grpc.VectorIds\"\000\022B\n"
-  "\006Search\022\030.milvus.grpc.SearchParam\032\034.milv"
-  "us.grpc.TopKQueryResult\"\000\022P\n\rSearchInFil"
-  "es\022\037.milvus.grpc.SearchInFilesParam\032\034.mi"
-  "lvus.grpc.TopKQueryResult\"\000\0227\n\003Cmd\022\024.mil"
-  "vus.grpc.Command\032\030.milvus.grpc.StringRep"
-  "ly\"\000\022E\n\014DeleteByDate\022\036.milvus.grpc.Delet"
-  "eByDateParam\032\023.milvus.grpc.Status\"\000\022=\n\014P"
-  "reloadTable\022\026.milvus.grpc.TableName\032\023.mi"
-  "lvus.grpc.Status\"\000b\006proto3"
+  "(\003\022\025\n\rpartition_tag\030\004 \001(\t\022\031\n\021packed_floa"
+  "t_data\030\005 \001(\014\022\032\n\022packed_binary_data\030\006 \001(\014"
+  "\022\030\n\020packed_dimension\030\007 \001(\003\"I\n\tVectorIds\022"
+  "#\n\006status\030\001 \001(\0132\023.milvus.grpc.Status\022\027\n\017"
+  "vector_id_array\030\002 \003(\003\"\267\002\n\013SearchParam\022\022\n"
+  "\ntable_name\030\001 \001(\t\0222\n\022query_record_array\030"
+  "\002 \003(\0132\026.milvus.grpc.RowRecord\022-\n\021query_r"
+  "ange_array\030\003 \003(\0132\022.milvus.grpc.Range\022\014\n\004"
+  "topk\030\004 \001(\003\022\016\n\006nprobe\030\005 \001(\003\022\033\n\023partition_"
+  "tag_array\030\006 \003(\t\022\031\n\021packed_float_data\030\007 \001"
+  "(\014\022\032\n\022packed_binary_data\030\010 \001(\014\022\030\n\020packed"
+  "_dimension\030\t \001(\003\022\016\n\006radius\030\n \001(\002\022\025\n\rrefi"
+  "ne_factor\030\013 \001(\003\"[\n\022SearchInFilesParam\022\025\n"
+  "\rfile_id_array\030\001 \003(\t\022.\n\014search_param\030\002 \001"
+  "(\0132\030.milvus.grpc.SearchParam\"u\n\017TopKQuer"
+  "yResult\022#\n\006status\030\001 \001(\0132\023.milvus.grpc.St"
+  "atus\022\017\n\007row_num\030\002 \001(\003\022\013\n\003ids\030\003 \003(\003\022\021\n\tdi"
+  "stances\030\004 \003(\002\022\014\n\004lims\030\005 \003(\003\"H\n\013StringRep"
+  "ly\022#\n\006status\030\001 \001(\0132\023.milvus.grpc.Status\022"
+  "\024\n\014string_reply\030\002 \001(\t\"D\n\tBoolReply\022#\n\006st"
+  "atus\030\001 \001(\0132\023.milvus.grpc.Status\022\022\n\nbool_"
+  "reply\030\002 \001(\010\"M\n\rTableRowCount\022#\n\006status\030\001"
+  " \001(\0132\023.milvus.grpc.Status\022\027\n\017table_row_c"
+  "ount\030\002 \001(\003\"\026\n\007Command\022\013\n\003cmd\030\001 \001(\t\"*\n\005In"
+  "dex\022\022\n\nindex_type\030\001 \001(\005\022\r\n\005nlist\030\002 \001(\005\"h"
+  "\n\nIndexParam\022#\n\006status\030\001 \001(\0132\023.milvus.gr"
+  "pc.Status\022\022\n\ntable_name\030\002 \001(\t\022!\n\005index\030\003"
+  " \001(\0132\022.milvus.grpc.Index\"J\n\021DeleteByDate"
+  "Param\022!\n\005range\030\001 \001(\0132\022.milvus.grpc.Range"
+  "\022\022\n\ntable_name\030\002 \001(\t\"7\n\017DeleteByIDParam\022"
+  "\022\n\ntable_name\030\001 \001(\t\022\020\n\010id_array\030\002 \003(\0032\306\n"
+  "\n\rMilvusService\022>\n\013CreateTable\022\030.milvus."
+  "grpc.TableSchema\032\023.milvus.grpc.Status\"\000\022"
+  "<\n\010HasTable\022\026.milvus.grpc.TableName\032\026.mi"
+  "lvus.grpc.BoolReply\"\000\022C\n\rDescribeTable\022\026"
+  ".milvus.grpc.TableName\032\030.milvus.grpc.Tab"
+  "leSchema\"\000\022B\n\nCountTable\022\026.milvus.grpc.T"
+  "ableName\032\032.milvus.grpc.TableRowCount\"\000\022@"
+  "\n\nShowTables\022\024.milvus.grpc.Command\032\032.mil"
+  "vus.grpc.TableNameList\"\000\022:\n\tDropTable\022\026."
+  "milvus.grpc.TableName\032\023.milvus.grpc.Stat"
+  "us\"\000\022=\n\013CreateIndex\022\027.milvus.grpc.IndexP"
+  "aram\032\023.milvus.grpc.Status\"\000\022B\n\rDescribeI"
+  "ndex\022\026.milvus.grpc.TableName\032\027.milvus.gr"
+  "pc.IndexParam\"\000\022:\n\tDropIndex\022\026.milvus.gr"
+  "pc.TableName\032\023.milvus.grpc.Status\"\000\022E\n\017C"
+  "reatePartition\022\033.milvus.grpc.PartitionPa"
+  "ram\032\023.milvus.grpc.Status\"\000\022F\n\016ShowPartit"
+  "ions\022\026.milvus.grpc.TableName\032\032.milvus.gr"
+  "pc.PartitionList\"\000\022C\n\rDropPartition\022\033.mi"
+  "lvus.grpc.PartitionParam\032\023.milvus.grpc.S"
+  "tatus\"\000\022<\n\006Insert\022\030.milvus.grpc.InsertPa"
+  "ram\032\026.milvus.grpc.VectorIds\"\000\022B\n\006Search\022"
+  "\030.milvus.grpc.SearchParam\032\034.milvus.grpc."
+  "TopKQueryResult\"\000\022P\n\rSearchInFiles\022\037.mil"
+  "vus.grpc.SearchInFilesParam\032\034.milvus.grp"
+  "c.TopKQueryResult\"\000\0227\n\003Cmd\022\024.milvus.grpc"
+  ".Command\032\030.milvus.grpc.StringReply\"\000\022E\n\014"
+  "DeleteByDate\022\036.milvus.grpc.DeleteByDateP"
+  "aram\032\023.milvus.grpc.Status\"\000\022=\n\014PreloadTa"
+  "ble\022\026.milvus.grpc.TableName\032\023.milvus.grp"
+  "c.Status\"\000\022G\n\013RangeSearch\022\030.milvus.grpc."
+  "SearchParam\032\034.milvus.grpc.TopKQueryResul"
+  "t\"\000\022A\n\nDeleteByID\022\034.milvus.grpc.DeleteBy"
+  "IDParam\032\023.milvus.grpc.Status\"\000b\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_milvus_2eproto_deps[1] = {
   &::descriptor_table_status_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_milvus_2eproto_sccs[20] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_milvus_2eproto_sccs[21] = {
   &scc_info_BoolReply_milvus_2eproto.base,
   &scc_info_Command_milvus_2eproto.base,
   &scc_info_DeleteByDateParam_milvus_2eproto.base,
+  &scc_info_DeleteByIDParam_milvus_2eproto.base,
   &scc_info_Index_milvus_2eproto.base,
   &scc_info_IndexParam_milvus_2eproto.base,
   &scc_info_InsertParam_milvus_2eproto.base,
@@ -706,10 +753,10 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_mil
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_milvus_2eproto_once;
 static bool descriptor_table_milvus_2eproto_initialized = false;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_milvus_2eproto = {
-  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 2906,
-  &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 20, 1,
+  &descriptor_table_milvus_2eproto_initialized, descriptor_table_protodef_milvus_2eproto, "milvus.proto", 3318,
+  &descriptor_table_milvus_2eproto_once, descriptor_table_milvus_2eproto_sccs, descriptor_table_milvus_2eproto_deps, 21, 1,
   schemas, file_default_instances, TableStruct_milvus_2eproto::offsets,
-  file_level_metadata_milvus_2eproto, 20, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
+  file_level_metadata_milvus_2eproto, 21, file_level_enum_descriptors_milvus_2eproto, file_level_service_descriptors_milvus_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -3458,6 +3505,15 @@ InsertParam::InsertParam(const InsertParam& from)
   if (!from.partition_tag().empty()) {
     partition_tag_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.partition_tag_);
   }
+  packed_float_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.packed_float_data().empty()) {
+    packed_float_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.packed_float_data_);
+  }
+  packed_binary_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.packed_binary_data().empty()) {
+    packed_binary_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.packed_binary_data_);
+  }
+  packed_dimension_ = from.packed_dimension_;
   // @@protoc_insertion_point(copy_constructor:milvus.grpc.InsertParam)
 }
 
@@ -3465,6 +3521,9 @@ void InsertParam::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_InsertParam_milvus_2eproto.base);
   table_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   partition_tag_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_float_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_binary_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_dimension_ = PROTOBUF_LONGLONG(0);
 }
 
 InsertParam::~InsertParam() {
@@ -3475,6 +3534,8 @@ InsertParam::~InsertParam() {
 void InsertParam::SharedDtor() {
   table_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   partition_tag_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_float_data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_binary_data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 void InsertParam::SetCachedSize(int size) const {
@@ -3496,6 +3557,9 @@ void InsertParam::Clear() {
   row_id_array_.Clear();
   table_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   partition_tag_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_float_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_binary_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_dimension_ = PROTOBUF_LONGLONG(0);
   _internal_metadata_.Clear();
 }
 
@@ -3543,6 +3607,27 @@ const char* InsertParam::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // bytes packed_float_data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_packed_float_data(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes packed_binary_data = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_packed_binary_data(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int64 packed_dimension = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          packed_dimension_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -3630,6 +3715,41 @@ bool InsertParam::MergePartialFromCodedStream(
         break;
       }
 
+      // bytes packed_float_data = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_packed_float_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes packed_binary_data = 6;
+      case 6: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (50 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_packed_binary_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 packed_dimension = 7;
+      case 7: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (56 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &packed_dimension_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -3697,6 +3817,23 @@ void InsertParam::SerializeWithCachedSizes(
       4, this->partition_tag(), output);
   }
 
+  // bytes packed_float_data = 5;
+  if (this->packed_float_data().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      5, this->packed_float_data(), output);
+  }
+
+  // bytes packed_binary_data = 6;
+  if (this->packed_binary_data().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      6, this->packed_binary_data(), output);
+  }
+
+  // int64 packed_dimension = 7;
+  if (this->packed_dimension() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(7, this->packed_dimension(), output);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
         _internal_metadata_.unknown_fields(), output);
@@ -3753,6 +3890,25 @@ void InsertParam::SerializeWithCachedSizes(
         4, this->partition_tag(), target);
   }
 
+  // bytes packed_float_data = 5;
+  if (this->packed_float_data().size() > 0) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        5, this->packed_float_data(), target);
+  }
+
+  // bytes packed_binary_data = 6;
+  if (this->packed_binary_data().size() > 0) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        6, this->packed_binary_data(), target);
+  }
+
+  // int64 packed_dimension = 7;
+  if (this->packed_dimension() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(7, this->packed_dimension(), target);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields(), target);
@@ -3814,6 +3970,27 @@ size_t InsertParam::ByteSizeLong() const {
         this->partition_tag());
   }
 
+  // bytes packed_float_data = 5;
+  if (this->packed_float_data().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->packed_float_data());
+  }
+
+  // bytes packed_binary_data = 6;
+  if (this->packed_binary_data().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->packed_binary_data());
+  }
+
+  // int64 packed_dimension = 7;
+  if (this->packed_dimension() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->packed_dimension());
+  }
+
   int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -3851,6 +4028,17 @@ void InsertParam::MergeFrom(const InsertParam& from) {
 
     partition_tag_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.partition_tag_);
   }
+  if (from.packed_float_data().size() > 0) {
+
+    packed_float_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.packed_float_data_);
+  }
+  if (from.packed_binary_data().size() > 0) {
+
+    packed_binary_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.packed_binary_data_);
+  }
+  if (from.packed_dimension() != 0) {
+    set_packed_dimension(from.packed_dimension());
+  }
 }
 
 void InsertParam::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -3880,6 +4068,11 @@ void InsertParam::InternalSwap(InsertParam* other) {
     GetArenaNoVirtual());
   partition_tag_.Swap(&other->partition_tag_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
+  packed_float_data_.Swap(&other->packed_float_data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  packed_binary_data_.Swap(&other->packed_binary_data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  swap(packed_dimension_, other->packed_dimension_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata InsertParam::GetMetadata() const {
@@ -4252,18 +4445,28 @@ SearchParam::SearchParam(const SearchParam& from)
   if (!from.table_name().empty()) {
     table_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.table_name_);
   }
+  packed_float_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.packed_float_data().empty()) {
+    packed_float_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.packed_float_data_);
+  }
+  packed_binary_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.packed_binary_data().empty()) {
+    packed_binary_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.packed_binary_data_);
+  }
   ::memcpy(&topk_, &from.topk_,
-    static_cast<size_t>(reinterpret_cast<char*>(&nprobe_) -
-    reinterpret_cast<char*>(&topk_)) + sizeof(nprobe_));
+    static_cast<size_t>(reinterpret_cast<char*>(&radius_) -
+    reinterpret_cast<char*>(&topk_)) + sizeof(radius_));
   // @@protoc_insertion_point(copy_constructor:milvus.grpc.SearchParam)
 }
 
 void SearchParam::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SearchParam_milvus_2eproto.base);
   table_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_float_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_binary_data_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   ::memset(&topk_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&nprobe_) -
-      reinterpret_cast<char*>(&topk_)) + sizeof(nprobe_));
+      reinterpret_cast<char*>(&radius_) -
+      reinterpret_cast<char*>(&topk_)) + sizeof(radius_));
 }
 
 SearchParam::~SearchParam() {
@@ -4273,6 +4476,8 @@ SearchParam::~SearchParam() {
 
 void SearchParam::SharedDtor() {
   table_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_float_data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_binary_data_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 void SearchParam::SetCachedSize(int size) const {
@@ -4294,9 +4499,11 @@ void SearchParam::Clear() {
   query_range_array_.Clear();
   partition_tag_array_.Clear();
   table_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_float_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  packed_binary_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   ::memset(&topk_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&nprobe_) -
-      reinterpret_cast<char*>(&topk_)) + sizeof(nprobe_));
+      reinterpret_cast<char*>(&radius_) -
+      reinterpret_cast<char*>(&topk_)) + sizeof(radius_));
   _internal_metadata_.Clear();
 }
 
@@ -4365,6 +4572,41 @@ const char* SearchParam::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID
           } while (::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint8>(ptr) == 50);
         } else goto handle_unusual;
         continue;
+      // bytes packed_float_data = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_packed_float_data(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes packed_binary_data = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(mutable_packed_binary_data(), ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int64 packed_dimension = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          packed_dimension_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // float radius = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 85)) {
+          radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else goto handle_unusual;
+        continue;
+      // int64 refine_factor = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 88)) {
+          refine_factor_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -4474,6 +4716,67 @@ bool SearchParam::MergePartialFromCodedStream(
         break;
       }
 
+      // bytes packed_float_data = 7;
+      case 7: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (58 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_packed_float_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // bytes packed_binary_data = 8;
+      case 8: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (66 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadBytes(
+                input, this->mutable_packed_binary_data()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 packed_dimension = 9;
+      case 9: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (72 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &packed_dimension_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // float radius = 10;
+      case 10: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (85 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   float, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, &radius_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // int64 refine_factor = 11;
+      case 11: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (88 & 0xFF)) {
+
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, &refine_factor_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -4549,6 +4852,33 @@ void SearchParam::SerializeWithCachedSizes(
       6, this->partition_tag_array(i), output);
   }
 
+  // bytes packed_float_data = 7;
+  if (this->packed_float_data().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      7, this->packed_float_data(), output);
+  }
+
+  // bytes packed_binary_data = 8;
+  if (this->packed_binary_data().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesMaybeAliased(
+      8, this->packed_binary_data(), output);
+  }
+
+  // int64 packed_dimension = 9;
+  if (this->packed_dimension() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(9, this->packed_dimension(), output);
+  }
+
+  // float radius = 10;
+  if (!(this->radius() <= 0 && this->radius() >= 0)) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloat(10, this->radius(), output);
+  }
+
+  // int64 refine_factor = 11;
+  if (this->refine_factor() != 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64(11, this->refine_factor(), output);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
         _internal_metadata_.unknown_fields(), output);
@@ -4609,6 +4939,35 @@ void SearchParam::SerializeWithCachedSizes(
       WriteStringToArray(6, this->partition_tag_array(i), target);
   }
 
+  // bytes packed_float_data = 7;
+  if (this->packed_float_data().size() > 0) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        7, this->packed_float_data(), target);
+  }
+
+  // bytes packed_binary_data = 8;
+  if (this->packed_binary_data().size() > 0) {
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBytesToArray(
+        8, this->packed_binary_data(), target);
+  }
+
+  // int64 packed_dimension = 9;
+  if (this->packed_dimension() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(9, this->packed_dimension(), target);
+  }
+
+  // float radius = 10;
+  if (!(this->radius() <= 0 && this->radius() >= 0)) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFloatToArray(10, this->radius(), target);
+  }
+
+  // int64 refine_factor = 11;
+  if (this->refine_factor() != 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64ToArray(11, this->refine_factor(), target);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields(), target);
@@ -4667,6 +5026,20 @@ size_t SearchParam::ByteSizeLong() const {
         this->table_name());
   }
 
+  // bytes packed_float_data = 7;
+  if (this->packed_float_data().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->packed_float_data());
+  }
+
+  // bytes packed_binary_data = 8;
+  if (this->packed_binary_data().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->packed_binary_data());
+  }
+
   // int64 topk = 4;
   if (this->topk() != 0) {
     total_size += 1 +
@@ -4681,6 +5054,25 @@ size_t SearchParam::ByteSizeLong() const {
         this->nprobe());
   }
 
+  // int64 packed_dimension = 9;
+  if (this->packed_dimension() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->packed_dimension());
+  }
+
+  // int64 refine_factor = 11;
+  if (this->refine_factor() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int64Size(
+        this->refine_factor());
+  }
+
+  // float radius = 10;
+  if (!(this->radius() <= 0 && this->radius() >= 0)) {
+    total_size += 1 + 4;
+  }
+
   int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
@@ -4715,12 +5107,29 @@ void SearchParam::MergeFrom(const SearchParam& from) {
 
     table_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.table_name_);
   }
+  if (from.packed_float_data().size() > 0) {
+
+    packed_float_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.packed_float_data_);
+  }
+  if (from.packed_binary_data().size() > 0) {
+
+    packed_binary_data_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.packed_binary_data_);
+  }
   if (from.topk() != 0) {
     set_topk(from.topk());
   }
   if (from.nprobe() != 0) {
     set_nprobe(from.nprobe());
   }
+  if (from.packed_dimension() != 0) {
+    set_packed_dimension(from.packed_dimension());
+  }
+  if (from.refine_factor() != 0) {
+    set_refine_factor(from.refine_factor());
+  }
+  if (!(from.radius() <= 0 && from.radius() >= 0)) {
+    set_radius(from.radius());
+  }
 }
 
 void SearchParam::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -4750,7 +5159,14 @@ void SearchParam::InternalSwap(SearchParam* other) {
   table_name_.Swap(&other->table_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
     GetArenaNoVirtual());
   swap(topk_, other->topk_);
+  packed_float_data_.Swap(&other->packed_float_data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+  packed_binary_data_.Swap(&other->packed_binary_data_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
   swap(nprobe_, other->nprobe_);
+  swap(packed_dimension_, other->packed_dimension_);
+  swap(refine_factor_, other->refine_factor_);
+  swap(radius_, other->radius_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata SearchParam::GetMetadata() const {
@@ -5114,7 +5530,8 @@ TopKQueryResult::TopKQueryResult(const TopKQueryResult& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       _internal_metadata_(nullptr),
       ids_(from.ids_),
-      distances_(from.distances_) {
+      distances_(from.distances_),
+      lims_(from.lims_) {
   _internal_metadata_.MergeFrom(from._internal_metadata_);
   if (from.has_status()) {
     status_ = new ::milvus::grpc::Status(*from.status_);
@@ -5158,6 +5575,7 @@ void TopKQueryResult::Clear() {
 
   ids_.Clear();
   distances_.Clear();
+  lims_.Clear();
   if (GetArenaNoVirtual() == nullptr && status_ != nullptr) {
     delete status_;
   }
@@ -5208,6 +5626,16 @@ const char* TopKQueryResult::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
           ptr += sizeof(float);
         } else goto handle_unusual;
         continue;
+      // repeated int64 lims = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(mutable_lims(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40) {
+          add_lims(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -5294,6 +5722,22 @@ bool TopKQueryResult::MergePartialFromCodedStream(
         break;
       }
 
+      // repeated int64 lims = 5;
+      case 5: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (42 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_lims())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (40 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 1, 42u, input, this->mutable_lims())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
       default: {
       handle_unusual:
         if (tag == 0) {
@@ -5352,6 +5796,17 @@ void TopKQueryResult::SerializeWithCachedSizes(
       this->distances().data(), this->distances_size(), output);
   }
 
+  // repeated int64 lims = 5;
+  if (this->lims_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(5, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_lims_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->lims_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64NoTag(
+      this->lims(i), output);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
         _internal_metadata_.unknown_fields(), output);
@@ -5403,6 +5858,19 @@ void TopKQueryResult::SerializeWithCachedSizes(
       WriteFloatNoTagToArray(this->distances_, target);
   }
 
+  // repeated int64 lims = 5;
+  if (this->lims_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      5,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _lims_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteInt64NoTagToArray(this->lims_, target);
+  }
+
   if (_internal_metadata_.have_unknown_fields()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields(), target);
@@ -5454,6 +5922,21 @@ size_t TopKQueryResult::ByteSizeLong() const {
     total_size += data_size;
   }
 
+  // repeated int64 lims = 5;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->lims_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _lims_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   // .milvus.grpc.Status status = 1;
   if (this->has_status()) {
     total_size += 1 +
@@ -5497,6 +5980,7 @@ void TopKQueryResult::MergeFrom(const TopKQueryResult& from) {
 
   ids_.MergeFrom(from.ids_);
   distances_.MergeFrom(from.distances_);
+  lims_.MergeFrom(from.lims_);
   if (from.has_status()) {
     mutable_status()->::milvus::grpc::Status::MergeFrom(from.status());
   }
@@ -5528,6 +6012,7 @@ void TopKQueryResult::InternalSwap(TopKQueryResult* other) {
   _internal_metadata_.Swap(&other->_internal_metadata_);
   ids_.InternalSwap(&other->ids_);
   distances_.InternalSwap(&other->distances_);
+  lims_.InternalSwap(&other->lims_);
   swap(status_, other->status_);
   swap(row_num_, other->row_num_);
 }
@@ -7794,6 +8279,344 @@ void DeleteByDateParam::InternalSwap(DeleteByDateParam* other) {
 }
 
 
+// ===================================================================
+
+void DeleteByIDParam::InitAsDefaultInstance() {
+}
+class DeleteByIDParam::_Internal {
+ public:
+};
+
+DeleteByIDParam::DeleteByIDParam()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:milvus.grpc.DeleteByIDParam)
+}
+DeleteByIDParam::DeleteByIDParam(const DeleteByIDParam& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr),
+      id_array_(from.id_array_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  table_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from.table_name().empty()) {
+    table_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.table_name_);
+  }
+  // @@protoc_insertion_point(copy_constructor:milvus.grpc.DeleteByIDParam)
+}
+
+void DeleteByIDParam::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DeleteByIDParam_milvus_2eproto.base);
+  table_name_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+DeleteByIDParam::~DeleteByIDParam() {
+  // @@protoc_insertion_point(destructor:milvus.grpc.DeleteByIDParam)
+  SharedDtor();
+}
+
+void DeleteByIDParam::SharedDtor() {
+  table_name_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void DeleteByIDParam::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const DeleteByIDParam& DeleteByIDParam::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DeleteByIDParam_milvus_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void DeleteByIDParam::Clear() {
+// @@protoc_insertion_point(message_clear_start:milvus.grpc.DeleteByIDParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  id_array_.Clear();
+  table_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  _internal_metadata_.Clear();
+}
+
+#if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+const char* DeleteByIDParam::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string table_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParserUTF8(mutable_table_name(), ptr, ctx, "milvus.grpc.DeleteByIDParam.table_name");
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated int64 id_array = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(mutable_id_array(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16) {
+          add_id_array(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+#else  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+bool DeleteByIDParam::MergePartialFromCodedStream(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!PROTOBUF_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+  // @@protoc_insertion_point(parse_start:milvus.grpc.DeleteByIDParam)
+  for (;;) {
+    ::std::pair<::PROTOBUF_NAMESPACE_ID::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // string table_name = 1;
+      case 1: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (10 & 0xFF)) {
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadString(
+                input, this->mutable_table_name()));
+          DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+            this->table_name().data(), static_cast<int>(this->table_name().length()),
+            ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE,
+            "milvus.grpc.DeleteByIDParam.table_name"));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int64 id_array = 2;
+      case 2: {
+        if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (18 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_id_array())));
+        } else if (static_cast< ::PROTOBUF_NAMESPACE_ID::uint8>(tag) == (16 & 0xFF)) {
+          DO_((::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::PROTOBUF_NAMESPACE_ID::int64, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_INT64>(
+                 1, 18u, input, this->mutable_id_array())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0) {
+          goto success;
+        }
+        DO_(::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SkipField(
+              input, tag, _internal_metadata_.mutable_unknown_fields()));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:milvus.grpc.DeleteByIDParam)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:milvus.grpc.DeleteByIDParam)
+  return false;
+#undef DO_
+}
+#endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+
+void DeleteByIDParam::SerializeWithCachedSizes(
+    ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:milvus.grpc.DeleteByIDParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string table_name = 1;
+  if (this->table_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->table_name().data(), static_cast<int>(this->table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.DeleteByIDParam.table_name");
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringMaybeAliased(
+      1, this->table_name(), output);
+  }
+
+  // repeated int64 id_array = 2;
+  if (this->id_array_size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTag(2, ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED, output);
+    output->WriteVarint32(_id_array_cached_byte_size_.load(
+        std::memory_order_relaxed));
+  }
+  for (int i = 0, n = this->id_array_size(); i < n; i++) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt64NoTag(
+      this->id_array(i), output);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFields(
+        _internal_metadata_.unknown_fields(), output);
+  }
+  // @@protoc_insertion_point(serialize_end:milvus.grpc.DeleteByIDParam)
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* DeleteByIDParam::InternalSerializeWithCachedSizesToArray(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:milvus.grpc.DeleteByIDParam)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string table_name = 1;
+  if (this->table_name().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->table_name().data(), static_cast<int>(this->table_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "milvus.grpc.DeleteByIDParam.table_name");
+    target =
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteStringToArray(
+        1, this->table_name(), target);
+  }
+
+  // repeated int64 id_array = 2;
+  if (this->id_array_size() > 0) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteTagToArray(
+      2,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      target);
+    target = ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream::WriteVarint32ToArray(
+        _id_array_cached_byte_size_.load(std::memory_order_relaxed),
+         target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      WriteInt64NoTagToArray(this->id_array_, target);
+  }
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:milvus.grpc.DeleteByIDParam)
+  return target;
+}
+
+size_t DeleteByIDParam::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:milvus.grpc.DeleteByIDParam)
+  size_t total_size = 0;
+
+  if (_internal_metadata_.have_unknown_fields()) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::ComputeUnknownFieldsSize(
+        _internal_metadata_.unknown_fields());
+  }
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int64 id_array = 2;
+  {
+    size_t data_size = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      Int64Size(this->id_array_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+    }
+    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
+    _id_array_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string table_name = 1;
+  if (this->table_name().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->table_name());
+  }
+
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void DeleteByIDParam::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:milvus.grpc.DeleteByIDParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  const DeleteByIDParam* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<DeleteByIDParam>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:milvus.grpc.DeleteByIDParam)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:milvus.grpc.DeleteByIDParam)
+    MergeFrom(*source);
+  }
+}
+
+void DeleteByIDParam::MergeFrom(const DeleteByIDParam& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:milvus.grpc.DeleteByIDParam)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  id_array_.MergeFrom(from.id_array_);
+  if (from.table_name().size() > 0) {
+
+    table_name_.AssignWithDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from.table_name_);
+  }
+}
+
+void DeleteByIDParam::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:milvus.grpc.DeleteByIDParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void DeleteByIDParam::CopyFrom(const DeleteByIDParam& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:milvus.grpc.DeleteByIDParam)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DeleteByIDParam::IsInitialized() const {
+  return true;
+}
+
+void DeleteByIDParam::InternalSwap(DeleteByIDParam* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  id_array_.InternalSwap(&other->id_array_);
+  table_name_.Swap(&other->table_name_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+    GetArenaNoVirtual());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DeleteByIDParam::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace grpc
 }  // namespace milvus
@@ -7858,6 +8681,9 @@ template<> PROTOBUF_NOINLINE ::milvus::grpc::IndexParam* Arena::CreateMaybeMessa
 template<> PROTOBUF_NOINLINE ::milvus::grpc::DeleteByDateParam* Arena::CreateMaybeMessage< ::milvus::grpc::DeleteByDateParam >(Arena* arena) {
   return Arena::CreateInternal< ::milvus::grpc::DeleteByDateParam >(arena);
 }
+template<> PROTOBUF_NOINLINE ::milvus::grpc::DeleteByIDParam* Arena::CreateMaybeMessage< ::milvus::grpc::DeleteByIDParam >(Arena* arena) {
+  return Arena::CreateInternal< ::milvus::grpc::DeleteByIDParam >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
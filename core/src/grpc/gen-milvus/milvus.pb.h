@@ -48,7 +48,7 @@ struct TableStruct_milvus_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[20]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[21]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -66,6 +66,9 @@ extern CommandDefaultTypeInternal _Command_default_instance_;
 class DeleteByDateParam;
 class DeleteByDateParamDefaultTypeInternal;
 extern DeleteByDateParamDefaultTypeInternal _DeleteByDateParam_default_instance_;
+class DeleteByIDParam;
+class DeleteByIDParamDefaultTypeInternal;
+extern DeleteByIDParamDefaultTypeInternal _DeleteByIDParam_default_instance_;
 class Index;
 class IndexDefaultTypeInternal;
 extern IndexDefaultTypeInternal _Index_default_instance_;
@@ -123,6 +126,7 @@ PROTOBUF_NAMESPACE_OPEN
 template<> ::milvus::grpc::BoolReply* Arena::CreateMaybeMessage<::milvus::grpc::BoolReply>(Arena*);
 template<> ::milvus::grpc::Command* Arena::CreateMaybeMessage<::milvus::grpc::Command>(Arena*);
 template<> ::milvus::grpc::DeleteByDateParam* Arena::CreateMaybeMessage<::milvus::grpc::DeleteByDateParam>(Arena*);
+template<> ::milvus::grpc::DeleteByIDParam* Arena::CreateMaybeMessage<::milvus::grpc::DeleteByIDParam>(Arena*);
 template<> ::milvus::grpc::Index* Arena::CreateMaybeMessage<::milvus::grpc::Index>(Arena*);
 template<> ::milvus::grpc::IndexParam* Arena::CreateMaybeMessage<::milvus::grpc::IndexParam>(Arena*);
 template<> ::milvus::grpc::InsertParam* Arena::CreateMaybeMessage<::milvus::grpc::InsertParam>(Arena*);
@@ -1469,6 +1473,9 @@ class InsertParam :
     kRowIdArrayFieldNumber = 3,
     kTableNameFieldNumber = 1,
     kPartitionTagFieldNumber = 4,
+    kPackedFloatDataFieldNumber = 5,
+    kPackedBinaryDataFieldNumber = 6,
+    kPackedDimensionFieldNumber = 7,
   };
   // repeated .milvus.grpc.RowRecord row_record_array = 2;
   int row_record_array_size() const;
@@ -1514,6 +1521,33 @@ class InsertParam :
   std::string* release_partition_tag();
   void set_allocated_partition_tag(std::string* partition_tag);
 
+  // bytes packed_float_data = 5;
+  void clear_packed_float_data();
+  const std::string& packed_float_data() const;
+  void set_packed_float_data(const std::string& value);
+  void set_packed_float_data(std::string&& value);
+  void set_packed_float_data(const char* value);
+  void set_packed_float_data(const void* value, size_t size);
+  std::string* mutable_packed_float_data();
+  std::string* release_packed_float_data();
+  void set_allocated_packed_float_data(std::string* packed_float_data);
+
+  // bytes packed_binary_data = 6;
+  void clear_packed_binary_data();
+  const std::string& packed_binary_data() const;
+  void set_packed_binary_data(const std::string& value);
+  void set_packed_binary_data(std::string&& value);
+  void set_packed_binary_data(const char* value);
+  void set_packed_binary_data(const void* value, size_t size);
+  std::string* mutable_packed_binary_data();
+  std::string* release_packed_binary_data();
+  void set_allocated_packed_binary_data(std::string* packed_binary_data);
+
+  // int64 packed_dimension = 7;
+  void clear_packed_dimension();
+  ::PROTOBUF_NAMESPACE_ID::int64 packed_dimension() const;
+  void set_packed_dimension(::PROTOBUF_NAMESPACE_ID::int64 value);
+
   // @@protoc_insertion_point(class_scope:milvus.grpc.InsertParam)
  private:
   class _Internal;
@@ -1524,6 +1558,9 @@ class InsertParam :
   mutable std::atomic<int> _row_id_array_cached_byte_size_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr partition_tag_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr packed_float_data_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr packed_binary_data_;
+  ::PROTOBUF_NAMESPACE_ID::int64 packed_dimension_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_milvus_2eproto;
 };
@@ -1794,8 +1831,13 @@ class SearchParam :
     kQueryRangeArrayFieldNumber = 3,
     kPartitionTagArrayFieldNumber = 6,
     kTableNameFieldNumber = 1,
+    kPackedFloatDataFieldNumber = 7,
+    kPackedBinaryDataFieldNumber = 8,
     kTopkFieldNumber = 4,
     kNprobeFieldNumber = 5,
+    kPackedDimensionFieldNumber = 9,
+    kRefineFactorFieldNumber = 11,
+    kRadiusFieldNumber = 10,
   };
   // repeated .milvus.grpc.RowRecord query_record_array = 2;
   int query_record_array_size() const;
@@ -1847,6 +1889,28 @@ class SearchParam :
   std::string* release_table_name();
   void set_allocated_table_name(std::string* table_name);
 
+  // bytes packed_float_data = 7;
+  void clear_packed_float_data();
+  const std::string& packed_float_data() const;
+  void set_packed_float_data(const std::string& value);
+  void set_packed_float_data(std::string&& value);
+  void set_packed_float_data(const char* value);
+  void set_packed_float_data(const void* value, size_t size);
+  std::string* mutable_packed_float_data();
+  std::string* release_packed_float_data();
+  void set_allocated_packed_float_data(std::string* packed_float_data);
+
+  // bytes packed_binary_data = 8;
+  void clear_packed_binary_data();
+  const std::string& packed_binary_data() const;
+  void set_packed_binary_data(const std::string& value);
+  void set_packed_binary_data(std::string&& value);
+  void set_packed_binary_data(const char* value);
+  void set_packed_binary_data(const void* value, size_t size);
+  std::string* mutable_packed_binary_data();
+  std::string* release_packed_binary_data();
+  void set_allocated_packed_binary_data(std::string* packed_binary_data);
+
   // int64 topk = 4;
   void clear_topk();
   ::PROTOBUF_NAMESPACE_ID::int64 topk() const;
@@ -1857,6 +1921,21 @@ class SearchParam :
   ::PROTOBUF_NAMESPACE_ID::int64 nprobe() const;
   void set_nprobe(::PROTOBUF_NAMESPACE_ID::int64 value);
 
+  // int64 packed_dimension = 9;
+  void clear_packed_dimension();
+  ::PROTOBUF_NAMESPACE_ID::int64 packed_dimension() const;
+  void set_packed_dimension(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // int64 refine_factor = 11;
+  void clear_refine_factor();
+  ::PROTOBUF_NAMESPACE_ID::int64 refine_factor() const;
+  void set_refine_factor(::PROTOBUF_NAMESPACE_ID::int64 value);
+
+  // float radius = 10;
+  void clear_radius();
+  float radius() const;
+  void set_radius(float value);
+
   // @@protoc_insertion_point(class_scope:milvus.grpc.SearchParam)
  private:
   class _Internal;
@@ -1866,8 +1945,13 @@ class SearchParam :
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::milvus::grpc::Range > query_range_array_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> partition_tag_array_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr packed_float_data_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr packed_binary_data_;
   ::PROTOBUF_NAMESPACE_ID::int64 topk_;
   ::PROTOBUF_NAMESPACE_ID::int64 nprobe_;
+  ::PROTOBUF_NAMESPACE_ID::int64 packed_dimension_;
+  ::PROTOBUF_NAMESPACE_ID::int64 refine_factor_;
+  float radius_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_milvus_2eproto;
 };
@@ -2141,6 +2225,7 @@ class TopKQueryResult :
   enum : int {
     kIdsFieldNumber = 3,
     kDistancesFieldNumber = 4,
+    kLimsFieldNumber = 5,
     kStatusFieldNumber = 1,
     kRowNumFieldNumber = 2,
   };
@@ -2166,6 +2251,17 @@ class TopKQueryResult :
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
       mutable_distances();
 
+  // repeated int64 lims = 5;
+  int lims_size() const;
+  void clear_lims();
+  ::PROTOBUF_NAMESPACE_ID::int64 lims(int index) const;
+  void set_lims(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_lims(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      lims() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_lims();
+
   // .milvus.grpc.Status status = 1;
   bool has_status() const;
   void clear_status();
@@ -2188,6 +2284,8 @@ class TopKQueryResult :
   mutable std::atomic<int> _ids_cached_byte_size_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > distances_;
   mutable std::atomic<int> _distances_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > lims_;
+  mutable std::atomic<int> _lims_cached_byte_size_;
   ::milvus::grpc::Status* status_;
   ::PROTOBUF_NAMESPACE_ID::int64 row_num_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
@@ -3201,6 +3299,157 @@ class DeleteByDateParam :
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_milvus_2eproto;
 };
+// -------------------------------------------------------------------
+
+class DeleteByIDParam :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:milvus.grpc.DeleteByIDParam) */ {
+ public:
+  DeleteByIDParam();
+  virtual ~DeleteByIDParam();
+
+  DeleteByIDParam(const DeleteByIDParam& from);
+  DeleteByIDParam(DeleteByIDParam&& from) noexcept
+    : DeleteByIDParam() {
+    *this = ::std::move(from);
+  }
+
+  inline DeleteByIDParam& operator=(const DeleteByIDParam& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DeleteByIDParam& operator=(DeleteByIDParam&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const DeleteByIDParam& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const DeleteByIDParam* internal_default_instance() {
+    return reinterpret_cast<const DeleteByIDParam*>(
+               &_DeleteByIDParam_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(DeleteByIDParam& a, DeleteByIDParam& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DeleteByIDParam* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline DeleteByIDParam* New() const final {
+    return CreateMaybeMessage<DeleteByIDParam>(nullptr);
+  }
+
+  DeleteByIDParam* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<DeleteByIDParam>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const DeleteByIDParam& from);
+  void MergeFrom(const DeleteByIDParam& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  #if GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  #else
+  bool MergePartialFromCodedStream(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedInputStream* input) final;
+  #endif  // GOOGLE_PROTOBUF_ENABLE_EXPERIMENTAL_PARSER
+  void SerializeWithCachedSizes(
+      ::PROTOBUF_NAMESPACE_ID::io::CodedOutputStream* output) const final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* InternalSerializeWithCachedSizesToArray(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DeleteByIDParam* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "milvus.grpc.DeleteByIDParam";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_milvus_2eproto);
+    return ::descriptor_table_milvus_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdArrayFieldNumber = 2,
+    kTableNameFieldNumber = 1,
+  };
+  // repeated int64 id_array = 2;
+  int id_array_size() const;
+  void clear_id_array();
+  ::PROTOBUF_NAMESPACE_ID::int64 id_array(int index) const;
+  void set_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value);
+  void add_id_array(::PROTOBUF_NAMESPACE_ID::int64 value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+      id_array() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+      mutable_id_array();
+
+  // string table_name = 1;
+  void clear_table_name();
+  const std::string& table_name() const;
+  void set_table_name(const std::string& value);
+  void set_table_name(std::string&& value);
+  void set_table_name(const char* value);
+  void set_table_name(const char* value, size_t size);
+  std::string* mutable_table_name();
+  std::string* release_table_name();
+  void set_allocated_table_name(std::string* table_name);
+
+  // @@protoc_insertion_point(class_scope:milvus.grpc.DeleteByIDParam)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 > id_array_;
+  mutable std::atomic<int> _id_array_cached_byte_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr table_name_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_milvus_2eproto;
+};
 // ===================================================================
 
 
@@ -4167,6 +4416,122 @@ inline void InsertParam::set_allocated_partition_tag(std::string* partition_tag)
   // @@protoc_insertion_point(field_set_allocated:milvus.grpc.InsertParam.partition_tag)
 }
 
+// bytes packed_float_data = 5;
+inline void InsertParam::clear_packed_float_data() {
+  packed_float_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& InsertParam::packed_float_data() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertParam.packed_float_data)
+  return packed_float_data_.GetNoArena();
+}
+inline void InsertParam::set_packed_float_data(const std::string& value) {
+  
+  packed_float_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertParam.packed_float_data)
+}
+inline void InsertParam::set_packed_float_data(std::string&& value) {
+  
+  packed_float_data_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.InsertParam.packed_float_data)
+}
+inline void InsertParam::set_packed_float_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  packed_float_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.InsertParam.packed_float_data)
+}
+inline void InsertParam::set_packed_float_data(const void* value, size_t size) {
+  
+  packed_float_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.InsertParam.packed_float_data)
+}
+inline std::string* InsertParam::mutable_packed_float_data() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.InsertParam.packed_float_data)
+  return packed_float_data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* InsertParam::release_packed_float_data() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.InsertParam.packed_float_data)
+  
+  return packed_float_data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void InsertParam::set_allocated_packed_float_data(std::string* packed_float_data) {
+  if (packed_float_data != nullptr) {
+    
+  } else {
+    
+  }
+  packed_float_data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), packed_float_data);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.InsertParam.packed_float_data)
+}
+
+// bytes packed_binary_data = 6;
+inline void InsertParam::clear_packed_binary_data() {
+  packed_binary_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& InsertParam::packed_binary_data() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertParam.packed_binary_data)
+  return packed_binary_data_.GetNoArena();
+}
+inline void InsertParam::set_packed_binary_data(const std::string& value) {
+  
+  packed_binary_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertParam.packed_binary_data)
+}
+inline void InsertParam::set_packed_binary_data(std::string&& value) {
+  
+  packed_binary_data_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.InsertParam.packed_binary_data)
+}
+inline void InsertParam::set_packed_binary_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  packed_binary_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.InsertParam.packed_binary_data)
+}
+inline void InsertParam::set_packed_binary_data(const void* value, size_t size) {
+  
+  packed_binary_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.InsertParam.packed_binary_data)
+}
+inline std::string* InsertParam::mutable_packed_binary_data() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.InsertParam.packed_binary_data)
+  return packed_binary_data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* InsertParam::release_packed_binary_data() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.InsertParam.packed_binary_data)
+  
+  return packed_binary_data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void InsertParam::set_allocated_packed_binary_data(std::string* packed_binary_data) {
+  if (packed_binary_data != nullptr) {
+    
+  } else {
+    
+  }
+  packed_binary_data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), packed_binary_data);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.InsertParam.packed_binary_data)
+}
+
+// int64 packed_dimension = 7;
+inline void InsertParam::clear_packed_dimension() {
+  packed_dimension_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 InsertParam::packed_dimension() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.InsertParam.packed_dimension)
+  return packed_dimension_;
+}
+inline void InsertParam::set_packed_dimension(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  packed_dimension_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.InsertParam.packed_dimension)
+}
+
 // -------------------------------------------------------------------
 
 // VectorIds
@@ -4454,6 +4819,150 @@ SearchParam::mutable_partition_tag_array() {
   return &partition_tag_array_;
 }
 
+// bytes packed_float_data = 7;
+inline void SearchParam::clear_packed_float_data() {
+  packed_float_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& SearchParam::packed_float_data() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchParam.packed_float_data)
+  return packed_float_data_.GetNoArena();
+}
+inline void SearchParam::set_packed_float_data(const std::string& value) {
+  
+  packed_float_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchParam.packed_float_data)
+}
+inline void SearchParam::set_packed_float_data(std::string&& value) {
+  
+  packed_float_data_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.SearchParam.packed_float_data)
+}
+inline void SearchParam::set_packed_float_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  packed_float_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.SearchParam.packed_float_data)
+}
+inline void SearchParam::set_packed_float_data(const void* value, size_t size) {
+  
+  packed_float_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.SearchParam.packed_float_data)
+}
+inline std::string* SearchParam::mutable_packed_float_data() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.SearchParam.packed_float_data)
+  return packed_float_data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* SearchParam::release_packed_float_data() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.SearchParam.packed_float_data)
+  
+  return packed_float_data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void SearchParam::set_allocated_packed_float_data(std::string* packed_float_data) {
+  if (packed_float_data != nullptr) {
+    
+  } else {
+    
+  }
+  packed_float_data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), packed_float_data);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.SearchParam.packed_float_data)
+}
+
+// bytes packed_binary_data = 8;
+inline void SearchParam::clear_packed_binary_data() {
+  packed_binary_data_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& SearchParam::packed_binary_data() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchParam.packed_binary_data)
+  return packed_binary_data_.GetNoArena();
+}
+inline void SearchParam::set_packed_binary_data(const std::string& value) {
+  
+  packed_binary_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchParam.packed_binary_data)
+}
+inline void SearchParam::set_packed_binary_data(std::string&& value) {
+  
+  packed_binary_data_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.SearchParam.packed_binary_data)
+}
+inline void SearchParam::set_packed_binary_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  packed_binary_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.SearchParam.packed_binary_data)
+}
+inline void SearchParam::set_packed_binary_data(const void* value, size_t size) {
+  
+  packed_binary_data_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.SearchParam.packed_binary_data)
+}
+inline std::string* SearchParam::mutable_packed_binary_data() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.SearchParam.packed_binary_data)
+  return packed_binary_data_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* SearchParam::release_packed_binary_data() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.SearchParam.packed_binary_data)
+  
+  return packed_binary_data_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void SearchParam::set_allocated_packed_binary_data(std::string* packed_binary_data) {
+  if (packed_binary_data != nullptr) {
+    
+  } else {
+    
+  }
+  packed_binary_data_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), packed_binary_data);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.SearchParam.packed_binary_data)
+}
+
+// int64 packed_dimension = 9;
+inline void SearchParam::clear_packed_dimension() {
+  packed_dimension_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 SearchParam::packed_dimension() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchParam.packed_dimension)
+  return packed_dimension_;
+}
+inline void SearchParam::set_packed_dimension(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  packed_dimension_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchParam.packed_dimension)
+}
+
+// float radius = 10;
+inline void SearchParam::clear_radius() {
+  radius_ = 0;
+}
+inline float SearchParam::radius() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchParam.radius)
+  return radius_;
+}
+inline void SearchParam::set_radius(float value) {
+  
+  radius_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchParam.radius)
+}
+
+// int64 refine_factor = 11;
+inline void SearchParam::clear_refine_factor() {
+  refine_factor_ = PROTOBUF_LONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 SearchParam::refine_factor() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.SearchParam.refine_factor)
+  return refine_factor_;
+}
+inline void SearchParam::set_refine_factor(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  
+  refine_factor_ = value;
+  // @@protoc_insertion_point(field_set:milvus.grpc.SearchParam.refine_factor)
+}
+
 // -------------------------------------------------------------------
 
 // SearchInFilesParam
@@ -4697,6 +5206,36 @@ TopKQueryResult::mutable_distances() {
   return &distances_;
 }
 
+// repeated int64 lims = 5;
+inline int TopKQueryResult::lims_size() const {
+  return lims_.size();
+}
+inline void TopKQueryResult::clear_lims() {
+  lims_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 TopKQueryResult::lims(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.TopKQueryResult.lims)
+  return lims_.Get(index);
+}
+inline void TopKQueryResult::set_lims(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  lims_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.TopKQueryResult.lims)
+}
+inline void TopKQueryResult::add_lims(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  lims_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.TopKQueryResult.lims)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+TopKQueryResult::lims() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.TopKQueryResult.lims)
+  return lims_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+TopKQueryResult::mutable_lims() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.TopKQueryResult.lims)
+  return &lims_;
+}
+
 // -------------------------------------------------------------------
 
 // StringReply
@@ -5267,6 +5806,91 @@ inline void DeleteByDateParam::set_allocated_table_name(std::string* table_name)
   // @@protoc_insertion_point(field_set_allocated:milvus.grpc.DeleteByDateParam.table_name)
 }
 
+// -------------------------------------------------------------------
+
+// DeleteByIDParam
+
+// string table_name = 1;
+inline void DeleteByIDParam::clear_table_name() {
+  table_name_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline const std::string& DeleteByIDParam::table_name() const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.DeleteByIDParam.table_name)
+  return table_name_.GetNoArena();
+}
+inline void DeleteByIDParam::set_table_name(const std::string& value) {
+  
+  table_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.DeleteByIDParam.table_name)
+}
+inline void DeleteByIDParam::set_table_name(std::string&& value) {
+  
+  table_name_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:milvus.grpc.DeleteByIDParam.table_name)
+}
+inline void DeleteByIDParam::set_table_name(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  table_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:milvus.grpc.DeleteByIDParam.table_name)
+}
+inline void DeleteByIDParam::set_table_name(const char* value, size_t size) {
+  
+  table_name_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:milvus.grpc.DeleteByIDParam.table_name)
+}
+inline std::string* DeleteByIDParam::mutable_table_name() {
+  
+  // @@protoc_insertion_point(field_mutable:milvus.grpc.DeleteByIDParam.table_name)
+  return table_name_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* DeleteByIDParam::release_table_name() {
+  // @@protoc_insertion_point(field_release:milvus.grpc.DeleteByIDParam.table_name)
+  
+  return table_name_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void DeleteByIDParam::set_allocated_table_name(std::string* table_name) {
+  if (table_name != nullptr) {
+    
+  } else {
+    
+  }
+  table_name_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), table_name);
+  // @@protoc_insertion_point(field_set_allocated:milvus.grpc.DeleteByIDParam.table_name)
+}
+
+// repeated int64 id_array = 2;
+inline int DeleteByIDParam::id_array_size() const {
+  return id_array_.size();
+}
+inline void DeleteByIDParam::clear_id_array() {
+  id_array_.Clear();
+}
+inline ::PROTOBUF_NAMESPACE_ID::int64 DeleteByIDParam::id_array(int index) const {
+  // @@protoc_insertion_point(field_get:milvus.grpc.DeleteByIDParam.id_array)
+  return id_array_.Get(index);
+}
+inline void DeleteByIDParam::set_id_array(int index, ::PROTOBUF_NAMESPACE_ID::int64 value) {
+  id_array_.Set(index, value);
+  // @@protoc_insertion_point(field_set:milvus.grpc.DeleteByIDParam.id_array)
+}
+inline void DeleteByIDParam::add_id_array(::PROTOBUF_NAMESPACE_ID::int64 value) {
+  id_array_.Add(value);
+  // @@protoc_insertion_point(field_add:milvus.grpc.DeleteByIDParam.id_array)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >&
+DeleteByIDParam::id_array() const {
+  // @@protoc_insertion_point(field_list:milvus.grpc.DeleteByIDParam.id_array)
+  return id_array_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::int64 >*
+DeleteByIDParam::mutable_id_array() {
+  // @@protoc_insertion_point(field_mutable_list:milvus.grpc.DeleteByIDParam.id_array)
+  return &id_array_;
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -5308,6 +5932,8 @@ inline void DeleteByDateParam::set_allocated_table_name(std::string* table_name)
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
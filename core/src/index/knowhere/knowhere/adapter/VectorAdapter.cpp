@@ -19,6 +19,7 @@ const char* TENSOR = "tensor";
 const char* ROWS = "rows";
 const char* IDS = "ids";
 const char* DISTANCE = "distance";
+const char* LIMS = "lims";
 };  // namespace meta
 
 }  // namespace knowhere
@@ -22,6 +22,7 @@ extern const char* TENSOR;
 extern const char* ROWS;
 extern const char* IDS;
 extern const char* DISTANCE;
+extern const char* LIMS;
 };  // namespace meta
 
 #define GETTENSOR(dataset)                         \
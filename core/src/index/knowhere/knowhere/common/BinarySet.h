@@ -25,6 +25,8 @@ struct Binary {
     ID id;
     std::shared_ptr<uint8_t> data;
     int64_t size = 0;
+    // data points into a read-only file mapping, a loaded index may keep pointers into it
+    bool mapped = false;
 };
 using BinaryPtr = std::shared_ptr<Binary>;
 
@@ -34,11 +34,25 @@ constexpr int64_t DEFAULT_DIM = INVALID_VALUE;
 constexpr int64_t DEFAULT_GPUID = INVALID_VALUE;
 constexpr METRICTYPE DEFAULT_TYPE = METRICTYPE::INVALID;
 
+// precision raw vectors are stored in by flat and IVF flat indexes, queries are always float
+enum class StorageType {
+    FP32 = 0,
+    FP16 = 1,
+    BF16 = 2,
+};
+
 struct Cfg {
     METRICTYPE metric_type = DEFAULT_TYPE;
     int64_t k = DEFAULT_K;
     int64_t gpu_id = DEFAULT_GPUID;
     int64_t d = DEFAULT_DIM;
+    // per query distance a result must beat, e.g. the k-th distance found in other segments, size nq (optional)
+    const float* distance_bound = nullptr;
+    // deleted vectors to skip, bit i & 7 of byte i >> 3 stands for the i-th id of GetIds() (optional)
+    const uint8_t* bitset = nullptr;
+    StorageType storage_type = StorageType::FP32;
+    // RangeSearch returns every vector closer than radius, squared distance for L2 and similarity for IP
+    float radius = 0;
 
     Cfg(const int64_t& dim, const int64_t& k, const int64_t& gpu_id, METRICTYPE type)
         : metric_type(type), k(k), gpu_id(gpu_id), d(dim) {
@@ -46,6 +60,14 @@ struct Cfg {
 
     Cfg() = default;
 
+    virtual ~Cfg() = default;
+
+    // copy of the concrete config, to set per search fields without touching the caller's one
+    virtual std::shared_ptr<Cfg>
+    Clone() const {
+        return std::make_shared<Cfg>(*this);
+    }
+
     virtual bool
     CheckValid() {
         if (metric_type == METRICTYPE::IP || metric_type == METRICTYPE::L2) {
@@ -65,7 +87,8 @@ struct Cfg {
     virtual std::stringstream
     DumpImpl() {
         std::stringstream ss;
-        ss << "dim: " << d << ", metric: " << int(metric_type) << ", gpuid: " << gpu_id << ", k: " << k;
+        ss << "dim: " << d << ", metric: " << int(metric_type) << ", gpuid: " << gpu_id << ", k: " << k
+           << ", storage: " << int(storage_type);
         return ss;
     }
 };
@@ -9,10 +9,13 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include <faiss/impl/AuxIndexStructures.h>
 #include <faiss/index_io.h>
 #include <fiu-local.h>
+#include <cstring>
 #include <utility>
 
+#include "knowhere/adapter/VectorAdapter.h"
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/FaissBaseIndex.h"
 #include "knowhere/index/vector_index/IndexIVF.h"
@@ -53,9 +56,18 @@ FaissBaseIndex::LoadImpl(const BinarySet& index_binary) {
     reader.total = binary->size;
     reader.data_ = binary->data.get();
 
-    faiss::Index* index = faiss::read_index(&reader);
+    // only a mapped file outlives the load without being copied, a heap binary is dropped by the caller;
+    // inverted lists of GPU builds go to page-locked memory for fast host-to-device copy
+    int io_flags = 0;
+#ifndef MILVUS_GPU_VERSION
+    if (binary->mapped) {
+        io_flags = faiss::IO_FLAG_ZERO_COPY;
+    }
+#endif
+    faiss::Index* index = faiss::read_index(&reader, io_flags);
 
     index_.reset(index);
+    index_binary_ = reader.borrowed ? binary : nullptr;
 
     SealImpl();
 }
@@ -74,4 +86,23 @@ FaissBaseIndex::SealImpl() {
 #endif
 }
 
+DatasetPtr
+FaissBaseIndex::RangeResultToDataset(int64_t n, const faiss::RangeSearchResult& result) {
+    auto total = result.lims[n];
+    auto p_lims = (int64_t*)malloc(sizeof(int64_t) * (n + 1));
+    auto p_id = (int64_t*)malloc(sizeof(int64_t) * total);
+    auto p_dist = (float*)malloc(sizeof(float) * total);
+    for (int64_t i = 0; i <= n; ++i) {
+        p_lims[i] = result.lims[i];
+    }
+    memcpy(p_id, result.labels, sizeof(int64_t) * total);
+    memcpy(p_dist, result.distances, sizeof(float) * total);
+
+    auto ret_ds = std::make_shared<Dataset>();
+    ret_ds->Set(meta::LIMS, p_lims);
+    ret_ds->Set(meta::IDS, p_id);
+    ret_ds->Set(meta::DISTANCE, p_dist);
+    return ret_ds;
+}
+
 }  // namespace knowhere
@@ -16,6 +16,7 @@
 #include <faiss/Index.h>
 
 #include "knowhere/common/BinarySet.h"
+#include "knowhere/common/Dataset.h"
 
 namespace knowhere {
 
@@ -32,8 +33,16 @@ class FaissBaseIndex {
     virtual void
     SealImpl();
 
+    // copy a faiss range search result of n queries into a dataset with meta::LIMS, meta::IDS and meta::DISTANCE
+    static DatasetPtr
+    RangeResultToDataset(int64_t n, const faiss::RangeSearchResult& result);
+
  public:
     std::shared_ptr<faiss::Index> index_ = nullptr;
+
+ protected:
+    // serialized buffer the loaded index still points into, see IO_FLAG_ZERO_COPY
+    BinaryPtr index_binary_ = nullptr;
 };
 
 }  // namespace knowhere
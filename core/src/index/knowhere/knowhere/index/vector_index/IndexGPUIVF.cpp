@@ -9,11 +9,14 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include <faiss/gpu/GpuCloner.h>
 #include <faiss/gpu/GpuIndexIVF.h>
 #include <faiss/gpu/GpuIndexIVFFlat.h>
+#include <faiss/gpu/utils/DeviceUtils.h>
 #include <faiss/index_io.h>
 #include <fiu-local.h>
 
@@ -131,6 +134,16 @@ GPUIVF::search_impl(int64_t n, const float* data, int64_t k, float* distances, i
         device_index->nprobe = search_cfg->nprobe;
         // assert(device_index->getNumProbes() == search_cfg->nprobe);
         ResScope rs(res_, gpu_id_);
+
+        // candidates from the device, re-ranked on the host against the raw vectors shared with the cpu index
+        int64_t nc = std::min<int64_t>(k * refine_factor(cfg), faiss::gpu::getMaxKSelection());
+        if (nc > k) {
+            std::vector<float> candidate_dis(n * nc);
+            std::vector<int64_t> candidates(n * nc);
+            device_index->search(n, (float*)data, nc, candidate_dis.data(), candidates.data());
+            refine_candidates(n, data, k, nc, candidates.data(), distances, labels, search_cfg->distance_bound);
+            return;
+        }
         device_index->search(n, (float*)data, k, distances, labels);
     } else {
         KNOWHERE_THROW_MSG("Not a GpuIndexIVF type.");
@@ -147,9 +160,13 @@ GPUIVF::CopyGpuToCpu(const Config& config) {
 
         std::shared_ptr<faiss::Index> new_index;
         new_index.reset(host_index);
-        return std::make_shared<IVF>(new_index);
+        auto host_ivf = std::make_shared<IVF>(new_index);
+        share_refine_index(*host_ivf);
+        return host_ivf;
     } else {
-        return std::make_shared<IVF>(index_);
+        auto host_ivf = std::make_shared<IVF>(index_);
+        share_refine_index(*host_ivf);
+        return host_ivf;
     }
 }
 
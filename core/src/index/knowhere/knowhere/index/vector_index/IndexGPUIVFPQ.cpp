@@ -69,7 +69,9 @@ GPUIVFPQ::CopyGpuToCpu(const Config& config) {
 
     std::shared_ptr<faiss::Index> new_index;
     new_index.reset(host_index);
-    return std::make_shared<IVFPQ>(new_index);
+    auto host_ivf = std::make_shared<IVFPQ>(new_index);
+    share_refine_index(*host_ivf);
+    return host_ivf;
 }
 
 }  // namespace knowhere
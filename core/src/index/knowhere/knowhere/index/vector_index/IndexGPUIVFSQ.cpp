@@ -63,7 +63,9 @@ GPUIVFSQ::CopyGpuToCpu(const Config& config) {
 
     std::shared_ptr<faiss::Index> new_index;
     new_index.reset(host_index);
-    return std::make_shared<IVFSQ>(new_index);
+    auto host_ivf = std::make_shared<IVFSQ>(new_index);
+    share_refine_index(*host_ivf);
+    return host_ivf;
 }
 
 }  // namespace knowhere
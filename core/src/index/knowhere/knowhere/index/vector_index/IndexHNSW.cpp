@@ -81,7 +81,8 @@ IndexHNSW::Search(const DatasetPtr& dataset, const Config& config) {
 #pragma omp parallel for
     for (unsigned int i = 0; i < rows; ++i) {
         const float* single_query = p_data + i * dim;
-        std::vector<std::pair<float, int64_t>> ret = index_->searchKnn(single_query, config->k, compare);
+        std::vector<std::pair<float, int64_t>> ret =
+            index_->searchKnn(single_query, config->k, compare, config->bitset);
         while (ret.size() < config->k) {
             ret.push_back(std::make_pair(-1, -1));
         }
@@ -163,4 +164,16 @@ IndexHNSW::Dimension() {
     return (*(size_t*)index_->dist_func_param_);
 }
 
+std::vector<int64_t>
+IndexHNSW::GetIds() {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    std::vector<int64_t> ids(index_->cur_element_count);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ids[i] = index_->getExternalLabel(i);
+    }
+    return ids;
+}
+
 }  // namespace knowhere
@@ -55,6 +55,10 @@ class IndexHNSW : public VectorIndex {
     int64_t
     Dimension() override;
 
+    // ids in the order of the internal ids of the graph
+    std::vector<int64_t>
+    GetIds() override;
+
  private:
     std::mutex mutex_;
     std::shared_ptr<hnswlib::HierarchicalNSW<float>> index_;
@@ -10,12 +10,16 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include <faiss/IndexFlat.h>
+#include <faiss/IndexScalarQuantizer.h>
 #include <faiss/MetaIndexes.h>
 
 #include <faiss/AutoTune.h>
 #include <faiss/clone_index.h>
+#include <faiss/impl/AuxIndexStructures.h>
 #include <faiss/index_factory.h>
 #include <faiss/index_io.h>
+#include <faiss/utils/Heap.h>
+#include <faiss/utils/distances.h>
 
 #ifdef MILVUS_GPU_VERSION
 
@@ -23,6 +27,7 @@
 
 #endif
 
+#include <memory>
 #include <vector>
 
 #include "knowhere/adapter/VectorAdapter.h"
@@ -39,6 +44,40 @@
 
 namespace knowhere {
 
+namespace {
+
+// brute force over the codes of a half precision index, seeded with the bound and skipping deleted rows,
+// labels are row offsets
+template <class C>
+void
+SearchCodes(const faiss::IndexScalarQuantizer* sq_index, int64_t n, const float* data, int64_t k, float* distances,
+            int64_t* labels, const float* bound, const uint8_t* bitset) {
+#pragma omp parallel for
+    for (int64_t i = 0; i < n; ++i) {
+        std::unique_ptr<faiss::DistanceComputer> dc(sq_index->get_distance_computer());
+        dc->set_query(data + i * sq_index->d);
+        float* heap_dis = distances + i * k;
+        int64_t* heap_ids = labels + i * k;
+        faiss::heap_heapify<C>(k, heap_dis, heap_ids);
+        if (bound != nullptr) {
+            faiss::heap_seed<C>(k, heap_dis, heap_ids, bound[i]);
+        }
+        for (int64_t j = 0; j < sq_index->ntotal; ++j) {
+            if (bitset != nullptr && faiss::bitset_test(bitset, j)) {
+                continue;
+            }
+            float dis = (*dc)(j);
+            if (C::cmp(heap_dis[0], dis)) {
+                faiss::heap_pop<C>(k, heap_dis, heap_ids);
+                faiss::heap_push<C>(k, heap_dis, heap_ids, dis, j);
+            }
+        }
+        faiss::heap_reorder<C>(k, heap_dis, heap_ids);
+    }
+}
+
+}  // namespace
+
 BinarySet
 IDMAP::Serialize() {
     if (!index_) {
@@ -68,7 +107,7 @@ IDMAP::Search(const DatasetPtr& dataset, const Config& config) {
     auto p_id = (int64_t*)malloc(p_id_size);
     auto p_dist = (float*)malloc(p_dist_size);
 
-    search_impl(rows, (float*)p_data, config->k, p_dist, p_id, Config());
+    search_impl(rows, (float*)p_data, config->k, p_dist, p_id, config);
 
     auto ret_ds = std::make_shared<Dataset>();
     ret_ds->Set(meta::IDS, p_id);
@@ -76,9 +115,80 @@ IDMAP::Search(const DatasetPtr& dataset, const Config& config) {
     return ret_ds;
 }
 
+DatasetPtr
+IDMAP::RangeSearch(const DatasetPtr& dataset, const Config& config) {
+    if (!index_) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    GETTENSOR(dataset)
+
+    try {
+        faiss::RangeSearchResult res(rows);
+        auto id_index = dynamic_cast<faiss::IndexIDMap*>(index_.get());
+        if (config->bitset == nullptr || id_index == nullptr) {
+            index_->range_search(rows, (float*)p_data, config->radius, &res);
+            return RangeResultToDataset(rows, res);
+        }
+
+        // search by offset, drop the deleted rows and map the rest to ids
+        id_index->index->range_search(rows, (float*)p_data, config->radius, &res);
+        size_t count = 0;
+        for (int64_t i = 0; i < rows; ++i) {
+            size_t begin = res.lims[i], end = res.lims[i + 1];
+            res.lims[i] = count;
+            for (size_t j = begin; j < end; ++j) {
+                if (!faiss::bitset_test(config->bitset, res.labels[j])) {
+                    res.labels[count] = id_index->id_map[res.labels[j]];
+                    res.distances[count++] = res.distances[j];
+                }
+            }
+        }
+        res.lims[rows] = count;
+        return RangeResultToDataset(rows, res);
+    } catch (faiss::FaissException& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
 void
 IDMAP::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg) {
-    index_->search(n, (float*)data, k, distances, labels);
+    auto id_index = dynamic_cast<faiss::IndexIDMap*>(index_.get());
+    auto flat_index = id_index ? dynamic_cast<faiss::IndexFlat*>(id_index->index) : nullptr;
+    auto sq_index = id_index ? dynamic_cast<faiss::IndexScalarQuantizer*>(id_index->index) : nullptr;
+    bool bounded = cfg != nullptr && cfg->distance_bound != nullptr;
+    bool filtered = cfg != nullptr && cfg->bitset != nullptr;
+    if ((!filtered && !bounded) || (flat_index == nullptr && sq_index == nullptr) ||
+        (id_index->metric_type != faiss::METRIC_L2 && id_index->metric_type != faiss::METRIC_INNER_PRODUCT)) {
+        index_->search(n, (float*)data, k, distances, labels);
+        return;
+    }
+
+    // seed the result heaps with the bound and skip deleted rows, same as IndexFlat::search otherwise;
+    // half precision rows are scored on their codes, nothing is decoded
+    if (sq_index != nullptr) {
+        if (id_index->metric_type == faiss::METRIC_INNER_PRODUCT) {
+            SearchCodes<faiss::CMin<float, int64_t>>(sq_index, n, data, k, distances, labels, cfg->distance_bound,
+                                                     cfg->bitset);
+        } else {
+            SearchCodes<faiss::CMax<float, int64_t>>(sq_index, n, data, k, distances, labels, cfg->distance_bound,
+                                                     cfg->bitset);
+        }
+    } else if (id_index->metric_type == faiss::METRIC_INNER_PRODUCT) {
+        faiss::float_minheap_array_t res = {size_t(n), size_t(k), labels, distances};
+        faiss::knn_inner_product(data, flat_index->xb.data(), id_index->d, n, id_index->ntotal, &res,
+                                 cfg->distance_bound, cfg->bitset);
+    } else {
+        faiss::float_maxheap_array_t res = {size_t(n), size_t(k), labels, distances};
+        faiss::knn_L2sqr(data, flat_index->xb.data(), id_index->d, n, id_index->ntotal, &res, cfg->distance_bound,
+                         cfg->bitset);
+    }
+
+    auto& id_map = id_index->id_map;
+    for (int64_t i = 0; i < n * k; ++i) {
+        if (labels[i] >= 0) {
+            labels[i] = id_map[labels[i]];
+        }
+    }
 }
 
 void
@@ -125,13 +235,46 @@ const float*
 IDMAP::GetRawVectors() {
     try {
         auto file_index = dynamic_cast<faiss::IndexIDMap*>(index_.get());
-        auto flat_index = dynamic_cast<faiss::IndexFlat*>(file_index->index);
-        return flat_index->xb.data();
+        if (auto flat_index = dynamic_cast<faiss::IndexFlat*>(file_index->index)) {
+            return flat_index->xb.data();
+        }
+        KNOWHERE_THROW_MSG("raw vectors are not available");
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
+const float*
+IDMAP::GetRawVectors(std::vector<float>& buffer) {
+    try {
+        auto file_index = dynamic_cast<faiss::IndexIDMap*>(index_.get());
+        if (auto flat_index = dynamic_cast<faiss::IndexFlat*>(file_index->index)) {
+            return flat_index->xb.data();
+        }
+
+        // half precision vectors are decoded into the caller's buffer, they are read to build an index or
+        // merge files and dropped afterwards
+        auto sq_index = dynamic_cast<faiss::IndexScalarQuantizer*>(file_index->index);
+        if (sq_index == nullptr) {
+            KNOWHERE_THROW_MSG("raw vectors are not available");
+        }
+        buffer.resize(sq_index->ntotal * sq_index->d);
+        sq_index->reconstruct_n(0, sq_index->ntotal, buffer.data());
+        return buffer.data();
     } catch (std::exception& e) {
         KNOWHERE_THROW_MSG(e.what());
     }
 }
 
+std::vector<int64_t>
+IDMAP::GetIds() {
+    auto id_index = dynamic_cast<faiss::IndexIDMap*>(index_.get());
+    if (id_index == nullptr) {
+        KNOWHERE_THROW_MSG("index not initialize");
+    }
+    return id_index->id_map;
+}
+
 const int64_t*
 IDMAP::GetRawIds() {
     try {
@@ -147,6 +290,11 @@ IDMAP::Train(const Config& config) {
     config->CheckValid();
 
     const char* type = "IDMap,Flat";
+    if (config->storage_type == StorageType::FP16) {
+        type = "IDMap,SQfp16";
+    } else if (config->storage_type == StorageType::BF16) {
+        type = "IDMap,SQbf16";
+    }
     auto index = faiss::index_factory(config->d, type, GetMetricType(config->metric_type));
     index_.reset(index);
 }
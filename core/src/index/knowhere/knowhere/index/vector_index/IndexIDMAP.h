@@ -15,6 +15,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace knowhere {
 
@@ -38,9 +39,15 @@ class IDMAP : public VectorIndex, public FaissBaseIndex {
     DatasetPtr
     Search(const DatasetPtr& dataset, const Config& config) override;
 
+    DatasetPtr
+    RangeSearch(const DatasetPtr& dataset, const Config& config) override;
+
     int64_t
     Count() override;
 
+    std::vector<int64_t>
+    GetIds() override;
+
     //    VectorIndexPtr
     //    Clone() override;
 
@@ -58,9 +65,14 @@ class IDMAP : public VectorIndex, public FaissBaseIndex {
     void
     Seal() override;
 
+    // vectors of a full precision index
     virtual const float*
     GetRawVectors();
 
+    // vectors of a full precision index, or those of a half precision index decoded into buffer
+    const float*
+    GetRawVectors(std::vector<float>& buffer);
+
     virtual const int64_t*
     GetRawIds();
 
@@ -15,17 +15,25 @@
 #include <faiss/IndexIVF.h>
 #include <faiss/IndexIVFFlat.h>
 #include <faiss/IndexIVFPQ.h>
+#include <faiss/IndexScalarQuantizer.h>
+#include <faiss/MetaIndexes.h>
 #include <faiss/clone_index.h>
+#include <faiss/impl/AuxIndexStructures.h>
 #include <faiss/index_factory.h>
 #include <faiss/index_io.h>
+#include <faiss/utils/Heap.h>
+#include <faiss/utils/distances.h>
 #ifdef MILVUS_GPU_VERSION
 #include <faiss/gpu/GpuAutoTune.h>
 #include <faiss/gpu/GpuCloner.h>
 #endif
 
 #include <fiu-local.h>
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -36,9 +44,102 @@
 #include "knowhere/index/vector_index/IndexGPUIVF.h"
 #endif
 #include "knowhere/index/vector_index/IndexIVF.h"
+#include "knowhere/index/vector_index/helpers/FaissIO.h"
 
 namespace knowhere {
 
+namespace {
+
+// vectors of one list scored per block, bounds the decoded block of a scalar quantizer list
+constexpr int64_t QUERY_MAJOR_BLOCK_SIZE = 4096;
+
+// queries of a group scored per gemm, bounds the score tile at QUERY_MAJOR_TILE_SIZE * QUERY_MAJOR_BLOCK_SIZE
+constexpr int64_t QUERY_MAJOR_TILE_SIZE = 64;
+
+// sorted top-k of one block for every query of a group. The group x block tile is scored with a gemm on the calling
+// thread: this runs inside the parallel loop over the lists, where faiss::knn_* would open nested omp regions
+template <class C>
+void
+ScoreBlock(int64_t group_size, const float* queries, const float* vectors, int64_t d, int64_t block_size,
+           int64_t k, bool is_ip, std::vector<float>& scores, std::vector<float>& norms, float* block_dis,
+           int64_t* block_labels) {
+    if (!is_ip) {
+        norms.resize(block_size);
+        for (int64_t j = 0; j < block_size; ++j) {
+            norms[j] = faiss::fvec_norm_L2sqr(vectors + j * d, d);
+        }
+    }
+
+    for (int64_t begin = 0; begin < group_size; begin += QUERY_MAJOR_TILE_SIZE) {
+        int64_t tile_size = std::min(QUERY_MAJOR_TILE_SIZE, group_size - begin);
+        scores.resize(tile_size * block_size);
+        if (is_ip) {
+            faiss::fvec_inner_products_tile(scores.data(), queries + begin * d, vectors, d, tile_size, block_size);
+        } else {
+            faiss::fvec_L2sqr_tile(scores.data(), queries + begin * d, vectors, norms.data(), d, tile_size,
+                                   block_size);
+        }
+
+        for (int64_t i = 0; i < tile_size; ++i) {
+            const float* dis = scores.data() + i * block_size;
+            float* heap_dis = block_dis + (begin + i) * k;
+            int64_t* heap_ids = block_labels + (begin + i) * k;
+            faiss::heap_heapify<C>(k, heap_dis, heap_ids);
+            for (int64_t j = 0; j < block_size; ++j) {
+                if (C::cmp(heap_dis[0], dis[j])) {
+                    faiss::heap_pop<C>(k, heap_dis, heap_ids);
+                    faiss::heap_push<C>(k, heap_dis, heap_ids, dis[j], j);
+                }
+            }
+            faiss::heap_reorder<C>(k, heap_dis, heap_ids);
+        }
+    }
+}
+
+// push the sorted top-k of one block into the result heap of a query
+template <class C>
+void
+MergeBlockResult(int64_t k, float* heap_dis, int64_t* heap_ids, const float* block_dis, const int64_t* block_labels,
+                 const faiss::Index::idx_t* ids) {
+    for (int64_t j = 0; j < k; ++j) {
+        if (block_labels[j] < 0 || !C::cmp(heap_dis[0], block_dis[j])) {
+            break;
+        }
+        faiss::heap_pop<C>(k, heap_dis, heap_ids);
+        faiss::heap_push<C>(k, heap_dis, heap_ids, block_dis[j], ids[block_labels[j]]);
+    }
+}
+
+// keep the k best candidates by exact distance, sorted, slots that don't beat the bound are -1;
+// candidates without a raw vector are skipped
+template <class C, class RawVector, class Distance>
+void
+RerankCandidates(int64_t k, float* heap_dis, int64_t* heap_ids, int64_t nc, const int64_t* candidates,
+                 const float* bound, RawVector raw_vector, Distance distance) {
+    faiss::heap_heapify<C>(k, heap_dis, heap_ids);
+    if (bound != nullptr) {
+        faiss::heap_seed<C>(k, heap_dis, heap_ids, *bound);
+    }
+    for (int64_t j = 0; j < nc; ++j) {
+        if (candidates[j] < 0) {
+            continue;
+        }
+        const float* x = raw_vector(candidates[j]);
+        if (x == nullptr) {
+            continue;
+        }
+        float dis = distance(x);
+        if (C::cmp(heap_dis[0], dis)) {
+            faiss::heap_pop<C>(k, heap_dis, heap_ids);
+            faiss::heap_push<C>(k, heap_dis, heap_ids, dis, candidates[j]);
+        }
+    }
+    faiss::heap_reorder<C>(k, heap_dis, heap_ids);
+}
+
+}  // namespace
+
+
 using stdclock = std::chrono::high_resolution_clock;
 
 IndexModelPtr
@@ -50,9 +151,22 @@ IVF::Train(const DatasetPtr& dataset, const Config& config) {
 
     GETTENSOR(dataset)
 
-    faiss::Index* coarse_quantizer = new faiss::IndexFlatL2(dim);
-    auto index = std::make_shared<faiss::IndexIVFFlat>(coarse_quantizer, dim, build_cfg->nlist,
-                                                       GetMetricType(build_cfg->metric_type));
+    // a trained quantizer with nlist centroids is not trained again
+    faiss::Index* coarse_quantizer = CloneCoarseQuantizer(dim, build_cfg->nlist);
+    if (coarse_quantizer == nullptr) {
+        coarse_quantizer = new faiss::IndexFlatL2(dim);
+    }
+    std::shared_ptr<faiss::IndexIVF> index;
+    if (build_cfg->storage_type == StorageType::FP32) {
+        index = std::make_shared<faiss::IndexIVFFlat>(coarse_quantizer, dim, build_cfg->nlist,
+                                                      GetMetricType(build_cfg->metric_type));
+    } else {
+        // the vectors themselves in half precision, not their residuals, same layout as IVFFlat at half the size
+        index = std::make_shared<faiss::IndexIVFScalarQuantizer>(coarse_quantizer, dim, build_cfg->nlist,
+                                                                 GetHalfQuantizerType(build_cfg->storage_type),
+                                                                 GetMetricType(build_cfg->metric_type), false);
+    }
+    index->own_fields = true;
     index->train(rows, (float*)p_data);
 
     // TODO(linxj): override here. train return model or not.
@@ -70,6 +184,15 @@ IVF::Add(const DatasetPtr& dataset, const Config& config) {
 
     auto p_ids = dataset->Get<const int64_t*>(meta::IDS);
     index_->add_with_ids(rows, (float*)p_data, p_ids);
+
+    auto build_cfg = std::dynamic_pointer_cast<IVFCfg>(config);
+    if (build_cfg != nullptr && build_cfg->refine) {
+        if (refine_index_ == nullptr) {
+            refine_index_ = std::make_shared<faiss::IndexIDMap2>(new faiss::IndexFlat(dim, index_->metric_type));
+            refine_index_->own_fields = true;
+        }
+        refine_index_->add_with_ids(rows, (float*)p_data, p_ids);
+    }
 }
 
 void
@@ -91,13 +214,38 @@ IVF::Serialize() {
     }
 
     std::lock_guard<std::mutex> lk(mutex_);
-    return SerializeImpl();
+    auto res_set = SerializeImpl();
+    if (refine_index_ != nullptr) {
+        try {
+            MemoryIOWriter writer;
+            faiss::write_index(refine_index_.get(), &writer);
+            auto data = std::make_shared<uint8_t>();
+            data.reset(writer.data_);
+            res_set.Append("REFINE", data, writer.rp);
+        } catch (std::exception& e) {
+            KNOWHERE_THROW_MSG(e.what());
+        }
+    }
+    return res_set;
 }
 
 void
 IVF::Load(const BinarySet& index_binary) {
     std::lock_guard<std::mutex> lk(mutex_);
     LoadImpl(index_binary);
+
+    refine_index_ = nullptr;
+    auto iter = index_binary.binary_map_.find("REFINE");
+    if (iter != index_binary.binary_map_.end()) {
+        MemoryIOReader reader;
+        reader.total = iter->second->size;
+        reader.data_ = iter->second->data.get();
+        auto refine_index = dynamic_cast<faiss::IndexIDMap2*>(faiss::read_index(&reader));
+        if (refine_index == nullptr) {
+            KNOWHERE_THROW_MSG("raw vectors for refine are not an id map");
+        }
+        refine_index_.reset(refine_index);
+    }
 }
 
 DatasetPtr
@@ -149,6 +297,33 @@ IVF::Search(const DatasetPtr& dataset, const Config& config) {
     }
 }
 
+DatasetPtr
+IVF::RangeSearch(const DatasetPtr& dataset, const Config& config) {
+    if (!index_ || !index_->is_trained) {
+        KNOWHERE_THROW_MSG("index not initialize or trained");
+    }
+
+    auto search_cfg = std::dynamic_pointer_cast<IVFCfg>(config);
+    if (search_cfg == nullptr) {
+        KNOWHERE_THROW_MSG("not support this kind of config");
+    }
+
+    GETTENSOR(dataset)
+
+    try {
+        // nprobe goes with the parameters, the index object is shared by concurrent searches
+        auto params = GenParams(config);
+        faiss::RangeSearchResult res(rows);
+        faiss::ivflib::range_search_with_parameters(index_.get(), rows, (float*)p_data, search_cfg->radius, &res,
+                                                    params.get());
+        return RangeResultToDataset(rows, res);
+    } catch (faiss::FaissException& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    } catch (std::exception& e) {
+        KNOWHERE_THROW_MSG(e.what());
+    }
+}
+
 void
 IVF::set_index_model(IndexModelPtr model) {
     std::lock_guard<std::mutex> lk(mutex_);
@@ -157,6 +332,78 @@ IVF::set_index_model(IndexModelPtr model) {
 
     // Deep copy here.
     index_.reset(faiss::clone_index(rel_model->index_.get()));
+    refine_index_ = nullptr;
+}
+
+QuantizerPtr
+IVF::GetCoarseQuantizer() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    if (ivf_index == nullptr || !ivf_index->is_trained) {
+        return nullptr;
+    }
+    if (coarse_quantizer_ != nullptr && ivf_index->quantizer == coarse_quantizer_->quantizer.get()) {
+        return coarse_quantizer_;
+    }
+
+    auto coarse_quantizer = std::make_shared<IVFCoarseQuantizer>();
+    coarse_quantizer->quantizer.reset(faiss::clone_index(ivf_index->quantizer));
+    coarse_quantizer->size = ivf_index->quantizer->ntotal * ivf_index->quantizer->d * sizeof(float);
+    return coarse_quantizer;
+}
+
+bool
+IVF::SetCoarseQuantizer(const QuantizerPtr& quantizer) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto coarse_quantizer = std::dynamic_pointer_cast<IVFCoarseQuantizer>(quantizer);
+    if (coarse_quantizer == nullptr || coarse_quantizer->quantizer == nullptr) {
+        return false;
+    }
+
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    if (ivf_index == nullptr) {
+        // not trained yet, Train() will clone it
+        coarse_quantizer_ = coarse_quantizer;
+        return false;
+    }
+    if (ivf_index->quantizer == coarse_quantizer->quantizer.get()) {
+        coarse_quantizer_ = coarse_quantizer;
+        return true;
+    }
+    if (!ivf_index->own_fields) {
+        // already points at another shared quantizer
+        return false;
+    }
+
+    // only an identical flat quantizer can be replaced, the assignment of vectors to lists must not change
+    auto own_flat = dynamic_cast<faiss::IndexFlat*>(ivf_index->quantizer);
+    auto shared_flat = dynamic_cast<faiss::IndexFlat*>(coarse_quantizer->quantizer.get());
+    if (own_flat == nullptr || shared_flat == nullptr || own_flat->d != shared_flat->d ||
+        own_flat->metric_type != shared_flat->metric_type || own_flat->xb.size() != shared_flat->xb.size() ||
+        memcmp(own_flat->xb.data(), shared_flat->xb.data(), own_flat->xb.size() * sizeof(float)) != 0) {
+        return false;
+    }
+
+    delete ivf_index->quantizer;
+    ivf_index->quantizer = coarse_quantizer->quantizer.get();
+    ivf_index->own_fields = false;
+    coarse_quantizer_ = coarse_quantizer;
+    return true;
+}
+
+faiss::Index*
+IVF::CloneCoarseQuantizer(int64_t dim, int64_t nlist) {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (coarse_quantizer_ == nullptr || coarse_quantizer_->quantizer == nullptr) {
+        return nullptr;
+    }
+
+    auto& quantizer = coarse_quantizer_->quantizer;
+    if (!quantizer->is_trained || quantizer->d != dim || quantizer->ntotal != nlist) {
+        KNOWHERE_LOG_WARNING << "Shared coarse quantizer doesn't fit dim " << dim << " nlist " << nlist;
+        return nullptr;
+    }
+    return faiss::clone_index(quantizer.get());
 }
 
 std::shared_ptr<faiss::IVFSearchParameters>
@@ -165,6 +412,8 @@ IVF::GenParams(const Config& config) {
 
     auto search_cfg = std::dynamic_pointer_cast<IVFCfg>(config);
     params->nprobe = search_cfg->nprobe;
+    params->distance_bound = search_cfg->distance_bound;
+    params->bitset = search_cfg->bitset;
     // params->max_codes = config.get_with_default("max_codes", size_t(0));
 
     return params;
@@ -180,6 +429,23 @@ IVF::Dimension() {
     return index_->d;
 }
 
+std::vector<int64_t>
+IVF::GetIds() {
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    if (ivf_index == nullptr) {
+        KNOWHERE_THROW_MSG("index not initialize or not on cpu");
+    }
+
+    std::vector<int64_t> ids;
+    ids.reserve(ivf_index->ntotal);
+    auto invlists = ivf_index->invlists;
+    for (size_t l = 0; l < invlists->nlist; ++l) {
+        faiss::InvertedLists::ScopedIds list_ids(invlists, l);
+        ids.insert(ids.end(), list_ids.get(), list_ids.get() + invlists->list_size(l));
+    }
+    return ids;
+}
+
 void
 IVF::GenGraph(const float* data, const int64_t& k, Graph& graph, const Config& config) {
     int64_t K = k + 1;
@@ -216,7 +482,37 @@ IVF::GenGraph(const float* data, const int64_t& k, Graph& graph, const Config& c
 
 void
 IVF::search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg) {
+    auto search_cfg = std::dynamic_pointer_cast<IVFCfg>(cfg);
+    const float* bound = (search_cfg != nullptr) ? search_cfg->distance_bound : nullptr;
+    int64_t factor = refine_factor(cfg);
+    if (factor > 1) {
+        // approximate distances may miss the bound while the exact ones beat it, only the re-ranking applies it
+        int64_t nc = k * factor;
+        std::vector<float> candidate_dis(n * nc);
+        std::vector<int64_t> candidates(n * nc);
+        search_quantized(n, data, nc, candidate_dis.data(), candidates.data(), cfg, nullptr);
+        refine_candidates(n, data, k, nc, candidates.data(), distances, labels, bound);
+        return;
+    }
+    search_quantized(n, data, k, distances, labels, cfg, bound);
+}
+
+void
+IVF::search_quantized(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg,
+                      const float* bound) {
+    auto search_cfg = std::dynamic_pointer_cast<IVFCfg>(cfg);
+    // the list major scan skips deleted entries, the query major one doesn't
+    if (search_cfg != nullptr && search_cfg->query_major && search_cfg->bitset == nullptr && support_query_major()) {
+        stdclock::time_point before = stdclock::now();
+        search_query_major(n, data, k, distances, labels, search_cfg->nprobe, bound);
+        stdclock::time_point after = stdclock::now();
+        double search_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
+        KNOWHERE_LOG_DEBUG << "IVF query major search cost: " << search_cost << ", nq: " << n;
+        return;
+    }
+
     auto params = GenParams(cfg);
+    params->distance_bound = bound;
     stdclock::time_point before = stdclock::now();
     faiss::ivflib::search_with_parameters(index_.get(), n, (float*)data, k, distances, labels, params.get());
     stdclock::time_point after = stdclock::now();
@@ -228,6 +524,202 @@ IVF::search_impl(int64_t n, const float* data, int64_t k, float* distances, int6
     faiss::indexIVF_stats.search_time = 0;
 }
 
+int64_t
+IVF::refine_factor(const Config& cfg) {
+    auto search_cfg = std::dynamic_pointer_cast<IVFCfg>(cfg);
+    if (refine_index_ == nullptr || search_cfg == nullptr || search_cfg->refine_factor <= 1) {
+        return 1;
+    }
+    if (search_cfg->refine_factor > MAX_REFINE_FACTOR) {
+        KNOWHERE_THROW_MSG("refine_factor should be no more than " + std::to_string(MAX_REFINE_FACTOR));
+    }
+    return search_cfg->refine_factor;
+}
+
+void
+IVF::refine_candidates(int64_t n, const float* data, int64_t k, int64_t nc, const int64_t* candidates,
+                       float* distances, int64_t* labels, const float* bound) {
+    stdclock::time_point before = stdclock::now();
+    auto flat_index = dynamic_cast<faiss::IndexFlat*>(refine_index_->index);
+    const auto& rev_map = refine_index_->rev_map;
+    int64_t d = flat_index->d;
+    bool is_ip = (flat_index->metric_type == faiss::METRIC_INNER_PRODUCT);
+
+    // a list entry without a raw vector is dropped rather than thrown out of the parallel region
+    auto raw_vector = [&](int64_t id) -> const float* {
+        auto iter = rev_map.find(id);
+        return (iter == rev_map.end()) ? nullptr : flat_index->xb.data() + iter->second * d;
+    };
+
+#pragma omp parallel for
+    for (int64_t i = 0; i < n; ++i) {
+        const float* query = data + i * d;
+        const float* query_bound = (bound != nullptr) ? bound + i : nullptr;
+        if (is_ip) {
+            RerankCandidates<faiss::CMin<float, int64_t>>(
+                k, distances + i * k, labels + i * k, nc, candidates + i * nc, query_bound, raw_vector,
+                [&](const float* x) { return faiss::fvec_inner_product(query, x, d); });
+        } else {
+            RerankCandidates<faiss::CMax<float, int64_t>>(
+                k, distances + i * k, labels + i * k, nc, candidates + i * nc, query_bound, raw_vector,
+                [&](const float* x) { return faiss::fvec_L2sqr(query, x, d); });
+        }
+    }
+    stdclock::time_point after = stdclock::now();
+    double refine_cost = (std::chrono::duration<double, std::micro>(after - before)).count();
+    KNOWHERE_LOG_DEBUG << "IVF refine cost: " << refine_cost << ", nq: " << n << ", candidates: " << nc;
+}
+
+void
+IVF::share_refine_index(IVF& copy) const {
+    copy.refine_index_ = refine_index_;
+}
+
+bool
+IVF::support_query_major() {
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    if (ivf_index == nullptr ||
+        (ivf_index->metric_type != faiss::METRIC_L2 && ivf_index->metric_type != faiss::METRIC_INNER_PRODUCT)) {
+        return false;
+    }
+    return dynamic_cast<faiss::IndexIVFFlat*>(ivf_index) != nullptr ||
+           dynamic_cast<faiss::IndexIVFScalarQuantizer*>(ivf_index) != nullptr;
+}
+
+void
+IVF::search_query_major(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, int64_t nprobe,
+                        const float* bound) {
+    auto ivf_index = dynamic_cast<faiss::IndexIVF*>(index_.get());
+    auto sq_index = dynamic_cast<faiss::IndexIVFScalarQuantizer*>(index_.get());
+    auto invlists = ivf_index->invlists;
+    int64_t d = ivf_index->d;
+    int64_t nlist = ivf_index->nlist;
+    bool is_ip = (ivf_index->metric_type == faiss::METRIC_INNER_PRODUCT);
+    nprobe = std::max<int64_t>(1, std::min(nprobe, nlist));
+
+    std::vector<faiss::Index::idx_t> coarse_ids(n * nprobe);
+    std::vector<float> coarse_dis(n * nprobe);
+    stdclock::time_point before = stdclock::now();
+    ivf_index->quantizer->search(n, data, nprobe, coarse_dis.data(), coarse_ids.data());
+    stdclock::time_point after = stdclock::now();
+    faiss::indexIVF_stats.quantization_time += (std::chrono::duration<double, std::milli>(after - before)).count();
+
+    // invert the assignment, the queries probing list l are groups[offsets[l], offsets[l + 1])
+    std::vector<int64_t> offsets(nlist + 1, 0);
+    for (auto list_no : coarse_ids) {
+        if (list_no >= 0) {
+            offsets[list_no + 1]++;
+        }
+    }
+    for (int64_t l = 0; l < nlist; ++l) {
+        offsets[l + 1] += offsets[l];
+    }
+    std::vector<int64_t> groups(offsets[nlist]);
+    std::vector<int64_t> fill(offsets.begin(), offsets.end() - 1);
+    for (int64_t i = 0; i < n * nprobe; ++i) {
+        auto list_no = coarse_ids[i];
+        if (list_no >= 0) {
+            groups[fill[list_no]++] = i / nprobe;
+        }
+    }
+
+    for (int64_t i = 0; i < n; ++i) {
+        if (is_ip) {
+            faiss::minheap_heapify(k, distances + i * k, labels + i * k);
+            if (bound != nullptr) {
+                faiss::heap_seed<faiss::CMin<float, int64_t>>(k, distances + i * k, labels + i * k, bound[i]);
+            }
+        } else {
+            faiss::maxheap_heapify(k, distances + i * k, labels + i * k);
+            if (bound != nullptr) {
+                faiss::heap_seed<faiss::CMax<float, int64_t>>(k, distances + i * k, labels + i * k, bound[i]);
+            }
+        }
+    }
+    std::vector<std::mutex> heap_mutexes(n);
+
+    // every list is streamed once and scored against all the queries probing it
+#pragma omp parallel for schedule(dynamic)
+    for (int64_t l = 0; l < nlist; ++l) {
+        int64_t group_size = offsets[l + 1] - offsets[l];
+        int64_t list_size = invlists->list_size(l);
+        if (group_size == 0 || list_size == 0) {
+            continue;
+        }
+
+        const int64_t* group = groups.data() + offsets[l];
+        std::vector<float> queries(group_size * d);
+        for (int64_t i = 0; i < group_size; ++i) {
+            memcpy(queries.data() + i * d, data + group[i] * d, d * sizeof(float));
+        }
+
+        std::vector<float> centroid;
+        if (sq_index != nullptr && sq_index->by_residual) {
+            centroid.resize(d);
+            ivf_index->quantizer->reconstruct(l, centroid.data());
+        }
+
+        faiss::InvertedLists::ScopedCodes codes(invlists, l);
+        faiss::InvertedLists::ScopedIds ids(invlists, l);
+        std::vector<float> block;
+        std::vector<float> block_scores;
+        std::vector<float> block_norms;
+        std::vector<float> block_dis(group_size * k);
+        std::vector<int64_t> block_labels(group_size * k);
+
+        for (int64_t begin = 0; begin < list_size; begin += QUERY_MAJOR_BLOCK_SIZE) {
+            int64_t block_size = std::min(QUERY_MAJOR_BLOCK_SIZE, list_size - begin);
+            const float* vectors = nullptr;
+            if (sq_index != nullptr) {
+                block.resize(block_size * d);
+                sq_index->sq.decode(codes.get() + begin * sq_index->code_size, block.data(), block_size);
+                if (!centroid.empty()) {
+                    for (int64_t i = 0; i < block_size; ++i) {
+                        for (int64_t j = 0; j < d; ++j) {
+                            block[i * d + j] += centroid[j];
+                        }
+                    }
+                }
+                vectors = block.data();
+            } else {
+                vectors = reinterpret_cast<const float*>(codes.get()) + begin * d;
+            }
+
+            if (is_ip) {
+                ScoreBlock<faiss::CMin<float, int64_t>>(group_size, queries.data(), vectors, d, block_size, k, true,
+                                                        block_scores, block_norms, block_dis.data(),
+                                                        block_labels.data());
+            } else {
+                ScoreBlock<faiss::CMax<float, int64_t>>(group_size, queries.data(), vectors, d, block_size, k, false,
+                                                        block_scores, block_norms, block_dis.data(),
+                                                        block_labels.data());
+            }
+
+            for (int64_t i = 0; i < group_size; ++i) {
+                auto q = group[i];
+                std::lock_guard<std::mutex> lk(heap_mutexes[q]);
+                if (is_ip) {
+                    MergeBlockResult<faiss::CMin<float, int64_t>>(k, distances + q * k, labels + q * k,
+                                                                  block_dis.data() + i * k,
+                                                                  block_labels.data() + i * k, ids.get() + begin);
+                } else {
+                    MergeBlockResult<faiss::CMax<float, int64_t>>(k, distances + q * k, labels + q * k,
+                                                                  block_dis.data() + i * k,
+                                                                  block_labels.data() + i * k, ids.get() + begin);
+                }
+            }
+        }
+    }
+
+    for (int64_t i = 0; i < n; ++i) {
+        if (is_ip) {
+            faiss::minheap_reorder(k, distances + i * k, labels + i * k);
+        } else {
+            faiss::maxheap_reorder(k, distances + i * k, labels + i * k);
+        }
+    }
+}
+
 VectorIndexPtr
 IVF::CopyCpuToGpu(const int64_t& device_id, const Config& config) {
 #ifdef MILVUS_GPU_VERSION
@@ -238,7 +730,9 @@ IVF::CopyCpuToGpu(const int64_t& device_id, const Config& config) {
 
         std::shared_ptr<faiss::Index> device_index;
         device_index.reset(gpu_index);
-        return std::make_shared<GPUIVF>(device_index, device_id, res);
+        auto device_ivf = std::make_shared<GPUIVF>(device_index, device_id, res);
+        share_refine_index(*device_ivf);
+        return device_ivf;
     } else {
         KNOWHERE_THROW_MSG("CopyCpuToGpu Error, can't get gpu_resource");
     }
@@ -294,4 +788,34 @@ IVFIndexModel::SealImpl() {
     // do nothing
 }
 
+BinarySet
+IVFCoarseQuantizer::Serialize() {
+    if (!quantizer) {
+        KNOWHERE_THROW_MSG("coarse quantizer not initialize");
+    }
+
+    MemoryIOWriter writer;
+    faiss::write_index(quantizer.get(), &writer);
+    auto data = std::make_shared<uint8_t>();
+    data.reset(writer.data_);
+
+    BinarySet res_set;
+    res_set.Append("QUANTIZER", data, writer.rp);
+    return res_set;
+}
+
+void
+IVFCoarseQuantizer::Load(const BinarySet& binary_set) {
+    auto binary = binary_set.GetByName("QUANTIZER");
+    if (binary == nullptr) {
+        KNOWHERE_THROW_MSG("coarse quantizer binary not found");
+    }
+
+    MemoryIOReader reader;
+    reader.total = binary->size;
+    reader.data_ = binary->data.get();
+    quantizer.reset(faiss::read_index(&reader));
+    size = quantizer->ntotal * quantizer->d * sizeof(float);
+}
+
 }  // namespace knowhere
@@ -17,13 +17,27 @@
 #include <vector>
 
 #include "FaissBaseIndex.h"
+#include "Quantizer.h"
 #include "VectorIndex.h"
 #include "faiss/IndexIVF.h"
+#include "faiss/MetaIndexes.h"
 
 namespace knowhere {
 
 using Graph = std::vector<std::vector<int64_t>>;
 
+// coarse quantizer of a trained IVF index, it can be shared by the IVF indexes of one table
+struct IVFCoarseQuantizer : public Quantizer {
+    std::shared_ptr<faiss::Index> quantizer = nullptr;
+
+    BinarySet
+    Serialize();
+
+    void
+    Load(const BinarySet& binary_set);
+};
+using IVFCoarseQuantizerPtr = std::shared_ptr<IVFCoarseQuantizer>;
+
 class IVF : public VectorIndex, public FaissBaseIndex {
  public:
     IVF() : FaissBaseIndex(nullptr) {
@@ -50,6 +64,9 @@ class IVF : public VectorIndex, public FaissBaseIndex {
     DatasetPtr
     Search(const DatasetPtr& dataset, const Config& config) override;
 
+    DatasetPtr
+    RangeSearch(const DatasetPtr& dataset, const Config& config) override;
+
     void
     GenGraph(const float* data, const int64_t& k, Graph& graph, const Config& config);
 
@@ -65,13 +82,30 @@ class IVF : public VectorIndex, public FaissBaseIndex {
     int64_t
     Dimension() override;
 
+    // ids list by list, in the order of the entries within each list
+    std::vector<int64_t>
+    GetIds() override;
+
     void
     Seal() override;
 
     virtual VectorIndexPtr
     CopyCpuToGpu(const int64_t& device_id, const Config& config);
 
+    // copy of the coarse quantizer of the trained index, nullptr if the index is not trained
+    QuantizerPtr
+    GetCoarseQuantizer();
+
+    // Train() reuses the given trained quantizer instead of running k-means on the data;
+    // a loaded index with the same centroids drops its own copy and points at it, return true then
+    bool
+    SetCoarseQuantizer(const QuantizerPtr& quantizer);
+
  protected:
+    // copy of the shared coarse quantizer if it fits dim and nlist, nullptr otherwise
+    faiss::Index*
+    CloneCoarseQuantizer(int64_t dim, int64_t nlist);
+
     virtual std::shared_ptr<faiss::IVFSearchParameters>
     GenParams(const Config& config);
 
@@ -81,8 +115,37 @@ class IVF : public VectorIndex, public FaissBaseIndex {
     virtual void
     search_impl(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg);
 
+    // scan of the quantized lists, bound overrides the distance bound of the config
+    void
+    search_quantized(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, const Config& cfg,
+                     const float* bound);
+
+    // candidates fetched per result for re-ranking, 1 when the index keeps no raw vectors or the config asks for none
+    int64_t
+    refine_factor(const Config& cfg);
+
+    // re-ranks nc candidates per query with exact distances to the raw vectors, candidates without one are dropped
+    void
+    refine_candidates(int64_t n, const float* data, int64_t k, int64_t nc, const int64_t* candidates,
+                      float* distances, int64_t* labels, const float* bound);
+
+    // the raw vectors don't change once the index is built, copies of the index share them
+    void
+    share_refine_index(IVF& copy) const;
+
+    // only flat and scalar quantizer lists can be decoded into float blocks
+    bool
+    support_query_major();
+
+    void
+    search_query_major(int64_t n, const float* data, int64_t k, float* distances, int64_t* labels, int64_t nprobe,
+                       const float* bound);
+
  protected:
     std::mutex mutex_;
+    IVFCoarseQuantizerPtr coarse_quantizer_ = nullptr;
+    // raw vectors by id, kept by Add() when the build config asks for refine
+    std::shared_ptr<faiss::IndexIDMap2> refine_index_ = nullptr;
 };
 
 using IVFIndexPtr = std::shared_ptr<IVF>;
@@ -37,9 +37,13 @@ IVFPQ::Train(const DatasetPtr& dataset, const Config& config) {
 
     GETTENSOR(dataset)
 
-    faiss::Index* coarse_quantizer = new faiss::IndexFlat(dim, GetMetricType(build_cfg->metric_type));
+    faiss::Index* coarse_quantizer = CloneCoarseQuantizer(dim, build_cfg->nlist);
+    if (coarse_quantizer == nullptr) {
+        coarse_quantizer = new faiss::IndexFlat(dim, GetMetricType(build_cfg->metric_type));
+    }
     auto index =
         std::make_shared<faiss::IndexIVFPQ>(coarse_quantizer, dim, build_cfg->nlist, build_cfg->m, build_cfg->nbits);
+    index->own_fields = true;
     index->train(rows, (float*)p_data);
 
     return std::make_shared<IVFIndexModel>(index);
@@ -50,6 +54,8 @@ IVFPQ::GenParams(const Config& config) {
     auto params = std::make_shared<faiss::IVFPQSearchParameters>();
     auto search_cfg = std::dynamic_pointer_cast<IVFPQCfg>(config);
     params->nprobe = search_cfg->nprobe;
+    params->distance_bound = search_cfg->distance_bound;
+    params->bitset = search_cfg->bitset;
     //    params->scan_table_threshold = conf->scan_table_threhold;
     //    params->polysemous_ht = conf->polysemous_ht;
     //    params->max_codes = conf->max_codes;
@@ -71,7 +77,9 @@ IVFPQ::CopyCpuToGpu(const int64_t& device_id, const Config& config) {
 
         std::shared_ptr<faiss::Index> device_index;
         device_index.reset(gpu_index);
-        return std::make_shared<GPUIVFPQ>(device_index, device_id, res);
+        auto device_ivf = std::make_shared<GPUIVFPQ>(device_index, device_id, res);
+        share_refine_index(*device_ivf);
+        return device_ivf;
     } else {
         KNOWHERE_THROW_MSG("CopyCpuToGpu Error, can't get gpu_resource");
     }
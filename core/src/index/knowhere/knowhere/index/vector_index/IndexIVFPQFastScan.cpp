@@ -0,0 +1,68 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <faiss/IndexFlat.h>
+#include <faiss/IndexIVFPQFastScan.h>
+
+#include <memory>
+
+#include "knowhere/adapter/VectorAdapter.h"
+#include "knowhere/common/Exception.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
+
+namespace knowhere {
+
+IndexModelPtr
+IVFPQFastScan::Train(const DatasetPtr& dataset, const Config& config) {
+    auto build_cfg = std::dynamic_pointer_cast<IVFPQCfg>(config);
+    if (build_cfg != nullptr) {
+        build_cfg->CheckValid();  // throw exception
+    }
+
+    GETTENSOR(dataset)
+
+    if (build_cfg->m <= 0 || build_cfg->m % 2 != 0 || dim % build_cfg->m != 0) {
+        KNOWHERE_THROW_MSG("IVFPQFastScan needs an even m dividing the dimension");
+    }
+
+    faiss::Index* coarse_quantizer = CloneCoarseQuantizer(dim, build_cfg->nlist);
+    if (coarse_quantizer == nullptr) {
+        coarse_quantizer = new faiss::IndexFlat(dim, GetMetricType(build_cfg->metric_type));
+    }
+    auto index = std::make_shared<faiss::IndexIVFPQFastScan>(coarse_quantizer, dim, build_cfg->nlist, build_cfg->m,
+                                                             GetMetricType(build_cfg->metric_type));
+    index->own_fields = true;
+    index->train(rows, (float*)p_data);
+
+    return std::make_shared<IVFIndexModel>(index);
+}
+
+VectorIndexPtr
+IVFPQFastScan::CopyCpuToGpu(const int64_t& device_id, const Config& config) {
+    KNOWHERE_THROW_MSG("IVFPQFastScan has no gpu version");
+}
+
+int64_t
+IVFPQFastScan::AuxiliarySize() {
+    std::lock_guard<std::mutex> lk(mutex_);
+    auto fast_scan_index = dynamic_cast<faiss::IndexIVFPQFastScan*>(index_.get());
+    if (fast_scan_index == nullptr) {
+        return 0;
+    }
+
+    int64_t size = 0;
+    for (auto& blocks : fast_scan_index->blocked_codes) {
+        size += blocks.capacity();
+    }
+    return size;
+}
+
+}  // namespace knowhere
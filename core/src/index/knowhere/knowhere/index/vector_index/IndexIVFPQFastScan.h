@@ -0,0 +1,41 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <utility>
+
+#include "IndexIVFPQ.h"
+
+namespace knowhere {
+
+// IVFPQ with 4-bit subquantizers, lists are scanned with SIMD lookup tables, cpu only
+class IVFPQFastScan : public IVFPQ {
+ public:
+    explicit IVFPQFastScan(std::shared_ptr<faiss::Index> index) : IVFPQ(std::move(index)) {
+    }
+
+    IVFPQFastScan() = default;
+
+    // m has to be even, nbits of the config is ignored
+    IndexModelPtr
+    Train(const DatasetPtr& dataset, const Config& config) override;
+
+    VectorIndexPtr
+    CopyCpuToGpu(const int64_t& device_id, const Config& config) override;
+
+    // the blocked copy of the codes the scan reads
+    int64_t
+    AuxiliarySize() override;
+};
+
+}  // namespace knowhere
@@ -13,6 +13,7 @@
 #include <faiss/gpu/GpuAutoTune.h>
 #include <faiss/gpu/GpuCloner.h>
 #endif
+#include <faiss/IndexScalarQuantizer.h>
 #include <faiss/index_factory.h>
 
 #include <memory>
@@ -37,10 +38,38 @@ IVFSQ::Train(const DatasetPtr& dataset, const Config& config) {
 
     GETTENSOR(dataset)
 
-    std::stringstream index_type;
-    index_type << "IVF" << build_cfg->nlist << ","
-               << "SQ" << build_cfg->nbits;
-    auto build_index = faiss::index_factory(dim, index_type.str().c_str(), GetMetricType(build_cfg->metric_type));
+    faiss::Index* build_index = nullptr;
+    faiss::Index* coarse_quantizer = CloneCoarseQuantizer(dim, build_cfg->nlist);
+    if (coarse_quantizer != nullptr) {
+        faiss::ScalarQuantizer::QuantizerType qtype;
+        switch (build_cfg->nbits) {
+            case 4:
+                qtype = faiss::ScalarQuantizer::QT_4bit;
+                break;
+            case 6:
+                qtype = faiss::ScalarQuantizer::QT_6bit;
+                break;
+            case 8:
+                qtype = faiss::ScalarQuantizer::QT_8bit;
+                break;
+            default:
+                delete coarse_quantizer;
+                coarse_quantizer = nullptr;
+                break;
+        }
+        if (coarse_quantizer != nullptr) {
+            auto ivf_index = new faiss::IndexIVFScalarQuantizer(coarse_quantizer, dim, build_cfg->nlist, qtype,
+                                                                 GetMetricType(build_cfg->metric_type));
+            ivf_index->own_fields = true;
+            build_index = ivf_index;
+        }
+    }
+    if (build_index == nullptr) {
+        std::stringstream index_type;
+        index_type << "IVF" << build_cfg->nlist << ","
+                   << "SQ" << build_cfg->nbits;
+        build_index = faiss::index_factory(dim, index_type.str().c_str(), GetMetricType(build_cfg->metric_type));
+    }
     build_index->train(rows, (float*)p_data);
 
     std::shared_ptr<faiss::Index> ret_index;
@@ -64,7 +93,9 @@ IVFSQ::CopyCpuToGpu(const int64_t& device_id, const Config& config) {
 
         std::shared_ptr<faiss::Index> device_index;
         device_index.reset(gpu_index);
-        return std::make_shared<GPUIVFSQ>(device_index, device_id, res);
+        auto device_ivf = std::make_shared<GPUIVFSQ>(device_index, device_id, res);
+        share_refine_index(*device_ivf);
+        return device_ivf;
     } else {
         KNOWHERE_THROW_MSG("CopyCpuToGpu Error, can't get gpu_resource");
     }
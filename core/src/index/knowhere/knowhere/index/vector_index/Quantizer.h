@@ -25,6 +25,11 @@ using QuantizerPtr = std::shared_ptr<Quantizer>;
 
 struct QuantizerCfg : Cfg {
     int64_t mode = -1;  // 0: all data, 1: copy quantizer, 2: copy data
+
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<QuantizerCfg>(*this);
+    }
 };
 using QuantizerConfig = std::shared_ptr<QuantizerCfg>;
 
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "knowhere/common/Config.h"
 #include "knowhere/common/Dataset.h"
@@ -39,6 +40,21 @@ class VectorIndex : public Index {
     virtual void
     Add(const DatasetPtr& dataset, const Config& config) = 0;
 
+    // all vectors within config->radius of each query, the result set has variable length per query:
+    // meta::LIMS holds rows + 1 offsets, the results of query i are IDS and DISTANCE in [lims[i], lims[i + 1])
+    // @throw
+    virtual DatasetPtr
+    RangeSearch(const DatasetPtr& dataset, const Config& config) {
+        KNOWHERE_THROW_MSG("range search is not supported by this index");
+    }
+
+    // ids of the vectors in the order Cfg::bitset refers to them
+    // @throw
+    virtual std::vector<int64_t>
+    GetIds() {
+        KNOWHERE_THROW_MSG("deletion is not supported by this index");
+    }
+
     virtual void
     Seal() = 0;
 
@@ -51,6 +67,12 @@ class VectorIndex : public Index {
 
     virtual int64_t
     Dimension() = 0;
+
+    // bytes held in memory besides the serialized index, e.g. search layouts rebuilt on load
+    virtual int64_t
+    AuxiliarySize() {
+        return 0;
+    }
 };
 
 }  // namespace knowhere
@@ -46,6 +46,11 @@ MemoryIOWriter::operator()(const void* ptr, size_t size, size_t nitems) {
     return nitems;
 }
 
+size_t
+MemoryIOWriter::tell() {
+    return rp;
+}
+
 size_t
 MemoryIOReader::operator()(void* ptr, size_t size, size_t nitems) {
     if (rp >= total)
@@ -58,4 +63,14 @@ MemoryIOReader::operator()(void* ptr, size_t size, size_t nitems) {
     return nitems;
 }
 
+const uint8_t*
+MemoryIOReader::borrow(size_t nbytes, size_t alignment) {
+    if (rp + nbytes > total || reinterpret_cast<uintptr_t>(data_ + rp) % alignment != 0)
+        return nullptr;
+    auto ptr = data_ + rp;
+    rp += nbytes;
+    borrowed = true;
+    return ptr;
+}
+
 }  // namespace knowhere
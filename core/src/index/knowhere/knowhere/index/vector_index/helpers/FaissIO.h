@@ -23,6 +23,9 @@ struct MemoryIOWriter : public faiss::IOWriter {
     size_t
     operator()(const void* ptr, size_t size, size_t nitems) override;
 
+    size_t
+    tell() override;
+
     template <typename T>
     size_t
     write(T* ptr, size_t size, size_t nitems = 1) {
@@ -34,10 +37,14 @@ struct MemoryIOReader : public faiss::IOReader {
     uint8_t* data_;
     size_t rp = 0;
     size_t total = 0;
+    bool borrowed = false;  // set once faiss keeps pointers into data_
 
     size_t
     operator()(void* ptr, size_t size, size_t nitems) override;
 
+    const uint8_t*
+    borrow(size_t nbytes, size_t alignment) override;
+
     template <typename T>
     size_t
     read(T* ptr, size_t size, size_t nitems = 1) {
@@ -38,10 +38,23 @@ GetMetricType(METRICTYPE& type) {
     KNOWHERE_THROW_MSG("Metric type is invalid");
 }
 
+faiss::ScalarQuantizer::QuantizerType
+GetHalfQuantizerType(StorageType type) {
+    if (type == StorageType::FP16) {
+        return faiss::ScalarQuantizer::QT_fp16;
+    }
+    if (type == StorageType::BF16) {
+        return faiss::ScalarQuantizer::QT_bf16;
+    }
+
+    KNOWHERE_THROW_MSG("Storage type is not half precision");
+}
+
 std::stringstream
 IVFCfg::DumpImpl() {
     auto ss = Cfg::DumpImpl();
-    ss << ", nlist: " << nlist << ", nprobe: " << nprobe;
+    ss << ", nlist: " << nlist << ", nprobe: " << nprobe << ", query_major: " << query_major << ", refine: " << refine
+       << ", refine_factor: " << refine_factor;
     return ss;
 }
 
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <faiss/Index.h>
+#include <faiss/impl/ScalarQuantizer.h>
 #include <memory>
 
 #include "knowhere/common/Config.h"
@@ -21,6 +22,10 @@ namespace knowhere {
 extern faiss::MetricType
 GetMetricType(METRICTYPE& type);
 
+// scalar quantizer keeping vectors in the given half precision type, throws for FP32
+extern faiss::ScalarQuantizer::QuantizerType
+GetHalfQuantizerType(StorageType type);
+
 // IVF Config
 constexpr int64_t DEFAULT_NLIST = INVALID_VALUE;
 constexpr int64_t DEFAULT_NPROBE = INVALID_VALUE;
@@ -29,6 +34,7 @@ constexpr int64_t DEFAULT_NBITS = INVALID_VALUE;
 constexpr int64_t DEFAULT_SCAN_TABLE_THREHOLD = INVALID_VALUE;
 constexpr int64_t DEFAULT_POLYSEMOUS_HT = INVALID_VALUE;
 constexpr int64_t DEFAULT_MAX_CODES = INVALID_VALUE;
+constexpr int64_t MAX_REFINE_FACTOR = 32;
 
 // NSG Config
 constexpr int64_t DEFAULT_SEARCH_LENGTH = INVALID_VALUE;
@@ -69,6 +75,13 @@ constexpr int64_t DEFAULT_EF = INVALID_VALUE;
 struct IVFCfg : public Cfg {
     int64_t nlist = DEFAULT_NLIST;
     int64_t nprobe = DEFAULT_NPROBE;
+    // scan the probed lists one by one against all the queries that probe them, for large nq on cpu
+    bool query_major = false;
+    // build: keep the raw vectors next to the quantized codes so that results can be re-ranked exactly
+    bool refine = false;
+    // search: candidates fetched per result and re-ranked exactly, 1 disables it, ignored without raw vectors,
+    // at most MAX_REFINE_FACTOR
+    int64_t refine_factor = 1;
 
     IVFCfg(const int64_t& dim, const int64_t& k, const int64_t& gpu_id, const int64_t& nlist, const int64_t& nprobe,
            METRICTYPE type)
@@ -77,6 +90,11 @@ struct IVFCfg : public Cfg {
 
     IVFCfg() = default;
 
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<IVFCfg>(*this);
+    }
+
     std::stringstream
     DumpImpl() override;
 
@@ -88,6 +106,11 @@ struct IVFCfg : public Cfg {
 using IVFConfig = std::shared_ptr<IVFCfg>;
 
 struct IVFBinCfg : public IVFCfg {
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<IVFBinCfg>(*this);
+    }
+
     bool
     CheckValid() override {
         if (metric_type == METRICTYPE::HAMMING || metric_type == METRICTYPE::TANIMOTO ||
@@ -115,6 +138,11 @@ struct IVFSQCfg : public IVFCfg {
 
     IVFSQCfg() = default;
 
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<IVFSQCfg>(*this);
+    }
+
     //    bool
     //    CheckValid() override {
     //        return true;
@@ -138,6 +166,11 @@ struct IVFPQCfg : public IVFCfg {
 
     IVFPQCfg() = default;
 
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<IVFPQCfg>(*this);
+    }
+
     //    bool
     //    CheckValid() override {
     //        return true;
@@ -163,6 +196,11 @@ struct NSGCfg : public IVFCfg {
 
     NSGCfg() = default;
 
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<NSGCfg>(*this);
+    }
+
     std::stringstream
     DumpImpl() override;
 
@@ -192,6 +230,11 @@ struct SPTAGCfg : public Cfg {
 
     SPTAGCfg() = default;
 
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<SPTAGCfg>(*this);
+    }
+
     //    bool
     //    CheckValid() override {
     //        return true;
@@ -205,6 +248,11 @@ struct KDTCfg : public SPTAGCfg {
 
     KDTCfg() = default;
 
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<KDTCfg>(*this);
+    }
+
     //    bool
     //    CheckValid() override {
     //        return true;
@@ -219,6 +267,11 @@ struct BKTCfg : public SPTAGCfg {
 
     BKTCfg() = default;
 
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<BKTCfg>(*this);
+    }
+
     //    bool
     //    CheckValid() override {
     //        return true;
@@ -227,6 +280,11 @@ struct BKTCfg : public SPTAGCfg {
 using BKTConfig = std::shared_ptr<BKTCfg>;
 
 struct BinIDMAPCfg : public Cfg {
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<BinIDMAPCfg>(*this);
+    }
+
     bool
     CheckValid() override {
         if (metric_type == METRICTYPE::HAMMING || metric_type == METRICTYPE::TANIMOTO ||
@@ -245,6 +303,11 @@ struct HNSWCfg : public Cfg {
     int64_t ef = DEFAULT_EF;
 
     HNSWCfg() = default;
+
+    std::shared_ptr<Cfg>
+    Clone() const override {
+        return std::make_shared<HNSWCfg>(*this);
+    }
 };
 using HNSWConfig = std::shared_ptr<HNSWCfg>;
 
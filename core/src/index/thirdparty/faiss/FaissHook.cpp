@@ -0,0 +1,249 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+#include <faiss/FaissHook.h>
+
+#include <mutex>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+#include <faiss/utils/distances.h>
+#include <faiss/utils/distances_simd.h>
+#include <faiss/impl/ScalarQuantizerDC.h>
+#include <faiss/impl/pq4_fast_scan.h>
+
+
+namespace faiss {
+
+/*********************************************************
+ * Function pointers and their defaults: the kernels built with the
+ * flags of the library. They are defined here rather than next to the
+ * kernels so that any user of a kernel links this file, and with it the
+ * static initializer at the bottom.
+ *********************************************************/
+
+#if defined(__SSE__)
+
+float (*fvec_L2sqr) (const float *, const float *, size_t) =
+        fvec_L2sqr_sse;
+float (*fvec_inner_product) (const float *, const float *, size_t) =
+        fvec_inner_product_sse;
+float (*fvec_norm_L2sqr) (const float *, size_t) = fvec_norm_L2sqr_sse;
+
+#elif defined(__aarch64__)
+
+float (*fvec_L2sqr) (const float *, const float *, size_t) =
+        fvec_L2sqr_neon;
+float (*fvec_inner_product) (const float *, const float *, size_t) =
+        fvec_inner_product_neon;
+float (*fvec_norm_L2sqr) (const float *, size_t) = fvec_norm_L2sqr_neon;
+
+#else
+
+float (*fvec_L2sqr) (const float *, const float *, size_t) = fvec_L2sqr_ref;
+float (*fvec_inner_product) (const float *, const float *, size_t) =
+        fvec_inner_product_ref;
+float (*fvec_norm_L2sqr) (const float *, size_t) = fvec_norm_L2sqr_ref;
+
+#endif
+
+float (*fvec_L1) (const float *, const float *, size_t) = fvec_L1_ref;
+float (*fvec_Linf) (const float *, const float *, size_t) = fvec_Linf_ref;
+
+sq_get_distance_computer_func_ptr sq_get_distance_computer =
+        sq_get_distance_computer_ref;
+sq_sel_quantizer_func_ptr sq_sel_quantizer = sq_sel_quantizer_ref;
+sq_sel_inv_list_scanner_func_ptr sq_sel_inv_list_scanner =
+        sq_sel_inv_list_scanner_ref;
+
+#if defined(__SSSE3__)
+pq4_accumulate_block_func_ptr pq4_accumulate_block =
+        pq4_accumulate_block_sse;
+#else
+pq4_accumulate_block_func_ptr pq4_accumulate_block =
+        pq4_accumulate_block_ref;
+#endif
+
+
+/*********************************************************
+ * cpu detection
+ *********************************************************/
+
+namespace {
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__SSSE3__)
+#define FAISS_SIMD_DISPATCH
+#endif
+
+#ifdef FAISS_SIMD_DISPATCH
+
+// register state the OS saves on context switches (XCR0)
+unsigned long long read_xcr0 ()
+{
+    unsigned int eax, edx;
+    __asm__ volatile ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+    return ((unsigned long long)edx << 32) | eax;
+}
+
+SIMDLevel detect_simd_level ()
+{
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid (1, &eax, &ebx, &ecx, &edx)) {
+        return SIMD_SSE4;
+    }
+    bool has_fma = ecx & (1u << 12);
+    bool has_osxsave = ecx & (1u << 27);
+    bool has_avx = ecx & (1u << 28);
+    bool has_f16c = ecx & (1u << 29);
+
+    if (!has_osxsave || !has_avx) {
+        return SIMD_SSE4;
+    }
+    unsigned long long xcr0 = read_xcr0 ();
+    // XMM and YMM state
+    if ((xcr0 & 0x6) != 0x6) {
+        return SIMD_SSE4;
+    }
+
+    if (!__get_cpuid_count (7, 0, &eax, &ebx, &ecx, &edx)) {
+        return SIMD_SSE4;
+    }
+    bool has_avx2 = ebx & (1u << 5);
+    if (!has_avx2 || !has_fma || !has_f16c) {
+        return SIMD_SSE4;
+    }
+
+    bool has_avx512 =
+        (ebx & (1u << 16)) &&   // F
+        (ebx & (1u << 17)) &&   // DQ
+        (ebx & (1u << 30)) &&   // BW
+        (ebx & (1u << 31));     // VL
+    // opmask, upper ZMM0-15 and ZMM16-31 state
+    if (has_avx512 && (xcr0 & 0xe0) == 0xe0) {
+        return SIMD_AVX512;
+    }
+    return SIMD_AVX2;
+}
+
+#endif
+
+SIMDLevel current_level = SIMD_NONE;
+
+std::mutex & level_mutex ()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+} // anonymous namespace
+
+
+SIMDLevel cpu_simd_level ()
+{
+#ifdef FAISS_SIMD_DISPATCH
+    static SIMDLevel level = detect_simd_level ();
+    return level;
+#else
+    return SIMD_NONE;
+#endif
+}
+
+SIMDLevel get_simd_level ()
+{
+    std::lock_guard<std::mutex> lock (level_mutex ());
+    return current_level;
+}
+
+bool set_simd_level (SIMDLevel level)
+{
+    if (level > cpu_simd_level ()) {
+        return false;
+    }
+#ifdef FAISS_SIMD_DISPATCH
+    if (level == SIMD_NONE) {
+        // there is no runtime dispatch to disable on x86
+        return false;
+    }
+#endif
+
+    std::lock_guard<std::mutex> lock (level_mutex ());
+    switch (level) {
+#ifdef FAISS_SIMD_DISPATCH
+    case SIMD_SSE4:
+        fvec_L2sqr = fvec_L2sqr_sse;
+        fvec_inner_product = fvec_inner_product_sse;
+        fvec_L1 = fvec_L1_ref;
+        fvec_Linf = fvec_Linf_ref;
+        fvec_norm_L2sqr = fvec_norm_L2sqr_sse;
+
+        sq_get_distance_computer = sq_get_distance_computer_ref;
+        sq_sel_quantizer = sq_sel_quantizer_ref;
+        sq_sel_inv_list_scanner = sq_sel_inv_list_scanner_ref;
+
+        pq4_accumulate_block = pq4_accumulate_block_sse;
+        break;
+
+    case SIMD_AVX2:
+        fvec_L2sqr = fvec_L2sqr_avx;
+        fvec_inner_product = fvec_inner_product_avx;
+        fvec_L1 = fvec_L1_avx;
+        fvec_Linf = fvec_Linf_avx;
+        fvec_norm_L2sqr = fvec_norm_L2sqr_avx;
+
+        sq_get_distance_computer = sq_get_distance_computer_avx;
+        sq_sel_quantizer = sq_sel_quantizer_avx;
+        sq_sel_inv_list_scanner = sq_sel_inv_list_scanner_avx;
+
+        pq4_accumulate_block = pq4_accumulate_block_avx;
+        break;
+
+    case SIMD_AVX512:
+        fvec_L2sqr = fvec_L2sqr_avx512;
+        fvec_inner_product = fvec_inner_product_avx512;
+        fvec_L1 = fvec_L1_avx512;
+        fvec_Linf = fvec_Linf_avx512;
+        fvec_norm_L2sqr = fvec_norm_L2sqr_avx512;
+
+        sq_get_distance_computer = sq_get_distance_computer_avx512;
+        sq_sel_quantizer = sq_sel_quantizer_avx512;
+        sq_sel_inv_list_scanner = sq_sel_inv_list_scanner_avx512;
+
+        pq4_accumulate_block = pq4_accumulate_block_avx512;
+        break;
+#endif
+
+    default:
+        // the defaults above are the only kernels
+        break;
+    }
+    current_level = level;
+    return true;
+}
+
+const char *simd_level_name (SIMDLevel level)
+{
+    switch (level) {
+    case SIMD_SSE4: return "SSE4";
+    case SIMD_AVX2: return "AVX2";
+    case SIMD_AVX512: return "AVX512";
+    default: return "NONE";
+    }
+}
+
+
+namespace {
+
+// route the kernels when the library is loaded
+const bool simd_level_routed = set_simd_level (cpu_simd_level ());
+
+} // anonymous namespace
+
+} // namespace faiss
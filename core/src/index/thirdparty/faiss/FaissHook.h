@@ -0,0 +1,50 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+#pragma once
+
+
+namespace faiss {
+
+/** Instruction sets the distance kernels are compiled for.
+ *
+ * The library itself is built for SSE4 on x86. The L2 / inner product /
+ * norm kernels, the scalar quantizer codecs and the 4-bit fast scan
+ * kernel are also compiled for AVX2 and AVX-512 in separate translation
+ * units, and reached through function pointers (fvec_L2sqr,
+ * sq_get_distance_computer, pq4_accumulate_block...). When the library is
+ * loaded, the pointers are routed to the highest level the cpu supports.
+ */
+enum SIMDLevel {
+    SIMD_NONE = 0,   ///< no runtime dispatch (non-x86 builds)
+    SIMD_SSE4,
+    SIMD_AVX2,       ///< AVX2 + FMA + F16C
+    SIMD_AVX512,     ///< AVX-512 F, DQ, BW and VL
+};
+
+/// highest level supported by both the cpu and the build
+SIMDLevel cpu_simd_level ();
+
+/// level the kernels are currently routed to
+SIMDLevel get_simd_level ();
+
+/** route the kernels to another level, eg. to benchmark them.
+ *
+ * Not thread-safe with respect to running searches: call it before
+ * querying the indexes.
+ *
+ * @return false (and leaves the kernels untouched) if the cpu does not
+ *         support that level
+ */
+bool set_simd_level (SIMDLevel level);
+
+/// "NONE", "SSE4", "AVX2" or "AVX512"
+const char *simd_level_name (SIMDLevel level);
+
+} // namespace faiss
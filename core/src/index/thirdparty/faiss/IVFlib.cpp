@@ -339,6 +339,41 @@ void search_with_parameters (const Index *index,
     indexIVF_stats.search_time += t2 - t1;
 }
 
+void range_search_with_parameters (const Index *index,
+                                   idx_t n, const float *x, float radius,
+                                   RangeSearchResult *result,
+                                   IVFSearchParameters *params)
+{
+    FAISS_THROW_IF_NOT (params);
+    const float *prev_x = x;
+    ScopeDeleter<float> del;
+
+    if (auto ip = dynamic_cast<const IndexPreTransform *> (index)) {
+        x = ip->apply_chain (n, x);
+        if (x != prev_x) {
+            del.set(x);
+        }
+        index = ip->index;
+    }
+
+    std::vector<idx_t> Iq(params->nprobe * n);
+    std::vector<float> Dq(params->nprobe * n);
+
+    const IndexIVF *index_ivf = dynamic_cast<const IndexIVF *>(index);
+    FAISS_THROW_IF_NOT (index_ivf);
+
+    double t0 = getmillisecs();
+    index_ivf->quantizer->search(n, x, params->nprobe,
+                                 Dq.data(), Iq.data());
+    double t1 = getmillisecs();
+    indexIVF_stats.quantization_time += t1 - t0;
+
+    index_ivf->range_search_preassigned(n, x, radius, Iq.data(), Dq.data(),
+                                        result, params);
+    double t2 = getmillisecs();
+    indexIVF_stats.search_time += t2 - t1;
+}
+
 
 
 } } // namespace faiss::ivflib
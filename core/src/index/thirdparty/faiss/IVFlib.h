@@ -125,6 +125,12 @@ void search_with_parameters (const Index *index,
                              IVFSearchParameters *params,
                              size_t *nb_dis = nullptr);
 
+// same as search_with_parameters but returns all vectors within radius
+void range_search_with_parameters (const Index *index,
+                                   idx_t n, const float *x, float radius,
+                                   RangeSearchResult *result,
+                                   IVFSearchParameters *params);
+
 
 
 } } // namespace faiss::ivflib
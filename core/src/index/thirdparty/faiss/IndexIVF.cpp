@@ -18,6 +18,7 @@
 
 #include <faiss/utils/utils.h>
 #include <faiss/utils/hamming.h>
+#include <faiss/utils/distances.h>
 
 #include <faiss/impl/FaissAssert.h>
 #include <faiss/IndexFlat.h>
@@ -318,6 +319,44 @@ void IndexIVF::search (idx_t n, const float *x, idx_t k,
 
 
 
+namespace {
+
+/// offset of the first entry of each list when the lists are enumerated
+/// in list order, the numbering used by deletion bitsets
+std::vector<size_t> get_list_offsets (const InvertedLists *invlists)
+{
+    std::vector<size_t> offsets (invlists->nlist);
+    size_t ofs = 0;
+    for (size_t l = 0; l < invlists->nlist; l++) {
+        offsets[l] = ofs;
+        ofs += invlists->list_size (l);
+    }
+    return offsets;
+}
+
+/// call f (j0, j1) on the maximal runs [j0, j1) of entries of a list that
+/// are not deleted, base is the offset of the list in the bitset
+template <class F>
+void for_each_live_run (const uint8_t *bitset, size_t base,
+                        size_t list_size, F f)
+{
+    size_t j0 = 0;
+    while (j0 < list_size) {
+        if (bitset_test (bitset, base + j0)) {
+            j0++;
+            continue;
+        }
+        size_t j1 = j0 + 1;
+        while (j1 < list_size && !bitset_test (bitset, base + j1)) {
+            j1++;
+        }
+        f (j0, j1);
+        j0 = j1;
+    }
+}
+
+} // namespace
+
 void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
                                    const idx_t *keys,
                                    const float *coarse_dis ,
@@ -327,6 +366,16 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 {
     long nprobe = params ? params->nprobe : this->nprobe;
     long max_codes = params ? params->max_codes : this->max_codes;
+    const float *distance_bound = params ? params->distance_bound : nullptr;
+    const uint8_t *bitset = params ? params->bitset : nullptr;
+
+    // offsets in store_pairs results would be relative to the live runs
+    FAISS_THROW_IF_NOT_MSG (!(bitset && store_pairs),
+                            "bitset not supported with store_pairs");
+    std::vector<size_t> list_offsets;
+    if (bitset) {
+        list_offsets = get_list_offsets (invlists);
+    }
 
     size_t nlistv = 0, ndis = 0, nheap = 0;
 
@@ -354,11 +403,17 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 
         // intialize + reorder a result heap
 
-        auto init_result = [&](float *simi, idx_t *idxi) {
+        auto init_result = [&](float *simi, idx_t *idxi, size_t i) {
             if (metric_type == METRIC_INNER_PRODUCT) {
                 heap_heapify<HeapForIP> (k, simi, idxi);
+                if (distance_bound) {
+                    heap_seed<HeapForIP> (k, simi, idxi, distance_bound[i]);
+                }
             } else {
                 heap_heapify<HeapForL2> (k, simi, idxi);
+                if (distance_bound) {
+                    heap_seed<HeapForL2> (k, simi, idxi, distance_bound[i]);
+                }
             }
         };
 
@@ -404,8 +459,19 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
                 ids = sids->get();
             }
 
-            nheap += scanner->scan_codes (list_size, scodes.get(),
-                                          ids, simi, idxi, k);
+            if (bitset) {
+                // deleted entries are skipped, they never take a result slot
+                size_t code_size = invlists->code_size;
+                for_each_live_run (bitset, list_offsets[key], list_size,
+                                   [&] (size_t j0, size_t j1) {
+                    nheap += scanner->scan_codes (
+                        j1 - j0, scodes.get() + j0 * code_size,
+                        ids + j0, simi, idxi, k);
+                });
+            } else {
+                nheap += scanner->scan_codes (list_size, scodes.get(),
+                                              ids, simi, idxi, k);
+            }
 
             return list_size;
         };
@@ -428,7 +494,7 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
                 float * simi = distances + i * k;
                 idx_t * idxi = labels + i * k;
 
-                init_result (simi, idxi);
+                init_result (simi, idxi, i);
 
                 long nscan = 0;
 
@@ -460,7 +526,7 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
 
             for (size_t i = 0; i < n; i++) {
                 scanner->set_query (x + i * d);
-                init_result (local_dis.data(), local_idx.data());
+                init_result (local_dis.data(), local_idx.data(), i);
 
 #pragma omp for schedule(dynamic)
                 for (size_t ik = 0; ik < nprobe; ik++) {
@@ -476,7 +542,7 @@ void IndexIVF::search_preassigned (idx_t n, const float *x, idx_t k,
                 float * simi = distances + i * k;
                 idx_t * idxi = labels + i * k;
 #pragma omp single
-                init_result (simi, idxi);
+                init_result (simi, idxi, i);
 
 #pragma omp barrier
 #pragma omp critical
@@ -537,8 +603,16 @@ void IndexIVF::range_search (idx_t nx, const float *x, float radius,
 void IndexIVF::range_search_preassigned (
          idx_t nx, const float *x, float radius,
          const idx_t *keys, const float *coarse_dis,
-         RangeSearchResult *result) const
+         RangeSearchResult *result,
+         const IVFSearchParameters *params) const
 {
+    long nprobe = params ? params->nprobe : this->nprobe;
+    const uint8_t *bitset = params ? params->bitset : nullptr;
+
+    std::vector<size_t> list_offsets;
+    if (bitset) {
+        list_offsets = get_list_offsets (invlists);
+    }
 
     size_t nlistv = 0, ndis = 0;
     bool store_pairs = false;
@@ -573,8 +647,18 @@ void IndexIVF::range_search_preassigned (
             scanner->set_list (key, coarse_dis[i * nprobe + ik]);
             nlistv++;
             ndis += list_size;
-            scanner->scan_codes_range (list_size, scodes.get(),
-                                       ids.get(), radius, qres);
+            if (bitset) {
+                size_t code_size = invlists->code_size;
+                for_each_live_run (bitset, list_offsets[key], list_size,
+                                   [&] (size_t j0, size_t j1) {
+                    scanner->scan_codes_range (
+                        j1 - j0, scodes.get() + j0 * code_size,
+                        ids.get() + j0, radius, qres);
+                });
+            } else {
+                scanner->scan_codes_range (list_size, scodes.get(),
+                                           ids.get(), radius, qres);
+            }
         };
 
         if (parallel_mode == 0) {
@@ -68,6 +68,10 @@ struct Level1Quantizer {
 struct IVFSearchParameters {
     size_t nprobe;            ///< number of probes at query time
     size_t max_codes;         ///< max nb of codes to visit to do a query
+    const float *distance_bound = nullptr; ///< per query distance a result must beat, size n (optional)
+    /// deleted entries, bit i stands for the i-th entry when the lists are
+    /// enumerated in list order (optional)
+    const uint8_t *bitset = nullptr;
     virtual ~IVFSearchParameters () {}
 };
 
@@ -190,7 +194,9 @@ struct IndexIVF: Index, Level1Quantizer {
 
     void range_search_preassigned(idx_t nx, const float *x, float radius,
                                   const idx_t *keys, const float *coarse_dis,
-                                  RangeSearchResult *result) const;
+                                  RangeSearchResult *result,
+                                  const IVFSearchParameters *params=nullptr
+                                  ) const;
 
     /// get a scanner for this index (store_pairs means ignore labels)
     virtual InvertedListScanner *get_InvertedListScanner (
@@ -0,0 +1,443 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+#include <faiss/IndexIVFPQFastScan.h>
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+#include <faiss/utils/Heap.h>
+#include <faiss/utils/utils.h>
+#include <faiss/utils/distances.h>
+
+#include <faiss/impl/FaissAssert.h>
+#include <faiss/impl/AuxIndexStructures.h>
+#include <faiss/impl/pq4_fast_scan.h>
+
+
+namespace faiss {
+
+namespace {
+
+/// index of sub-quantizer m in a packed 4-bit code, even m in the low nibble
+inline int get_code4 (const uint8_t *code, size_t m)
+{
+    return (code[m >> 1] >> ((m & 1) * 4)) & 15;
+}
+
+/// distance of a packed code with a float table of M x 16 entries
+inline float table_distance (size_t M, const float *table,
+                             const uint8_t *code)
+{
+    float dis = 0;
+    for (size_t m = 0; m < M; m++) {
+        dis += table[m * 16 + get_code4 (code, m)];
+    }
+    return dis;
+}
+
+/** quantize a float table of M x 16 entries to 8 bits.
+ *
+ * Each sub-quantizer gets its own offset (its minimum) and all of them
+ * share the same scale, so that the quantized sum of a code is
+ * scale * (dis - bias) up to a rounding error of M / 2 */
+void quantize_table (size_t M, const float *table, uint8_t *qtable,
+                     float & bias, float & scale)
+{
+    float max_span = 0;
+    bias = 0;
+    for (size_t m = 0; m < M; m++) {
+        const float *t = table + m * 16;
+        float tmin = *std::min_element (t, t + 16);
+        float tmax = *std::max_element (t, t + 16);
+        bias += tmin;
+        max_span = std::max (max_span, tmax - tmin);
+    }
+    scale = max_span > 0 ? 255 / max_span : 0;
+    for (size_t m = 0; m < M; m++) {
+        const float *t = table + m * 16;
+        float tmin = *std::min_element (t, t + 16);
+        for (size_t j = 0; j < 16; j++) {
+            float q = std::floor ((t[j] - tmin) * scale + 0.5f);
+            qtable[m * 16 + j] = (uint8_t) std::min (q, 255.0f);
+        }
+    }
+}
+
+bool blocked_codes_in_sync (const IndexIVFPQFastScan & index)
+{
+    if (index.blocked_codes.size() != index.nlist) {
+        return false;
+    }
+    size_t bs = IndexIVFPQFastScan::block_size;
+    for (size_t l = 0; l < index.nlist; l++) {
+        size_t nblock = (index.invlists->list_size (l) + bs - 1) / bs;
+        if (index.blocked_codes[l].size() != nblock * bs * index.code_size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+/// plain scan of the packed codes with the float table
+template<class C>
+struct IVFPQFastScanScanner: InvertedListScanner {
+    const IndexIVFPQFastScan & index;
+    bool store_pairs;
+    bool is_ip;
+
+    const float *x;
+    idx_t list_no;
+    float dis0;
+    std::vector<float> table;
+    std::vector<float> residual;
+
+    IVFPQFastScanScanner (const IndexIVFPQFastScan & index, bool store_pairs):
+        index (index), store_pairs (store_pairs),
+        is_ip (index.metric_type == METRIC_INNER_PRODUCT),
+        x (nullptr), list_no (-1), dis0 (0),
+        table (index.pq.M * index.pq.ksub), residual (index.d)
+    {}
+
+    void set_query (const float *query) override {
+        x = query;
+    }
+
+    void set_list (idx_t list_no, float /* coarse_dis */) override {
+        this->list_no = list_no;
+        dis0 = index.compute_list_table (x, list_no, table.data(),
+                                         residual.data());
+    }
+
+    float distance_to_code (const uint8_t *code) const override {
+        float dis = dis0 + table_distance (index.pq.M, table.data(), code);
+        return is_ip ? -dis : dis;
+    }
+
+    size_t scan_codes (size_t list_size,
+                       const uint8_t *codes,
+                       const idx_t *ids,
+                       float *simi, idx_t *idxi,
+                       size_t k) const override
+    {
+        size_t nup = 0;
+        for (size_t j = 0; j < list_size; j++) {
+            float dis = distance_to_code (codes + j * index.code_size);
+            if (C::cmp (simi[0], dis)) {
+                heap_pop<C> (k, simi, idxi);
+                int64_t id = store_pairs ? (list_no << 32 | j) : ids[j];
+                heap_push<C> (k, simi, idxi, dis, id);
+                nup++;
+            }
+        }
+        return nup;
+    }
+
+    void scan_codes_range (size_t list_size,
+                           const uint8_t *codes,
+                           const idx_t *ids,
+                           float radius,
+                           RangeQueryResult & res) const override
+    {
+        for (size_t j = 0; j < list_size; j++) {
+            float dis = distance_to_code (codes + j * index.code_size);
+            if (C::cmp (radius, dis)) {
+                int64_t id = store_pairs ? (list_no << 32 | j) : ids[j];
+                res.add (dis, id);
+            }
+        }
+    }
+};
+
+} // anonymous namespace
+
+
+/*****************************************
+ * IndexIVFPQFastScan implementation
+ ******************************************/
+
+const size_t IndexIVFPQFastScan::block_size;
+
+IndexIVFPQFastScan::IndexIVFPQFastScan (
+            Index * quantizer, size_t d, size_t nlist,
+            size_t M, MetricType metric):
+    IndexIVFPQ (quantizer, d, nlist, M, 4)
+{
+    FAISS_THROW_IF_NOT_MSG (M % 2 == 0 && M <= 256,
+                            "M must be even and at most 256");
+    metric_type = metric;
+    // the scan computes its tables per list, the IVFPQ ones are not used
+    use_precomputed_table = -1;
+    blocked_codes.resize (nlist);
+}
+
+IndexIVFPQFastScan::IndexIVFPQFastScan ()
+{
+    use_precomputed_table = -1;
+}
+
+void IndexIVFPQFastScan::add_with_ids (idx_t n, const float * x,
+                                       const idx_t *xids)
+{
+    IndexIVFPQ::add_with_ids (n, x, xids);
+    build_blocked_codes ();
+}
+
+void IndexIVFPQFastScan::reset ()
+{
+    IndexIVFPQ::reset ();
+    build_blocked_codes ();
+}
+
+size_t IndexIVFPQFastScan::remove_ids (const IDSelector& sel)
+{
+    size_t nremove = IndexIVFPQ::remove_ids (sel);
+    build_blocked_codes ();
+    return nremove;
+}
+
+void IndexIVFPQFastScan::merge_from (IndexIVF &other, idx_t add_id)
+{
+    IndexIVFPQ::merge_from (other, add_id);
+    build_blocked_codes ();
+    IndexIVFPQFastScan *other_fs = dynamic_cast<IndexIVFPQFastScan *> (&other);
+    if (other_fs) {
+        other_fs->build_blocked_codes ();
+    }
+}
+
+void IndexIVFPQFastScan::build_blocked_codes ()
+{
+    blocked_codes.resize (nlist);
+#pragma omp parallel for if(nlist > 100)
+    for (idx_t l = 0; l < nlist; l++) {
+        build_blocked_codes (l);
+    }
+}
+
+void IndexIVFPQFastScan::build_blocked_codes (idx_t list_no)
+{
+    size_t list_size = invlists->list_size (list_no);
+    size_t nblock = (list_size + block_size - 1) / block_size;
+    std::vector<uint8_t> & blocks = blocked_codes[list_no];
+    blocks.assign (nblock * block_size * code_size, 0);
+    if (list_size == 0) {
+        return;
+    }
+
+    InvertedLists::ScopedCodes codes (invlists, list_no);
+    size_t M = pq.M;
+    for (size_t i = 0; i < list_size; i++) {
+        const uint8_t *code = codes.get() + i * code_size;
+        uint8_t *block = blocks.data() + (i / block_size) * block_size * code_size;
+        size_t j = i % block_size;
+        for (size_t m = 0; m < M; m++) {
+            int c = get_code4 (code, m);
+            block[m * 16 + (j & 15)] |= j < 16 ? c : c << 4;
+        }
+    }
+}
+
+float IndexIVFPQFastScan::compute_list_table (
+        const float *x, idx_t list_no, float *table, float *residual) const
+{
+    float dis0 = 0;
+    if (metric_type == METRIC_INNER_PRODUCT) {
+        pq.compute_inner_prod_table (x, table);
+        if (by_residual) {
+            quantizer->reconstruct (list_no, residual);
+            dis0 = -fvec_inner_product (x, residual, d);
+        }
+        for (size_t i = 0; i < pq.M * pq.ksub; i++) {
+            table[i] = -table[i];
+        }
+    } else if (by_residual) {
+        quantizer->compute_residual (x, residual, list_no);
+        pq.compute_distance_table (residual, table);
+    } else {
+        pq.compute_distance_table (x, table);
+    }
+    return dis0;
+}
+
+InvertedListScanner *
+IndexIVFPQFastScan::get_InvertedListScanner (bool store_pairs) const
+{
+    if (metric_type == METRIC_INNER_PRODUCT) {
+        return new IVFPQFastScanScanner<CMin<float, idx_t> > (*this, store_pairs);
+    } else {
+        return new IVFPQFastScanScanner<CMax<float, idx_t> > (*this, store_pairs);
+    }
+}
+
+void IndexIVFPQFastScan::search_preassigned (idx_t n, const float *x, idx_t k,
+                                             const idx_t *keys,
+                                             const float *coarse_dis,
+                                             float *distances, idx_t *labels,
+                                             bool store_pairs,
+                                             const IVFSearchParameters *params) const
+{
+    if (store_pairs || parallel_mode != 0 || !blocked_codes_in_sync (*this)) {
+        IndexIVF::search_preassigned (n, x, k, keys, coarse_dis, distances,
+                                      labels, store_pairs, params);
+        return;
+    }
+
+    long nprobe = params ? params->nprobe : this->nprobe;
+    long max_codes = params ? params->max_codes : this->max_codes;
+    const float *distance_bound = params ? params->distance_bound : nullptr;
+    const uint8_t *bitset = params ? params->bitset : nullptr;
+
+    std::vector<size_t> list_offsets;
+    if (bitset) {
+        list_offsets.resize (nlist);
+        size_t ofs = 0;
+        for (size_t l = 0; l < nlist; l++) {
+            list_offsets[l] = ofs;
+            ofs += invlists->list_size (l);
+        }
+    }
+
+    // the heaps hold costs to minimize, inner products are negated
+    using C = CMax<float, idx_t>;
+    bool is_ip = metric_type == METRIC_INNER_PRODUCT;
+    size_t M = pq.M;
+
+    size_t nlistv = 0, ndis = 0, nheap = 0;
+    bool interrupt = false;
+
+#pragma omp parallel if(n > 1) reduction(+: nlistv, ndis, nheap)
+    {
+        std::vector<float> table (M * pq.ksub);
+        std::vector<uint8_t> qtable (M * pq.ksub);
+        std::vector<float> residual (d);
+        uint16_t acc[block_size];
+
+#pragma omp for
+        for (idx_t i = 0; i < n; i++) {
+
+            if (interrupt) {
+                continue;
+            }
+
+            const float *xi = x + i * d;
+            float *simi = distances + i * k;
+            idx_t *idxi = labels + i * k;
+
+            heap_heapify<C> (k, simi, idxi);
+            if (distance_bound) {
+                heap_seed<C> (k, simi, idxi,
+                              is_ip ? -distance_bound[i] : distance_bound[i]);
+            }
+
+            long nscan = 0;
+
+            for (long ik = 0; ik < nprobe; ik++) {
+                idx_t key = keys[i * nprobe + ik];
+                if (key < 0) {
+                    // not enough centroids for multiprobe
+                    continue;
+                }
+                FAISS_THROW_IF_NOT_FMT (key < (idx_t) nlist,
+                                        "Invalid key=%ld nlist=%ld\n",
+                                        key, nlist);
+
+                size_t list_size = invlists->list_size (key);
+                if (list_size == 0) {
+                    continue;
+                }
+                nlistv++;
+
+                float dis0 = compute_list_table (xi, key, table.data(),
+                                                 residual.data());
+                float bias, scale;
+                quantize_table (M, table.data(), qtable.data(), bias, scale);
+
+                InvertedLists::ScopedCodes scodes (invlists, key);
+                InvertedLists::ScopedIds sids (invlists, key);
+                const uint8_t *codes = scodes.get();
+                const idx_t *ids = sids.get();
+                const uint8_t *blocks = blocked_codes[key].data();
+
+                // largest quantized sum that may still beat the heap top,
+                // widened by the rounding error of the table and a margin
+                auto threshold = [&] () -> long {
+                    if (scale == 0) {
+                        return std::numeric_limits<uint16_t>::max();
+                    }
+                    float t = (simi[0] - dis0 - bias) * scale + M / 2 + 1;
+                    if (!(t < std::numeric_limits<uint16_t>::max())) {
+                        return std::numeric_limits<uint16_t>::max();
+                    }
+                    return t < 0 ? -1 : (long) t;
+                };
+
+                for (size_t j0 = 0; j0 < list_size; j0 += block_size) {
+                    long thresh = threshold ();
+                    if (thresh < 0) {
+                        // nothing left in this list can beat the heap top
+                        break;
+                    }
+                    pq4_accumulate_block (M, qtable.data(),
+                                          blocks + j0 * code_size, acc);
+
+                    size_t nj = std::min (block_size, list_size - j0);
+                    for (size_t j = 0; j < nj; j++) {
+                        if (acc[j] > thresh) {
+                            continue;
+                        }
+                        size_t ofs = j0 + j;
+                        if (bitset && bitset_test (bitset, list_offsets[key] + ofs)) {
+                            continue;
+                        }
+                        float dis = dis0 + table_distance (
+                            M, table.data(), codes + ofs * code_size);
+                        if (C::cmp (simi[0], dis)) {
+                            heap_pop<C> (k, simi, idxi);
+                            heap_push<C> (k, simi, idxi, dis, ids[ofs]);
+                            nheap++;
+                            thresh = threshold ();
+                        }
+                    }
+                }
+
+                nscan += list_size;
+                if (max_codes && nscan >= max_codes) {
+                    break;
+                }
+            }
+
+            ndis += nscan;
+            heap_reorder<C> (k, simi, idxi);
+            if (is_ip) {
+                for (idx_t j = 0; j < k; j++) {
+                    simi[j] = -simi[j];
+                }
+            }
+
+            if (InterruptCallback::is_interrupted ()) {
+                interrupt = true;
+            }
+        }
+    }
+
+    if (interrupt) {
+        FAISS_THROW_MSG ("computation interrupted");
+    }
+
+    indexIVF_stats.nq += n;
+    indexIVF_stats.nlist += nlistv;
+    indexIVF_stats.ndis += ndis;
+    indexIVF_stats.nheap_updates += nheap;
+}
+
+
+} // namespace faiss
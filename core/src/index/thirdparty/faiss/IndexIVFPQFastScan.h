@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+#pragma once
+
+#include <vector>
+
+#include <faiss/IndexIVFPQ.h>
+
+
+namespace faiss {
+
+
+/** IVFPQ with 4-bit sub-quantizers, scanned with in-register lookup
+ * tables.
+ *
+ * The inverted lists keep the usual packed codes (2 sub-quantizer indices
+ * per byte). In addition, each list is copied into blocks of 32 vectors:
+ * for each sub-quantizer m a block stores 16 bytes, byte j holding the
+ * index of vector j in the low nibble and the one of vector j + 16 in the
+ * high nibble. At search time the distance table of a (query, list) pair
+ * is quantized to 8 bits, so that the 16 entries of a sub-quantizer fit
+ * in a SIMD register and a single shuffle looks up 32 vectors at a time.
+ * The 8-bit lookups are accumulated in 16 bits.
+ *
+ * The quantized sums are only used to filter: a vector is re-ranked with
+ * the float distance table when its quantized sum, widened by the worst
+ * case rounding error, may beat the current k-th result. The results are
+ * therefore the same as a plain scan of the 4-bit PQ codes.
+ */
+struct IndexIVFPQFastScan: IndexIVFPQ {
+
+    /// number of vectors in a block of the blocked layout
+    static const size_t block_size = 32;
+
+    /// per inverted list, the codes in the blocked layout, padded with
+    /// zeros to a multiple of block_size vectors
+    std::vector<std::vector<uint8_t> > blocked_codes;
+
+    /// M must be even and at most 256 so that the 16-bit sums can't overflow
+    IndexIVFPQFastScan (
+            Index * quantizer, size_t d, size_t nlist,
+            size_t M, MetricType metric = METRIC_L2);
+
+    IndexIVFPQFastScan ();
+
+    void add_with_ids(idx_t n, const float* x, const idx_t* xids) override;
+
+    void reset() override;
+
+    size_t remove_ids(const IDSelector& sel) override;
+
+    void merge_from (IndexIVF &other, idx_t add_id) override;
+
+    /// rebuild the blocked copy of all inverted lists
+    void build_blocked_codes ();
+
+    /// rebuild the blocked copy of one inverted list
+    void build_blocked_codes (idx_t list_no);
+
+    void search_preassigned (idx_t n, const float *x, idx_t k,
+                             const idx_t *assign,
+                             const float *centroid_dis,
+                             float *distances, idx_t *labels,
+                             bool store_pairs,
+                             const IVFSearchParameters *params=nullptr
+                             ) const override;
+
+    /// scalar scanner on the packed codes, used for range search and when
+    /// the blocked scan does not apply (store_pairs, parallel_mode != 0)
+    InvertedListScanner *get_InvertedListScanner (bool store_pairs)
+        const override;
+
+    /** float distance table of a (query, list) pair, in a form that is
+     * minimized whatever the metric: the distance of a code is
+     * dis0 + sum_m table[m * 16 + code_m], negated for inner product.
+     *
+     * @param residual  scratch buffer of size d
+     * @return          dis0
+     */
+    float compute_list_table (const float *x, idx_t list_no,
+                              float *table, float *residual) const;
+};
+
+
+} // namespace faiss
@@ -35,6 +35,7 @@ IndexScalarQuantizer::IndexScalarQuantizer
 {
     is_trained =
         qtype == ScalarQuantizer::QT_fp16 ||
+        qtype == ScalarQuantizer::QT_bf16 ||
         qtype == ScalarQuantizer::QT_8bit_direct;
     code_size = sq.code_size;
 }
@@ -102,6 +103,34 @@ void IndexScalarQuantizer::search(
 }
 
 
+/* Scans all the codes as one list, labels are the row numbers. */
+void IndexScalarQuantizer::range_search (idx_t n, const float *x,
+                                         float radius,
+                                         RangeSearchResult *result) const
+{
+    FAISS_THROW_IF_NOT (is_trained);
+    FAISS_THROW_IF_NOT (metric_type == METRIC_L2 ||
+                        metric_type == METRIC_INNER_PRODUCT);
+
+#pragma omp parallel
+    {
+        InvertedListScanner* scanner = sq.select_InvertedListScanner
+            (metric_type, nullptr, true);
+        ScopeDeleter1<InvertedListScanner> del(scanner);
+        RangeSearchPartialResult pres (result);
+
+#pragma omp for
+        for (size_t i = 0; i < n; i++) {
+            RangeQueryResult & qres = pres.new_result (i);
+            scanner->set_query (x + i * d);
+            scanner->scan_codes_range (ntotal, codes.data(),
+                                       nullptr, radius, qres);
+        }
+        pres.finalize ();
+    }
+}
+
+
 DistanceComputer *IndexScalarQuantizer::get_distance_computer () const
 {
     ScalarQuantizer::SQDistanceComputer *dc =
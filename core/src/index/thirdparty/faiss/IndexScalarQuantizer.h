@@ -60,6 +60,9 @@ struct IndexScalarQuantizer: Index {
         float* distances,
         idx_t* labels) const override;
 
+    void range_search (idx_t n, const float *x, float radius,
+                       RangeSearchResult *result) const override;
+
     void reset() override;
 
     void reconstruct_n(idx_t i0, idx_t ni, float* recons) const override;
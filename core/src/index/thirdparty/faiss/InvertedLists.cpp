@@ -365,6 +365,9 @@ const uint8_t * ReadOnlyArrayInvertedLists::get_codes (size_t list_no) const
 {
     FAISS_ASSERT(list_no < nlist && valid);
 #ifdef USE_CPU
+    if (borrowed_codes) {
+        return borrowed_codes + readonly_offset[list_no] * code_size;
+    }
     return readonly_codes.data() + readonly_offset[list_no] * code_size;
 #else
     uint8_t *pcodes = (uint8_t *)(pin_readonly_codes->data);
@@ -376,6 +379,9 @@ const InvertedLists::idx_t* ReadOnlyArrayInvertedLists::get_ids (size_t list_no)
 {
     FAISS_ASSERT(list_no < nlist && valid);
 #ifdef USE_CPU
+    if (borrowed_ids) {
+        return borrowed_ids + readonly_offset[list_no];
+    }
     return readonly_ids.data() + readonly_offset[list_no];
 #else
     idx_t *pids = (idx_t *)pin_readonly_ids->data;
@@ -386,6 +392,9 @@ const InvertedLists::idx_t* ReadOnlyArrayInvertedLists::get_ids (size_t list_no)
 const InvertedLists::idx_t* ReadOnlyArrayInvertedLists::get_all_ids() const {
     FAISS_ASSERT(valid);
 #ifdef USE_CPU
+    if (borrowed_ids) {
+        return borrowed_ids;
+    }
     return readonly_ids.data();
 #else
     return (idx_t *)(pin_readonly_ids->data);
@@ -395,6 +404,9 @@ const InvertedLists::idx_t* ReadOnlyArrayInvertedLists::get_all_ids() const {
 const uint8_t* ReadOnlyArrayInvertedLists::get_all_codes() const {
     FAISS_ASSERT(valid);
 #ifdef USE_CPU
+    if (borrowed_codes) {
+        return borrowed_codes;
+    }
     return readonly_codes.data();
 #else
     return (uint8_t *)(pin_readonly_codes->data);
@@ -406,6 +418,18 @@ const std::vector<size_t>& ReadOnlyArrayInvertedLists::get_list_length() const {
     return readonly_length;
 }
 
+size_t ReadOnlyArrayInvertedLists::get_total_size() const {
+    FAISS_ASSERT(valid);
+#ifdef USE_CPU
+    if (borrowed_ids) {
+        return borrowed_n;
+    }
+    return readonly_ids.size();
+#else
+    return pin_readonly_ids->size() / sizeof(idx_t);
+#endif
+}
+
 bool ReadOnlyArrayInvertedLists::is_readonly() const {
     FAISS_ASSERT(valid);
     return true;
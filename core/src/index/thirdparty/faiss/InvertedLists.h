@@ -238,6 +238,11 @@ struct ReadOnlyArrayInvertedLists: InvertedLists {
 #ifdef USE_CPU
     std::vector <uint8_t> readonly_codes;
     std::vector <idx_t> readonly_ids;
+
+    // set when codes and ids live in an external buffer (IO_FLAG_ZERO_COPY)
+    const uint8_t * borrowed_codes = nullptr;
+    const idx_t * borrowed_ids = nullptr;
+    size_t borrowed_n = 0;
 #else
     PageLockMemoryPtr pin_readonly_codes;
     PageLockMemoryPtr pin_readonly_ids;
@@ -263,6 +268,9 @@ struct ReadOnlyArrayInvertedLists: InvertedLists {
     const idx_t * get_all_ids() const;
     const std::vector<size_t>& get_list_length() const;
 
+    // total number of entries over all lists
+    size_t get_total_size() const;
+
     size_t add_entries (
             size_t list_no, size_t n_entry,
             const idx_t* ids, const uint8_t *code) override;
@@ -22,6 +22,7 @@
 #include <faiss/IndexIVF.h>
 #include <faiss/IndexIVFPQ.h>
 #include <faiss/IndexIVFPQR.h>
+#include <faiss/IndexIVFPQFastScan.h>
 #include <faiss/Index2Layer.h>
 #include <faiss/IndexIVFFlat.h>
 #include <faiss/IndexIVFSpectralHash.h>
@@ -71,6 +72,7 @@ VectorTransform *Cloner::clone_VectorTransform (const VectorTransform *vt)
 IndexIVF * Cloner::clone_IndexIVF (const IndexIVF *ivf)
 {
     TRYCLONE (IndexIVFPQR, ivf)
+    TRYCLONE (IndexIVFPQFastScan, ivf)
     TRYCLONE (IndexIVFPQ, ivf)
     TRYCLONE (IndexIVFFlat, ivf)
     TRYCLONE (IndexIVFScalarQuantizer, ivf)
@@ -104,7 +106,20 @@ Index *Cloner::clone_Index (const Index *index)
             res->invlists = new ArrayInvertedLists(*ails);
             res->own_invlists = true;
         } else if (auto *ails = dynamic_cast<const ReadOnlyArrayInvertedLists*>(ivf->invlists)) {
-            res->invlists = new ReadOnlyArrayInvertedLists(*ails);
+            auto res_ails = new ReadOnlyArrayInvertedLists(*ails);
+#ifdef USE_CPU
+            if (res_ails->borrowed_ids) {
+                // the clone may outlive the borrowed buffer, own a copy
+                size_t n = res_ails->borrowed_n;
+                res_ails->readonly_ids.assign(res_ails->borrowed_ids, res_ails->borrowed_ids + n);
+                res_ails->readonly_codes.assign(res_ails->borrowed_codes,
+                                                res_ails->borrowed_codes + n * res_ails->code_size);
+                res_ails->borrowed_ids = nullptr;
+                res_ails->borrowed_codes = nullptr;
+                res_ails->borrowed_n = 0;
+            }
+#endif
+            res->invlists = res_ails;
             res->own_invlists = true;
         } else {
             FAISS_THROW_MSG( "clone not supported for this type of inverted lists");
@@ -31,6 +31,7 @@ struct ScalarQuantizer {
         QT_fp16,
         QT_8bit_direct,      /// fast indexing of uint8s
         QT_6bit,             ///< 6 bits per component
+        QT_bf16,             ///< upper half of a float32, same range
     };
 
     QuantizerType qtype;
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+/* Runtime selection of the ScalarQuantizer templates.
+ *
+ * The ScalarQuantizer methods go through the function pointers below.
+ * They default to the _ref functions (no explicit SIMD, built with the
+ * flags of the library) and FaissHook.cpp routes them to the _avx (SIMD
+ * width 8) or _avx512 (SIMD width 16) functions when the cpu supports
+ * them. */
+
+#pragma once
+
+#include <vector>
+
+#include <faiss/impl/ScalarQuantizer.h>
+
+
+namespace faiss {
+
+typedef ScalarQuantizer::SQDistanceComputer *
+        (*sq_get_distance_computer_func_ptr) (
+                MetricType metric, ScalarQuantizer::QuantizerType qtype,
+                size_t dim, const std::vector<float> & trained);
+
+typedef ScalarQuantizer::Quantizer *
+        (*sq_sel_quantizer_func_ptr) (
+                ScalarQuantizer::QuantizerType qtype,
+                size_t dim, const std::vector<float> & trained);
+
+typedef InvertedListScanner *
+        (*sq_sel_inv_list_scanner_func_ptr) (
+                MetricType mt, const ScalarQuantizer *sq,
+                const Index *quantizer, bool store_pairs, bool by_residual);
+
+extern sq_get_distance_computer_func_ptr sq_get_distance_computer;
+extern sq_sel_quantizer_func_ptr sq_sel_quantizer;
+extern sq_sel_inv_list_scanner_func_ptr sq_sel_inv_list_scanner;
+
+
+ScalarQuantizer::SQDistanceComputer *
+sq_get_distance_computer_ref (
+        MetricType metric, ScalarQuantizer::QuantizerType qtype,
+        size_t dim, const std::vector<float> & trained);
+
+ScalarQuantizer::Quantizer *
+sq_sel_quantizer_ref (
+        ScalarQuantizer::QuantizerType qtype,
+        size_t dim, const std::vector<float> & trained);
+
+InvertedListScanner *
+sq_sel_inv_list_scanner_ref (
+        MetricType mt, const ScalarQuantizer *sq,
+        const Index *quantizer, bool store_pairs, bool by_residual);
+
+#if defined(__x86_64__) || defined(__i386__)
+
+ScalarQuantizer::SQDistanceComputer *
+sq_get_distance_computer_avx (
+        MetricType metric, ScalarQuantizer::QuantizerType qtype,
+        size_t dim, const std::vector<float> & trained);
+
+ScalarQuantizer::Quantizer *
+sq_sel_quantizer_avx (
+        ScalarQuantizer::QuantizerType qtype,
+        size_t dim, const std::vector<float> & trained);
+
+InvertedListScanner *
+sq_sel_inv_list_scanner_avx (
+        MetricType mt, const ScalarQuantizer *sq,
+        const Index *quantizer, bool store_pairs, bool by_residual);
+
+ScalarQuantizer::SQDistanceComputer *
+sq_get_distance_computer_avx512 (
+        MetricType metric, ScalarQuantizer::QuantizerType qtype,
+        size_t dim, const std::vector<float> & trained);
+
+ScalarQuantizer::Quantizer *
+sq_sel_quantizer_avx512 (
+        ScalarQuantizer::QuantizerType qtype,
+        size_t dim, const std::vector<float> & trained);
+
+InvertedListScanner *
+sq_sel_inv_list_scanner_avx512 (
+        MetricType mt, const ScalarQuantizer *sq,
+        const Index *quantizer, bool store_pairs, bool by_residual);
+
+#endif
+
+} // namespace faiss
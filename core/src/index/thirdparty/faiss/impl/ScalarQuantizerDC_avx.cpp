@@ -0,0 +1,77 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+/* Compiled with -mavx2 -mfma -mf16c (see makefile.inc), only reached when
+ * the cpu supports AVX2. */
+
+#include <faiss/impl/ScalarQuantizerDC.h>
+
+#ifdef __AVX2__
+
+#include <faiss/impl/ScalarQuantizerCodec.h>
+
+
+namespace faiss {
+
+/*******************************************************************
+ * AVX2 versions of the templates: SIMD width 8 when the dimension
+ * allows it.
+ ********************************************************************/
+
+ScalarQuantizer::SQDistanceComputer *
+sq_get_distance_computer_avx (MetricType metric, QuantizerType qtype,
+                              size_t dim, const std::vector<float> & trained)
+{
+    if (dim % 8 == 0) {
+        if (metric == METRIC_L2) {
+            return select_distance_computer<SimilarityL2<8> >
+                (qtype, dim, trained);
+        } else {
+            return select_distance_computer<SimilarityIP<8> >
+                (qtype, dim, trained);
+        }
+    } else {
+        if (metric == METRIC_L2) {
+            return select_distance_computer<SimilarityL2<1> >
+                (qtype, dim, trained);
+        } else {
+            return select_distance_computer<SimilarityIP<1> >
+                (qtype, dim, trained);
+        }
+    }
+}
+
+ScalarQuantizer::Quantizer *
+sq_sel_quantizer_avx (QuantizerType qtype, size_t dim,
+                      const std::vector<float> & trained)
+{
+    if (dim % 8 == 0) {
+        return select_quantizer_1<8> (qtype, dim, trained);
+    } else {
+        return select_quantizer_1<1> (qtype, dim, trained);
+    }
+}
+
+InvertedListScanner *
+sq_sel_inv_list_scanner_avx (MetricType mt, const ScalarQuantizer *sq,
+                             const Index *quantizer, bool store_pairs,
+                             bool by_residual)
+{
+    if (sq->d % 8 == 0) {
+        return sel0_InvertedListScanner<8>
+            (mt, sq, quantizer, store_pairs, by_residual);
+    } else {
+        return sel0_InvertedListScanner<1>
+            (mt, sq, quantizer, store_pairs, by_residual);
+    }
+}
+
+} // namespace faiss
+
+#endif
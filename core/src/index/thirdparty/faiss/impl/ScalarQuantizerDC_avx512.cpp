@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+/* Compiled with AVX-512 F/DQ/BW/VL on top of the AVX2 flags (see
+ * makefile.inc), only reached when the cpu supports them. */
+
+#include <faiss/impl/ScalarQuantizerDC.h>
+
+#ifdef __AVX512F__
+
+#include <faiss/impl/ScalarQuantizerCodec.h>
+
+
+namespace faiss {
+
+/*******************************************************************
+ * AVX-512 versions of the templates: SIMD width 16 when the dimension
+ * allows it, else 8.
+ ********************************************************************/
+
+namespace {
+
+template<template<int> class Sim>
+ScalarQuantizer::SQDistanceComputer *
+select_distance_computer_avx512 (QuantizerType qtype, size_t dim,
+                                 const std::vector<float> & trained)
+{
+    if (dim % 16 == 0) {
+        return select_distance_computer<Sim<16> > (qtype, dim, trained);
+    } else if (dim % 8 == 0) {
+        return select_distance_computer<Sim<8> > (qtype, dim, trained);
+    } else {
+        return select_distance_computer<Sim<1> > (qtype, dim, trained);
+    }
+}
+
+} // anonymous namespace
+
+ScalarQuantizer::SQDistanceComputer *
+sq_get_distance_computer_avx512 (MetricType metric, QuantizerType qtype,
+                                 size_t dim,
+                                 const std::vector<float> & trained)
+{
+    if (metric == METRIC_L2) {
+        return select_distance_computer_avx512<SimilarityL2>
+            (qtype, dim, trained);
+    } else {
+        return select_distance_computer_avx512<SimilarityIP>
+            (qtype, dim, trained);
+    }
+}
+
+ScalarQuantizer::Quantizer *
+sq_sel_quantizer_avx512 (QuantizerType qtype, size_t dim,
+                         const std::vector<float> & trained)
+{
+    if (dim % 16 == 0) {
+        return select_quantizer_1<16> (qtype, dim, trained);
+    } else if (dim % 8 == 0) {
+        return select_quantizer_1<8> (qtype, dim, trained);
+    } else {
+        return select_quantizer_1<1> (qtype, dim, trained);
+    }
+}
+
+InvertedListScanner *
+sq_sel_inv_list_scanner_avx512 (MetricType mt, const ScalarQuantizer *sq,
+                                const Index *quantizer, bool store_pairs,
+                                bool by_residual)
+{
+    if (sq->d % 16 == 0) {
+        return sel0_InvertedListScanner<16>
+            (mt, sq, quantizer, store_pairs, by_residual);
+    } else if (sq->d % 8 == 0) {
+        return sel0_InvertedListScanner<8>
+            (mt, sq, quantizer, store_pairs, by_residual);
+    } else {
+        return sel0_InvertedListScanner<1>
+            (mt, sq, quantizer, store_pairs, by_residual);
+    }
+}
+
+} // namespace faiss
+
+#endif
@@ -28,6 +28,7 @@
 #include <faiss/IndexIVF.h>
 #include <faiss/IndexIVFPQ.h>
 #include <faiss/IndexIVFPQR.h>
+#include <faiss/IndexIVFPQFastScan.h>
 #include <faiss/Index2Layer.h>
 #include <faiss/IndexIVFFlat.h>
 #include <faiss/IndexIVFSpectralHash.h>
@@ -201,7 +202,8 @@ InvertedLists *read_InvertedLists (IOReader *f, int io_flags) {
         fprintf(stderr, "read_InvertedLists:"
                 " WARN! inverted lists not stored with IVF object\n");
         return nullptr;
-    } else if (h == fourcc ("iloa") && !(io_flags & IO_FLAG_MMAP)) {
+    } else if ((h == fourcc ("iloa") || h == fourcc ("ilop")) &&
+               !(io_flags & IO_FLAG_MMAP)) {
         size_t nlist;
         size_t code_size;
         std::vector <size_t> list_length;
@@ -211,7 +213,29 @@ InvertedLists *read_InvertedLists (IOReader *f, int io_flags) {
         auto ails = new ReadOnlyArrayInvertedLists(nlist, code_size, list_length);
         size_t n;
         READ1(n);
+        if (h == fourcc ("ilop")) {
+            // skip the padding that aligns the ids
+            uint8_t pad;
+            READ1(pad);
+            std::vector<uint8_t> skipped(pad);
+            READANDCHECK(skipped.data(), pad);
+        }
 #ifdef USE_CPU
+        if (io_flags & IO_FLAG_ZERO_COPY) {
+            auto ids = f->borrow(n * sizeof(InvertedLists::idx_t),
+                                 alignof(InvertedLists::idx_t));
+            if (ids != nullptr) {
+                auto codes = f->borrow(n * code_size);
+                FAISS_THROW_IF_NOT_MSG(codes, "read_InvertedLists: truncated inverted lists");
+                ails->borrowed_ids = (const InvertedLists::idx_t *) ids;
+                ails->borrowed_codes = codes;
+                ails->borrowed_n = n;
+                // drop the storage reserved by the constructor
+                std::vector<uint8_t>().swap(ails->readonly_codes);
+                std::vector<InvertedLists::idx_t>().swap(ails->readonly_ids);
+                return ails;
+            }
+        }
         ails->readonly_ids.resize(n);
         ails->readonly_codes.resize(n*code_size);
         READANDCHECK(ails->readonly_ids.data(), n);
@@ -624,6 +648,17 @@ Index *read_index (IOReader *f, int io_flags) {
 
         idx = read_ivfpq (f, h, io_flags);
 
+    } else if(h == fourcc ("IwPf")) {
+        IndexIVFPQFastScan * ivpqfs = new IndexIVFPQFastScan ();
+        read_ivf_header (ivpqfs, f);
+        READ1 (ivpqfs->by_residual);
+        READ1 (ivpqfs->code_size);
+        read_ProductQuantizer (&ivpqfs->pq, f);
+        read_InvertedLists (ivpqfs, f, io_flags);
+        if (ivpqfs->invlists) {
+            ivpqfs->build_blocked_codes ();
+        }
+        idx = ivpqfs;
     } else if(h == fourcc ("IxPT")) {
         IndexPreTransform * ixpt = new IndexPreTransform();
         ixpt->own_fields = true;
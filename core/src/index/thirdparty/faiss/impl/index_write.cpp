@@ -28,6 +28,7 @@
 #include <faiss/IndexIVF.h>
 #include <faiss/IndexIVFPQ.h>
 #include <faiss/IndexIVFPQR.h>
+#include <faiss/IndexIVFPQFastScan.h>
 #include <faiss/Index2Layer.h>
 #include <faiss/IndexIVFFlat.h>
 #include <faiss/IndexIVFSpectralHash.h>
@@ -240,22 +241,24 @@ void write_InvertedLists (const InvertedLists *ils, IOWriter *f) {
         }
     } else if (const auto & oa =
             dynamic_cast<const ReadOnlyArrayInvertedLists *>(ils)) {
-        uint32_t h = fourcc("iloa");
+        uint32_t h = fourcc("ilop");
         WRITE1 (h);
         WRITE1 (oa->nlist);
         WRITE1 (oa->code_size);
         WRITEVECTOR(oa->readonly_length);
-#ifdef USE_CPU
-        size_t n = oa->readonly_ids.size();
+        size_t n = oa->get_total_size();
         WRITE1(n);
-        WRITEANDCHECK(oa->readonly_ids.data(), n);
-        WRITEANDCHECK(oa->readonly_codes.data(), n * oa->code_size);
-#else
-        size_t n = oa->pin_readonly_ids->size() / sizeof(InvertedLists::idx_t);
-        WRITE1(n);
-        WRITEANDCHECK((InvertedLists::idx_t *) oa->pin_readonly_ids->data, n);
-        WRITEANDCHECK((uint8_t *) oa->pin_readonly_codes->data, n * oa->code_size);
-#endif
+        // pad the ids to IO_ZERO_COPY_ALIGNMENT so a reader can borrow them
+        uint8_t pad = (IO_ZERO_COPY_ALIGNMENT -
+                       (f->tell() + sizeof(pad)) % IO_ZERO_COPY_ALIGNMENT) %
+                      IO_ZERO_COPY_ALIGNMENT;
+        WRITE1(pad);
+        if (pad > 0) {
+            std::vector<uint8_t> zeros(pad, 0);
+            WRITEANDCHECK(zeros.data(), pad);
+        }
+        WRITEANDCHECK(oa->get_all_ids(), n);
+        WRITEANDCHECK(oa->get_all_codes(), n * oa->code_size);
     } else if (const auto & od =
                dynamic_cast<const OnDiskInvertedLists *>(ils)) {
         uint32_t h = fourcc ("ilod");
@@ -424,6 +427,16 @@ void write_index (const Index *idx, IOWriter *f) {
         WRITE1 (ivsp->threshold_type);
         WRITEVECTOR (ivsp->trained);
         write_InvertedLists (ivsp->invlists, f);
+    } else if(const IndexIVFPQFastScan * ivpqfs =
+              dynamic_cast<const IndexIVFPQFastScan *> (idx)) {
+        // the blocked codes are rebuilt from the inverted lists when read
+        uint32_t h = fourcc ("IwPf");
+        WRITE1 (h);
+        write_ivf_header (ivpqfs, f);
+        WRITE1 (ivpqfs->by_residual);
+        WRITE1 (ivpqfs->code_size);
+        write_ProductQuantizer (&ivpqfs->pq, f);
+        write_InvertedLists (ivpqfs->invlists, f);
     } else if(const IndexIVFPQ * ivpq =
               dynamic_cast<const IndexIVFPQ *> (idx)) {
         const IndexIVFPQR * ivfpqr = dynamic_cast<const IndexIVFPQR *> (idx);
@@ -27,11 +27,21 @@ int IOReader::fileno ()
     FAISS_THROW_MSG ("IOReader does not support memory mapping");
 }
 
+const uint8_t * IOReader::borrow (size_t, size_t)
+{
+    return nullptr;
+}
+
 int IOWriter::fileno ()
 {
     FAISS_THROW_MSG ("IOWriter does not support memory mapping");
 }
 
+size_t IOWriter::tell ()
+{
+    return 0;
+}
+
 /***********************************************************************
  * IO Vector
  ***********************************************************************/
@@ -50,6 +60,11 @@ size_t VectorIOWriter::operator()(
     return nitems;
 }
 
+size_t VectorIOWriter::tell ()
+{
+    return data.size();
+}
+
 size_t VectorIOReader::operator()(
                   void *ptr, size_t size, size_t nitems)
 {
@@ -132,6 +147,11 @@ int FileIOWriter::fileno()  {
     return ::fileno (f);
 }
 
+size_t FileIOWriter::tell()  {
+    long pos = ftell(f);
+    return pos < 0 ? 0 : pos;
+}
+
 uint32_t fourcc (const char sx[4]) {
     assert(4 == strlen(sx));
     const unsigned char *x = (unsigned char*)sx;
@@ -33,6 +33,11 @@ struct IOReader {
     // return a file number that can be memory-mapped
     virtual int fileno ();
 
+    // return a pointer to the next nbytes and skip over them without
+    // copying, or nullptr (and skip nothing) if the reader cannot expose
+    // its buffer or the pointer is not a multiple of alignment
+    virtual const uint8_t * borrow (size_t nbytes, size_t alignment = 1);
+
     virtual ~IOReader() {}
 };
 
@@ -47,6 +52,10 @@ struct IOWriter {
     // return a file number that can be memory-mapped
     virtual int fileno ();
 
+    // number of bytes written so far, used to align data that a reader
+    // may borrow; 0 if the writer does not keep track
+    virtual size_t tell ();
+
     virtual ~IOWriter() {}
 };
 
@@ -60,6 +69,7 @@ struct VectorIOReader:IOReader {
 struct VectorIOWriter:IOWriter {
     std::vector<uint8_t> data;
     size_t operator()(const void *ptr, size_t size, size_t nitems) override;
+    size_t tell() override;
 };
 
 struct FileIOReader: IOReader {
@@ -90,6 +100,8 @@ struct FileIOWriter: IOWriter {
     size_t operator()(const void *ptr, size_t size, size_t nitems) override;
 
     int fileno() override;
+
+    size_t tell() override;
 };
 
 /// cast a 4-character string to a uint32_t that can be written and read easily
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+#include <faiss/impl/pq4_fast_scan.h>
+
+#ifdef __SSSE3__
+#include <immintrin.h>
+#endif
+
+
+namespace faiss {
+
+void pq4_accumulate_block_ref (size_t M, const uint8_t *qtable,
+                               const uint8_t *block, uint16_t *acc)
+{
+    for (size_t j = 0; j < 32; j++) {
+        acc[j] = 0;
+    }
+    for (size_t m = 0; m < M; m++) {
+        const uint8_t *t = qtable + m * 16;
+        const uint8_t *c = block + m * 16;
+        for (size_t j = 0; j < 16; j++) {
+            acc[j] += t[c[j] & 15];
+            acc[j + 16] += t[c[j] >> 4];
+        }
+    }
+}
+
+#ifdef __SSSE3__
+
+/* The table of sub-quantizer m fits in a 128-bit register: one shuffle
+ * per nibble looks up 16 vectors. The bytes are widened to 16 bits
+ * before accumulating, 8 vectors per register. */
+void pq4_accumulate_block_sse (size_t M, const uint8_t *qtable,
+                               const uint8_t *block, uint16_t *acc)
+{
+    const __m128i mask = _mm_set1_epi8 (0xf);
+    const __m128i zero = _mm_setzero_si128 ();
+    __m128i acc0 = zero;  // vectors 0..7
+    __m128i acc1 = zero;  // vectors 8..15
+    __m128i acc2 = zero;  // vectors 16..23
+    __m128i acc3 = zero;  // vectors 24..31
+
+    for (size_t m = 0; m < M; m++) {
+        __m128i lut = _mm_loadu_si128 ((const __m128i*)(qtable + m * 16));
+        __m128i codes = _mm_loadu_si128 ((const __m128i*)(block + m * 16));
+
+        __m128i d_lo = _mm_shuffle_epi8 (lut, _mm_and_si128 (codes, mask));
+        __m128i d_hi = _mm_shuffle_epi8 (
+            lut, _mm_and_si128 (_mm_srli_epi16 (codes, 4), mask));
+
+        acc0 = _mm_add_epi16 (acc0, _mm_unpacklo_epi8 (d_lo, zero));
+        acc1 = _mm_add_epi16 (acc1, _mm_unpackhi_epi8 (d_lo, zero));
+        acc2 = _mm_add_epi16 (acc2, _mm_unpacklo_epi8 (d_hi, zero));
+        acc3 = _mm_add_epi16 (acc3, _mm_unpackhi_epi8 (d_hi, zero));
+    }
+
+    _mm_storeu_si128 ((__m128i*)acc, acc0);
+    _mm_storeu_si128 ((__m128i*)(acc + 8), acc1);
+    _mm_storeu_si128 ((__m128i*)(acc + 16), acc2);
+    _mm_storeu_si128 ((__m128i*)(acc + 24), acc3);
+}
+
+#endif
+
+} // namespace faiss
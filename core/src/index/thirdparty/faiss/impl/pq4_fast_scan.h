@@ -0,0 +1,51 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+/* Kernel of IndexIVFPQFastScan: sums the 8-bit lookup table entries of
+ * the 32 codes of a block.
+ *
+ * qtable holds 16 entries per sub-quantizer, block holds 16 bytes per
+ * sub-quantizer (byte j: code of vector j in the low nibble, of vector
+ * j + 16 in the high nibble). M must be even. acc receives the 32 sums.
+ *
+ * pq4_accumulate_block defaults to the SSE4 kernel on x86 (scalar
+ * elsewhere) and is routed to the AVX2 or AVX-512 one by FaissHook.cpp
+ * when the cpu supports it. */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+namespace faiss {
+
+typedef void (*pq4_accumulate_block_func_ptr) (
+        size_t M, const uint8_t *qtable, const uint8_t *block,
+        uint16_t *acc);
+
+extern pq4_accumulate_block_func_ptr pq4_accumulate_block;
+
+void pq4_accumulate_block_ref (size_t M, const uint8_t *qtable,
+                               const uint8_t *block, uint16_t *acc);
+
+#if defined(__x86_64__) || defined(__i386__)
+
+void pq4_accumulate_block_sse (size_t M, const uint8_t *qtable,
+                               const uint8_t *block, uint16_t *acc);
+
+void pq4_accumulate_block_avx (size_t M, const uint8_t *qtable,
+                               const uint8_t *block, uint16_t *acc);
+
+void pq4_accumulate_block_avx512 (size_t M, const uint8_t *qtable,
+                                  const uint8_t *block, uint16_t *acc);
+
+#endif
+
+} // namespace faiss
@@ -0,0 +1,54 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+/* Compiled with -mavx2 -mfma -mf16c (see makefile.inc), only reached when
+ * the cpu supports AVX2. */
+
+#include <faiss/impl/pq4_fast_scan.h>
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+
+namespace faiss {
+
+/* Two sub-quantizers are handled per iteration, one per 128-bit lane. */
+void pq4_accumulate_block_avx (size_t M, const uint8_t *qtable,
+                               const uint8_t *block, uint16_t *acc)
+{
+    const __m256i mask = _mm256_set1_epi8 (0xf);
+    __m256i acc_lo = _mm256_setzero_si256 ();  // vectors 0..15
+    __m256i acc_hi = _mm256_setzero_si256 ();  // vectors 16..31
+
+    for (size_t m = 0; m < M; m += 2) {
+        // lane 0: sub-quantizer m, lane 1: sub-quantizer m + 1
+        __m256i lut = _mm256_loadu_si256 ((const __m256i*)(qtable + m * 16));
+        __m256i codes = _mm256_loadu_si256 ((const __m256i*)(block + m * 16));
+
+        __m256i d_lo = _mm256_shuffle_epi8 (
+            lut, _mm256_and_si256 (codes, mask));
+        __m256i d_hi = _mm256_shuffle_epi8 (
+            lut, _mm256_and_si256 (_mm256_srli_epi16 (codes, 4), mask));
+
+        acc_lo = _mm256_add_epi16 (acc_lo, _mm256_add_epi16 (
+            _mm256_cvtepu8_epi16 (_mm256_castsi256_si128 (d_lo)),
+            _mm256_cvtepu8_epi16 (_mm256_extracti128_si256 (d_lo, 1))));
+        acc_hi = _mm256_add_epi16 (acc_hi, _mm256_add_epi16 (
+            _mm256_cvtepu8_epi16 (_mm256_castsi256_si128 (d_hi)),
+            _mm256_cvtepu8_epi16 (_mm256_extracti128_si256 (d_hi, 1))));
+    }
+
+    _mm256_storeu_si256 ((__m256i*)acc, acc_lo);
+    _mm256_storeu_si256 ((__m256i*)(acc + 16), acc_hi);
+}
+
+} // namespace faiss
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+/* Compiled with AVX-512 F/DQ/BW/VL on top of the AVX2 flags (see
+ * makefile.inc), only reached when the cpu supports them. */
+
+#include <faiss/impl/pq4_fast_scan.h>
+
+#ifdef __AVX512BW__
+
+#include <immintrin.h>
+
+
+namespace faiss {
+
+/* Four sub-quantizers are handled per iteration, one per 128-bit lane.
+ * The lanes of sub-quantizers m and m + 2 (resp. m + 1 and m + 3) are
+ * summed together and only folded at the end. */
+void pq4_accumulate_block_avx512 (size_t M, const uint8_t *qtable,
+                                  const uint8_t *block, uint16_t *acc)
+{
+    const __m512i mask = _mm512_set1_epi8 (0xf);
+    __m512i acc_lo = _mm512_setzero_si512 ();  // vectors 0..15, twice
+    __m512i acc_hi = _mm512_setzero_si512 ();  // vectors 16..31, twice
+
+    size_t m = 0;
+    for (; m + 4 <= M; m += 4) {
+        __m512i lut = _mm512_loadu_si512 ((const void*)(qtable + m * 16));
+        __m512i codes = _mm512_loadu_si512 ((const void*)(block + m * 16));
+
+        __m512i d_lo = _mm512_shuffle_epi8 (
+            lut, _mm512_and_si512 (codes, mask));
+        __m512i d_hi = _mm512_shuffle_epi8 (
+            lut, _mm512_and_si512 (_mm512_srli_epi16 (codes, 4), mask));
+
+        acc_lo = _mm512_add_epi16 (acc_lo, _mm512_add_epi16 (
+            _mm512_cvtepu8_epi16 (_mm512_castsi512_si256 (d_lo)),
+            _mm512_cvtepu8_epi16 (_mm512_extracti64x4_epi64 (d_lo, 1))));
+        acc_hi = _mm512_add_epi16 (acc_hi, _mm512_add_epi16 (
+            _mm512_cvtepu8_epi16 (_mm512_castsi512_si256 (d_hi)),
+            _mm512_cvtepu8_epi16 (_mm512_extracti64x4_epi64 (d_hi, 1))));
+    }
+
+    __m256i acc_lo2 = _mm256_add_epi16 (
+        _mm512_castsi512_si256 (acc_lo), _mm512_extracti64x4_epi64 (acc_lo, 1));
+    __m256i acc_hi2 = _mm256_add_epi16 (
+        _mm512_castsi512_si256 (acc_hi), _mm512_extracti64x4_epi64 (acc_hi, 1));
+
+    if (m < M) {
+        // M is even: the last two sub-quantizers, as in the AVX2 kernel
+        const __m256i mask2 = _mm256_set1_epi8 (0xf);
+        __m256i lut = _mm256_loadu_si256 ((const __m256i*)(qtable + m * 16));
+        __m256i codes = _mm256_loadu_si256 ((const __m256i*)(block + m * 16));
+
+        __m256i d_lo = _mm256_shuffle_epi8 (
+            lut, _mm256_and_si256 (codes, mask2));
+        __m256i d_hi = _mm256_shuffle_epi8 (
+            lut, _mm256_and_si256 (_mm256_srli_epi16 (codes, 4), mask2));
+
+        acc_lo2 = _mm256_add_epi16 (acc_lo2, _mm256_add_epi16 (
+            _mm256_cvtepu8_epi16 (_mm256_castsi256_si128 (d_lo)),
+            _mm256_cvtepu8_epi16 (_mm256_extracti128_si256 (d_lo, 1))));
+        acc_hi2 = _mm256_add_epi16 (acc_hi2, _mm256_add_epi16 (
+            _mm256_cvtepu8_epi16 (_mm256_castsi256_si128 (d_hi)),
+            _mm256_cvtepu8_epi16 (_mm256_extracti128_si256 (d_hi, 1))));
+    }
+
+    _mm256_storeu_si256 ((__m256i*)acc, acc_lo2);
+    _mm256_storeu_si256 ((__m256i*)(acc + 16), acc_hi2);
+}
+
+} // namespace faiss
+
+#endif
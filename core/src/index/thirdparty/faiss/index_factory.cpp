@@ -194,12 +194,13 @@ Index *index_factory (int d, const char *description_in, MetricType metric)
                 index_1 = new IndexFlat (d, metric);
             }
         } else if (!index && (stok == "SQ8" || stok == "SQ4" || stok == "SQ6" ||
-                              stok == "SQfp16")) {
+                              stok == "SQfp16" || stok == "SQbf16")) {
             ScalarQuantizer::QuantizerType qt =
                 stok == "SQ8" ? ScalarQuantizer::QT_8bit :
                 stok == "SQ6" ? ScalarQuantizer::QT_6bit :
                 stok == "SQ4" ? ScalarQuantizer::QT_4bit :
                 stok == "SQfp16" ? ScalarQuantizer::QT_fp16 :
+                stok == "SQbf16" ? ScalarQuantizer::QT_bf16 :
                 ScalarQuantizer::QT_4bit;
             if (coarse_quantizer) {
                 FAISS_THROW_IF_NOT (!use_2layer);
@@ -47,6 +47,12 @@ const int IO_FLAG_READ_ONLY = 2;
 // strip directory component from ondisk filename, and assume it's in
 // the same directory as the index file
 const int IO_FLAG_ONDISK_SAME_DIR = 4;
+// read-only inverted lists keep pointing at the reader's buffer instead of
+// copying it, the buffer must outlive the index
+const int IO_FLAG_ZERO_COPY = 8;
+// read-only inverted lists are padded to this alignment from the start of
+// the stream, a buffer aligned the same way can be borrowed as is
+const size_t IO_ZERO_COPY_ALIGNMENT = 64;
 
 Index *read_index (const char *fname, int io_flags = 0);
 Index *read_index (FILE * f, int io_flags = 0);
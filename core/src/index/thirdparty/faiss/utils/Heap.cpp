@@ -23,6 +23,14 @@ void HeapArray<C>::heapify ()
         heap_heapify<C> (k, val + j * k, ids + j * k);
 }
 
+template <typename C>
+void HeapArray<C>::seed (const T *bound)
+{
+#pragma omp parallel for
+    for (size_t j = 0; j < nh; j++)
+        heap_seed<C> (k, val + j * k, ids + j * k, bound[j]);
+}
+
 template <typename C>
 void HeapArray<C>::reorder ()
 {
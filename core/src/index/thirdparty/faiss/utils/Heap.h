@@ -286,6 +286,23 @@ void maxheap_addn (size_t k, T * bh_val, int64_t * bh_ids,
 
 
 
+/* Fill a heapified heap with a bound, elements that don't beat it are
+   rejected. The slots still holding the bound are dropped by heap_reorder. */
+template <class C> inline
+void heap_seed (size_t k,
+                typename C::T * bh_val, typename C::TI * bh_ids,
+                typename C::T bound)
+{
+    if (!C::cmp (bh_val[0], bound))
+        return;
+    for (size_t i = 0; i < k; i++) {
+        bh_val[i] = bound;
+        bh_ids[i] = -1;
+    }
+}
+
+
+
 /*******************************************************************
  * Heap finalization (reorder elements)
  *******************************************************************/
@@ -365,6 +382,9 @@ struct HeapArray {
     /// prepare all the heaps before adding
     void heapify ();
 
+    /// fill heap i with bound[i] after heapify, size nh
+    void seed (const T *bound);
+
     /** add nj elements to heaps i0:i0+ni, with sequential ids
      *
      * @param nj    nb of elements to add to each heap
@@ -44,6 +44,10 @@ int sgemv_(const char *trans, FINTEGER *m, FINTEGER *n, float *alpha,
            const float *a, FINTEGER *lda, const float *x, FINTEGER *incx,
            float *beta, float *y, FINTEGER *incy);
 
+/* threading controls, null unless the BLAS library provides them */
+int openblas_get_parallel (void) __attribute__((weak));
+int MKL_Set_Num_Threads_Local (int nth) __attribute__((weak));
+
 }
 
 
@@ -98,6 +102,86 @@ void fvec_norms_L2 (float * __restrict nr,
     }
 }
 
+namespace {
+
+/* holds the BLAS library to the calling thread while in scope. MKL takes a
+ * thread-local setting; OpenBLAS built with OpenMP runs serially inside a
+ * parallel region, but its pthreads build shares one pool between all
+ * callers and cannot be held. */
+struct SingleThreadBlas {
+    bool ok = true;
+    int prev_mkl_threads = 0;
+
+    SingleThreadBlas () {
+        if (MKL_Set_Num_Threads_Local) {
+            prev_mkl_threads = MKL_Set_Num_Threads_Local (1);
+        } else if (openblas_get_parallel) {
+            ok = openblas_get_parallel () != 1;
+        }
+    }
+
+    ~SingleThreadBlas () {
+        if (MKL_Set_Num_Threads_Local) {
+            MKL_Set_Num_Threads_Local (prev_mkl_threads);
+        }
+    }
+};
+
+} // namespace
+
+void fvec_inner_products_tile (float * ip,
+                               const float * x,
+                               const float * y,
+                               size_t d, size_t nx, size_t ny)
+{
+    if (nx == 0 || ny == 0) return;
+
+    SingleThreadBlas blas;
+    if (!blas.ok) {
+        for (size_t i = 0; i < nx; i++) {
+            fvec_inner_products_ny (ip + i * ny, x + i * d, y, d, ny);
+        }
+        return;
+    }
+
+    float one = 1, zero = 0;
+    FINTEGER nyi = ny, nxi = nx, di = d;
+    sgemm_ ("Transpose", "Not transpose", &nyi, &nxi, &di, &one,
+            y, &di, x, &di, &zero, ip, &nyi);
+}
+
+void fvec_L2sqr_tile (float * dis,
+                      const float * x,
+                      const float * y,
+                      const float * y_norms,
+                      size_t d, size_t nx, size_t ny)
+{
+    if (nx == 0 || ny == 0) return;
+
+    SingleThreadBlas blas;
+    if (!blas.ok) {
+        for (size_t i = 0; i < nx; i++) {
+            fvec_L2sqr_ny (dis + i * ny, x + i * d, y, d, ny);
+        }
+        return;
+    }
+
+    float minus_2 = -2, zero = 0;
+    FINTEGER nyi = ny, nxi = nx, di = d;
+    sgemm_ ("Transpose", "Not transpose", &nyi, &nxi, &di, &minus_2,
+            y, &di, x, &di, &zero, dis, &nyi);
+
+    for (size_t i = 0; i < nx; i++) {
+        float x_norm = fvec_norm_L2sqr (x + i * d, d);
+        float * dis_i = dis + i * ny;
+        for (size_t j = 0; j < ny; j++) {
+            // cancellation can make the expansion slightly negative
+            float v = dis_i[j] + x_norm + y_norms[j];
+            dis_i[j] = v < 0 ? 0 : v;
+        }
+    }
+}
+
 void fvec_norms_L2sqr (float * __restrict nr,
                        const float * __restrict x,
                        size_t d, size_t nx)
@@ -147,7 +231,9 @@ void fvec_renorm_L2 (size_t d, size_t nx, float * __restrict x)
 static void knn_inner_product_sse (const float * x,
                         const float * y,
                         size_t d, size_t nx, size_t ny,
-                        float_minheap_array_t * res)
+                        float_minheap_array_t * res,
+                        const float * bound,
+                        const uint8_t * bitset)
 {
     size_t k = res->k;
     size_t check_period = InterruptCallback::get_period_hint (ny * d);
@@ -166,15 +252,16 @@ static void knn_inner_product_sse (const float * x,
             int64_t * __restrict idxi = res->get_ids (i);
 
             minheap_heapify (k, simi, idxi);
+            if (bound) heap_seed<CMin<float, int64_t> > (k, simi, idxi, bound[i]);
 
-            for (size_t j = 0; j < ny; j++) {
+            for (size_t j = 0; j < ny; j++, y_j += d) {
+                if (bitset && bitset_test (bitset, j)) continue;
                 float ip = fvec_inner_product (x_i, y_j, d);
 
                 if (ip > simi[0]) {
                     minheap_pop (k, simi, idxi);
                     minheap_push (k, simi, idxi, ip, j);
                 }
-                y_j += d;
             }
             minheap_reorder (k, simi, idxi);
         }
@@ -187,7 +274,9 @@ static void knn_L2sqr_sse (
                 const float * x,
                 const float * y,
                 size_t d, size_t nx, size_t ny,
-                float_maxheap_array_t * res)
+                float_maxheap_array_t * res,
+                const float * bound,
+                const uint8_t * bitset)
 {
     size_t k = res->k;
 
@@ -206,14 +295,15 @@ static void knn_L2sqr_sse (
             int64_t * idxi = res->get_ids (i);
 
             maxheap_heapify (k, simi, idxi);
-            for (j = 0; j < ny; j++) {
+            if (bound) heap_seed<CMax<float, int64_t> > (k, simi, idxi, bound[i]);
+            for (j = 0; j < ny; j++, y_j += d) {
+                if (bitset && bitset_test (bitset, j)) continue;
                 float disij = fvec_L2sqr (x_i, y_j, d);
 
                 if (disij < simi[0]) {
                     maxheap_pop (k, simi, idxi);
                     maxheap_push (k, simi, idxi, disij, j);
                 }
-                y_j += d;
             }
             maxheap_reorder (k, simi, idxi);
         }
@@ -228,9 +318,12 @@ static void knn_inner_product_blas (
         const float * x,
         const float * y,
         size_t d, size_t nx, size_t ny,
-        float_minheap_array_t * res)
+        float_minheap_array_t * res,
+        const float * bound,
+        const uint8_t * bitset)
 {
     res->heapify ();
+    if (bound) res->seed (bound);
 
     // BLAS does not like empty matrices
     if (nx == 0 || ny == 0) return;
@@ -257,6 +350,16 @@ static void knn_inner_product_blas (
                         ip_block.get(), &nyi);
             }
 
+            /* deleted rows can't beat the heap neutral value */
+            if (bitset) {
+                for (size_t j = j0; j < j1; j++) {
+                    if (!bitset_test (bitset, j)) continue;
+                    for (size_t i = 0; i < i1 - i0; i++) {
+                        ip_block[i * (j1 - j0) + j - j0] = -HUGE_VALF;
+                    }
+                }
+            }
+
             /* collect maxima */
             res->addn (j1 - j0, ip_block.get(), j0, i0, i1 - i0);
         }
@@ -272,9 +375,12 @@ static void knn_L2sqr_blas (const float * x,
         const float * y,
         size_t d, size_t nx, size_t ny,
         float_maxheap_array_t * res,
-        const DistanceCorrection &corr)
+        const DistanceCorrection &corr,
+        const float * bound = nullptr,
+        const uint8_t * bitset = nullptr)
 {
     res->heapify ();
+    if (bound) res->seed (bound);
 
     // BLAS does not like empty matrices
     if (nx == 0 || ny == 0) return;
@@ -319,6 +425,7 @@ static void knn_L2sqr_blas (const float * x,
 
                 for (size_t j = j0; j < j1; j++) {
                     float ip = *ip_line++;
+                    if (bitset && bitset_test (bitset, j)) continue;
                     float dis = x_norms[i] + y_norms[j] - 2 * ip;
 
                     // negative values can occur for identical vectors
@@ -428,12 +535,14 @@ int distance_compute_blas_threshold = 20;
 void knn_inner_product (const float * x,
         const float * y,
         size_t d, size_t nx, size_t ny,
-        float_minheap_array_t * res)
+        float_minheap_array_t * res,
+        const float * bound,
+        const uint8_t * bitset)
 {
     if (d % 4 == 0 && nx < distance_compute_blas_threshold) {
-        knn_inner_product_sse (x, y, d, nx, ny, res);
+        knn_inner_product_sse (x, y, d, nx, ny, res, bound, bitset);
     } else {
-        knn_inner_product_blas (x, y, d, nx, ny, res);
+        knn_inner_product_blas (x, y, d, nx, ny, res, bound, bitset);
     }
 }
 
@@ -448,13 +557,15 @@ struct NopDistanceCorrection {
 void knn_L2sqr (const float * x,
                 const float * y,
                 size_t d, size_t nx, size_t ny,
-                float_maxheap_array_t * res)
+                float_maxheap_array_t * res,
+                const float * bound,
+                const uint8_t * bitset)
 {
     if (d % 4 == 0 && nx < distance_compute_blas_threshold) {
-        knn_L2sqr_sse (x, y, d, nx, ny, res);
+        knn_L2sqr_sse (x, y, d, nx, ny, res, bound, bitset);
     } else {
         NopDistanceCorrection nop;
-        knn_L2sqr_blas (x, y, d, nx, ny, res, nop);
+        knn_L2sqr_blas (x, y, d, nx, ny, res, nop, bound, bitset);
     }
 }
 
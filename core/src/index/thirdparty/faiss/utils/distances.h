@@ -21,28 +21,32 @@ namespace faiss {
 
  /*********************************************************
  * Optimized distance/norm/inner prod computations
+ *
+ * fvec_L2sqr, fvec_inner_product, fvec_L1, fvec_Linf and
+ * fvec_norm_L2sqr are function pointers, routed at load time to the
+ * kernels of the best instruction set of the cpu (see FaissHook.h)
  *********************************************************/
 
 
 /// Squared L2 distance between two vectors
-float fvec_L2sqr (
+extern float (*fvec_L2sqr) (
         const float * x,
         const float * y,
         size_t d);
 
 /// inner product
-float  fvec_inner_product (
+extern float (*fvec_inner_product) (
         const float * x,
         const float * y,
         size_t d);
 
 /// L1 distance
-float fvec_L1 (
+extern float (*fvec_L1) (
         const float * x,
         const float * y,
         size_t d);
 
-float fvec_Linf (
+extern float (*fvec_Linf) (
         const float * x,
         const float * y,
         size_t d);
@@ -82,10 +86,35 @@ void fvec_L2sqr_ny (
         const float * y,
         size_t d, size_t ny);
 
+/** Inner products of nx vectors x with ny vectors y, with one sgemm
+ * running on the calling thread only. For callers that are already inside
+ * a parallel loop: nothing here opens an omp region, and the BLAS library
+ * is held to one thread for the call. Where it cannot be held (OpenBLAS
+ * with its own thread pool) the SIMD kernels are used instead.
+ *
+ * @param ip    output inner products, size nx * ny
+ */
+void fvec_inner_products_tile (
+        float * ip,
+        const float * x,
+        const float * y,
+        size_t d, size_t nx, size_t ny);
+
+/** same as fvec_inner_products_tile for squared L2 distances
+ *
+ * @param y_norms  squared norms of the y vectors, size ny
+ */
+void fvec_L2sqr_tile (
+        float * dis,
+        const float * x,
+        const float * y,
+        const float * y_norms,
+        size_t d, size_t nx, size_t ny);
+
 
 /** squared norm of a vector */
-float fvec_norm_L2sqr (const float * x,
-                       size_t d);
+extern float (*fvec_norm_L2sqr) (const float * x,
+                                 size_t d);
 
 /** compute the L2 norms for a set of vectors
  *
@@ -165,19 +194,31 @@ extern int distance_compute_blas_threshold;
  * @param x    query vectors, size nx * d
  * @param y    database vectors, size ny * d
  * @param res  result array, which also provides k. Sorted on output
+ * @param bound  per query distance a result must beat, size nx (optional)
+ * @param bitset  database vectors to skip, bit j set for deleted row j,
+ *                size (ny + 7) / 8 (optional)
  */
 void knn_inner_product (
         const float * x,
         const float * y,
         size_t d, size_t nx, size_t ny,
-        float_minheap_array_t * res);
+        float_minheap_array_t * res,
+        const float * bound = nullptr,
+        const uint8_t * bitset = nullptr);
 
 /** Same as knn_inner_product, for the L2 distance */
 void knn_L2sqr (
         const float * x,
         const float * y,
         size_t d, size_t nx, size_t ny,
-        float_maxheap_array_t * res);
+        float_maxheap_array_t * res,
+        const float * bound = nullptr,
+        const uint8_t * bitset = nullptr);
+
+/// whether bit i of a deletion bitset is set
+inline bool bitset_test (const uint8_t * bitset, size_t i) {
+    return (bitset[i >> 3] >> (i & 7)) & 1;
+}
 
 void knn_jaccard (
         const float * x,
@@ -0,0 +1,221 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+/* AVX2 kernels, compiled with -mavx2 -mfma -mf16c (see makefile.inc).
+ * Only reached through the function pointers of distances.h when the
+ * cpu supports AVX2, so nothing with external linkage other than the
+ * kernels may be defined here. */
+
+#include <faiss/utils/distances_simd.h>
+
+#ifdef __AVX2__
+
+#include <immintrin.h>
+
+
+namespace faiss {
+
+namespace {
+
+// reads 0 <= d < 4 floats as __m128
+inline __m128 masked_read (int d, const float *x)
+{
+    __attribute__((__aligned__(16))) float buf[4] = {0, 0, 0, 0};
+    switch (d) {
+      case 3:
+        buf[2] = x[2];
+      case 2:
+        buf[1] = x[1];
+      case 1:
+        buf[0] = x[0];
+    }
+    return _mm_load_ps (buf);
+}
+
+inline float horizontal_sum (__m128 v)
+{
+    v = _mm_hadd_ps (v, v);
+    v = _mm_hadd_ps (v, v);
+    return _mm_cvtss_f32 (v);
+}
+
+inline __m128 fold (__m256 v)
+{
+    return _mm_add_ps (_mm256_extractf128_ps (v, 1),
+                       _mm256_castps256_ps128 (v));
+}
+
+} // anonymous namespace
+
+
+float fvec_inner_product_avx (const float * x,
+                              const float * y,
+                              size_t d)
+{
+    __m256 msum1 = _mm256_setzero_ps();
+
+    while (d >= 8) {
+        __m256 mx = _mm256_loadu_ps (x); x += 8;
+        __m256 my = _mm256_loadu_ps (y); y += 8;
+        msum1 = _mm256_fmadd_ps (mx, my, msum1);
+        d -= 8;
+    }
+
+    __m128 msum2 = fold (msum1);
+
+    if (d >= 4) {
+        __m128 mx = _mm_loadu_ps (x); x += 4;
+        __m128 my = _mm_loadu_ps (y); y += 4;
+        msum2 = _mm_fmadd_ps (mx, my, msum2);
+        d -= 4;
+    }
+
+    if (d > 0) {
+        __m128 mx = masked_read (d, x);
+        __m128 my = masked_read (d, y);
+        msum2 = _mm_fmadd_ps (mx, my, msum2);
+    }
+
+    return horizontal_sum (msum2);
+}
+
+float fvec_L2sqr_avx (const float * x,
+                      const float * y,
+                      size_t d)
+{
+    __m256 msum1 = _mm256_setzero_ps();
+
+    while (d >= 8) {
+        __m256 mx = _mm256_loadu_ps (x); x += 8;
+        __m256 my = _mm256_loadu_ps (y); y += 8;
+        const __m256 a_m_b1 = _mm256_sub_ps (mx, my);
+        msum1 = _mm256_fmadd_ps (a_m_b1, a_m_b1, msum1);
+        d -= 8;
+    }
+
+    __m128 msum2 = fold (msum1);
+
+    if (d >= 4) {
+        __m128 mx = _mm_loadu_ps (x); x += 4;
+        __m128 my = _mm_loadu_ps (y); y += 4;
+        const __m128 a_m_b1 = _mm_sub_ps (mx, my);
+        msum2 = _mm_fmadd_ps (a_m_b1, a_m_b1, msum2);
+        d -= 4;
+    }
+
+    if (d > 0) {
+        __m128 mx = masked_read (d, x);
+        __m128 my = masked_read (d, y);
+        __m128 a_m_b1 = _mm_sub_ps (mx, my);
+        msum2 = _mm_fmadd_ps (a_m_b1, a_m_b1, msum2);
+    }
+
+    return horizontal_sum (msum2);
+}
+
+float fvec_L1_avx (const float * x, const float * y, size_t d)
+{
+    __m256 msum1 = _mm256_setzero_ps();
+    __m256 signmask = _mm256_castsi256_ps (_mm256_set1_epi32 (0x7fffffffUL));
+
+    while (d >= 8) {
+        __m256 mx = _mm256_loadu_ps (x); x += 8;
+        __m256 my = _mm256_loadu_ps (y); y += 8;
+        const __m256 a_m_b = _mm256_sub_ps (mx, my);
+        msum1 = _mm256_add_ps (msum1, _mm256_and_ps (signmask, a_m_b));
+        d -= 8;
+    }
+
+    __m128 msum2 = fold (msum1);
+    __m128 signmask2 = _mm_castsi128_ps (_mm_set1_epi32 (0x7fffffffUL));
+
+    if (d >= 4) {
+        __m128 mx = _mm_loadu_ps (x); x += 4;
+        __m128 my = _mm_loadu_ps (y); y += 4;
+        const __m128 a_m_b = _mm_sub_ps (mx, my);
+        msum2 = _mm_add_ps (msum2, _mm_and_ps (signmask2, a_m_b));
+        d -= 4;
+    }
+
+    if (d > 0) {
+        __m128 mx = masked_read (d, x);
+        __m128 my = masked_read (d, y);
+        __m128 a_m_b = _mm_sub_ps (mx, my);
+        msum2 = _mm_add_ps (msum2, _mm_and_ps (signmask2, a_m_b));
+    }
+
+    return horizontal_sum (msum2);
+}
+
+float fvec_Linf_avx (const float * x, const float * y, size_t d)
+{
+    __m256 msum1 = _mm256_setzero_ps();
+    __m256 signmask = _mm256_castsi256_ps (_mm256_set1_epi32 (0x7fffffffUL));
+
+    while (d >= 8) {
+        __m256 mx = _mm256_loadu_ps (x); x += 8;
+        __m256 my = _mm256_loadu_ps (y); y += 8;
+        const __m256 a_m_b = _mm256_sub_ps (mx, my);
+        msum1 = _mm256_max_ps (msum1, _mm256_and_ps (signmask, a_m_b));
+        d -= 8;
+    }
+
+    __m128 msum2 = _mm256_extractf128_ps (msum1, 1);
+    msum2 = _mm_max_ps (msum2, _mm256_castps256_ps128 (msum1));
+    __m128 signmask2 = _mm_castsi128_ps (_mm_set1_epi32 (0x7fffffffUL));
+
+    if (d >= 4) {
+        __m128 mx = _mm_loadu_ps (x); x += 4;
+        __m128 my = _mm_loadu_ps (y); y += 4;
+        const __m128 a_m_b = _mm_sub_ps (mx, my);
+        msum2 = _mm_max_ps (msum2, _mm_and_ps (signmask2, a_m_b));
+        d -= 4;
+    }
+
+    if (d > 0) {
+        __m128 mx = masked_read (d, x);
+        __m128 my = masked_read (d, y);
+        __m128 a_m_b = _mm_sub_ps (mx, my);
+        msum2 = _mm_max_ps (msum2, _mm_and_ps (signmask2, a_m_b));
+    }
+
+    msum2 = _mm_max_ps (_mm_movehl_ps (msum2, msum2), msum2);
+    msum2 = _mm_max_ps (msum2, _mm_shuffle_ps (msum2, msum2, 1));
+    return  _mm_cvtss_f32 (msum2);
+}
+
+float fvec_norm_L2sqr_avx (const float * x, size_t d)
+{
+    __m256 msum1 = _mm256_setzero_ps();
+
+    while (d >= 8) {
+        __m256 mx = _mm256_loadu_ps (x); x += 8;
+        msum1 = _mm256_fmadd_ps (mx, mx, msum1);
+        d -= 8;
+    }
+
+    __m128 msum2 = fold (msum1);
+
+    if (d >= 4) {
+        __m128 mx = _mm_loadu_ps (x); x += 4;
+        msum2 = _mm_fmadd_ps (mx, mx, msum2);
+        d -= 4;
+    }
+
+    if (d > 0) {
+        __m128 mx = masked_read (d, x);
+        msum2 = _mm_fmadd_ps (mx, mx, msum2);
+    }
+
+    return horizontal_sum (msum2);
+}
+
+} // namespace faiss
+
+#endif
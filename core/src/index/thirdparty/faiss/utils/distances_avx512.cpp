@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+/* AVX-512 kernels, compiled with -mavx512f -mavx512dq -mavx512bw
+ * -mavx512vl on top of the AVX2 flags (see makefile.inc). Only reached
+ * through the function pointers of distances.h when the cpu supports
+ * these extensions. */
+
+#include <faiss/utils/distances_simd.h>
+
+#ifdef __AVX512F__
+
+#include <immintrin.h>
+
+
+namespace faiss {
+
+namespace {
+
+// mask of the first 0 <= d < 16 lanes
+inline __mmask16 tail_mask (size_t d)
+{
+    return (__mmask16)((1U << d) - 1);
+}
+
+} // anonymous namespace
+
+
+/* The tails are read with masked loads, which do not fault on the
+ * masked-out lanes, so any d is handled without a scalar loop. Two
+ * accumulators hide the latency of the FMAs. */
+
+float fvec_inner_product_avx512 (const float * x,
+                                 const float * y,
+                                 size_t d)
+{
+    __m512 msum1 = _mm512_setzero_ps();
+    __m512 msum2 = _mm512_setzero_ps();
+
+    while (d >= 32) {
+        msum1 = _mm512_fmadd_ps (_mm512_loadu_ps (x), _mm512_loadu_ps (y),
+                                 msum1);
+        msum2 = _mm512_fmadd_ps (_mm512_loadu_ps (x + 16),
+                                 _mm512_loadu_ps (y + 16), msum2);
+        x += 32; y += 32; d -= 32;
+    }
+
+    if (d >= 16) {
+        msum1 = _mm512_fmadd_ps (_mm512_loadu_ps (x), _mm512_loadu_ps (y),
+                                 msum1);
+        x += 16; y += 16; d -= 16;
+    }
+
+    if (d > 0) {
+        __mmask16 mask = tail_mask (d);
+        msum2 = _mm512_fmadd_ps (_mm512_maskz_loadu_ps (mask, x),
+                                 _mm512_maskz_loadu_ps (mask, y), msum2);
+    }
+
+    return _mm512_reduce_add_ps (_mm512_add_ps (msum1, msum2));
+}
+
+float fvec_L2sqr_avx512 (const float * x,
+                         const float * y,
+                         size_t d)
+{
+    __m512 msum1 = _mm512_setzero_ps();
+    __m512 msum2 = _mm512_setzero_ps();
+
+    while (d >= 32) {
+        __m512 a_m_b1 = _mm512_sub_ps (_mm512_loadu_ps (x),
+                                       _mm512_loadu_ps (y));
+        __m512 a_m_b2 = _mm512_sub_ps (_mm512_loadu_ps (x + 16),
+                                       _mm512_loadu_ps (y + 16));
+        msum1 = _mm512_fmadd_ps (a_m_b1, a_m_b1, msum1);
+        msum2 = _mm512_fmadd_ps (a_m_b2, a_m_b2, msum2);
+        x += 32; y += 32; d -= 32;
+    }
+
+    if (d >= 16) {
+        __m512 a_m_b1 = _mm512_sub_ps (_mm512_loadu_ps (x),
+                                       _mm512_loadu_ps (y));
+        msum1 = _mm512_fmadd_ps (a_m_b1, a_m_b1, msum1);
+        x += 16; y += 16; d -= 16;
+    }
+
+    if (d > 0) {
+        __mmask16 mask = tail_mask (d);
+        __m512 a_m_b2 = _mm512_sub_ps (_mm512_maskz_loadu_ps (mask, x),
+                                       _mm512_maskz_loadu_ps (mask, y));
+        msum2 = _mm512_fmadd_ps (a_m_b2, a_m_b2, msum2);
+    }
+
+    return _mm512_reduce_add_ps (_mm512_add_ps (msum1, msum2));
+}
+
+float fvec_L1_avx512 (const float * x, const float * y, size_t d)
+{
+    __m512 msum = _mm512_setzero_ps();
+
+    while (d >= 16) {
+        __m512 a_m_b = _mm512_sub_ps (_mm512_loadu_ps (x),
+                                      _mm512_loadu_ps (y));
+        msum = _mm512_add_ps (msum, _mm512_abs_ps (a_m_b));
+        x += 16; y += 16; d -= 16;
+    }
+
+    if (d > 0) {
+        __mmask16 mask = tail_mask (d);
+        __m512 a_m_b = _mm512_sub_ps (_mm512_maskz_loadu_ps (mask, x),
+                                      _mm512_maskz_loadu_ps (mask, y));
+        msum = _mm512_add_ps (msum, _mm512_abs_ps (a_m_b));
+    }
+
+    return _mm512_reduce_add_ps (msum);
+}
+
+float fvec_Linf_avx512 (const float * x, const float * y, size_t d)
+{
+    __m512 mmax = _mm512_setzero_ps();
+
+    while (d >= 16) {
+        __m512 a_m_b = _mm512_sub_ps (_mm512_loadu_ps (x),
+                                      _mm512_loadu_ps (y));
+        mmax = _mm512_max_ps (mmax, _mm512_abs_ps (a_m_b));
+        x += 16; y += 16; d -= 16;
+    }
+
+    if (d > 0) {
+        __mmask16 mask = tail_mask (d);
+        __m512 a_m_b = _mm512_sub_ps (_mm512_maskz_loadu_ps (mask, x),
+                                      _mm512_maskz_loadu_ps (mask, y));
+        mmax = _mm512_max_ps (mmax, _mm512_abs_ps (a_m_b));
+    }
+
+    return _mm512_reduce_max_ps (mmax);
+}
+
+float fvec_norm_L2sqr_avx512 (const float * x, size_t d)
+{
+    __m512 msum1 = _mm512_setzero_ps();
+    __m512 msum2 = _mm512_setzero_ps();
+
+    while (d >= 32) {
+        __m512 mx1 = _mm512_loadu_ps (x);
+        __m512 mx2 = _mm512_loadu_ps (x + 16);
+        msum1 = _mm512_fmadd_ps (mx1, mx1, msum1);
+        msum2 = _mm512_fmadd_ps (mx2, mx2, msum2);
+        x += 32; d -= 32;
+    }
+
+    if (d >= 16) {
+        __m512 mx1 = _mm512_loadu_ps (x);
+        msum1 = _mm512_fmadd_ps (mx1, mx1, msum1);
+        x += 16; d -= 16;
+    }
+
+    if (d > 0) {
+        __m512 mx2 = _mm512_maskz_loadu_ps (tail_mask (d), x);
+        msum2 = _mm512_fmadd_ps (mx2, mx2, msum2);
+    }
+
+    return _mm512_reduce_add_ps (_mm512_add_ps (msum1, msum2));
+}
+
+} // namespace faiss
+
+#endif
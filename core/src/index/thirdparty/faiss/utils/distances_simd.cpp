@@ -8,6 +8,7 @@
 // -*- c++ -*-
 
 #include <faiss/utils/distances.h>
+#include <faiss/utils/distances_simd.h>
 
 #include <cstdio>
 #include <cassert>
@@ -26,10 +27,6 @@
 
 namespace faiss {
 
-#ifdef __AVX__
-#define USE_AVX
-#endif
-
 
 /*********************************************************
  * Optimized distance computations
@@ -153,8 +150,8 @@ static inline __m128 masked_read (int d, const float *x)
     // cannot use AVX2 _mm_mask_set1_epi32
 }
 
-float fvec_norm_L2sqr (const float *  x,
-                      size_t d)
+float fvec_norm_L2sqr_sse (const float *  x,
+                          size_t d)
 {
     __m128 mx;
     __m128 msum1 = _mm_setzero_ps();
@@ -315,185 +312,12 @@ void fvec_L2sqr_ny (float * dis, const float * x,
 
 #endif
 
-#ifdef USE_AVX
-
-// reads 0 <= d < 8 floats as __m256
-static inline __m256 masked_read_8 (int d, const float *x)
-{
-    assert (0 <= d && d < 8);
-    if (d < 4) {
-        __m256 res = _mm256_setzero_ps ();
-        res = _mm256_insertf128_ps (res, masked_read (d, x), 0);
-        return res;
-    } else {
-        __m256 res = _mm256_setzero_ps ();
-        res = _mm256_insertf128_ps (res, _mm_loadu_ps (x), 0);
-        res = _mm256_insertf128_ps (res, masked_read (d - 4, x + 4), 1);
-        return res;
-    }
-}
-
-float fvec_inner_product (const float * x,
-                          const float * y,
-                          size_t d)
-{
-    __m256 msum1 = _mm256_setzero_ps();
-
-    while (d >= 8) {
-        __m256 mx = _mm256_loadu_ps (x); x += 8;
-        __m256 my = _mm256_loadu_ps (y); y += 8;
-        msum1 = _mm256_add_ps (msum1, _mm256_mul_ps (mx, my));
-        d -= 8;
-    }
-
-    __m128 msum2 = _mm256_extractf128_ps(msum1, 1);
-    msum2 +=       _mm256_extractf128_ps(msum1, 0);
-
-    if (d >= 4) {
-        __m128 mx = _mm_loadu_ps (x); x += 4;
-        __m128 my = _mm_loadu_ps (y); y += 4;
-        msum2 = _mm_add_ps (msum2, _mm_mul_ps (mx, my));
-        d -= 4;
-    }
-
-    if (d > 0) {
-        __m128 mx = masked_read (d, x);
-        __m128 my = masked_read (d, y);
-        msum2 = _mm_add_ps (msum2, _mm_mul_ps (mx, my));
-    }
-
-    msum2 = _mm_hadd_ps (msum2, msum2);
-    msum2 = _mm_hadd_ps (msum2, msum2);
-    return  _mm_cvtss_f32 (msum2);
-}
-
-float fvec_L2sqr (const float * x,
-                 const float * y,
-                 size_t d)
-{
-    __m256 msum1 = _mm256_setzero_ps();
-
-    while (d >= 8) {
-        __m256 mx = _mm256_loadu_ps (x); x += 8;
-        __m256 my = _mm256_loadu_ps (y); y += 8;
-        const __m256 a_m_b1 = mx - my;
-        msum1 += a_m_b1 * a_m_b1;
-        d -= 8;
-    }
-
-    __m128 msum2 = _mm256_extractf128_ps(msum1, 1);
-    msum2 +=       _mm256_extractf128_ps(msum1, 0);
-
-    if (d >= 4) {
-        __m128 mx = _mm_loadu_ps (x); x += 4;
-        __m128 my = _mm_loadu_ps (y); y += 4;
-        const __m128 a_m_b1 = mx - my;
-        msum2 += a_m_b1 * a_m_b1;
-        d -= 4;
-    }
-
-    if (d > 0) {
-        __m128 mx = masked_read (d, x);
-        __m128 my = masked_read (d, y);
-        __m128 a_m_b1 = mx - my;
-        msum2 += a_m_b1 * a_m_b1;
-    }
-
-    msum2 = _mm_hadd_ps (msum2, msum2);
-    msum2 = _mm_hadd_ps (msum2, msum2);
-    return  _mm_cvtss_f32 (msum2);
-}
-
-float fvec_L1 (const float * x, const float * y, size_t d)
-{
-    __m256 msum1 = _mm256_setzero_ps();
-    __m256 signmask = __m256(_mm256_set1_epi32 (0x7fffffffUL));
-
-    while (d >= 8) {
-        __m256 mx = _mm256_loadu_ps (x); x += 8;
-        __m256 my = _mm256_loadu_ps (y); y += 8;
-        const __m256 a_m_b = mx - my;
-        msum1 += _mm256_and_ps(signmask, a_m_b);
-        d -= 8;
-    }
-
-    __m128 msum2 = _mm256_extractf128_ps(msum1, 1);
-    msum2 +=       _mm256_extractf128_ps(msum1, 0);
-    __m128 signmask2 = __m128(_mm_set1_epi32 (0x7fffffffUL));
-
-    if (d >= 4) {
-        __m128 mx = _mm_loadu_ps (x); x += 4;
-        __m128 my = _mm_loadu_ps (y); y += 4;
-        const __m128 a_m_b = mx - my;
-        msum2 += _mm_and_ps(signmask2, a_m_b);
-        d -= 4;
-    }
-
-    if (d > 0) {
-        __m128 mx = masked_read (d, x);
-        __m128 my = masked_read (d, y);
-        __m128 a_m_b = mx - my;
-        msum2 += _mm_and_ps(signmask2, a_m_b);
-    }
-
-    msum2 = _mm_hadd_ps (msum2, msum2);
-    msum2 = _mm_hadd_ps (msum2, msum2);
-    return  _mm_cvtss_f32 (msum2);
-}
-
-float fvec_Linf (const float * x, const float * y, size_t d)
-{
-    __m256 msum1 = _mm256_setzero_ps();
-    __m256 signmask = __m256(_mm256_set1_epi32 (0x7fffffffUL));
-
-    while (d >= 8) {
-        __m256 mx = _mm256_loadu_ps (x); x += 8;
-        __m256 my = _mm256_loadu_ps (y); y += 8;
-        const __m256 a_m_b = mx - my;
-        msum1 = _mm256_max_ps(msum1, _mm256_and_ps(signmask, a_m_b));
-        d -= 8;
-    }
-
-    __m128 msum2 = _mm256_extractf128_ps(msum1, 1);
-    msum2 = _mm_max_ps (msum2, _mm256_extractf128_ps(msum1, 0));
-    __m128 signmask2 = __m128(_mm_set1_epi32 (0x7fffffffUL));
-
-    if (d >= 4) {
-        __m128 mx = _mm_loadu_ps (x); x += 4;
-        __m128 my = _mm_loadu_ps (y); y += 4;
-        const __m128 a_m_b = mx - my;
-        msum2 = _mm_max_ps(msum2, _mm_and_ps(signmask2, a_m_b));
-        d -= 4;
-    }
-
-    if (d > 0) {
-        __m128 mx = masked_read (d, x);
-        __m128 my = masked_read (d, y);
-        __m128 a_m_b = mx - my;
-        msum2 = _mm_max_ps(msum2, _mm_and_ps(signmask2, a_m_b));
-    }
-
-    msum2 = _mm_max_ps(_mm_movehl_ps(msum2, msum2), msum2);
-    msum2 = _mm_max_ps(msum2, _mm_shuffle_ps (msum2, msum2, 1));
-    return  _mm_cvtss_f32 (msum2);
-}
-
-#elif defined(__SSE__) // But not AVX
-
-float fvec_L1 (const float * x, const float * y, size_t d)
-{
-    return fvec_L1_ref (x, y, d);
-}
-
-float fvec_Linf (const float * x, const float * y, size_t d)
-{
-    return fvec_Linf_ref (x, y, d);
-}
+#ifdef __SSE__
 
 
-float fvec_L2sqr (const float * x,
-                 const float * y,
-                 size_t d)
+float fvec_L2sqr_sse (const float * x,
+                     const float * y,
+                     size_t d)
 {
     __m128 msum1 = _mm_setzero_ps();
 
@@ -519,9 +343,9 @@ float fvec_L2sqr (const float * x,
 }
 
 
-float fvec_inner_product (const float * x,
-                         const float * y,
-                         size_t d)
+float fvec_inner_product_sse (const float * x,
+                             const float * y,
+                             size_t d)
 {
     __m128 mx, my;
     __m128 msum1 = _mm_setzero_ps();
@@ -545,12 +369,14 @@ float fvec_inner_product (const float * x,
     return  _mm_cvtss_f32 (msum1);
 }
 
-#elif defined(__aarch64__)
+#endif
+
 
+#if defined(__aarch64__)
 
-float fvec_L2sqr (const float * x,
-                  const float * y,
-                  size_t d)
+float fvec_L2sqr_neon (const float * x,
+                       const float * y,
+                       size_t d)
 {
     if (d & 3) return fvec_L2sqr_ref (x, y, d);
     float32x4_t accu = vdupq_n_f32 (0);
@@ -564,9 +390,9 @@ float fvec_L2sqr (const float * x,
     return vdups_laneq_f32 (a2, 0) + vdups_laneq_f32 (a2, 1);
 }
 
-float fvec_inner_product (const float * x,
-                          const float * y,
-                          size_t d)
+float fvec_inner_product_neon (const float * x,
+                               const float * y,
+                               size_t d)
 {
     if (d & 3) return fvec_inner_product_ref (x, y, d);
     float32x4_t accu = vdupq_n_f32 (0);
@@ -579,7 +405,7 @@ float fvec_inner_product (const float * x,
     return vdups_laneq_f32 (a2, 0) + vdups_laneq_f32 (a2, 1);
 }
 
-float fvec_norm_L2sqr (const float *x, size_t d)
+float fvec_norm_L2sqr_neon (const float *x, size_t d)
 {
     if (d & 3) return fvec_norm_L2sqr_ref (x, d);
     float32x4_t accu = vdupq_n_f32 (0);
@@ -591,82 +417,24 @@ float fvec_norm_L2sqr (const float *x, size_t d)
     return vdups_laneq_f32 (a2, 0) + vdups_laneq_f32 (a2, 1);
 }
 
+
 // not optimized for ARM
 void fvec_L2sqr_ny (float * dis, const float * x,
                         const float * y, size_t d, size_t ny) {
     fvec_L2sqr_ny_ref (dis, x, y, d, ny);
 }
 
-float fvec_L1 (const float * x, const float * y, size_t d)
-{
-    return fvec_L1_ref (x, y, d);
-}
-
-float fvec_Linf (const float * x, const float * y, size_t d)
-{
-    return fvec_Linf_ref (x, y, d);
-}
-
-
-#else
+#elif !defined(__SSE__)
 // scalar implementation
 
-float fvec_L2sqr (const float * x,
-                  const float * y,
-                  size_t d)
-{
-    return fvec_L2sqr_ref (x, y, d);
-}
-
-float fvec_L1 (const float * x, const float * y, size_t d)
-{
-    return fvec_L1_ref (x, y, d);
-}
-
-float fvec_Linf (const float * x, const float * y, size_t d)
-{
-    return fvec_Linf_ref (x, y, d);
-}
-
-float fvec_inner_product (const float * x,
-                             const float * y,
-                             size_t d)
-{
-    return fvec_inner_product_ref (x, y, d);
-}
-
-float fvec_norm_L2sqr (const float *x, size_t d)
-{
-    return fvec_norm_L2sqr_ref (x, d);
-}
-
 void fvec_L2sqr_ny (float * dis, const float * x,
                         const float * y, size_t d, size_t ny) {
     fvec_L2sqr_ny_ref (dis, x, y, d, ny);
 }
 
-
 #endif
 
 
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
 /***************************************************************************
  * heavily optimized table computations
  ***************************************************************************/
@@ -0,0 +1,57 @@
+/**
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+// -*- c++ -*-
+
+/* Kernels behind the fvec_L2sqr, fvec_inner_product, fvec_L1, fvec_Linf
+ * and fvec_norm_L2sqr function pointers, one set per instruction set.
+ *
+ * The _avx kernels are compiled with -mavx2 -mfma -mf16c and the _avx512
+ * ones with AVX-512 F/DQ/BW/VL on top: they may only be called when the
+ * cpu supports them, see FaissHook.h. This header is included by those
+ * translation units, so it must stay free of inline code. */
+
+#pragma once
+
+#include <stddef.h>
+
+
+namespace faiss {
+
+float fvec_L2sqr_ref (const float * x, const float * y, size_t d);
+float fvec_inner_product_ref (const float * x, const float * y, size_t d);
+float fvec_L1_ref (const float * x, const float * y, size_t d);
+float fvec_Linf_ref (const float * x, const float * y, size_t d);
+float fvec_norm_L2sqr_ref (const float * x, size_t d);
+
+#if defined(__x86_64__) || defined(__i386__)
+
+float fvec_L2sqr_sse (const float * x, const float * y, size_t d);
+float fvec_inner_product_sse (const float * x, const float * y, size_t d);
+float fvec_norm_L2sqr_sse (const float * x, size_t d);
+
+float fvec_L2sqr_avx (const float * x, const float * y, size_t d);
+float fvec_inner_product_avx (const float * x, const float * y, size_t d);
+float fvec_L1_avx (const float * x, const float * y, size_t d);
+float fvec_Linf_avx (const float * x, const float * y, size_t d);
+float fvec_norm_L2sqr_avx (const float * x, size_t d);
+
+float fvec_L2sqr_avx512 (const float * x, const float * y, size_t d);
+float fvec_inner_product_avx512 (const float * x, const float * y, size_t d);
+float fvec_L1_avx512 (const float * x, const float * y, size_t d);
+float fvec_Linf_avx512 (const float * x, const float * y, size_t d);
+float fvec_norm_L2sqr_avx512 (const float * x, size_t d);
+
+#elif defined(__aarch64__)
+
+float fvec_L2sqr_neon (const float * x, const float * y, size_t d);
+float fvec_inner_product_neon (const float * x, const float * y, size_t d);
+float fvec_norm_L2sqr_neon (const float * x, size_t d);
+
+#endif
+
+} // namespace faiss
@@ -252,7 +252,7 @@ namespace hnswlib {
 
         template <bool has_deletions>
         std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst>
-        searchBaseLayerST(tableint ep_id, const void *data_point, size_t ef) const {
+        searchBaseLayerST(tableint ep_id, const void *data_point, size_t ef, const uint8_t *deleted = nullptr) const {
             VisitedList *vl = visited_list_pool_->getFreeVisitedList();
             vl_type *visited_array = vl->mass;
             vl_type visited_array_tag = vl->curV;
@@ -261,7 +261,7 @@ namespace hnswlib {
             std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> candidate_set;
 
             dist_t lowerBound;
-            if (!has_deletions || !isMarkedDeleted(ep_id)) {
+            if (!has_deletions || !isDeleted(ep_id, deleted)) {
                 dist_t dist = fstdistfunc_(data_point, getDataByInternalId(ep_id), dist_func_param_);
                 lowerBound = dist;
                 top_candidates.emplace(dist, ep_id);
@@ -317,7 +317,7 @@ namespace hnswlib {
                                          _MM_HINT_T0);////////////////////////
 #endif
 
-                            if (!has_deletions || !isMarkedDeleted(candidate_id))
+                            if (!has_deletions || !isDeleted(candidate_id, deleted))
                                 top_candidates.emplace(dist, candidate_id);
 
                             if (top_candidates.size() > ef)
@@ -945,6 +945,13 @@ namespace hnswlib {
             *ll_cur &= ~DELETE_MARK;
         }
 
+        /**
+         * Checks the mark and the bit of the element in the deleted bitset, if any.
+         */
+        bool isDeleted(tableint internalId, const uint8_t *deleted) const {
+            return isMarkedDeleted(internalId) || (deleted != nullptr && ((deleted[internalId >> 3] >> (internalId & 7)) & 1));
+        }
+
         /**
          * Checks the first 8 bits of the memory to see if the element is marked deleted.
          * @param internalId
@@ -1084,6 +1091,13 @@ namespace hnswlib {
 
         std::priority_queue<std::pair<dist_t, labeltype >>
         searchKnn(const void *query_data, size_t k) const {
+            return searchKnnFiltered(query_data, k, nullptr);
+        }
+
+        // deleted marks internal ids that must not be returned, bit i & 7 of byte i >> 3 for internal id i,
+        // they are still traversed so the graph stays connected
+        std::priority_queue<std::pair<dist_t, labeltype >>
+        searchKnnFiltered(const void *query_data, size_t k, const uint8_t *deleted) const {
             std::priority_queue<std::pair<dist_t, labeltype >> result;
             if (cur_element_count == 0) return result;
 
@@ -1115,9 +1129,9 @@ namespace hnswlib {
             }
 
             std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> top_candidates;
-            if (has_deletions_) {
+            if (has_deletions_ || deleted != nullptr) {
                 std::priority_queue<std::pair<dist_t, tableint>, std::vector<std::pair<dist_t, tableint>>, CompareByFirst> top_candidates1=searchBaseLayerST<true>(
-                        currObj, query_data, std::max(ef_, k));
+                        currObj, query_data, std::max(ef_, k), deleted);
                 top_candidates.swap(top_candidates1);
             }
             else{
@@ -1138,11 +1152,11 @@ namespace hnswlib {
 
         template <typename Comp>
         std::vector<std::pair<dist_t, labeltype>>
-        searchKnn(const void* query_data, size_t k, Comp comp) {
+        searchKnn(const void* query_data, size_t k, Comp comp, const uint8_t* deleted = nullptr) {
             std::vector<std::pair<dist_t, labeltype>> result;
             if (cur_element_count == 0) return result;
 
-            auto ret = searchKnn(query_data, k);
+            auto ret = searchKnnFiltered(query_data, k, deleted);
 
             while (!ret.empty()) {
                 result.push_back(ret.top());
@@ -14,6 +14,7 @@
 
 #include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
 #include "knowhere/index/vector_index/IndexIVFSQ.h"
 
 #ifdef MILVUS_GPU_VERSION
@@ -40,6 +41,8 @@ IndexFactory(const std::string& type) {
         return std::make_shared<knowhere::IVFPQ>();
     } else if (type == "IVFSQ") {
         return std::make_shared<knowhere::IVFSQ>();
+    } else if (type == "IVFPQFastScan") {
+        return std::make_shared<knowhere::IVFPQFastScan>();
 #ifdef MILVUS_GPU_VERSION
     } else if (type == "GPUIVF") {
         return std::make_shared<knowhere::GPUIVF>(DEVICEID);
@@ -59,6 +62,7 @@ enum class ParameterType {
     ivf,
     ivfpq,
     ivfsq,
+    ivfpq_fastscan,
 };
 
 class ParamGenerator {
@@ -101,6 +105,17 @@ class ParamGenerator {
             tempconf->nbits = 8;
             tempconf->metric_type = knowhere::METRICTYPE::L2;
             return tempconf;
+        } else if (type == ParameterType::ivfpq_fastscan) {
+            auto tempconf = std::make_shared<knowhere::IVFPQCfg>();
+            tempconf->d = DIM;
+            tempconf->gpu_id = DEVICEID;
+            tempconf->nlist = 100;
+            tempconf->nprobe = 4;
+            tempconf->k = K;
+            tempconf->m = 32;
+            tempconf->nbits = 4;
+            tempconf->metric_type = knowhere::METRICTYPE::L2;
+            return tempconf;
         }
     }
 };
@@ -0,0 +1,245 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <faiss/FaissHook.h>
+#include <faiss/impl/ScalarQuantizer.h>
+#include <faiss/impl/pq4_fast_scan.h>
+#include <faiss/utils/distances.h>
+#include <faiss/utils/distances_simd.h>
+
+/*****************************************************
+ * Checks the kernels of every SIMD level the cpu supports against the
+ * scalar ones, and prints how long each level takes on the same data.
+ *****************************************************/
+
+namespace {
+
+constexpr size_t NB = 20000;
+constexpr size_t DIM = 128;
+constexpr int ROUNDS = 10;
+
+std::vector<faiss::SIMDLevel>
+SupportedLevels() {
+    std::vector<faiss::SIMDLevel> levels;
+    for (int level = faiss::SIMD_NONE; level <= faiss::cpu_simd_level(); level++) {
+        levels.push_back(static_cast<faiss::SIMDLevel>(level));
+    }
+    return levels;
+}
+
+std::vector<float>
+RandomFloats(size_t n, int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> distrib(-1.0f, 1.0f);
+    std::vector<float> x(n);
+    for (auto& v : x) {
+        v = distrib(rng);
+    }
+    return x;
+}
+
+double
+ElapsedMs(const std::chrono::steady_clock::time_point& start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+void
+ExpectNear(float expected, float actual) {
+    EXPECT_NEAR(expected, actual, 1e-4 * std::max(1.0f, std::fabs(expected)));
+}
+
+class SIMDBenchmarkTest : public ::testing::Test {
+ protected:
+    void
+    TearDown() override {
+        faiss::set_simd_level(faiss::cpu_simd_level());
+    }
+};
+
+}  // namespace
+
+TEST_F(SIMDBenchmarkTest, fvec_kernels) {
+    printf("cpu SIMD level: %s\n", faiss::simd_level_name(faiss::cpu_simd_level()));
+
+    // odd dimensions go through the tails of the kernels
+    for (size_t d : {1, 3, 7, 8, 15, 16, 17, 31, 33, 64, 100, 128, 960}) {
+        auto x = RandomFloats(d, 1);
+        auto y = RandomFloats(d, 2);
+        float l2 = faiss::fvec_L2sqr_ref(x.data(), y.data(), d);
+        float ip = faiss::fvec_inner_product_ref(x.data(), y.data(), d);
+        float l1 = faiss::fvec_L1_ref(x.data(), y.data(), d);
+        float linf = faiss::fvec_Linf_ref(x.data(), y.data(), d);
+        float norm = faiss::fvec_norm_L2sqr_ref(x.data(), d);
+
+        for (auto level : SupportedLevels()) {
+            ASSERT_TRUE(faiss::set_simd_level(level) || level == faiss::SIMD_NONE);
+            ExpectNear(l2, faiss::fvec_L2sqr(x.data(), y.data(), d));
+            ExpectNear(ip, faiss::fvec_inner_product(x.data(), y.data(), d));
+            ExpectNear(l1, faiss::fvec_L1(x.data(), y.data(), d));
+            ExpectNear(linf, faiss::fvec_Linf(x.data(), y.data(), d));
+            ExpectNear(norm, faiss::fvec_norm_L2sqr(x.data(), d));
+        }
+    }
+
+    auto xb = RandomFloats(NB * DIM, 3);
+    auto xq = RandomFloats(DIM, 4);
+    for (auto level : SupportedLevels()) {
+        if (!faiss::set_simd_level(level)) {
+            continue;
+        }
+        float sum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; r++) {
+            for (size_t i = 0; i < NB; i++) {
+                sum += faiss::fvec_L2sqr(xq.data(), xb.data() + i * DIM, DIM);
+            }
+        }
+        double l2_ms = ElapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; r++) {
+            for (size_t i = 0; i < NB; i++) {
+                sum += faiss::fvec_inner_product(xq.data(), xb.data() + i * DIM, DIM);
+            }
+        }
+        double ip_ms = ElapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; r++) {
+            for (size_t i = 0; i < NB; i++) {
+                sum += faiss::fvec_norm_L2sqr(xb.data() + i * DIM, DIM);
+            }
+        }
+        double norm_ms = ElapsedMs(start);
+
+        printf("%-6s L2 %8.2f ms  IP %8.2f ms  norm %8.2f ms  (%d x %zu x %zud, checksum %g)\n",
+               faiss::simd_level_name(level), l2_ms, ip_ms, norm_ms, ROUNDS, NB, DIM, sum);
+    }
+}
+
+TEST_F(SIMDBenchmarkTest, sq_distance_computer) {
+    auto xb = RandomFloats(NB * DIM, 5);
+    auto xq = RandomFloats(DIM, 6);
+
+    for (auto qtype : {faiss::ScalarQuantizer::QT_8bit, faiss::ScalarQuantizer::QT_6bit,
+                       faiss::ScalarQuantizer::QT_4bit, faiss::ScalarQuantizer::QT_fp16}) {
+        faiss::ScalarQuantizer sq(DIM, qtype);
+        sq.train(NB, xb.data());
+        std::vector<uint8_t> codes(NB * sq.code_size);
+        sq.compute_codes(xb.data(), codes.data(), NB);
+
+        for (auto metric : {faiss::METRIC_L2, faiss::METRIC_INNER_PRODUCT}) {
+            // the scalar templates are the reference
+            std::vector<float> expected(NB);
+            faiss::set_simd_level(faiss::SIMD_SSE4);
+            {
+                std::unique_ptr<faiss::ScalarQuantizer::SQDistanceComputer> dc(sq.get_distance_computer(metric));
+                dc->codes = codes.data();
+                dc->code_size = sq.code_size;
+                dc->set_query(xq.data());
+                for (size_t i = 0; i < NB; i++) {
+                    expected[i] = (*dc)(i);
+                }
+            }
+
+            for (auto level : SupportedLevels()) {
+                if (!faiss::set_simd_level(level)) {
+                    continue;
+                }
+                std::unique_ptr<faiss::ScalarQuantizer::SQDistanceComputer> dc(sq.get_distance_computer(metric));
+                dc->codes = codes.data();
+                dc->code_size = sq.code_size;
+                dc->set_query(xq.data());
+
+                float sum = 0;
+                auto start = std::chrono::steady_clock::now();
+                for (int r = 0; r < ROUNDS; r++) {
+                    for (size_t i = 0; i < NB; i++) {
+                        sum += (*dc)(i);
+                    }
+                }
+                double ms = ElapsedMs(start);
+
+                for (size_t i = 0; i < NB; i++) {
+                    ExpectNear(expected[i], (*dc)(i));
+                }
+                printf("%-6s SQ qtype %d metric %d %8.2f ms  (checksum %g)\n", faiss::simd_level_name(level),
+                       static_cast<int>(qtype), static_cast<int>(metric), ms, sum);
+            }
+        }
+    }
+}
+
+TEST_F(SIMDBenchmarkTest, pq4_accumulate_block) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> byte(0, 255);
+
+    for (size_t M : {2, 4, 6, 8, 16, 18, 32, 64}) {
+        std::vector<uint8_t> qtable(M * 16);
+        std::vector<uint8_t> block(M * 16);
+        for (auto& v : qtable) {
+            v = byte(rng);
+        }
+        for (auto& v : block) {
+            v = byte(rng);
+        }
+        uint16_t expected[32];
+        faiss::pq4_accumulate_block_ref(M, qtable.data(), block.data(), expected);
+
+        for (auto level : SupportedLevels()) {
+            if (!faiss::set_simd_level(level)) {
+                continue;
+            }
+            uint16_t acc[32];
+            faiss::pq4_accumulate_block(M, qtable.data(), block.data(), acc);
+            for (size_t j = 0; j < 32; j++) {
+                ASSERT_EQ(expected[j], acc[j]) << "M " << M << " vector " << j;
+            }
+        }
+    }
+
+    // one query scanning NB * 32 codes of 32 sub-quantizers
+    constexpr size_t M = 32;
+    std::vector<uint8_t> qtable(M * 16);
+    std::vector<uint8_t> blocks(NB * M * 16);
+    for (auto& v : qtable) {
+        v = byte(rng);
+    }
+    for (auto& v : blocks) {
+        v = byte(rng);
+    }
+    for (auto level : SupportedLevels()) {
+        if (!faiss::set_simd_level(level)) {
+            continue;
+        }
+        uint64_t sum = 0;
+        uint16_t acc[32];
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < ROUNDS; r++) {
+            for (size_t b = 0; b < NB; b++) {
+                faiss::pq4_accumulate_block(M, qtable.data(), blocks.data() + b * M * 16, acc);
+                sum += acc[b % 32];
+            }
+        }
+        printf("%-6s PQ4 fast scan %8.2f ms  (%d x %zu blocks, checksum %lu)\n", faiss::simd_level_name(level),
+               ElapsedMs(start), ROUNDS, NB, sum);
+    }
+}
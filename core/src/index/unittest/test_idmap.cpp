@@ -12,8 +12,12 @@
 #include <fiu-control.h>
 #include <fiu-local.h>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <unordered_set>
 
+#include "knowhere/adapter/VectorAdapter.h"
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
 #ifdef MILVUS_GPU_VERSION
@@ -77,6 +81,146 @@ TEST_F(IDMAPTest, idmap_basic) {
     //    PrintResult(re_result, nq, k);
 }
 
+TEST_F(IDMAPTest, idmap_distance_bound) {
+    auto conf = std::make_shared<knowhere::Cfg>();
+    conf->d = dim;
+    conf->k = k;
+    conf->metric_type = knowhere::METRICTYPE::L2;
+
+    index_->Train(conf);
+    index_->Add(base_dataset, conf);
+    auto result = index_->Search(query_dataset, conf);
+    AssertAnns(result, nq, k);
+    auto ids = result->Get<int64_t*>(knowhere::meta::IDS);
+    auto dists = result->Get<float*>(knowhere::meta::DISTANCE);
+
+    // only results strictly better than the k-th distance survive
+    std::vector<float> bound(nq);
+    for (auto i = 0; i < nq; ++i) {
+        bound[i] = dists[i * k + k - 1];
+    }
+    conf->distance_bound = bound.data();
+    auto bounded_result = index_->Search(query_dataset, conf);
+    auto bounded_ids = bounded_result->Get<int64_t*>(knowhere::meta::IDS);
+    auto bounded_dists = bounded_result->Get<float*>(knowhere::meta::DISTANCE);
+    for (auto i = 0; i < nq; ++i) {
+        ASSERT_EQ(bounded_ids[i * k], ids[i * k]);
+        for (auto j = 0; j < k; ++j) {
+            if (bounded_ids[i * k + j] >= 0) {
+                ASSERT_LT(bounded_dists[i * k + j], bound[i]);
+            }
+        }
+        ASSERT_EQ(bounded_ids[i * k + k - 1], -1);
+    }
+}
+
+TEST_F(IDMAPTest, idmap_range_search) {
+    auto conf = std::make_shared<knowhere::Cfg>();
+    conf->d = dim;
+    conf->k = k;
+    conf->metric_type = knowhere::METRICTYPE::L2;
+
+    index_->Train(conf);
+    index_->Add(base_dataset, conf);
+    auto result = index_->Search(query_dataset, conf);
+    auto dists = result->Get<float*>(knowhere::meta::DISTANCE);
+
+    // the k-th distance of the first query as radius, everything strictly closer comes back
+    conf->radius = dists[k - 1];
+    auto range_result = index_->RangeSearch(query_dataset, conf);
+    AssertRangeResult(range_result, xb.data(), ids.data(), nb, xq.data(), nq, dim, conf->radius, 1e-4);
+    auto lims = range_result->Get<int64_t*>(knowhere::meta::LIMS);
+    ASSERT_GE(lims[1], k - 1);
+}
+
+TEST_F(IDMAPTest, idmap_bitset) {
+    auto conf = std::make_shared<knowhere::Cfg>();
+    conf->d = dim;
+    conf->k = k;
+    conf->metric_type = knowhere::METRICTYPE::L2;
+
+    index_->Train(conf);
+    index_->Add(base_dataset, conf);
+
+    // delete every other vector, none of them may come back
+    auto ids = index_->GetIds();
+    ASSERT_EQ(ids.size(), static_cast<size_t>(nb));
+    std::vector<uint8_t> bitset((ids.size() + 7) / 8, 0);
+    std::unordered_set<int64_t> deleted;
+    for (size_t i = 0; i < ids.size(); i += 2) {
+        bitset[i >> 3] |= (0x1 << (i & 0x7));
+        deleted.insert(ids[i]);
+    }
+    conf->bitset = bitset.data();
+    auto result = index_->Search(query_dataset, conf);
+    auto result_ids = result->Get<int64_t*>(knowhere::meta::IDS);
+    for (auto i = 0; i < nq * k; ++i) {
+        ASSERT_GE(result_ids[i], 0);
+        ASSERT_EQ(deleted.count(result_ids[i]), 0);
+    }
+}
+
+TEST_F(IDMAPTest, idmap_half_storage) {
+    for (auto storage_type : {knowhere::StorageType::FP16, knowhere::StorageType::BF16}) {
+        auto conf = std::make_shared<knowhere::Cfg>();
+        conf->d = dim;
+        conf->k = k;
+        conf->metric_type = knowhere::METRICTYPE::L2;
+        conf->storage_type = storage_type;
+
+        auto index = std::make_shared<knowhere::IDMAP>();
+        index->Train(conf);
+        index->Add(base_dataset, conf);
+        EXPECT_EQ(index->Count(), nb);
+        auto result = index->Search(query_dataset, conf);
+        AssertAnns(result, nq, k);
+
+        // raw vectors are decoded within the precision of the storage type
+        float tolerance = (storage_type == knowhere::StorageType::FP16) ? 1e-3 : 1e-2;
+        std::vector<float> buffer;
+        auto raw_vectors = index->GetRawVectors(buffer);
+        for (auto i = 0; i < nb * dim; ++i) {
+            ASSERT_NEAR(raw_vectors[i], xb[i], std::abs(xb[i]) * tolerance + 1e-6);
+        }
+
+        // deleted rows are skipped by scoring the codes, the results stay sorted
+        auto index_ids = index->GetIds();
+        std::vector<uint8_t> bitset((index_ids.size() + 7) / 8, 0);
+        std::unordered_set<int64_t> deleted;
+        for (size_t i = 0; i < index_ids.size(); i += 2) {
+            bitset[i >> 3] |= (0x1 << (i & 0x7));
+            deleted.insert(index_ids[i]);
+        }
+        conf->bitset = bitset.data();
+        auto filtered_result = index->Search(query_dataset, conf);
+        auto filtered_ids = filtered_result->Get<int64_t*>(knowhere::meta::IDS);
+        auto filtered_dists = filtered_result->Get<float*>(knowhere::meta::DISTANCE);
+        for (auto i = 0; i < nq; ++i) {
+            for (auto j = 0; j < k; ++j) {
+                ASSERT_GE(filtered_ids[i * k + j], 0);
+                ASSERT_EQ(deleted.count(filtered_ids[i * k + j]), 0);
+                if (j > 0) {
+                    ASSERT_LE(filtered_dists[i * k + j - 1], filtered_dists[i * k + j]);
+                }
+            }
+        }
+        conf->bitset = nullptr;
+
+        // range search scans the codes, the decoded distances only differ within the precision
+        auto dists = result->Get<float*>(knowhere::meta::DISTANCE);
+        conf->radius = dists[k - 1];
+        auto range_result = index->RangeSearch(query_dataset, conf);
+        AssertRangeResult(range_result, xb.data(), ids.data(), nb, xq.data(), nq, dim, conf->radius, tolerance * 10);
+
+        auto binaryset = index->Serialize();
+        auto new_index = std::make_shared<knowhere::IDMAP>();
+        new_index->Load(binaryset);
+        EXPECT_EQ(new_index->Count(), nb);
+        auto re_result = new_index->Search(query_dataset, conf);
+        AssertAnns(re_result, nq, k);
+    }
+}
+
 TEST_F(IDMAPTest, idmap_serialize) {
     auto serialize = [](const std::string& filename, knowhere::BinaryPtr& bin, uint8_t* ret) {
         FileIOWriter writer(filename);
@@ -11,10 +11,17 @@
 
 #include <gtest/gtest.h>
 
+#include <faiss/IndexFlat.h>
+#include <faiss/IndexIVFPQFastScan.h>
+#include <faiss/IndexScalarQuantizer.h>
+#include <faiss/utils/distances.h>
 #include <fiu-control.h>
 #include <fiu-local.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <thread>
+#include <unordered_set>
 
 #ifdef MILVUS_GPU_VERSION
 
@@ -28,6 +35,7 @@
 
 #include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
 #include "knowhere/index/vector_index/IndexIVFSQ.h"
 
 #ifdef MILVUS_GPU_VERSION
@@ -90,7 +98,8 @@ INSTANTIATE_TEST_CASE_P(IVFParameters, IVFTest,
 #endif
 #endif
                             std::make_tuple("IVF", ParameterType::ivf), std::make_tuple("IVFPQ", ParameterType::ivfpq),
-                            std::make_tuple("IVFSQ", ParameterType::ivfsq)));
+                            std::make_tuple("IVFSQ", ParameterType::ivfsq),
+                            std::make_tuple("IVFPQFastScan", ParameterType::ivfpq_fastscan)));
 
 TEST_P(IVFTest, ivf_basic) {
     assert(!xb.empty());
@@ -117,6 +126,406 @@ TEST_P(IVFTest, ivf_basic) {
 #endif
 }
 
+TEST_P(IVFTest, ivf_query_major) {
+    if (index_type.find("GPU") != std::string::npos || index_type == "IVFSQHybrid") {
+        return;
+    }
+
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+
+    auto search_cfg = std::dynamic_pointer_cast<knowhere::IVFCfg>(conf);
+    search_cfg->query_major = true;
+    auto result = index_->Search(query_dataset, conf);
+    AssertAnns(result, nq, conf->k);
+
+    // scanning the lists once per query must find the same neighbors
+    search_cfg->query_major = false;
+    auto list_major_result = index_->Search(query_dataset, conf);
+    {
+        auto ids = result->Get<int64_t*>(knowhere::meta::IDS);
+        auto dists = result->Get<float*>(knowhere::meta::DISTANCE);
+        auto expect_ids = list_major_result->Get<int64_t*>(knowhere::meta::IDS);
+        auto expect_dists = list_major_result->Get<float*>(knowhere::meta::DISTANCE);
+        for (auto i = 0; i < nq * conf->k; ++i) {
+            ASSERT_EQ(expect_ids[i], ids[i]);
+            ASSERT_NEAR(expect_dists[i], dists[i], 1e-3 * std::max(1.0f, std::fabs(expect_dists[i])));
+        }
+    }
+    search_cfg->query_major = true;
+
+    search_cfg->metric_type = knowhere::METRICTYPE::IP;
+    auto ip_index = IndexFactory(index_type);
+    ip_index->set_index_model(ip_index->Train(base_dataset, conf));
+    ip_index->Add(base_dataset, conf);
+    result = ip_index->Search(query_dataset, conf);
+    // faiss IndexIVFPQ always scans with L2, only check the order where the metric is honored
+    auto faiss_index = std::dynamic_pointer_cast<knowhere::IVF>(ip_index)->index_;
+    if (faiss_index->metric_type == faiss::METRIC_INNER_PRODUCT) {
+        auto ids = result->Get<int64_t*>(knowhere::meta::IDS);
+        auto dists = result->Get<float*>(knowhere::meta::DISTANCE);
+        for (auto i = 0; i < nq; ++i) {
+            for (auto j = 1; j < conf->k && ids[i * conf->k + j] >= 0; ++j) {
+                ASSERT_GE(dists[i * conf->k + j - 1], dists[i * conf->k + j]);
+            }
+        }
+    }
+    search_cfg->query_major = false;
+}
+
+TEST_P(IVFTest, ivf_distance_bound) {
+    if (index_type.find("GPU") != std::string::npos || index_type == "IVFSQHybrid") {
+        return;
+    }
+
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+
+    auto k = conf->k;
+    std::vector<float> bound(nq);
+    auto search_cfg = std::dynamic_pointer_cast<knowhere::IVFCfg>(conf);
+    for (auto query_major : {false, true}) {
+        // both scan orders may round distances differently, take the bound from the same order
+        search_cfg->query_major = query_major;
+        conf->distance_bound = nullptr;
+        auto result = index_->Search(query_dataset, conf);
+        auto dists = result->Get<float*>(knowhere::meta::DISTANCE);
+        for (auto i = 0; i < nq; ++i) {
+            bound[i] = dists[i * k + k - 1];
+        }
+        conf->distance_bound = bound.data();
+        auto bounded_result = index_->Search(query_dataset, conf);
+        auto bounded_ids = bounded_result->Get<int64_t*>(knowhere::meta::IDS);
+        auto bounded_dists = bounded_result->Get<float*>(knowhere::meta::DISTANCE);
+        for (auto i = 0; i < nq; ++i) {
+            for (auto j = 0; j < k; ++j) {
+                if (bounded_ids[i * k + j] >= 0) {
+                    ASSERT_LT(bounded_dists[i * k + j], bound[i]);
+                }
+            }
+            ASSERT_EQ(bounded_ids[i * k + k - 1], -1);
+        }
+    }
+    search_cfg->query_major = false;
+    conf->distance_bound = nullptr;
+}
+
+TEST_P(IVFTest, ivf_bitset) {
+    if (index_type.find("GPU") != std::string::npos || index_type == "IVFSQHybrid") {
+        return;
+    }
+
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+
+    // bits follow the order of GetIds, which walks the inverted lists
+    auto ids = index_->GetIds();
+    ASSERT_EQ(ids.size(), static_cast<size_t>(nb));
+    std::vector<uint8_t> bitset((ids.size() + 7) / 8, 0);
+    std::unordered_set<int64_t> deleted;
+    for (size_t i = 0; i < ids.size(); i += 2) {
+        bitset[i >> 3] |= (0x1 << (i & 0x7));
+        deleted.insert(ids[i]);
+    }
+    conf->bitset = bitset.data();
+    auto search_cfg = std::dynamic_pointer_cast<knowhere::IVFCfg>(conf);
+    for (auto query_major : {false, true}) {
+        search_cfg->query_major = query_major;
+        auto result = index_->Search(query_dataset, conf);
+        auto result_ids = result->Get<int64_t*>(knowhere::meta::IDS);
+        for (auto i = 0; i < nq * conf->k; ++i) {
+            ASSERT_EQ(deleted.count(result_ids[i]), 0);
+        }
+    }
+    search_cfg->query_major = false;
+    conf->bitset = nullptr;
+}
+
+TEST_P(IVFTest, ivf_refine) {
+    if (index_type.find("GPU") != std::string::npos || index_type == "IVFSQHybrid" ||
+        conf->metric_type != knowhere::METRICTYPE::L2) {
+        return;
+    }
+
+    auto ivf_cfg = std::dynamic_pointer_cast<knowhere::IVFCfg>(conf);
+    ivf_cfg->refine = true;
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+
+    // the raw vectors travel with the index
+    auto binaryset = index_->Serialize();
+    auto loaded = IndexFactory(index_type);
+    loaded->Load(binaryset);
+
+    auto k = conf->k;
+    faiss::IndexFlatL2 flat(dim);
+    flat.add(nb, xb.data());
+    std::vector<float> gt_dists(nq * k);
+    std::vector<int64_t> gt_ids(nq * k);
+    flat.search(nq, xq.data(), k, gt_dists.data(), gt_ids.data());
+    auto recall = [&](const knowhere::DatasetPtr& result) {
+        auto ids = result->Get<int64_t*>(knowhere::meta::IDS);
+        int64_t hit = 0;
+        for (auto i = 0; i < nq; ++i) {
+            std::unordered_set<int64_t> truth(gt_ids.begin() + i * k, gt_ids.begin() + (i + 1) * k);
+            for (auto j = 0; j < k; ++j) {
+                hit += truth.count(ids[i * k + j]);
+            }
+        }
+        return static_cast<double>(hit) / (nq * k);
+    };
+
+    ivf_cfg->refine_factor = 1;
+    auto plain_result = loaded->Search(query_dataset, conf);
+    AssertAnns(plain_result, nq, k);
+
+    ivf_cfg->refine_factor = 4;
+    auto result = loaded->Search(query_dataset, conf);
+    AssertAnns(result, nq, k);
+    std::cout << index_type << " recall: " << recall(plain_result) << ", refined: " << recall(result) << std::endl;
+    ASSERT_GE(recall(result), recall(plain_result));
+
+    // re-ranked results come with exact distances, closest first
+    auto ids = result->Get<int64_t*>(knowhere::meta::IDS);
+    auto dists = result->Get<float*>(knowhere::meta::DISTANCE);
+    for (auto i = 0; i < nq; ++i) {
+        for (auto j = 0; j < k; ++j) {
+            auto id = ids[i * k + j];
+            if (id < 0) {
+                continue;
+            }
+            float exact = faiss::fvec_L2sqr(xq.data() + i * dim, xb.data() + id * dim, dim);
+            ASSERT_NEAR(dists[i * k + j], exact, 1e-3 * std::max(1.0f, exact));
+            if (j > 0 && ids[i * k + j - 1] >= 0) {
+                ASSERT_LE(dists[i * k + j - 1], dists[i * k + j]);
+            }
+        }
+    }
+
+    // list entries without a raw vector are dropped from the candidates
+    loaded->AddWithoutIds(base_dataset, conf);
+    result = loaded->Search(query_dataset, conf);
+    ids = result->Get<int64_t*>(knowhere::meta::IDS);
+    for (auto i = 0; i < nq * k; ++i) {
+        ASSERT_LT(ids[i], nb);
+    }
+
+    ivf_cfg->refine_factor = knowhere::MAX_REFINE_FACTOR + 1;
+    ASSERT_ANY_THROW(loaded->Search(query_dataset, conf));
+
+#ifdef MILVUS_GPU_VERSION
+    // a gpu copy re-ranks against the raw vectors of the cpu index
+    if (index_type != "IVFPQFastScan") {
+        ivf_cfg->refine_factor = 4;
+        auto device_index = knowhere::cloner::CopyCpuToGpu(index_, DEVICEID, conf);
+        result = device_index->Search(query_dataset, conf);
+        AssertAnns(result, nq, k);
+        ASSERT_GE(recall(result), recall(plain_result));
+    }
+#endif
+    ivf_cfg->refine = false;
+    ivf_cfg->refine_factor = 1;
+}
+
+TEST_P(IVFTest, ivf_range_search) {
+    if (index_type.find("GPU") != std::string::npos || index_type == "IVFSQHybrid") {
+        return;
+    }
+
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+    auto result = index_->Search(query_dataset, conf);
+    auto dists = result->Get<float*>(knowhere::meta::DISTANCE);
+
+    // probes the same lists as Search, so the first query finds all of its top k closer than the k-th
+    auto k = conf->k;
+    conf->radius = dists[k - 1];
+    int64_t closer = std::count_if(dists, dists + k, [&](float dist) { return dist < conf->radius; });
+    auto range_result = index_->RangeSearch(query_dataset, conf);
+    auto lims = range_result->Get<int64_t*>(knowhere::meta::LIMS);
+    auto range_dists = range_result->Get<float*>(knowhere::meta::DISTANCE);
+    ASSERT_EQ(lims[0], 0);
+    for (auto i = 0; i < nq; ++i) {
+        ASSERT_LE(lims[i], lims[i + 1]);
+        for (auto j = lims[i]; j < lims[i + 1]; ++j) {
+            ASSERT_LT(range_dists[j], conf->radius);
+        }
+    }
+    ASSERT_GE(lims[1], closer);
+
+    // probing every list of the flat variant is exact
+    if (index_type == "IVF") {
+        auto search_cfg = std::dynamic_pointer_cast<knowhere::IVFCfg>(conf);
+        auto nprobe = search_cfg->nprobe;
+        search_cfg->nprobe = search_cfg->nlist;
+        range_result = index_->RangeSearch(query_dataset, conf);
+        AssertRangeResult(range_result, xb.data(), ids.data(), nb, xq.data(), nq, dim, conf->radius, 1e-4);
+        search_cfg->nprobe = nprobe;
+    }
+    conf->radius = 0;
+}
+
+TEST_P(IVFTest, ivf_shared_coarse_quantizer) {
+    if (index_type.find("GPU") != std::string::npos || index_type == "IVFSQHybrid") {
+        return;
+    }
+
+    // untrained index has no quantizer
+    ASSERT_EQ(index_->GetCoarseQuantizer(), nullptr);
+
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+    auto quantizer = std::dynamic_pointer_cast<knowhere::IVFCoarseQuantizer>(index_->GetCoarseQuantizer());
+    ASSERT_NE(quantizer, nullptr);
+    ASSERT_GT(quantizer->size, 0);
+
+    // serialize and load quantizer
+    auto binaryset = quantizer->Serialize();
+    auto loaded = std::make_shared<knowhere::IVFCoarseQuantizer>();
+    loaded->Load(binaryset);
+    ASSERT_EQ(loaded->size, quantizer->size);
+
+    // train another index against the shared quantizer
+    auto new_index = IndexFactory(index_type);
+    ASSERT_FALSE(new_index->SetCoarseQuantizer(loaded));
+    auto new_model = new_index->Train(base_dataset, conf);
+    new_index->set_index_model(new_model);
+    new_index->Add(base_dataset, conf);
+    auto result = new_index->Search(query_dataset, conf);
+    AssertAnns(result, nq, conf->k);
+
+    auto new_quantizer = std::dynamic_pointer_cast<knowhere::IVFCoarseQuantizer>(new_index->GetCoarseQuantizer());
+    auto flat = dynamic_cast<faiss::IndexFlat*>(quantizer->quantizer.get());
+    auto new_flat = dynamic_cast<faiss::IndexFlat*>(new_quantizer->quantizer.get());
+    ASSERT_NE(flat, nullptr);
+    ASSERT_NE(new_flat, nullptr);
+    ASSERT_EQ(flat->xb, new_flat->xb);
+
+    // a loaded index with the same centroids points at the shared quantizer
+    auto loaded_index = IndexFactory(index_type);
+    loaded_index->Load(new_index->Serialize());
+    ASSERT_TRUE(loaded_index->SetCoarseQuantizer(loaded));
+    ASSERT_EQ(loaded_index->GetCoarseQuantizer(), loaded);
+    result = loaded_index->Search(query_dataset, conf);
+    AssertAnns(result, nq, conf->k);
+
+    // different centroids are refused
+    auto other = std::make_shared<knowhere::IVFCoarseQuantizer>();
+    other->quantizer = std::make_shared<faiss::IndexFlatL2>(dim);
+    ASSERT_FALSE(loaded_index->SetCoarseQuantizer(other));
+}
+
+TEST_P(IVFTest, ivf_half_storage) {
+    if (index_type != "IVF") {
+        return;
+    }
+
+    for (auto storage_type : {knowhere::StorageType::FP16, knowhere::StorageType::BF16}) {
+        auto half_conf = ParamGenerator::GetInstance().Gen(parameter_type_);
+        half_conf->storage_type = storage_type;
+
+        auto half_index = IndexFactory(index_type);
+        half_index->set_index_model(half_index->Train(base_dataset, half_conf));
+        half_index->Add(base_dataset, half_conf);
+        EXPECT_EQ(half_index->Count(), nb);
+        auto result = half_index->Search(query_dataset, half_conf);
+        AssertAnns(result, nq, half_conf->k);
+
+        // codes take 2 bytes per dimension
+        auto ivf_index = dynamic_cast<faiss::IndexIVFScalarQuantizer*>(half_index->index_.get());
+        ASSERT_NE(ivf_index, nullptr);
+        ASSERT_EQ(ivf_index->code_size, dim * sizeof(uint16_t));
+
+        auto loaded_index = IndexFactory(index_type);
+        loaded_index->Load(half_index->Serialize());
+        result = loaded_index->Search(query_dataset, half_conf);
+        AssertAnns(result, nq, half_conf->k);
+    }
+}
+
+TEST_P(IVFTest, ivfpq_fastscan) {
+    if (index_type != "IVFPQFastScan") {
+        return;
+    }
+
+    auto model = index_->Train(base_dataset, conf);
+    index_->set_index_model(model);
+    index_->Add(base_dataset, conf);
+    auto fastscan_index = dynamic_cast<faiss::IndexIVFPQFastScan*>(index_->index_.get());
+    ASSERT_NE(fastscan_index, nullptr);
+    ASSERT_EQ(fastscan_index->pq.nbits, 4);
+    // the blocked codes are a second copy of the codes, rounded up to whole blocks
+    ASSERT_GE(index_->AuxiliarySize(), nb * fastscan_index->code_size);
+    ASSERT_EQ(IndexFactory("IVFPQ")->AuxiliarySize(), 0);
+
+    // IVF_PQ with 8-bit subquantizers and the same code size
+    auto fastscan_conf = std::dynamic_pointer_cast<knowhere::IVFPQCfg>(conf);
+    auto pq_conf =
+        std::dynamic_pointer_cast<knowhere::IVFPQCfg>(ParamGenerator::GetInstance().Gen(ParameterType::ivfpq));
+    pq_conf->m = fastscan_conf->m / 2;
+    auto pq_index = IndexFactory("IVFPQ");
+    pq_index->set_index_model(pq_index->Train(base_dataset, pq_conf));
+    pq_index->Add(base_dataset, pq_conf);
+
+    auto k = conf->k;
+    faiss::IndexFlatL2 flat(dim);
+    flat.add(nb, xb.data());
+    std::vector<float> gt_dists(nq * k);
+    std::vector<int64_t> gt_ids(nq * k);
+    flat.search(nq, xq.data(), k, gt_dists.data(), gt_ids.data());
+    auto recall = [&](const knowhere::DatasetPtr& result) {
+        auto ids = result->Get<int64_t*>(knowhere::meta::IDS);
+        int64_t hit = 0;
+        for (auto i = 0; i < nq; ++i) {
+            std::unordered_set<int64_t> truth(gt_ids.begin() + i * k, gt_ids.begin() + (i + 1) * k);
+            for (auto j = 0; j < k; ++j) {
+                hit += truth.count(ids[i * k + j]);
+            }
+        }
+        return static_cast<double>(hit) / (nq * k);
+    };
+
+    knowhere::TimeRecorder tc("IVFPQ vs IVFPQFastScan");
+    auto pq_result = pq_index->Search(query_dataset, pq_conf);
+    auto pq_cost = tc.RecordSection("IVFPQ search");
+    auto result = index_->Search(query_dataset, conf);
+    auto fastscan_cost = tc.RecordSection("IVFPQFastScan search");
+    AssertAnns(result, nq, k);
+    std::cout << "IVFPQ recall: " << recall(pq_result) << ", cost: " << pq_cost
+              << "; IVFPQFastScan recall: " << recall(result) << ", cost: " << fastscan_cost << std::endl;
+    ASSERT_GE(recall(result), recall(pq_result) - 0.1);
+
+    // the SIMD scan only filters, its results are the ones of a plain scan of the codes
+    fastscan_index->parallel_mode = 1;
+    auto plain_result = index_->Search(query_dataset, conf);
+    fastscan_index->parallel_mode = 0;
+    auto dists = result->Get<float*>(knowhere::meta::DISTANCE);
+    auto plain_dists = plain_result->Get<float*>(knowhere::meta::DISTANCE);
+    for (auto i = 0; i < nq * k; ++i) {
+        ASSERT_NEAR(dists[i], plain_dists[i], 1e-3 * std::max(1.0f, plain_dists[i]));
+    }
+
+    // blocks are rebuilt on load
+    auto loaded = IndexFactory(index_type);
+    loaded->Load(index_->Serialize());
+    auto loaded_result = loaded->Search(query_dataset, conf);
+    auto loaded_dists = loaded_result->Get<float*>(knowhere::meta::DISTANCE);
+    for (auto i = 0; i < nq * k; ++i) {
+        ASSERT_FLOAT_EQ(dists[i], loaded_dists[i]);
+    }
+
+    // subquantizers are paired in the SIMD registers
+    fastscan_conf->m = 3;
+    ASSERT_ANY_THROW(IndexFactory(index_type)->Train(base_dataset, conf));
+    fastscan_conf->m = 32;
+}
+
 TEST_P(IVFTest, ivf_serialize) {
     fiu_init(0);
     auto serialize = [](const std::string& filename, knowhere::BinaryPtr& bin, uint8_t* ret) {
@@ -12,9 +12,13 @@
 #include "unittest/utils.h"
 #include "knowhere/adapter/VectorAdapter.h"
 
+#include <faiss/utils/distances.h>
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 INITIALIZE_EASYLOGGINGPP
@@ -212,6 +216,37 @@ AssertAnns(const knowhere::DatasetPtr& result, const int& nq, const int& k) {
     }
 }
 
+void
+AssertRangeResult(const knowhere::DatasetPtr& result, const float* xb, const int64_t* ids, int64_t nb, const float* xq,
+                  int64_t nq, int64_t dim, float radius, float tolerance) {
+    auto lims = result->Get<int64_t*>(knowhere::meta::LIMS);
+    auto range_ids = result->Get<int64_t*>(knowhere::meta::IDS);
+    auto range_dists = result->Get<float*>(knowhere::meta::DISTANCE);
+    std::unordered_map<int64_t, int64_t> offsets;
+    for (int64_t j = 0; j < nb; ++j) {
+        offsets[ids[j]] = j;
+    }
+
+    ASSERT_EQ(lims[0], 0);
+    for (int64_t i = 0; i < nq; ++i) {
+        ASSERT_LE(lims[i], lims[i + 1]);
+        std::unordered_set<int64_t> found;
+        for (auto j = lims[i]; j < lims[i + 1]; ++j) {
+            auto iter = offsets.find(range_ids[j]);
+            ASSERT_NE(iter, offsets.end());
+            float dist = faiss::fvec_L2sqr(xq + i * dim, xb + iter->second * dim, dim);
+            ASSERT_LT(dist, radius * (1 + tolerance));
+            ASSERT_NEAR(range_dists[j], dist, tolerance * std::max(1.0f, dist));
+            found.insert(range_ids[j]);
+        }
+        for (int64_t j = 0; j < nb; ++j) {
+            if (faiss::fvec_L2sqr(xq + i * dim, xb + j * dim, dim) < radius * (1 - tolerance)) {
+                ASSERT_EQ(found.count(ids[j]), 1) << "query " << i << " misses " << ids[j];
+            }
+        }
+    }
+}
+
 void
 PrintResult(const knowhere::DatasetPtr& result, const int& nq, const int& k) {
     auto ids = result->Get<int64_t*>(knowhere::meta::IDS);
@@ -104,6 +104,12 @@ generate_binary_query_dataset(int64_t nb, int64_t dim, const uint8_t* xb);
 void
 AssertAnns(const knowhere::DatasetPtr& result, const int& nq, const int& k);
 
+// an L2 range search result against brute force: every vector closer than radius * (1 - tolerance) comes back,
+// every result is closer than radius * (1 + tolerance) with its exact distance within the same tolerance
+void
+AssertRangeResult(const knowhere::DatasetPtr& result, const float* xb, const int64_t* ids, int64_t nb, const float* xq,
+                  int64_t nq, int64_t dim, float radius, float tolerance);
+
 void
 PrintResult(const knowhere::DatasetPtr& result, const int& nq, const int& k);
 
@@ -83,6 +83,42 @@ class MetricsBase {
     CacheAccessTotalIncrement(double value = 1) {
     }
 
+    virtual void
+    CpuCacheHitCounterIncrement(const std::string& table_id) {
+    }
+
+    virtual void
+    CpuCacheMissCounterIncrement(const std::string& table_id) {
+    }
+
+    virtual void
+    CpuCacheEvictCounterIncrement(const std::string& table_id) {
+    }
+
+    virtual void
+    LoadQueueDepthGaugeSet(double value) {
+    }
+
+    virtual void
+    LoadReservedBytesGaugeSet(double value) {
+    }
+
+    virtual void
+    LoadWaitDurationSecondsHistogramObserve(double value) {
+    }
+
+    virtual void
+    SearchTopkPrunedCounterIncrement(double value) {
+    }
+
+    virtual void
+    SegmentCountGaugeSet(double value) {
+    }
+
+    virtual void
+    CompactionDebtBytesGaugeSet(double value) {
+    }
+
     virtual void
     MemTableMergeDurationSecondsHistogramObserve(double value) {
     }
@@ -183,6 +219,26 @@ class MetricsBase {
     KeepingAliveCounterIncrement(double value = 1) {
     }
 
+    virtual void
+    InsertRequestDurationHistogramObserve(double value) {
+    }
+
+    virtual void
+    InsertBufferWaitDurationHistogramObserve(double value) {
+    }
+
+    virtual void
+    FlushDurationHistogramObserve(double value) {
+    }
+
+    virtual void
+    FlushBytesPerSecondGaugeSet(double value) {
+    }
+
+    virtual void
+    SearchReduceDurationHistogramObserve(double value) {
+    }
+
     virtual void
     OctetsSet() {
     }
@@ -60,6 +60,7 @@ class CollectInsertMetrics : CollectMetricsBase {
     ~CollectInsertMetrics() {
         if (n_ > 0) {
             auto total_time = TimeFromBegine();
+            Metrics::GetInstance().InsertRequestDurationHistogramObserve(total_time);
             double avg_time = total_time / n_;
             for (int i = 0; i < n_; ++i) {
                 Metrics::GetInstance().AddVectorsDurationHistogramOberve(avg_time);
@@ -115,6 +116,18 @@ class CollectMergeFilesMetrics : CollectMetricsBase {
     }
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class CollectSearchReduceMetrics : CollectMetricsBase {
+ public:
+    CollectSearchReduceMetrics() {
+    }
+
+    ~CollectSearchReduceMetrics() {
+        auto total_time = TimeFromBegine();
+        server::Metrics::GetInstance().SearchReduceDurationHistogramObserve(total_time);
+    }
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class CollectBuildIndexMetrics : CollectMetricsBase {
  public:
@@ -146,6 +146,69 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    CpuCacheHitCounterIncrement(const std::string& table_id) override {
+        if (startup_) {
+            cpu_cache_hit_.Add({{"table", table_id}}).Increment();
+        }
+    }
+
+    void
+    CpuCacheMissCounterIncrement(const std::string& table_id) override {
+        if (startup_) {
+            cpu_cache_miss_.Add({{"table", table_id}}).Increment();
+        }
+    }
+
+    void
+    CpuCacheEvictCounterIncrement(const std::string& table_id) override {
+        if (startup_) {
+            cpu_cache_evict_.Add({{"table", table_id}}).Increment();
+        }
+    }
+
+    void
+    LoadQueueDepthGaugeSet(double value) override {
+        if (startup_) {
+            load_queue_depth_gauge_.Set(value);
+        }
+    }
+
+    void
+    LoadReservedBytesGaugeSet(double value) override {
+        if (startup_) {
+            load_reserved_bytes_gauge_.Set(value);
+        }
+    }
+
+    void
+    LoadWaitDurationSecondsHistogramObserve(double value) override {
+        if (startup_) {
+            load_wait_duration_seconds_histogram_.Observe(value);
+        }
+    }
+
+    void
+    SearchTopkPrunedCounterIncrement(double value) override {
+        if (startup_) {
+            search_topk_pruned_counter_.Increment(value);
+        }
+    }
+
+    void
+    SegmentCountGaugeSet(double value) override {
+        if (startup_) {
+            segment_count_gauge_.Set(value);
+        }
+    }
+
+    void
+    CompactionDebtBytesGaugeSet(double value) override {
+        if (startup_) {
+            compaction_debt_bytes_gauge_.Set(value);
+        }
+    }
+
     void
     MemTableMergeDurationSecondsHistogramObserve(double value) override {
         if (startup_) {
@@ -281,6 +344,41 @@ class PrometheusMetrics : public MetricsBase {
         }
     }
 
+    void
+    InsertRequestDurationHistogramObserve(double value) override {
+        if (startup_) {
+            insert_request_duration_histogram_.Observe(value);
+        }
+    }
+
+    void
+    InsertBufferWaitDurationHistogramObserve(double value) override {
+        if (startup_) {
+            insert_buffer_wait_duration_histogram_.Observe(value);
+        }
+    }
+
+    void
+    FlushDurationHistogramObserve(double value) override {
+        if (startup_) {
+            flush_duration_histogram_.Observe(value);
+        }
+    }
+
+    void
+    FlushBytesPerSecondGaugeSet(double value) override {
+        if (startup_) {
+            flush_bytes_per_second_gauge_.Set(value);
+        }
+    }
+
+    void
+    SearchReduceDurationHistogramObserve(double value) override {
+        if (startup_) {
+            search_reduce_duration_histogram_.Observe(value);
+        }
+    }
+
     void
     OctetsSet() override;
 
@@ -374,6 +472,37 @@ class PrometheusMetrics : public MetricsBase {
     prometheus::Histogram& add_vectors_duration_histogram_ =
         add_vectors_duration_seconds_.Add({}, BucketBoundaries{0, 0.01, 0.02, 0.03, 0.04, 0.05, 0.08, 0.1, 0.5, 1});
 
+    // record insert request latency and the time blocked by a full insert buffer
+    prometheus::Family<prometheus::Histogram>& insert_request_duration_ =
+        prometheus::BuildHistogram()
+            .Name("insert_request_duration_microseconds")
+            .Help("time of an insert request")
+            .Register(*registry_);
+    prometheus::Histogram& insert_request_duration_histogram_ = insert_request_duration_.Add(
+        {}, BucketBoundaries{100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000});
+
+    prometheus::Family<prometheus::Histogram>& insert_buffer_wait_duration_ =
+        prometheus::BuildHistogram()
+            .Name("insert_buffer_wait_duration_microseconds")
+            .Help("time an insert request is blocked because insert buffer is full")
+            .Register(*registry_);
+    prometheus::Histogram& insert_buffer_wait_duration_histogram_ = insert_buffer_wait_duration_.Add(
+        {}, BucketBoundaries{100, 500, 1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000});
+
+    // record insert buffer flush time and throughput
+    prometheus::Family<prometheus::Histogram>& flush_duration_ =
+        prometheus::BuildHistogram()
+            .Name("flush_duration_microseconds")
+            .Help("time to write all immutable tables of a flush to disk and meta")
+            .Register(*registry_);
+    prometheus::Histogram& flush_duration_histogram_ = flush_duration_.Add(
+        {}, BucketBoundaries{1000, 5000, 10000, 50000, 100000, 500000, 1000000, 5000000, 10000000, 50000000});
+    prometheus::Family<prometheus::Gauge>& flush_bytes_per_second_ = prometheus::BuildGauge()
+                                                                         .Name("flush_bytes_per_second")
+                                                                         .Help("write throughput of the last flush")
+                                                                         .Register(*registry_);
+    prometheus::Gauge& flush_bytes_per_second_gauge_ = flush_bytes_per_second_.Add({});
+
     // record search count and average time
     prometheus::Family<prometheus::Counter>& search_request_ = prometheus::BuildCounter()
                                                                    .Name("search_request_total")
@@ -460,6 +589,15 @@ class PrometheusMetrics : public MetricsBase {
     prometheus::Histogram& search_raw_data_duration_seconds_histogram_ =
         search_data_duration_seconds_.Add({{"type", "raw"}}, BucketBoundaries{1e5, 2e5, 4e5, 6e5, 8e5});
 
+    // record time of reducing per-file results into the final topk of a search job
+    prometheus::Family<prometheus::Histogram>& search_reduce_duration_ =
+        prometheus::BuildHistogram()
+            .Name("search_reduce_duration_microseconds")
+            .Help("time of reducing topk results of a search job")
+            .Register(*registry_);
+    prometheus::Histogram& search_reduce_duration_histogram_ =
+        search_reduce_duration_.Add({}, BucketBoundaries{10, 100, 1000, 10000, 100000, 1000000});
+
     ////all form Cache.cpp
     // record cache usage, when insert/erase/clear/free
 
@@ -543,6 +681,58 @@ class PrometheusMetrics : public MetricsBase {
                                                                  .Register(*registry_);
     prometheus::Counter& cache_access_total_ = cache_access_.Add({});
 
+    // record CPU cache hit, miss and eviction count per table
+    prometheus::Family<prometheus::Counter>& cpu_cache_hit_ = prometheus::BuildCounter()
+                                                                  .Name("cpu_cache_hit_total")
+                                                                  .Help("the count of CPU cache hits")
+                                                                  .Register(*registry_);
+    prometheus::Family<prometheus::Counter>& cpu_cache_miss_ = prometheus::BuildCounter()
+                                                                   .Name("cpu_cache_miss_total")
+                                                                   .Help("the count of CPU cache misses")
+                                                                   .Register(*registry_);
+    prometheus::Family<prometheus::Counter>& cpu_cache_evict_ = prometheus::BuildCounter()
+                                                                    .Name("cpu_cache_evict_total")
+                                                                    .Help("the count of items evicted from CPU cache")
+                                                                    .Register(*registry_);
+
+    // record search load admission, tasks waiting for memory budget and how long they wait
+    prometheus::Family<prometheus::Gauge>& load_queue_depth_ = prometheus::BuildGauge()
+                                                                   .Name("load_queue_depth")
+                                                                   .Help("number of search loads waiting for memory")
+                                                                   .Register(*registry_);
+    prometheus::Gauge& load_queue_depth_gauge_ = load_queue_depth_.Add({});
+    prometheus::Family<prometheus::Gauge>& load_reserved_bytes_ = prometheus::BuildGauge()
+                                                                      .Name("load_reserved_bytes")
+                                                                      .Help("memory reserved by search loads")
+                                                                      .Register(*registry_);
+    prometheus::Gauge& load_reserved_bytes_gauge_ = load_reserved_bytes_.Add({});
+    prometheus::Family<prometheus::Histogram>& load_wait_duration_seconds_ =
+        prometheus::BuildHistogram()
+            .Name("load_wait_duration_seconds")
+            .Help("histogram of time search loads wait for memory")
+            .Register(*registry_);
+    prometheus::Histogram& load_wait_duration_seconds_histogram_ =
+        load_wait_duration_seconds_.Add({}, BucketBoundaries{0.01, 0.1, 0.5, 1, 5, 10, 60});
+
+    // record top-k results of segments that couldn't beat the k-th distance of other segments
+    prometheus::Family<prometheus::Counter>& search_topk_pruned_ = prometheus::BuildCounter()
+                                                                       .Name("search_topk_pruned_total")
+                                                                       .Help("the count of pruned segment results")
+                                                                       .Register(*registry_);
+    prometheus::Counter& search_topk_pruned_counter_ = search_topk_pruned_.Add({});
+
+    // record searchable segments and the bytes the compaction policy still wants to rewrite
+    prometheus::Family<prometheus::Gauge>& segment_count_ = prometheus::BuildGauge()
+                                                                .Name("segment_count")
+                                                                .Help("number of searchable segments")
+                                                                .Register(*registry_);
+    prometheus::Gauge& segment_count_gauge_ = segment_count_.Add({});
+    prometheus::Family<prometheus::Gauge>& compaction_debt_bytes_ = prometheus::BuildGauge()
+                                                                        .Name("compaction_debt_bytes")
+                                                                        .Help("bytes waiting to be compacted")
+                                                                        .Register(*registry_);
+    prometheus::Gauge& compaction_debt_bytes_gauge_ = compaction_debt_bytes_.Add({});
+
     // record CPU cache usage and %
     prometheus::Family<prometheus::Gauge>& cpu_cache_usage_ =
         prometheus::BuildGauge().Name("cache_usage_bytes").Help("current cache usage by bytes").Register(*registry_);
@@ -28,7 +28,7 @@ namespace scheduler {
 
 class BuildMgr {
  public:
-    explicit BuildMgr(int64_t concurrent_limit) : available_(concurrent_limit) {
+    explicit BuildMgr(int64_t concurrent_limit) : concurrent_limit_(concurrent_limit), available_(concurrent_limit) {
     }
 
  public:
@@ -49,12 +49,21 @@ class BuildMgr {
         }
     }
 
+    // builds already taken keep their place, the available count follows the new limit
+    void
+    SetConcurrentLimit(int64_t concurrent_limit) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        available_ += concurrent_limit - concurrent_limit_;
+        concurrent_limit_ = concurrent_limit;
+    }
+
     int64_t
     NumOfAvailable() {
         return available_;
     }
 
  private:
+    std::int64_t concurrent_limit_;
     std::int64_t available_;
     std::mutex mutex_;
 };
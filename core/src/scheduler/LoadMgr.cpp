@@ -0,0 +1,86 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "scheduler/LoadMgr.h"
+#include "metrics/Metrics.h"
+
+namespace milvus {
+namespace scheduler {
+
+LoadMgr::LoadMgr(int64_t capacity) : capacity_(capacity) {
+}
+
+bool
+LoadMgr::Reserve(int64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // capacity not greater than 0 means no budget limit
+    if (capacity_ > 0 && size > 0 && reserved_ > 0 && reserved_ + size > capacity_) {
+        return false;
+    }
+
+    reserved_ += size;
+    server::Metrics::GetInstance().LoadReservedBytesGaugeSet(reserved_);
+    return true;
+}
+
+void
+LoadMgr::Release(int64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reserved_ -= size;
+    if (reserved_ < 0) {
+        reserved_ = 0;
+    }
+    server::Metrics::GetInstance().LoadReservedBytesGaugeSet(reserved_);
+}
+
+void
+LoadMgr::WaitBegin() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++waiting_;
+    server::Metrics::GetInstance().LoadQueueDepthGaugeSet(waiting_);
+}
+
+void
+LoadMgr::WaitEnd(uint64_t wait_ms) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (waiting_ > 0) {
+        --waiting_;
+    }
+    server::Metrics::GetInstance().LoadQueueDepthGaugeSet(waiting_);
+    server::Metrics::GetInstance().LoadWaitDurationSecondsHistogramObserve(wait_ms / 1000.0);
+}
+
+void
+LoadMgr::SetCapacity(int64_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+}
+
+int64_t
+LoadMgr::Capacity() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+}
+
+int64_t
+LoadMgr::Reserved() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return reserved_;
+}
+
+int64_t
+LoadMgr::NumOfWaiting() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return waiting_;
+}
+
+}  // namespace scheduler
+}  // namespace milvus
@@ -0,0 +1,67 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace milvus {
+namespace scheduler {
+
+// Memory budget of DISK2CPU loads for search tasks.
+// A task reserves the size of its file before it is loaded and holds the reservation until it has been
+// executed, so the files a query needs are not evicted from cpu cache by other loads before they are searched.
+class LoadMgr {
+ public:
+    explicit LoadMgr(int64_t capacity);
+
+ public:
+    // reserve memory for one load, return false if the budget is exhausted;
+    // a file larger than the whole budget is admitted once nothing else is reserved so it cannot starve
+    bool
+    Reserve(int64_t size);
+
+    void
+    Release(int64_t size);
+
+    // a task was refused and starts to wait for budget
+    void
+    WaitBegin();
+
+    // a waiting task was admitted or dropped, wait_ms is the time it waited
+    void
+    WaitEnd(uint64_t wait_ms);
+
+    void
+    SetCapacity(int64_t capacity);
+
+    int64_t
+    Capacity();
+
+    int64_t
+    Reserved();
+
+    int64_t
+    NumOfWaiting();
+
+ private:
+    int64_t capacity_;
+    int64_t reserved_ = 0;
+    int64_t waiting_ = 0;
+    std::mutex mutex_;
+};
+
+using LoadMgrPtr = std::shared_ptr<LoadMgr>;
+
+}  // namespace scheduler
+}  // namespace milvus
@@ -13,8 +13,12 @@
 #include "ResourceFactory.h"
 #include "Utils.h"
 #include "server/Config.h"
+#include "scheduler/resource/CpuResource.h"
+#include "utils/CommonUtil.h"
 
 #include <fiu-local.h>
+#include <algorithm>
+#include <cmath>
 #include <set>
 #include <string>
 #include <utility>
@@ -38,19 +42,47 @@ std::mutex OptimizerInst::mutex_;
 BuildMgrPtr BuildMgrInst::instance = nullptr;
 std::mutex BuildMgrInst::mutex_;
 
+LoadMgrPtr LoadMgrInst::instance = nullptr;
+std::mutex LoadMgrInst::mutex_;
+
 void
 load_simple_config() {
+    server::Config& config = server::Config::GetInstance();
+    int64_t loader_thread_num = 1, executor_thread_num = 1, omp_thread_num = 0;
+    int64_t build_parallel_num = 1, build_omp_thread_num = 0;
+    config.GetEngineConfigLoaderThreadNum(loader_thread_num);
+    config.GetEngineConfigExecutorThreadNum(executor_thread_num);
+    config.GetEngineConfigOmpThreadNum(omp_thread_num);
+    config.GetEngineConfigBuildParallelNum(build_parallel_num);
+    config.GetEngineConfigBuildOmpThreadNum(build_omp_thread_num);
+    if (omp_thread_num <= 0) {
+        // same default as the engine uses for the whole process
+        int64_t sys_thread_cnt = 8;
+        if (server::CommonUtil::GetSystemAvailableThreads(sys_thread_cnt)) {
+            omp_thread_num = static_cast<int64_t>(ceil(sys_thread_cnt * 0.5));
+        }
+    }
+
     // create and connect
-    ResMgrInst::GetInstance()->Add(ResourceFactory::Create("disk", "DISK", 0, false));
+    auto disk = ResourceFactory::Create("disk", "DISK", 0, false);
+    disk->SetThreadNum(loader_thread_num, 1);
+    ResMgrInst::GetInstance()->Add(std::move(disk));
 
     auto io = Connection("io", 500);
-    ResMgrInst::GetInstance()->Add(ResourceFactory::Create("cpu", "CPU", 0));
+    auto cpu = ResourceFactory::Create("cpu", "CPU", 0);
+    // builds run on executor threads of their own, searches keep executor_thread_num threads whatever is building
+    cpu->SetThreadNum(loader_thread_num, executor_thread_num + build_parallel_num);
+    std::static_pointer_cast<CpuResource>(cpu)->SetOmpThreadNum(omp_thread_num);
+    std::static_pointer_cast<CpuResource>(cpu)->SetBuildThreadNum(build_parallel_num, build_omp_thread_num);
+    ResMgrInst::GetInstance()->Add(std::move(cpu));
     ResMgrInst::GetInstance()->Connect("disk", "cpu", io);
 
+    // a build loaded beyond what can execute holds memory and a load slot searches are waiting for
+    int64_t build_limit = build_parallel_num;
+
 // get resources
 #ifdef MILVUS_GPU_VERSION
     bool enable_gpu = false;
-    server::Config& config = server::Config::GetInstance();
     config.GetGpuResourceConfigEnable(enable_gpu);
     if (enable_gpu) {
         std::vector<int64_t> gpu_ids;
@@ -83,8 +115,12 @@ load_simple_config() {
             ResMgrInst::GetInstance()->Add(ResourceFactory::Create(std::to_string(not_find_id), "GPU", not_find_id));
             ResMgrInst::GetInstance()->Connect("cpu", std::to_string(not_find_id), pcie);
         }
+
+        // gpu builds pass the cpu too, keep the former limit for them
+        build_limit = std::max(build_limit, (int64_t)4);
     }
 #endif
+    BuildMgrInst::GetInstance()->SetConcurrentLimit(build_limit);
 }
 
 void
@@ -13,9 +13,11 @@
 
 #include "BuildMgr.h"
 #include "JobMgr.h"
+#include "LoadMgr.h"
 #include "ResourceMgr.h"
 #include "Scheduler.h"
 #include "Utils.h"
+#include "cache/CpuCacheMgr.h"
 #include "optimizer/BuildIndexPass.h"
 #include "optimizer/FaissFlatPass.h"
 #include "optimizer/FaissIVFFlatPass.h"
@@ -23,7 +25,9 @@
 #include "optimizer/FaissIVFSQ8HPass.h"
 #include "optimizer/FaissIVFSQ8Pass.h"
 #include "optimizer/FallbackPass.h"
+#include "optimizer/InsertBufferPass.h"
 #include "optimizer/Optimizer.h"
+#include "optimizer/RangeSearchPass.h"
 #include "server/Config.h"
 
 #include <memory>
@@ -96,6 +100,8 @@ class OptimizerInst {
             std::lock_guard<std::mutex> lock(mutex_);
             if (instance == nullptr) {
                 std::vector<PassPtr> pass_list;
+                pass_list.push_back(std::make_shared<InsertBufferPass>());
+                pass_list.push_back(std::make_shared<RangeSearchPass>());
 #ifdef MILVUS_GPU_VERSION
                 bool enable_gpu = false;
                 server::Config& config = server::Config::GetInstance();
@@ -160,6 +166,25 @@ class BuildMgrInst {
     static std::mutex mutex_;
 };
 
+class LoadMgrInst {
+ public:
+    static LoadMgrPtr
+    GetInstance() {
+        if (instance == nullptr) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (instance == nullptr) {
+                // search loads may hold at most what the cpu cache can keep
+                instance = std::make_shared<LoadMgr>(cache::CpuCacheMgr::GetInstance()->CacheCapacity());
+            }
+        }
+        return instance;
+    }
+
+ private:
+    static LoadMgrPtr instance;
+    static std::mutex mutex_;
+};
+
 void
 StartSchedulerService();
 
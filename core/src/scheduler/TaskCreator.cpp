@@ -10,6 +10,11 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "scheduler/TaskCreator.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
 #include "SchedInst.h"
 #include "tasklabel/BroadcastLabel.h"
 #include "tasklabel/SpecResLabel.h"
@@ -38,13 +43,32 @@ TaskCreator::Create(const JobPtr& job) {
 
 std::vector<TaskPtr>
 TaskCreator::Create(const SearchJobPtr& job) {
-    std::vector<TaskPtr> tasks;
+    std::vector<std::shared_ptr<XSearchTask>> search_tasks;
+    auto& mem_files = job->mem_files();
     for (auto& index_file : job->index_files()) {
-        auto task = std::make_shared<XSearchTask>(job->GetContext(), index_file.second, nullptr);
+        engine::MemTableFilePtr mem_file = nullptr;
+        auto mem_it = mem_files.find(index_file.first);
+        if (mem_it != mem_files.end()) {
+            mem_file = mem_it->second;
+        }
+        auto task = std::make_shared<XSearchTask>(job->GetContext(), index_file.second, nullptr, mem_file);
         task->job_ = job;
-        tasks.emplace_back(task);
+        search_tasks.emplace_back(task);
     }
 
+    // cached and large files first, they are searched soon and give a tight distance bound to the others
+    std::vector<std::pair<bool, int64_t>> keys;
+    for (auto& task : search_tasks) {
+        keys.emplace_back(task->IsCached(), task->file_ ? (int64_t)task->file_->row_count_ : 0);
+    }
+    std::vector<size_t> order(search_tasks.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return keys[a] > keys[b]; });
+
+    std::vector<TaskPtr> tasks;
+    for (auto i : order) {
+        tasks.emplace_back(search_tasks[i]);
+    }
     return tasks;
 }
 
@@ -153,6 +153,8 @@ TaskTable::PickToLoad(uint64_t limit) {
     std::vector<uint64_t> indexes;
     bool cross = false;
 
+    std::lock_guard<std::mutex> lock(pick_mutex_);
+
     uint64_t available_begin = table_.front() + 1;
     for (uint64_t i = 0, loaded_count = 0, pick_count = 0; i < table_.size() && pick_count < limit; ++i) {
         auto index = available_begin + i;
@@ -165,7 +167,7 @@ TaskTable::PickToLoad(uint64_t limit) {
         } else if (table_[index]->state == TaskTableItemState::LOADED) {
             cross = true;
             ++loaded_count;
-            if (loaded_count > 2)
+            if (loaded_count > max_loaded_)
                 return std::vector<uint64_t>();
         } else if (table_[index]->state == TaskTableItemState::START) {
             auto task = table_[index]->task;
@@ -236,6 +238,8 @@ TaskTable::PickToExecute(uint64_t limit) {
     TimeRecorder rc("");
     std::vector<uint64_t> indexes;
     bool cross = false;
+
+    std::lock_guard<std::mutex> lock(pick_mutex_);
     uint64_t available_begin = table_.front() + 1;
     for (uint64_t i = 0, pick_count = 0; i < table_.size() && pick_count < limit; ++i) {
         uint64_t index = available_begin + i;
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <deque>
 #include <functional>
 #include <memory>
@@ -125,6 +126,15 @@ class TaskTable : public interface::dumpable {
     std::vector<uint64_t>
     PickToExecute(uint64_t limit);
 
+    /*
+     * Upper bound of loaded-but-not-executed tasks before loader stops picking;
+     * Raised when a resource runs several executor threads;
+     */
+    inline void
+    SetMaxLoaded(uint64_t max_loaded) {
+        max_loaded_ = max_loaded;
+    }
+
  public:
     inline const TaskTableItemPtr& operator[](uint64_t index) {
         return table_[index];
@@ -219,6 +229,11 @@ class TaskTable : public interface::dumpable {
     // pick from (last_finish_ + 1)
     // init with -1, pick from (last_finish_ + 1) = 0
     uint64_t last_finish_ = -1;
+
+    // loader and executor threads pick concurrently, the front of the table only moves under this lock
+    std::mutex pick_mutex_;
+
+    std::atomic<uint64_t> max_loaded_{2};
 };
 
 }  // namespace scheduler
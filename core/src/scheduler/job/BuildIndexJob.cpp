@@ -17,8 +17,12 @@
 namespace milvus {
 namespace scheduler {
 
-BuildIndexJob::BuildIndexJob(engine::meta::MetaPtr meta_ptr, engine::DBOptions options)
-    : Job(JobType::BUILD), meta_ptr_(std::move(meta_ptr)), options_(std::move(options)) {
+BuildIndexJob::BuildIndexJob(engine::meta::MetaPtr meta_ptr, engine::DBOptions options,
+                             std::shared_timed_mutex* deletion_mutex)
+    : Job(JobType::BUILD),
+      meta_ptr_(std::move(meta_ptr)),
+      options_(std::move(options)),
+      deletion_mutex_(deletion_mutex) {
 }
 
 bool
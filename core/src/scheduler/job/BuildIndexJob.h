@@ -16,6 +16,7 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <shared_mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -35,7 +36,9 @@ using Id2ToTableFileMap = std::unordered_map<size_t, TableFileSchema>;
 
 class BuildIndexJob : public Job {
  public:
-    explicit BuildIndexJob(engine::meta::MetaPtr meta_ptr, engine::DBOptions options);
+    // deletion_mutex is held shared while a built index takes over the deletions of its raw file, see DBImpl
+    explicit BuildIndexJob(engine::meta::MetaPtr meta_ptr, engine::DBOptions options,
+                           std::shared_timed_mutex* deletion_mutex = nullptr);
 
  public:
     bool
@@ -71,10 +74,16 @@ class BuildIndexJob : public Job {
         return options_;
     }
 
+    std::shared_timed_mutex*
+    deletion_mutex() const {
+        return deletion_mutex_;
+    }
+
  private:
     Id2ToIndexMap to_index_files_;
     engine::meta::MetaPtr meta_ptr_;
     engine::DBOptions options_;
+    std::shared_timed_mutex* deletion_mutex_ = nullptr;
 
     Status status_;
     std::mutex mutex_;
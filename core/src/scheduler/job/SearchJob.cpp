@@ -11,6 +11,12 @@
 
 #include "scheduler/job/SearchJob.h"
 
+#include <algorithm>
+#include <limits>
+#include <string>
+
+#include "metrics/Metrics.h"
+#include "scheduler/task/SearchTask.h"
 #include "utils/Log.h"
 
 namespace milvus {
@@ -34,11 +40,32 @@ SearchJob::AddIndexFile(const TableFileSchemaPtr& index_file) {
     return true;
 }
 
+bool
+SearchJob::AddMemFile(const engine::MemTableFilePtr& mem_file) {
+    if (mem_file == nullptr) {
+        return false;
+    }
+
+    // a buffer file already serialized is searched from disk, skip it by file id
+    auto index_file = std::make_shared<engine::meta::TableFileSchema>(mem_file->GetTableFileSchema());
+    if (!AddIndexFile(index_file)) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    mem_files_[index_file->id_] = mem_file;
+    return true;
+}
+
 void
 SearchJob::WaitResult() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    cv_.wait(lock, [this] { return index_files_.empty(); });
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return index_files_.empty(); });
+    }
     SERVER_LOG_DEBUG << "SearchJob " << id() << " all done";
+
+    ReduceResult();
 }
 
 void
@@ -52,6 +79,175 @@ SearchJob::SearchDone(size_t index_id) {
     SERVER_LOG_DEBUG << "SearchJob " << id() << " finish index file: " << index_id;
 }
 
+void
+SearchJob::AddTaskResult(ResultIds& ids, ResultDistances& distances, size_t k, bool ascending) {
+    if (k == 0) {
+        return;
+    }
+
+    uint64_t nq = this->nq();
+    if (k == topk_) {
+        // the final k-th distance of every query is at least as good as the k-th distance of any task
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (distance_bound_.empty()) {
+            float neutral = ascending ? std::numeric_limits<float>::max() : std::numeric_limits<float>::lowest();
+            distance_bound_.resize(nq, neutral);
+        }
+        for (uint64_t i = 0; i < nq; ++i) {
+            size_t last = i * topk_ + topk_ - 1;
+            if (ids[last] < 0) {
+                continue;
+            }
+            float distance = distances[last];
+            if (ascending ? distance < distance_bound_[i] : distance > distance_bound_[i]) {
+                distance_bound_[i] = distance;
+            }
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(reduce_mutex_);
+    reduced_count_++;
+    if (result_k_ == 0) {
+        // the task buffers keep topk slots per query, the first one becomes the job result
+        result_ids_.swap(ids);
+        result_distances_.swap(distances);
+        result_k_ = k;
+        return;
+    }
+
+    server::CollectSearchReduceMetrics metrics;
+    if (merge_ids_.empty()) {
+        merge_ids_.resize(nq * topk_);
+        merge_distances_.resize(nq * topk_);
+    }
+    result_k_ = XSearchTask::MergeTopkResults(ids, distances, k, nq, topk_, ascending, result_k_, result_ids_,
+                                              result_distances_, merge_ids_, merge_distances_);
+}
+
+void
+SearchJob::SetRangeSearch(float radius, int64_t max_results) {
+    range_search_ = true;
+    radius_ = radius;
+    max_range_results_ = max_results;
+}
+
+void
+SearchJob::SetRefineFactor(uint64_t refine_factor) {
+    refine_factor_ = refine_factor;
+}
+
+void
+SearchJob::AddRangeTaskResult(std::vector<int64_t>& lims, ResultIds& ids, ResultDistances& distances) {
+    if (ids.empty()) {
+        return;
+    }
+
+    SearchTaskResult result;
+    result.lims_.swap(lims);
+    result.ids_.swap(ids);
+    result.distances_.swap(distances);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!status_.ok()) {
+        return;
+    }
+
+    // past the limit the job fails, and the results taken so far are freed at once
+    range_result_count_ += result.ids_.size();
+    if (range_result_count_ > max_range_results_) {
+        std::string msg = "Range search matches more than " + std::to_string(max_range_results_) +
+                          " vectors, use a smaller radius or fewer query vectors";
+        status_ = Status(SERVER_INVALID_ARGUMENT, msg);
+        task_results_.clear();
+        return;
+    }
+    task_results_.emplace_back(std::move(result));
+}
+
+bool
+SearchJob::GetDistanceBound(std::vector<float>& bound) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (distance_bound_.empty()) {
+        return false;
+    }
+    bound = distance_bound_;
+    return true;
+}
+
+void
+SearchJob::AddPrunedCount(int64_t pruned_count, int64_t deleted_count) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    pruned_count_ += pruned_count;
+    deleted_count_ += deleted_count;
+}
+
+void
+SearchJob::ReduceResult() {
+    if (range_search_) {
+        ConcatRangeResults();
+        return;
+    }
+
+    // every task is merged as it is done, only drop the slots no task filled
+    uint64_t nq = this->nq();
+    if (result_k_ == 0) {
+        // no task returned a result, the buffers may never have been allocated
+        result_ids_.clear();
+        result_distances_.clear();
+    } else if (result_k_ < topk_) {
+        for (uint64_t i = 1; i < nq; ++i) {
+            std::copy(result_ids_.begin() + i * topk_, result_ids_.begin() + i * topk_ + result_k_,
+                      result_ids_.begin() + i * result_k_);
+            std::copy(result_distances_.begin() + i * topk_, result_distances_.begin() + i * topk_ + result_k_,
+                      result_distances_.begin() + i * result_k_);
+        }
+        result_ids_.resize(nq * result_k_);
+        result_distances_.resize(nq * result_k_);
+    }
+    ResultIds().swap(merge_ids_);
+    ResultDistances().swap(merge_distances_);
+
+    SERVER_LOG_DEBUG << "SearchJob " << id() << " merged " << reduced_count_ << " results, " << pruned_count_
+                     << " results pruned by distance bound, " << deleted_count_
+                     << " empty results in files with deleted vectors";
+    server::Metrics::GetInstance().SearchTopkPrunedCounterIncrement(pruned_count_);
+}
+
+void
+SearchJob::ConcatRangeResults() {
+    if (!status_.ok()) {
+        task_results_.clear();
+        return;
+    }
+
+    uint64_t nq = this->nq();
+    result_lims_.assign(nq + 1, 0);
+    for (uint64_t i = 0; i < nq; ++i) {
+        int64_t count = 0;
+        for (auto& result : task_results_) {
+            count += result.lims_[i + 1] - result.lims_[i];
+        }
+        result_lims_[i + 1] = result_lims_[i] + count;
+    }
+
+    result_ids_.resize(result_lims_[nq]);
+    result_distances_.resize(result_lims_[nq]);
+    for (uint64_t i = 0; i < nq; ++i) {
+        int64_t offset = result_lims_[i];
+        for (auto& result : task_results_) {
+            auto from = result.lims_[i], to = result.lims_[i + 1];
+            std::copy(result.ids_.begin() + from, result.ids_.begin() + to, result_ids_.begin() + offset);
+            std::copy(result.distances_.begin() + from, result.distances_.begin() + to,
+                      result_distances_.begin() + offset);
+            offset += to - from;
+        }
+    }
+
+    SERVER_LOG_DEBUG << "SearchJob " << id() << " concat " << task_results_.size() << " range results, "
+                     << result_lims_[nq] << " results in total";
+    task_results_.clear();
+}
+
 ResultIds&
 SearchJob::GetResultIds() {
     return result_ids_;
@@ -62,6 +258,11 @@ SearchJob::GetResultDistances() {
     return result_distances_;
 }
 
+std::vector<int64_t>&
+SearchJob::GetResultLims() {
+    return result_lims_;
+}
+
 Status&
 SearchJob::GetStatus() {
     return status_;
@@ -74,6 +275,12 @@ SearchJob::Dump() const {
         {"nq", vectors_.vector_count_},
         {"nprobe", nprobe_},
     };
+    if (range_search_) {
+        ret["radius"] = radius_;
+    }
+    if (refine_factor_ != 0) {
+        ret["refine_factor"] = refine_factor_;
+    }
     auto base = Job::Dump();
     ret.insert(base.begin(), base.end());
     return ret;
@@ -24,6 +24,7 @@
 
 #include "Job.h"
 #include "db/Types.h"
+#include "db/insert/MemTableFile.h"
 #include "db/meta/MetaTypes.h"
 
 #include "server/context/Context.h"
@@ -34,10 +35,19 @@ namespace scheduler {
 using engine::meta::TableFileSchemaPtr;
 
 using Id2IndexMap = std::unordered_map<size_t, TableFileSchemaPtr>;
+using Id2MemFileMap = std::unordered_map<size_t, engine::MemTableFilePtr>;
 
 using ResultIds = engine::ResultIds;
 using ResultDistances = engine::ResultDistances;
 
+// private result of one range search task, it keeps nq + 1 offsets in lims_,
+// the results of query i are in [lims_[i], lims_[i + 1])
+struct SearchTaskResult {
+    ResultIds ids_;
+    ResultDistances distances_;
+    std::vector<int64_t> lims_;
+};
+
 class SearchJob : public Job {
  public:
     SearchJob(const std::shared_ptr<server::Context>& context, uint64_t topk, uint64_t nprobe,
@@ -47,24 +57,67 @@ class SearchJob : public Job {
     bool
     AddIndexFile(const TableFileSchemaPtr& index_file);
 
+    // in-memory insert buffer file, searched by brute force as a virtual index file
+    bool
+    AddMemFile(const engine::MemTableFilePtr& mem_file);
+
     void
     WaitResult();
 
     void
     SearchDone(size_t index_id);
 
+    // merge the topk result of a task into the job result as soon as the task is done
+    void
+    AddTaskResult(ResultIds& ids, ResultDistances& distances, size_t k, bool ascending);
+
+    // make it a range search job, its tasks return all vectors within radius and topk is ignored;
+    // the job fails once its tasks return more than max_results in total
+    void
+    SetRangeSearch(float radius, int64_t max_results);
+
+    // candidates per result re-ranked by the files keeping raw vectors, 0 for the default of the index
+    void
+    SetRefineFactor(uint64_t refine_factor);
+
+    // take over the variable length result of a range search task, see SearchTaskResult
+    void
+    AddRangeTaskResult(std::vector<int64_t>& lims, ResultIds& ids, ResultDistances& distances);
+
+    // per query k-th distance among the tasks done with full topk results, a result of another task
+    // that doesn't beat it can't enter the final result; return false before any such task is done
+    bool
+    GetDistanceBound(std::vector<float>& bound);
+
+    // result slots a task left empty because of the distance bound, and the ones that deleted vectors
+    // of the searched file may have left empty instead
+    void
+    AddPrunedCount(int64_t pruned_count, int64_t deleted_count);
+
     ResultIds&
     GetResultIds();
 
     ResultDistances&
     GetResultDistances();
 
+    // nq + 1 offsets into the result ids and distances of a range search job
+    std::vector<int64_t>&
+    GetResultLims();
+
     Status&
     GetStatus();
 
     json
     Dump() const override;
 
+ private:
+    void
+    ReduceResult();
+
+    // results of a query from all tasks are put one after another, no dense nq * topk matrix is built
+    void
+    ConcatRangeResults();
+
  public:
     const std::shared_ptr<server::Context>&
     GetContext() const;
@@ -84,16 +137,49 @@ class SearchJob : public Job {
         return nprobe_;
     }
 
+    bool
+    range_search() const {
+        return range_search_;
+    }
+
+    float
+    radius() const {
+        return radius_;
+    }
+
+    uint64_t
+    refine_factor() const {
+        return refine_factor_;
+    }
+
     const engine::VectorsData&
     vectors() const {
         return vectors_;
     }
 
+    // counters added by AddPrunedCount
+    int64_t
+    pruned_count() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pruned_count_;
+    }
+
+    int64_t
+    deleted_count() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return deleted_count_;
+    }
+
     Id2IndexMap&
     index_files() {
         return index_files_;
     }
 
+    Id2MemFileMap&
+    mem_files() {
+        return mem_files_;
+    }
+
     std::mutex&
     mutex() {
         return mutex_;
@@ -104,13 +190,31 @@ class SearchJob : public Job {
 
     uint64_t topk_ = 0;
     uint64_t nprobe_ = 0;
+    bool range_search_ = false;
+    float radius_ = 0;
+    int64_t max_range_results_ = 0;
+    int64_t range_result_count_ = 0;
+    uint64_t refine_factor_ = 0;
     // TODO: smart pointer
     const engine::VectorsData& vectors_;
 
     Id2IndexMap index_files_;
+    Id2MemFileMap mem_files_;
     // TODO: column-base better ?
     ResultIds result_ids_;
     ResultDistances result_distances_;
+    std::vector<int64_t> result_lims_;
+    // result_ids_ and result_distances_ keep topk slots per query until all tasks are done,
+    // the first result_k_ of them are valid; the merge buffers are allocated once at the second task
+    size_t result_k_ = 0;
+    ResultIds merge_ids_;
+    ResultDistances merge_distances_;
+    int64_t reduced_count_ = 0;
+    std::mutex reduce_mutex_;
+    std::vector<SearchTaskResult> task_results_;
+    std::vector<float> distance_bound_;
+    int64_t pruned_count_ = 0;
+    int64_t deleted_count_ = 0;
     Status status_;
 
     std::mutex mutex_;
@@ -13,6 +13,7 @@
 #include "scheduler/SchedInst.h"
 #include "scheduler/Utils.h"
 #include "scheduler/optimizer/BuildIndexPass.h"
+#include "scheduler/task/BuildIndexTask.h"
 #include "scheduler/tasklabel/SpecResLabel.h"
 #ifdef MILVUS_GPU_VERSION
 namespace milvus {
@@ -32,6 +33,16 @@ bool
 BuildIndexPass::Run(const TaskPtr& task) {
     if (task->Type() != TaskType::BuildIndexTask)
         return false;
+
+    // half precision and fast scan indexes have no gpu kernels, raw vectors for refine are kept by cpu builds only
+    auto build_task = std::static_pointer_cast<XBuildIndexTask>(task);
+    auto engine_type = (engine::EngineType)build_task->file_->engine_type_;
+    if (engine_type == engine::EngineType::FAISS_IVFFLAT_FP16 ||
+        engine_type == engine::EngineType::FAISS_IVFFLAT_BF16 || engine_type == engine::EngineType::FAISS_PQ_FASTSCAN ||
+        engine_type == engine::EngineType::FAISS_IVFSQ8_REFINE || engine_type == engine::EngineType::FAISS_PQ_REFINE) {
+        return false;
+    }
+
     fiu_do_on("BuildIndexPass.Run.empty_gpu_ids", build_gpu_ids_.clear());
     if (build_gpu_ids_.empty()) {
         SERVER_LOG_WARNING << "BuildIndexPass cannot get build index gpu!";
@@ -11,6 +11,8 @@
 
 #include "scheduler/resource/CpuResource.h"
 
+#include <omp.h>
+#include <algorithm>
 #include <utility>
 
 namespace milvus {
@@ -26,6 +28,17 @@ CpuResource::CpuResource(std::string name, uint64_t device_id, bool enable_execu
     : Resource(std::move(name), ResourceType::CPU, device_id, enable_executor) {
 }
 
+void
+CpuResource::SetOmpThreadNum(int64_t omp_thread_num) {
+    omp_thread_num_ = omp_thread_num;
+}
+
+void
+CpuResource::SetBuildThreadNum(int64_t parallel_num, int64_t omp_thread_num) {
+    build_parallel_num_ = std::max(parallel_num, (int64_t)0);
+    build_omp_thread_num_ = omp_thread_num;
+}
+
 void
 CpuResource::LoadFile(TaskPtr task) {
     task->Load(LoadType::DISK2CPU, 0);
@@ -33,7 +46,64 @@ CpuResource::LoadFile(TaskPtr task) {
 
 void
 CpuResource::Process(TaskPtr task) {
+    bool is_search = task->Type() == TaskType::SearchTask;
+    if (task->Type() == TaskType::BuildIndexTask && build_parallel_num_ > 0) {
+        omp_set_num_threads(static_cast<int>(BuildThreadShare()));
+    } else if (omp_thread_num_ > 0) {
+        // omp setting is per thread, split the budget so concurrent tasks do not oversubscribe cores
+        omp_set_num_threads(static_cast<int>(SearchThreadShare()));
+    }
+
+    if (is_search) {
+        ++running_search_num_;
+    }
     task->Execute();
+    if (is_search) {
+        --running_search_num_;
+    }
+}
+
+bool
+CpuResource::AdmitExecute(const TaskPtr& task) {
+    if (task->Type() != TaskType::BuildIndexTask || build_parallel_num_ == 0) {
+        return true;
+    }
+
+    auto running = running_build_num_.load();
+    while (running < build_parallel_num_) {
+        if (running_build_num_.compare_exchange_weak(running, running + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+CpuResource::ReleaseExecute(const TaskPtr& task) {
+    if (task->Type() == TaskType::BuildIndexTask && build_parallel_num_ > 0) {
+        --running_build_num_;
+    }
+}
+
+int64_t
+CpuResource::SearchThreadShare() const {
+    // executor threads reserved for builds don't take a share of their own
+    auto search_thread_num = std::max((int64_t)ExecutorThreadNum() - build_parallel_num_, (int64_t)1);
+    return std::max(omp_thread_num_ / search_thread_num, (int64_t)1);
+}
+
+int64_t
+CpuResource::BuildThreadShare() const {
+    int64_t share = build_omp_thread_num_;
+    if (share <= 0) {
+        share = std::max(omp_thread_num_ / build_parallel_num_, (int64_t)1);
+    }
+    if (omp_thread_num_ > 0) {
+        // searches come first, a build starting next to them only gets the threads they leave idle
+        auto left = omp_thread_num_ - running_search_num_ * SearchThreadShare();
+        share = std::min(share, std::max(left / build_parallel_num_, (int64_t)1));
+    }
+    return share;
 }
 
 }  // namespace scheduler
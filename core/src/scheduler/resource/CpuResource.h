@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include "Resource.h"
@@ -25,12 +26,49 @@ class CpuResource : public Resource {
     friend std::ostream&
     operator<<(std::ostream& out, const CpuResource& resource);
 
+    /*
+     * Total OpenMP threads shared by all executor threads of this resource;
+     * Each executor thread runs its task with an equal share of the budget;
+     */
+    void
+    SetOmpThreadNum(int64_t omp_thread_num);
+
+    /*
+     * At most parallel_num index builds execute at once, on executor threads reserved for them;
+     * Each build runs with omp_thread_num threads, 0 splits the OpenMP budget between the builds;
+     * A build gets no more than what the running searches leave of the budget;
+     * Must be called before Start(), together with SetThreadNum();
+     */
+    void
+    SetBuildThreadNum(int64_t parallel_num, int64_t omp_thread_num);
+
  protected:
     void
     LoadFile(TaskPtr task) override;
 
     void
     Process(TaskPtr task) override;
+
+    bool
+    AdmitExecute(const TaskPtr& task) override;
+
+    void
+    ReleaseExecute(const TaskPtr& task) override;
+
+ private:
+    int64_t
+    SearchThreadShare() const;
+
+    int64_t
+    BuildThreadShare() const;
+
+ private:
+    int64_t omp_thread_num_ = 0;
+    int64_t build_parallel_num_ = 0;
+    int64_t build_omp_thread_num_ = 0;
+
+    std::atomic<int64_t> running_search_num_{0};
+    std::atomic<int64_t> running_build_num_{0};
 };
 
 }  // namespace scheduler
@@ -12,7 +12,9 @@
 #include "scheduler/resource/Resource.h"
 #include "scheduler/SchedInst.h"
 #include "scheduler/Utils.h"
+#include "scheduler/task/SearchTask.h"
 
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -53,23 +55,49 @@ Resource::Resource(std::string name, ResourceType type, uint64_t device_id, bool
     });
 }
 
+void
+Resource::SetThreadNum(uint64_t loader_num, uint64_t executor_num) {
+    loader_thread_num_ = std::max(loader_num, (uint64_t)1);
+    executor_thread_num_ = std::max(executor_num, (uint64_t)1);
+    // keep enough tasks loaded to feed every executor thread
+    task_table_.SetMaxLoaded(std::max(executor_thread_num_, (uint64_t)2));
+}
+
 void
 Resource::Start() {
     running_ = true;
-    loader_thread_ = std::thread(&Resource::loader_function, this);
+    for (uint64_t i = 0; i < loader_thread_num_; ++i) {
+        loader_threads_.emplace_back(&Resource::loader_function, this);
+    }
     if (enable_executor_) {
-        executor_thread_ = std::thread(&Resource::executor_function, this);
+        for (uint64_t i = 0; i < executor_thread_num_; ++i) {
+            executor_threads_.emplace_back(&Resource::executor_function, this, i);
+        }
     }
 }
 
 void
 Resource::Stop() {
     running_ = false;
-    WakeupLoader();
-    loader_thread_.join();
+    {
+        std::lock_guard<std::mutex> lock(load_mutex_);
+        load_flag_ = true;
+    }
+    load_cv_.notify_all();
+    for (auto& thread : loader_threads_) {
+        thread.join();
+    }
+    loader_threads_.clear();
     if (enable_executor_) {
-        WakeupExecutor();
-        executor_thread_.join();
+        {
+            std::lock_guard<std::mutex> lock(exec_mutex_);
+            exec_flag_ = true;
+        }
+        exec_cv_.notify_all();
+        for (auto& thread : executor_threads_) {
+            thread.join();
+        }
+        executor_threads_.clear();
     }
 }
 
@@ -98,8 +126,10 @@ Resource::Dump() const {
         {"name", name_},
         {"type", ToString(type_)},
         {"task_average_cost", TaskAvgCost()},
-        {"task_total_cost", total_cost_},
-        {"total_tasks", total_task_},
+        {"task_total_cost", total_cost_.load()},
+        {"total_tasks", total_task_.load()},
+        {"loader_thread_num", loader_thread_num_},
+        {"executor_thread_num", executor_thread_num_},
         {"running", running_},
         {"enable_executor", enable_executor_},
     };
@@ -114,11 +144,35 @@ Resource::NumOfTaskToExec() {
 TaskTableItemPtr
 Resource::pick_task_load() {
     auto indexes = task_table_.PickToLoad(10);
+    if (type_ == ResourceType::CPU) {
+        // search tasks go ahead of index builds, and among them those whose file is already cached cost no
+        // memory and no disk io, load them first
+        auto is_search = [&](uint64_t index) { return task_table_[index]->task->Type() == TaskType::SearchTask; };
+        auto others = std::stable_partition(indexes.begin(), indexes.end(), is_search);
+        std::stable_partition(indexes.begin(), others, [&](uint64_t index) {
+            return std::static_pointer_cast<XSearchTask>(task_table_[index]->task)->IsCached();
+        });
+    }
+
     for (auto index : indexes) {
+        // a search task must get memory budget before it is loaded from disk, otherwise it waits
+        std::shared_ptr<XSearchTask> search_task = nullptr;
+        bool reserved = false;
+        if (type_ == ResourceType::CPU && task_table_[index]->task->Type() == TaskType::SearchTask) {
+            search_task = std::static_pointer_cast<XSearchTask>(task_table_[index]->task);
+            if (!search_task->AdmitLoad(reserved)) {
+                continue;
+            }
+        }
+
         // try to set one task loading, then return
         if (task_table_.Load(index))
             return task_table_.at(index);
-        // else try next
+        // else try next, the reservation is given back only by the loader that made it,
+        // another loader may hold the task already
+        if (reserved) {
+            search_task->ReleaseLoad();
+        }
     }
     return nullptr;
 }
@@ -126,6 +180,13 @@ Resource::pick_task_load() {
 TaskTableItemPtr
 Resource::pick_task_execute() {
     auto indexes = task_table_.PickToExecute(std::numeric_limits<uint64_t>::max());
+    if (type_ == ResourceType::CPU) {
+        // foreground searches go ahead of background index builds
+        std::stable_partition(indexes.begin(), indexes.end(), [&](uint64_t index) {
+            return task_table_[index]->task->Type() == TaskType::SearchTask;
+        });
+    }
+
     for (auto index : indexes) {
         // try to set one task executing, then return
         if (task_table_[index]->task->label()->Type() == TaskLabelType::SPECIFIED_RESOURCE) {
@@ -134,9 +195,14 @@ Resource::pick_task_execute() {
             }
         }
 
+        auto task = task_table_[index]->task;
+        if (!AdmitExecute(task)) {
+            continue;
+        }
         if (task_table_.Execute(index)) {
             return task_table_.at(index);
         }
+        ReleaseExecute(task);
         //        if (task_table_[index]->task->label()->Type() == TaskLabelType::SPECIFIED_RESOURCE) {
         //            if (task_table_.Get(index)->task->path().Current() == task_table_.Get(index)->task->path().Last()
         //            &&
@@ -163,6 +229,10 @@ Resource::loader_function() {
             if (task_item == nullptr) {
                 break;
             }
+            if (loader_thread_num_ > 1) {
+                // let an idle sibling pick the next task while this one is loading
+                WakeupLoader();
+            }
             if (task_item->task->Type() == TaskType::BuildIndexTask && name() == "cpu") {
                 BuildMgrInst::GetInstance()->Take();
                 SERVER_LOG_DEBUG << name() << " load BuildIndexTask";
@@ -182,8 +252,8 @@ Resource::loader_function() {
 }
 
 void
-Resource::executor_function() {
-    if (subscriber_) {
+Resource::executor_function(uint64_t thread_index) {
+    if (thread_index == 0 && subscriber_) {
         auto event = std::make_shared<StartUpEvent>(shared_from_this());
         subscriber_(std::static_pointer_cast<Event>(event));
     }
@@ -197,8 +267,13 @@ Resource::executor_function() {
             if (task_item == nullptr) {
                 break;
             }
+            if (executor_thread_num_ > 1) {
+                // let an idle sibling pick the next task while this one is executing
+                WakeupExecutor();
+            }
             auto start = get_current_timestamp();
             Process(task_item->task);
+            ReleaseExecute(task_item->task);
             auto finish = get_current_timestamp();
             ++total_task_;
             total_cost_ += finish - start;
@@ -207,8 +282,21 @@ Resource::executor_function() {
 
             if (task_item->task->Type() == TaskType::BuildIndexTask) {
                 BuildMgrInst::GetInstance()->Put();
-                ResMgrInst::GetInstance()->GetResource("cpu")->WakeupLoader();
-                ResMgrInst::GetInstance()->GetResource("disk")->WakeupLoader();
+                for (auto& name : {"cpu", "disk"}) {
+                    auto res = ResMgrInst::GetInstance()->GetResource(name);
+                    if (res != nullptr) {
+                        res->WakeupLoader();
+                    }
+                }
+            }
+
+            // memory held by a search load is free now, tasks waiting for budget may be loaded
+            if (task_item->task->Type() == TaskType::SearchTask &&
+                std::static_pointer_cast<XSearchTask>(task_item->task)->ReleaseLoad()) {
+                auto cpu = ResMgrInst::GetInstance()->GetResource("cpu");
+                if (cpu != nullptr) {
+                    cpu->WakeupLoader();
+                }
             }
 
             if (subscriber_) {
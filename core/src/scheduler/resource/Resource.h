@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -54,6 +55,14 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     void
     Stop();
 
+    /*
+     * Set number of loader and executor threads, must be called before Start();
+     * Threads pick tasks from the same task table, so an idle thread takes over
+     * any task its siblings have not claimed yet;
+     */
+    void
+    SetThreadNum(uint64_t loader_num, uint64_t executor_num);
+
     /*
      * wake up loader;
      */
@@ -101,6 +110,11 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
         return enable_executor_;
     }
 
+    inline uint64_t
+    ExecutorThreadNum() const {
+        return executor_thread_num_;
+    }
+
     // TODO(wxyu): const
     uint64_t
     NumOfTaskToExec();
@@ -139,6 +153,18 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
     virtual void
     Process(TaskPtr task) = 0;
 
+    /*
+     * Whether task may start executing now, an admitted task is released after Process();
+     */
+    virtual bool
+    AdmitExecute(const TaskPtr& task) {
+        return true;
+    }
+
+    virtual void
+    ReleaseExecute(const TaskPtr& task) {
+    }
+
  private:
     /*
      * Pick one task to load;
@@ -165,7 +191,7 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
      * Only called by worker thread;
      */
     void
-    executor_function();
+    executor_function(uint64_t thread_index);
 
  protected:
     uint64_t device_id_;
@@ -176,15 +202,17 @@ class Resource : public Node, public std::enable_shared_from_this<Resource> {
 
     TaskTable task_table_;
 
-    uint64_t total_cost_ = 0;
-    uint64_t total_task_ = 0;
+    std::atomic<uint64_t> total_cost_{0};
+    std::atomic<uint64_t> total_task_{0};
 
     std::function<void(EventPtr)> subscriber_ = nullptr;
 
     bool running_ = false;
     bool enable_executor_ = true;
-    std::thread loader_thread_;
-    std::thread executor_thread_;
+    uint64_t loader_thread_num_ = 1;
+    uint64_t executor_thread_num_ = 1;
+    std::vector<std::thread> loader_threads_;
+    std::vector<std::thread> executor_threads_;
 
     bool load_flag_ = false;
     bool exec_flag_ = false;
@@ -19,9 +19,11 @@
 
 #include <fiu-local.h>
 #include <memory>
+#include <shared_mutex>
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 namespace milvus {
 namespace scheduler {
@@ -30,7 +32,8 @@ XBuildIndexTask::XBuildIndexTask(TableFileSchemaPtr file, TaskLabelPtr label)
     : Task(TaskType::BuildIndexTask, std::move(label)), file_(file) {
     if (file_) {
         to_index_engine_ = EngineFactory::Build(file_->dimension_, file_->location_, (EngineType)file_->engine_type_,
-                                                (MetricType)file_->metric_type_, file_->nlist_);
+                                                (MetricType)file_->metric_type_, file_->nlist_,
+                                                file_->table_created_on_);
     }
 }
 
@@ -200,7 +203,23 @@ XBuildIndexTask::Execute() {
         engine::meta::TableFilesSchema update_files = {table_file, origin_file};
 
         if (status.ok()) {  // makesure index file is sucessfully serialized to disk
-            status = meta_ptr->UpdateTableFiles(update_files);
+            // vectors deleted from the raw file during the build are deleted from the index before it replaces
+            // the raw file, no deletion runs until the meta is updated
+            std::shared_lock<std::shared_timed_mutex> deletion_lock;
+            if (build_index_job->deletion_mutex() != nullptr) {
+                deletion_lock = std::shared_lock<std::shared_timed_mutex>(*build_index_job->deletion_mutex());
+            }
+            std::vector<int64_t> deleted_ids;
+            int64_t deleted_count = 0;
+            status = to_index_engine_->GetDeletedIds(deleted_ids);
+            if (status.ok() && !deleted_ids.empty()) {
+                status = index->DeleteIds(deleted_ids, deleted_count);
+            }
+
+            // concurrent builds commit their files together
+            if (status.ok()) {
+                status = meta_ptr->UpdateTableFilesAsync(update_files).get();
+            }
         }
 
         fiu_do_on("XBuildIndexTask.Execute.update_table_file_fail", status = Status(SERVER_UNEXPECTED_ERROR, ""));
@@ -11,17 +11,21 @@
 
 #include <fiu-local.h>
 #include <algorithm>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <thread>
 #include <utility>
 
+#include "cache/CpuCacheMgr.h"
 #include "db/engine/EngineFactory.h"
 #include "metrics/Metrics.h"
 #include "scheduler/SchedInst.h"
 #include "scheduler/job/SearchJob.h"
 #include "scheduler/task/SearchTask.h"
 #include "utils/Log.h"
+#include "utils/ThreadPool.h"
 #include "utils/TimeRecorder.h"
 
 namespace milvus {
@@ -30,48 +34,48 @@ namespace scheduler {
 static constexpr size_t PARALLEL_REDUCE_THRESHOLD = 10000;
 static constexpr size_t PARALLEL_REDUCE_BATCH = 1000;
 
-// TODO(wxyu): remove unused code
-// bool
-// NeedParallelReduce(uint64_t nq, uint64_t topk) {
-//    server::ServerConfig &config = server::ServerConfig::GetInstance();
-//    server::ConfigNode &db_config = config.GetConfig(server::CONFIG_DB);
-//    bool need_parallel = db_config.GetBoolValue(server::CONFIG_DB_PARALLEL_REDUCE, false);
-//    if (!need_parallel) {
-//        return false;
-//    }
-//
-//    return nq * topk >= PARALLEL_REDUCE_THRESHOLD;
-//}
-//
-// void
-// ParallelReduce(std::function<void(size_t, size_t)> &reduce_function, size_t max_index) {
-//    size_t reduce_batch = PARALLEL_REDUCE_BATCH;
-//
-//    auto thread_count = std::thread::hardware_concurrency() - 1; //not all core do this work
-//    if (thread_count > 0) {
-//        reduce_batch = max_index / thread_count + 1;
-//    }
-//    ENGINE_LOG_DEBUG << "use " << thread_count <<
-//                     " thread parallelly do reduce, each thread process " << reduce_batch << " vectors";
-//
-//    std::vector<std::shared_ptr<std::thread> > thread_array;
-//    size_t from_index = 0;
-//    while (from_index < max_index) {
-//        size_t to_index = from_index + reduce_batch;
-//        if (to_index > max_index) {
-//            to_index = max_index;
-//        }
-//
-//        auto reduce_thread = std::make_shared<std::thread>(reduce_function, from_index, to_index);
-//        thread_array.push_back(reduce_thread);
-//
-//        from_index = to_index;
-//    }
-//
-//    for (auto &thread_ptr : thread_array) {
-//        thread_ptr->join();
-//    }
-//}
+bool
+NeedParallelReduce(uint64_t nq, uint64_t topk) {
+    return nq > 1 && nq * topk >= PARALLEL_REDUCE_THRESHOLD;
+}
+
+ThreadPool&
+ReduceThreadPool() {
+    static ThreadPool pool(std::max(1U, std::min(std::thread::hardware_concurrency(), (unsigned)MAX_THREADS_NUM)));
+    return pool;
+}
+
+void
+ParallelReduce(const std::function<void(size_t, size_t)>& reduce_function, size_t max_index) {
+    size_t reduce_batch = PARALLEL_REDUCE_BATCH;
+
+    auto thread_count = std::thread::hardware_concurrency();
+    if (thread_count > 1) {
+        reduce_batch = max_index / thread_count + 1;
+    }
+    ENGINE_LOG_DEBUG << "use " << thread_count << " thread parallelly do reduce, each thread process "
+                     << reduce_batch << " vectors";
+
+    std::vector<std::future<void>> futures;
+    size_t from_index = reduce_batch;
+    while (from_index < max_index) {
+        size_t to_index = from_index + reduce_batch;
+        if (to_index > max_index) {
+            to_index = max_index;
+        }
+
+        futures.emplace_back(ReduceThreadPool().enqueue(reduce_function, from_index, to_index));
+
+        from_index = to_index;
+    }
+
+    // the first batch is done by current thread
+    reduce_function(0, std::min(reduce_batch, max_index));
+
+    for (auto& future : futures) {
+        future.wait();
+    }
+}
 
 void
 CollectFileMetrics(int file_type, size_t file_size) {
@@ -93,23 +97,94 @@ CollectFileMetrics(int file_type, size_t file_size) {
     }
 }
 
-XSearchTask::XSearchTask(const std::shared_ptr<server::Context>& context, TableFileSchemaPtr file, TaskLabelPtr label)
-    : Task(TaskType::SearchTask, std::move(label)), context_(context), file_(file) {
+XSearchTask::XSearchTask(const std::shared_ptr<server::Context>& context, TableFileSchemaPtr file, TaskLabelPtr label,
+                         engine::MemTableFilePtr mem_file)
+    : Task(TaskType::SearchTask, std::move(label)), context_(context), file_(file), mem_file_(std::move(mem_file)) {
     if (file_) {
         // distance -- value 0 means two vectors equal, ascending reduce, L2/HAMMING/JACCARD/TONIMOTO ...
         // similarity -- infinity value means two vectors equal, descending reduce, IP
         if (file_->metric_type_ == static_cast<int>(MetricType::IP)) {
             ascending_reduce = false;
         }
+        if (mem_file_ != nullptr) {
+            return;
+        }
         index_engine_ = EngineFactory::Build(file_->dimension_, file_->location_, (EngineType)file_->engine_type_,
-                                             (MetricType)file_->metric_type_, file_->nlist_);
+                                             (MetricType)file_->metric_type_, file_->nlist_, file_->table_created_on_);
+    }
+}
+
+XSearchTask::~XSearchTask() {
+    ReleaseLoad();
+
+    std::lock_guard<std::mutex> lock(load_budget_mutex_);
+    if (load_wait_begin_ != 0) {
+        LoadMgrInst::GetInstance()->WaitEnd(get_current_timestamp() - load_wait_begin_);
+        load_wait_begin_ = 0;
+    }
+}
+
+bool
+XSearchTask::IsCached() {
+    if (mem_file_ != nullptr || file_ == nullptr) {
+        return true;
+    }
+    return cache::CpuCacheMgr::GetInstance()->ItemExists(file_->location_);
+}
+
+bool
+XSearchTask::AdmitLoad(bool& reserved) {
+    std::lock_guard<std::mutex> lock(load_budget_mutex_);
+    reserved = false;
+    if (load_admitted_) {
+        return true;
+    }
+
+    int64_t size = IsCached() ? 0 : static_cast<int64_t>(file_->file_size_);
+    auto load_mgr = LoadMgrInst::GetInstance();
+    if (!load_mgr->Reserve(size)) {
+        if (load_wait_begin_ == 0) {
+            load_wait_begin_ = get_current_timestamp();
+            load_mgr->WaitBegin();
+        }
+        return false;
+    }
+
+    if (load_wait_begin_ != 0) {
+        load_mgr->WaitEnd(get_current_timestamp() - load_wait_begin_);
+        load_wait_begin_ = 0;
+    }
+    load_admitted_ = true;
+    load_reserved_ = size;
+    reserved = true;
+    return true;
+}
+
+bool
+XSearchTask::ReleaseLoad() {
+    std::lock_guard<std::mutex> lock(load_budget_mutex_);
+    load_admitted_ = false;
+    if (load_reserved_ <= 0) {
+        return false;
     }
+
+    LoadMgrInst::GetInstance()->Release(load_reserved_);
+    load_reserved_ = 0;
+    return true;
 }
 
 void
 XSearchTask::Load(LoadType type, uint8_t device_id) {
     auto load_ctx = context_->Follower("XSearchTask::Load " + std::to_string(file_->id_));
 
+    if (mem_file_ != nullptr) {
+        // insert buffer is already in memory
+        index_id_ = file_->id_;
+        index_type_ = file_->file_type_;
+        load_ctx->GetTraceContext()->GetSpan()->Finish();
+        return;
+    }
+
     TimeRecorder rc("");
     Status stat = Status::OK();
     std::string error_msg;
@@ -184,7 +259,7 @@ void
 XSearchTask::Execute() {
     auto execute_ctx = context_->Follower("XSearchTask::Execute " + std::to_string(index_id_));
 
-    if (index_engine_ == nullptr) {
+    if (index_engine_ == nullptr && mem_file_ == nullptr) {
         return;
     }
 
@@ -198,8 +273,10 @@ XSearchTask::Execute() {
     std::vector<int64_t> output_ids;
     std::vector<float> output_distance;
 
-    if (auto job = job_.lock()) {
-        auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job);
+    auto search_job = std::static_pointer_cast<scheduler::SearchJob>(job_.lock());
+    if (search_job != nullptr && search_job->range_search()) {
+        ExecuteRangeSearch(search_job);
+    } else if (search_job != nullptr) {
         // step 1: allocate memory
         uint64_t nq = search_job->nq();
         uint64_t topk = search_job->topk();
@@ -214,18 +291,51 @@ XSearchTask::Execute() {
         try {
             fiu_do_on("XSearchTask.Execute.throw_std_exception", throw std::exception());
             // step 2: search
-            bool hybrid = false;
-            if (index_engine_->IndexEngineType() == engine::EngineType::FAISS_IVFSQ8H &&
-                ResMgrInst::GetInstance()->GetResource(path().Last())->type() == ResourceType::CPU) {
-                hybrid = true;
-            }
             Status s;
-            if (!vectors.float_data_.empty()) {
-                s = index_engine_->Search(nq, vectors.float_data_.data(), topk, nprobe, output_distance.data(),
-                                          output_ids.data(), hybrid);
-            } else if (!vectors.binary_data_.empty()) {
-                s = index_engine_->Search(nq, vectors.binary_data_.data(), topk, nprobe, output_distance.data(),
-                                          output_ids.data(), hybrid);
+            size_t row_count = 0;
+            if (mem_file_ != nullptr) {
+                // rows are only appended, count before search so that every picked result is valid
+                row_count = mem_file_->RowCount();
+                if (!vectors.float_data_.empty()) {
+                    s = mem_file_->Search(nq, vectors.float_data_.data(), topk, nprobe, output_distance.data(),
+                                          output_ids.data());
+                } else if (!vectors.binary_data_.empty()) {
+                    s = mem_file_->Search(nq, vectors.binary_data_.data(), topk, nprobe, output_distance.data(),
+                                          output_ids.data());
+                }
+            } else {
+                bool hybrid = false;
+                if (index_engine_->IndexEngineType() == engine::EngineType::FAISS_IVFSQ8H &&
+                    ResMgrInst::GetInstance()->GetResource(path().Last())->type() == ResourceType::CPU) {
+                    hybrid = true;
+                }
+                row_count = index_engine_->Count();
+                if (!vectors.float_data_.empty()) {
+                    // results that can't beat the k-th distance found in finished files are skipped
+                    std::vector<float> distance_bound;
+                    bool bounded = search_job->GetDistanceBound(distance_bound);
+                    index_engine_->SetDistanceBound(bounded ? distance_bound.data() : nullptr);
+                    index_engine_->SetRefineFactor(search_job->refine_factor());
+                    s = index_engine_->Search(nq, vectors.float_data_.data(), topk, nprobe, output_distance.data(),
+                                              output_ids.data(), hybrid);
+                    index_engine_->SetDistanceBound(nullptr);
+                    if (bounded && s.ok() && row_count >= topk) {
+                        // a query may miss up to deleted_count results because of deletions, count the
+                        // empty slots they can explain apart from the ones left by the bound
+                        int64_t deleted_count = index_engine_->DeletedCount();
+                        int64_t pruned = 0, deleted = 0;
+                        for (uint64_t i = 0; i < nq; ++i) {
+                            int64_t empty = std::count(output_ids.begin() + i * topk,
+                                                       output_ids.begin() + (i + 1) * topk, -1);
+                            deleted += std::min(empty, deleted_count);
+                            pruned += empty - std::min(empty, deleted_count);
+                        }
+                        search_job->AddPrunedCount(pruned, deleted);
+                    }
+                } else if (!vectors.binary_data_.empty()) {
+                    s = index_engine_->Search(nq, vectors.binary_data_.data(), topk, nprobe, output_distance.data(),
+                                              output_ids.data(), hybrid);
+                }
             }
             fiu_do_on("XSearchTask.Execute.search_fail", s = Status(SERVER_UNEXPECTED_ERROR, ""));
 
@@ -238,13 +348,9 @@ XSearchTask::Execute() {
             double span = rc.RecordSection(hdr + ", do search");
             //            search_job->AccumSearchCost(span);
 
-            // step 3: pick up topk result
-            auto spec_k = index_engine_->Count() < topk ? index_engine_->Count() : topk;
-            {
-                std::unique_lock<std::mutex> lock(search_job->mutex());
-                XSearchTask::MergeTopkToResultSet(output_ids, output_distance, spec_k, nq, topk, ascending_reduce,
-                                                  search_job->GetResultIds(), search_job->GetResultDistances());
-            }
+            // step 3: merge private result into the result of the job
+            auto spec_k = row_count < topk ? row_count : topk;
+            search_job->AddTaskResult(output_ids, output_distance, spec_k, ascending_reduce);
 
             span = rc.RecordSection(hdr + ", reduce topk");
             //            search_job->AccumReduceCost(span);
@@ -261,10 +367,49 @@ XSearchTask::Execute() {
 
     // release index in resource
     index_engine_ = nullptr;
+    mem_file_ = nullptr;
 
     execute_ctx->GetTraceContext()->GetSpan()->Finish();
 }
 
+void
+XSearchTask::ExecuteRangeSearch(const SearchJobPtr& search_job) {
+    uint64_t nq = search_job->nq();
+    float radius = search_job->radius();
+    uint64_t nprobe = search_job->nprobe();
+    const engine::VectorsData& vectors = search_job->vectors();
+
+    std::vector<int64_t> lims;
+    std::vector<int64_t> output_ids;
+    std::vector<float> output_distance;
+
+    try {
+        Status s;
+        if (vectors.float_data_.empty()) {
+            s = Status(SERVER_INVALID_ARGUMENT, "Range search only supports float vectors");
+        } else if (mem_file_ != nullptr) {
+            s = mem_file_->RangeSearch(nq, vectors.float_data_.data(), radius, nprobe, lims, output_ids,
+                                       output_distance);
+        } else {
+            bool hybrid = index_engine_->IndexEngineType() == engine::EngineType::FAISS_IVFSQ8H &&
+                          ResMgrInst::GetInstance()->GetResource(path().Last())->type() == ResourceType::CPU;
+            s = index_engine_->RangeSearch(nq, vectors.float_data_.data(), radius, nprobe, lims, output_ids,
+                                           output_distance, hybrid);
+        }
+
+        if (s.ok()) {
+            search_job->AddRangeTaskResult(lims, output_ids, output_distance);
+        } else {
+            search_job->GetStatus() = s;
+        }
+    } catch (std::exception& ex) {
+        ENGINE_LOG_ERROR << "SearchTask encounter exception: " << ex.what();
+        search_job->GetStatus() = Status(SERVER_UNEXPECTED_ERROR, ex.what());
+    }
+
+    search_job->SearchDone(index_id_);
+}
+
 void
 XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const scheduler::ResultDistances& src_distances,
                                   size_t src_k, size_t nq, size_t topk, bool ascending, scheduler::ResultIds& tar_ids,
@@ -331,6 +476,57 @@ XSearchTask::MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const sch
     tar_distances.swap(buf_distances);
 }
 
+size_t
+XSearchTask::MergeTopkResults(const scheduler::ResultIds& src_ids, const scheduler::ResultDistances& src_distances,
+                              size_t src_k, size_t nq, size_t topk, bool ascending, size_t tar_k,
+                              scheduler::ResultIds& tar_ids, scheduler::ResultDistances& tar_distances,
+                              scheduler::ResultIds& buf_ids, scheduler::ResultDistances& buf_distances) {
+    size_t buf_k = std::min(topk, src_k + tar_k);
+    if (nq == 0 || src_k == 0) {
+        return tar_k;
+    }
+
+    auto reduce_function = [&](size_t from_index, size_t to_index) {
+        for (size_t i = from_index; i < to_index; i++) {
+            size_t offset = i * topk;
+            size_t src_j = 0, tar_j = 0;
+            for (size_t buf_j = 0; buf_j < buf_k; buf_j++) {
+                size_t buf_idx = offset + buf_j;
+                bool take_src;
+                if (src_j >= src_k) {
+                    take_src = false;
+                } else if (tar_j >= tar_k) {
+                    take_src = true;
+                } else {
+                    float src_distance = src_distances[offset + src_j];
+                    float tar_distance = tar_distances[offset + tar_j];
+                    take_src = ascending ? src_distance < tar_distance : src_distance > tar_distance;
+                }
+
+                if (take_src) {
+                    buf_ids[buf_idx] = src_ids[offset + src_j];
+                    buf_distances[buf_idx] = src_distances[offset + src_j];
+                    src_j++;
+                } else {
+                    buf_ids[buf_idx] = tar_ids[offset + tar_j];
+                    buf_distances[buf_idx] = tar_distances[offset + tar_j];
+                    tar_j++;
+                }
+            }
+        }
+    };
+
+    if (NeedParallelReduce(nq, buf_k)) {
+        ParallelReduce(reduce_function, nq);
+    } else {
+        reduce_function(0, nq);
+    }
+
+    tar_ids.swap(buf_ids);
+    tar_distances.swap(buf_distances);
+    return buf_k;
+}
+
 // void
 // XSearchTask::MergeTopkArray(std::vector<int64_t>& tar_ids, std::vector<float>& tar_distance, uint64_t& tar_input_k,
 //                            const std::vector<int64_t>& src_ids, const std::vector<float>& src_distance,
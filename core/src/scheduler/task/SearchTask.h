@@ -12,6 +12,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "Task.h"
@@ -24,7 +25,8 @@ namespace scheduler {
 // TODO(wxyu): rewrite
 class XSearchTask : public Task {
  public:
-    explicit XSearchTask(const std::shared_ptr<server::Context>& context, TableFileSchemaPtr file, TaskLabelPtr label);
+    explicit XSearchTask(const std::shared_ptr<server::Context>& context, TableFileSchemaPtr file, TaskLabelPtr label,
+                         engine::MemTableFilePtr mem_file = nullptr);
 
     void
     Load(LoadType type, uint8_t device_id) override;
@@ -32,12 +34,37 @@ class XSearchTask : public Task {
     void
     Execute() override;
 
+    ~XSearchTask();
+
+    // reserve memory budget for the DISK2CPU load of this task, false means the task must wait;
+    // cached files and in-memory insert buffers need no budget.
+    // reserved is set only when this call made the reservation, its caller is the one to release it
+    bool
+    AdmitLoad(bool& reserved);
+
+    // give back the budget and the admission, return true if anything was released
+    bool
+    ReleaseLoad();
+
+    // the file of this task is already in cpu cache, loading it is free
+    bool
+    IsCached();
+
  public:
     static void
     MergeTopkToResultSet(const scheduler::ResultIds& src_ids, const scheduler::ResultDistances& src_distances,
                          size_t src_k, size_t nq, size_t topk, bool ascending, scheduler::ResultIds& tar_ids,
                          scheduler::ResultDistances& tar_distances);
 
+    // merge src_k results per query into the tar_k results of tar, both keep topk slots per query; the merge is
+    // written into the preallocated buf of the same size which is then swapped with tar, return the merged k;
+    // queries are striped over the reduce thread pool when the result set is large
+    static size_t
+    MergeTopkResults(const scheduler::ResultIds& src_ids, const scheduler::ResultDistances& src_distances,
+                     size_t src_k, size_t nq, size_t topk, bool ascending, size_t tar_k, scheduler::ResultIds& tar_ids,
+                     scheduler::ResultDistances& tar_distances, scheduler::ResultIds& buf_ids,
+                     scheduler::ResultDistances& buf_distances);
+
     //    static void
     //    MergeTopkArray(std::vector<int64_t>& tar_ids, std::vector<float>& tar_distance, uint64_t& tar_input_k,
     //                   const std::vector<int64_t>& src_ids, const std::vector<float>& src_distance, uint64_t
@@ -52,9 +79,23 @@ class XSearchTask : public Task {
     int index_type_ = 0;
     ExecutionEnginePtr index_engine_ = nullptr;
 
+    // not null if the file is an in-memory insert buffer, it is searched in place without loading
+    engine::MemTableFilePtr mem_file_ = nullptr;
+
     // distance -- value 0 means two vectors equal, ascending reduce, L2/HAMMING/JACCARD/TONIMOTO ...
     // similarity -- infinity value means two vectors equal, descending reduce, IP
     bool ascending_reduce = true;
+
+ private:
+    // search the file for all vectors within the radius of the job, the result keeps its variable length
+    void
+    ExecuteRangeSearch(const SearchJobPtr& search_job);
+
+ private:
+    std::mutex load_budget_mutex_;
+    bool load_admitted_ = false;
+    int64_t load_reserved_ = 0;
+    uint64_t load_wait_begin_ = 0;  // ms timestamp of the first refused admission, 0 if not waiting
 };
 
 }  // namespace scheduler
@@ -35,6 +35,30 @@ constexpr int64_t GB = 1UL << 30;
 
 static const std::unordered_map<std::string, std::string> milvus_config_version_map({{"0.6.0", "0.1"}});
 
+// value must be an integer in [1, system cpu cores]
+static Status
+CheckThreadNumInCpuRange(const std::string& value, const std::string& desc, const std::string& key) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg =
+            "Invalid " + desc + ": " + value + ". Possible reason: " + key + " is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t thread_num = std::stoll(value);
+    if (thread_num < 1) {
+        std::string msg = "Invalid " + desc + ": " + value + ". Possible reason: " + key + " must be at least 1.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t sys_thread_cnt = 8;
+    CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+    if (thread_num > sys_thread_cnt) {
+        std::string msg = "Invalid " + desc + ": " + value + ". Possible reason: " + key + " exceeds system cpu cores.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 Config&
 Config::GetInstance() {
     static Config config_inst;
@@ -93,6 +117,27 @@ Config::ValidateConfig() {
     int64_t db_archive_days_threshold;
     CONFIG_CHECK(GetDBConfigArchiveDaysThreshold(db_archive_days_threshold));
 
+    std::string db_compaction_policy;
+    CONFIG_CHECK(GetDBConfigCompactionPolicy(db_compaction_policy));
+
+    int64_t db_compaction_fan_in;
+    CONFIG_CHECK(GetDBConfigCompactionFanIn(db_compaction_fan_in));
+
+    double db_compaction_write_amp;
+    CONFIG_CHECK(GetDBConfigCompactionWriteAmp(db_compaction_write_amp));
+
+    int64_t db_compaction_throttle;
+    CONFIG_CHECK(GetDBConfigCompactionThrottle(db_compaction_throttle));
+
+    float db_compaction_deleted_ratio;
+    CONFIG_CHECK(GetDBConfigCompactionDeletedRatio(db_compaction_deleted_ratio));
+
+    bool db_meta_cache_enable;
+    CONFIG_CHECK(GetDBConfigMetaCacheEnable(db_meta_cache_enable));
+
+    int64_t db_meta_commit_delay;
+    CONFIG_CHECK(GetDBConfigMetaCommitDelay(db_meta_commit_delay));
+
     /* storage config */
     std::string storage_primary_path;
     CONFIG_CHECK(GetStorageConfigPrimaryPath(storage_primary_path));
@@ -100,6 +145,9 @@ Config::ValidateConfig() {
     std::string storage_secondary_path;
     CONFIG_CHECK(GetStorageConfigSecondaryPath(storage_secondary_path));
 
+    bool storage_file_mmap_enable;
+    CONFIG_CHECK(GetStorageConfigFileMmapEnable(storage_file_mmap_enable));
+
     bool storage_s3_enable;
     CONFIG_CHECK(GetStorageConfigS3Enable(storage_s3_enable));
     std::cout << "S3 " << (storage_s3_enable ? "ENABLED !" : "DISABLED !") << std::endl;
@@ -119,6 +167,12 @@ Config::ValidateConfig() {
     std::string storage_s3_bucket;
     CONFIG_CHECK(GetStorageConfigS3Bucket(storage_s3_bucket));
 
+    std::string storage_s3_cache_path;
+    CONFIG_CHECK(GetStorageConfigS3CachePath(storage_s3_cache_path));
+
+    int64_t storage_s3_cache_capacity;
+    CONFIG_CHECK(GetStorageConfigS3CacheCapacity(storage_s3_cache_capacity));
+
     /* metric config */
     bool metric_enable_monitor;
     CONFIG_CHECK(GetMetricConfigEnableMonitor(metric_enable_monitor));
@@ -136,12 +190,18 @@ Config::ValidateConfig() {
     float cache_cpu_cache_threshold;
     CONFIG_CHECK(GetCacheConfigCpuCacheThreshold(cache_cpu_cache_threshold));
 
+    std::string cache_cpu_cache_policy;
+    CONFIG_CHECK(GetCacheConfigCpuCachePolicy(cache_cpu_cache_policy));
+
     int64_t cache_insert_buffer_size;
     CONFIG_CHECK(GetCacheConfigInsertBufferSize(cache_insert_buffer_size));
 
     bool cache_insert_data;
     CONFIG_CHECK(GetCacheConfigCacheInsertData(cache_insert_data));
 
+    bool cache_warm_start_enable;
+    CONFIG_CHECK(GetCacheConfigWarmStartEnable(cache_warm_start_enable));
+
     /* engine config */
     int64_t engine_use_blas_threshold;
     CONFIG_CHECK(GetEngineConfigUseBlasThreshold(engine_use_blas_threshold));
@@ -149,6 +209,36 @@ Config::ValidateConfig() {
     int64_t engine_omp_thread_num;
     CONFIG_CHECK(GetEngineConfigOmpThreadNum(engine_omp_thread_num));
 
+    int64_t engine_executor_thread_num;
+    CONFIG_CHECK(GetEngineConfigExecutorThreadNum(engine_executor_thread_num));
+
+    int64_t engine_loader_thread_num;
+    CONFIG_CHECK(GetEngineConfigLoaderThreadNum(engine_loader_thread_num));
+
+    int64_t engine_search_batch_wait;
+    CONFIG_CHECK(GetEngineConfigSearchBatchWait(engine_search_batch_wait));
+
+    int64_t engine_search_batch_max_nq;
+    CONFIG_CHECK(GetEngineConfigSearchBatchMaxNq(engine_search_batch_max_nq));
+
+    int64_t engine_max_range_results;
+    CONFIG_CHECK(GetEngineConfigMaxRangeResults(engine_max_range_results));
+
+    bool engine_share_ivf_quantizer;
+    CONFIG_CHECK(GetEngineConfigShareIvfQuantizer(engine_share_ivf_quantizer));
+
+    int64_t engine_preload_thread_num;
+    CONFIG_CHECK(GetEngineConfigPreloadThreadNum(engine_preload_thread_num));
+
+    int64_t engine_build_parallel_num;
+    CONFIG_CHECK(GetEngineConfigBuildParallelNum(engine_build_parallel_num));
+
+    int64_t engine_build_omp_thread_num;
+    CONFIG_CHECK(GetEngineConfigBuildOmpThreadNum(engine_build_omp_thread_num));
+
+    int64_t engine_flush_thread_num;
+    CONFIG_CHECK(GetEngineConfigFlushThreadNum(engine_flush_thread_num));
+
 #ifdef MILVUS_GPU_VERSION
     int64_t engine_gpu_search_threshold;
     CONFIG_CHECK(GetEngineConfigGpuSearchThreshold(engine_gpu_search_threshold));
@@ -195,16 +285,26 @@ Config::ResetDefaultConfig() {
     CONFIG_CHECK(SetDBConfigBackendUrl(CONFIG_DB_BACKEND_URL_DEFAULT));
     CONFIG_CHECK(SetDBConfigArchiveDiskThreshold(CONFIG_DB_ARCHIVE_DISK_THRESHOLD_DEFAULT));
     CONFIG_CHECK(SetDBConfigArchiveDaysThreshold(CONFIG_DB_ARCHIVE_DAYS_THRESHOLD_DEFAULT));
+    CONFIG_CHECK(SetDBConfigCompactionPolicy(CONFIG_DB_COMPACTION_POLICY_DEFAULT));
+    CONFIG_CHECK(SetDBConfigCompactionFanIn(CONFIG_DB_COMPACTION_FAN_IN_DEFAULT));
+    CONFIG_CHECK(SetDBConfigCompactionWriteAmp(CONFIG_DB_COMPACTION_WRITE_AMP_DEFAULT));
+    CONFIG_CHECK(SetDBConfigCompactionThrottle(CONFIG_DB_COMPACTION_THROTTLE_DEFAULT));
+    CONFIG_CHECK(SetDBConfigCompactionDeletedRatio(CONFIG_DB_COMPACTION_DELETED_RATIO_DEFAULT));
+    CONFIG_CHECK(SetDBConfigMetaCacheEnable(CONFIG_DB_META_CACHE_ENABLE_DEFAULT));
+    CONFIG_CHECK(SetDBConfigMetaCommitDelay(CONFIG_DB_META_COMMIT_DELAY_DEFAULT));
 
     /* storage config */
     CONFIG_CHECK(SetStorageConfigPrimaryPath(CONFIG_STORAGE_PRIMARY_PATH_DEFAULT));
     CONFIG_CHECK(SetStorageConfigSecondaryPath(CONFIG_STORAGE_SECONDARY_PATH_DEFAULT));
+    CONFIG_CHECK(SetStorageConfigFileMmapEnable(CONFIG_STORAGE_FILE_MMAP_ENABLE_DEFAULT));
     CONFIG_CHECK(SetStorageConfigS3Enable(CONFIG_STORAGE_S3_ENABLE_DEFAULT));
     CONFIG_CHECK(SetStorageConfigS3Address(CONFIG_STORAGE_S3_ADDRESS_DEFAULT));
     CONFIG_CHECK(SetStorageConfigS3Port(CONFIG_STORAGE_S3_PORT_DEFAULT));
     CONFIG_CHECK(SetStorageConfigS3AccessKey(CONFIG_STORAGE_S3_ACCESS_KEY_DEFAULT));
     CONFIG_CHECK(SetStorageConfigS3SecretKey(CONFIG_STORAGE_S3_SECRET_KEY_DEFAULT));
     CONFIG_CHECK(SetStorageConfigS3Bucket(CONFIG_STORAGE_S3_BUCKET_DEFAULT));
+    CONFIG_CHECK(SetStorageConfigS3CachePath(CONFIG_STORAGE_S3_CACHE_PATH_DEFAULT));
+    CONFIG_CHECK(SetStorageConfigS3CacheCapacity(CONFIG_STORAGE_S3_CACHE_CAPACITY_DEFAULT));
 
     /* metric config */
     CONFIG_CHECK(SetMetricConfigEnableMonitor(CONFIG_METRIC_ENABLE_MONITOR_DEFAULT));
@@ -214,12 +314,24 @@ Config::ResetDefaultConfig() {
     /* cache config */
     CONFIG_CHECK(SetCacheConfigCpuCacheCapacity(CONFIG_CACHE_CPU_CACHE_CAPACITY_DEFAULT));
     CONFIG_CHECK(SetCacheConfigCpuCacheThreshold(CONFIG_CACHE_CPU_CACHE_THRESHOLD_DEFAULT));
+    CONFIG_CHECK(SetCacheConfigCpuCachePolicy(CONFIG_CACHE_CPU_CACHE_POLICY_DEFAULT));
     CONFIG_CHECK(SetCacheConfigInsertBufferSize(CONFIG_CACHE_INSERT_BUFFER_SIZE_DEFAULT));
     CONFIG_CHECK(SetCacheConfigCacheInsertData(CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT));
+    CONFIG_CHECK(SetCacheConfigWarmStartEnable(CONFIG_CACHE_WARM_START_ENABLE_DEFAULT));
 
     /* engine config */
     CONFIG_CHECK(SetEngineConfigUseBlasThreshold(CONFIG_ENGINE_USE_BLAS_THRESHOLD_DEFAULT));
     CONFIG_CHECK(SetEngineConfigOmpThreadNum(CONFIG_ENGINE_OMP_THREAD_NUM_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigExecutorThreadNum(CONFIG_ENGINE_EXECUTOR_THREAD_NUM_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigLoaderThreadNum(CONFIG_ENGINE_LOADER_THREAD_NUM_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigSearchBatchWait(CONFIG_ENGINE_SEARCH_BATCH_WAIT_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigSearchBatchMaxNq(CONFIG_ENGINE_SEARCH_BATCH_MAX_NQ_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigMaxRangeResults(CONFIG_ENGINE_MAX_RANGE_RESULTS_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigShareIvfQuantizer(CONFIG_ENGINE_SHARE_IVF_QUANTIZER_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigPreloadThreadNum(CONFIG_ENGINE_PRELOAD_THREAD_NUM_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigBuildParallelNum(CONFIG_ENGINE_BUILD_PARALLEL_NUM_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigBuildOmpThreadNum(CONFIG_ENGINE_BUILD_OMP_THREAD_NUM_DEFAULT));
+    CONFIG_CHECK(SetEngineConfigFlushThreadNum(CONFIG_ENGINE_FLUSH_THREAD_NUM_DEFAULT));
 #ifdef MILVUS_GPU_VERSION
     CONFIG_CHECK(SetEngineConfigGpuSearchThreshold(CONFIG_ENGINE_GPU_SEARCH_THRESHOLD_DEFAULT));
 #endif
@@ -270,8 +382,12 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             return SetCacheConfigCpuCacheCapacity(value);
         } else if (child_key == CONFIG_CACHE_CPU_CACHE_THRESHOLD) {
             return SetCacheConfigCpuCacheThreshold(value);
+        } else if (child_key == CONFIG_CACHE_CPU_CACHE_POLICY) {
+            return SetCacheConfigCpuCachePolicy(value);
         } else if (child_key == CONFIG_CACHE_CACHE_INSERT_DATA) {
             return SetCacheConfigCacheInsertData(value);
+        } else if (child_key == CONFIG_CACHE_WARM_START_ENABLE) {
+            return SetCacheConfigWarmStartEnable(value);
         } else if (child_key == CONFIG_CACHE_INSERT_BUFFER_SIZE) {
             return SetCacheConfigInsertBufferSize(value);
         }
@@ -280,6 +396,26 @@ Config::SetConfigCli(const std::string& parent_key, const std::string& child_key
             return SetEngineConfigUseBlasThreshold(value);
         } else if (child_key == CONFIG_ENGINE_OMP_THREAD_NUM) {
             return SetEngineConfigOmpThreadNum(value);
+        } else if (child_key == CONFIG_ENGINE_EXECUTOR_THREAD_NUM) {
+            return SetEngineConfigExecutorThreadNum(value);
+        } else if (child_key == CONFIG_ENGINE_LOADER_THREAD_NUM) {
+            return SetEngineConfigLoaderThreadNum(value);
+        } else if (child_key == CONFIG_ENGINE_SEARCH_BATCH_WAIT) {
+            return SetEngineConfigSearchBatchWait(value);
+        } else if (child_key == CONFIG_ENGINE_SEARCH_BATCH_MAX_NQ) {
+            return SetEngineConfigSearchBatchMaxNq(value);
+        } else if (child_key == CONFIG_ENGINE_MAX_RANGE_RESULTS) {
+            return SetEngineConfigMaxRangeResults(value);
+        } else if (child_key == CONFIG_ENGINE_SHARE_IVF_QUANTIZER) {
+            return SetEngineConfigShareIvfQuantizer(value);
+        } else if (child_key == CONFIG_ENGINE_PRELOAD_THREAD_NUM) {
+            return SetEngineConfigPreloadThreadNum(value);
+        } else if (child_key == CONFIG_ENGINE_BUILD_PARALLEL_NUM) {
+            return SetEngineConfigBuildParallelNum(value);
+        } else if (child_key == CONFIG_ENGINE_BUILD_OMP_THREAD_NUM) {
+            return SetEngineConfigBuildOmpThreadNum(value);
+        } else if (child_key == CONFIG_ENGINE_FLUSH_THREAD_NUM) {
+            return SetEngineConfigFlushThreadNum(value);
 #ifdef MILVUS_GPU_VERSION
         } else if (child_key == CONFIG_ENGINE_GPU_SEARCH_THRESHOLD) {
             return SetEngineConfigGpuSearchThreshold(value);
@@ -475,6 +611,97 @@ Config::CheckDBConfigArchiveDaysThreshold(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckDBConfigCompactionPolicy(const std::string& value) {
+    fiu_return_on("check_config_compaction_policy_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (value != "simple" && value != "size_tiered") {
+        std::string msg = "Invalid compaction policy: " + value +
+                          ". Possible reason: db_config.compaction_policy is not one of simple and size_tiered.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckDBConfigCompactionFanIn(const std::string& value) {
+    fiu_return_on("check_config_compaction_fan_in_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) < 2) {
+        std::string msg = "Invalid compaction fan in: " + value +
+                          ". Possible reason: db_config.compaction_fan_in is not an integer greater than 1.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckDBConfigCompactionWriteAmp(const std::string& value) {
+    fiu_return_on("check_config_compaction_write_amp_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsFloat(value).ok() || std::stof(value) <= 1.0) {
+        std::string msg = "Invalid compaction write amp: " + value +
+                          ". Possible reason: db_config.compaction_write_amp is not a number greater than 1.0.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckDBConfigCompactionThrottle(const std::string& value) {
+    fiu_return_on("check_config_compaction_throttle_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) < 0) {
+        std::string msg = "Invalid compaction throttle: " + value +
+                          ". Possible reason: db_config.compaction_throttle is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckDBConfigCompactionDeletedRatio(const std::string& value) {
+    fiu_return_on("check_config_compaction_deleted_ratio_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsFloat(value).ok() || std::stof(value) <= 0.0 || std::stof(value) > 1.0) {
+        std::string msg = "Invalid compaction deleted ratio: " + value +
+                          ". Possible reason: db_config.compaction_deleted_ratio is not a number in range (0, 1].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckDBConfigMetaCacheEnable(const std::string& value) {
+    fiu_return_on("check_config_meta_cache_enable_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid db config: " + value +
+                          ". Possible reason: db_config.meta_cache_enable is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckDBConfigMetaCommitDelay(const std::string& value) {
+    fiu_return_on("check_config_meta_commit_delay_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid meta commit delay: " + value +
+                          ". Possible reason: db_config.meta_commit_delay is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t delay = std::stoll(value);
+    if (delay < 0 || delay > 1000) {
+        std::string msg = "Invalid meta commit delay: " + value +
+                          ". Possible reason: db_config.meta_commit_delay is not in range [0, 1000].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 /* storage config */
 Status
 Config::CheckStorageConfigPrimaryPath(const std::string& value) {
@@ -491,6 +718,16 @@ Config::CheckStorageConfigSecondaryPath(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckStorageConfigFileMmapEnable(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid storage config: " + value +
+                          ". Possible reason: storage_config.file_mmap_enable is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckStorageConfigS3Enable(const std::string& value) {
     if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
@@ -550,6 +787,26 @@ Config::CheckStorageConfigS3Bucket(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckStorageConfigS3CachePath(const std::string& value) {
+    if (!value.empty() && value[0] != '/') {
+        std::string msg = "Invalid s3 cache path: " + value +
+                          ". Possible reason: storage_config.s3_cache_path is not an absolute path.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckStorageConfigS3CacheCapacity(const std::string& value) {
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid s3 cache capacity: " + value +
+                          ". Possible reason: storage_config.s3_cache_capacity is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 /* metric config */
 Status
 Config::CheckMetricConfigEnableMonitor(const std::string& value) {
@@ -650,6 +907,18 @@ Config::CheckCacheConfigCpuCacheThreshold(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckCacheConfigCpuCachePolicy(const std::string& value) {
+    fiu_return_on("check_config_cpu_cache_policy_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (value != "lru" && value != "slru") {
+        std::string msg = "Invalid cpu cache policy: " + value +
+                          ". Possible reason: cache_config.cpu_cache_policy is not one of lru and slru.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 Status
 Config::CheckCacheConfigInsertBufferSize(const std::string& value) {
     fiu_return_on("check_config_insert_buffer_size_fail", Status(SERVER_INVALID_ARGUMENT, ""));
@@ -688,6 +957,18 @@ Config::CheckCacheConfigCacheInsertData(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckCacheConfigWarmStartEnable(const std::string& value) {
+    fiu_return_on("check_config_warm_start_enable_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid cache config: " + value +
+                          ". Possible reason: cache_config.warm_start_enable is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 /* engine config */
 Status
 Config::CheckEngineConfigUseBlasThreshold(const std::string& value) {
@@ -722,6 +1003,142 @@ Config::CheckEngineConfigOmpThreadNum(const std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::CheckEngineConfigExecutorThreadNum(const std::string& value) {
+    fiu_return_on("check_config_executor_thread_num_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    return CheckThreadNumInCpuRange(value, "executor thread num", "engine_config.executor_thread_num");
+}
+
+Status
+Config::CheckEngineConfigLoaderThreadNum(const std::string& value) {
+    fiu_return_on("check_config_loader_thread_num_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    return CheckThreadNumInCpuRange(value, "loader thread num", "engine_config.loader_thread_num");
+}
+
+Status
+Config::CheckEngineConfigSearchBatchWait(const std::string& value) {
+    fiu_return_on("check_config_search_batch_wait_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid search batch wait: " + value +
+                          ". Possible reason: engine_config.search_batch_wait is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t wait = std::stoll(value);
+    if (wait < 0 || wait > 100) {
+        std::string msg = "Invalid search batch wait: " + value +
+                          ". Possible reason: engine_config.search_batch_wait is not in range [0, 100].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigSearchBatchMaxNq(const std::string& value) {
+    fiu_return_on("check_config_search_batch_max_nq_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid search batch max nq: " + value +
+                          ". Possible reason: engine_config.search_batch_max_nq is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigMaxRangeResults(const std::string& value) {
+    fiu_return_on("check_config_max_range_results_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid max range results: " + value +
+                          ". Possible reason: engine_config.max_range_results is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigShareIvfQuantizer(const std::string& value) {
+    fiu_return_on("check_config_share_ivf_quantizer_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsBool(value).ok()) {
+        std::string msg = "Invalid engine config: " + value +
+                          ". Possible reason: engine_config.share_ivf_quantizer is not a boolean.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigPreloadThreadNum(const std::string& value) {
+    fiu_return_on("check_config_preload_thread_num_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid preload thread num: " + value +
+                          ". Possible reason: engine_config.preload_thread_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigBuildParallelNum(const std::string& value) {
+    fiu_return_on("check_config_build_parallel_num_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid build parallel num: " + value +
+                          ". Possible reason: engine_config.build_parallel_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t thread_num = std::stoll(value);
+    int64_t sys_thread_cnt = 8;
+    CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+    if (thread_num < 1 || thread_num > sys_thread_cnt) {
+        std::string msg = "Invalid build parallel num: " + value +
+                          ". Possible reason: engine_config.build_parallel_num is not in range [1, system cpu cores].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigBuildOmpThreadNum(const std::string& value) {
+    fiu_return_on("check_config_build_omp_thread_num_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok()) {
+        std::string msg = "Invalid build omp thread num: " + value +
+                          ". Possible reason: engine_config.build_omp_thread_num is not a non-negative integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    int64_t thread_num = std::stoll(value);
+    int64_t sys_thread_cnt = 8;
+    CommonUtil::GetSystemAvailableThreads(sys_thread_cnt);
+    if (thread_num < 0 || thread_num > sys_thread_cnt) {
+        std::string msg =
+            "Invalid build omp thread num: " + value +
+            ". Possible reason: engine_config.build_omp_thread_num is not in range [0, system cpu cores].";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
+Status
+Config::CheckEngineConfigFlushThreadNum(const std::string& value) {
+    fiu_return_on("check_config_flush_thread_num_fail", Status(SERVER_INVALID_ARGUMENT, ""));
+
+    if (!ValidationUtil::ValidateStringIsNumber(value).ok() || std::stoll(value) <= 0) {
+        std::string msg = "Invalid flush thread num: " + value +
+                          ". Possible reason: engine_config.flush_thread_num is not a positive integer.";
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+    return Status::OK();
+}
+
 #ifdef MILVUS_GPU_VERSION
 
 Status
@@ -1006,6 +1423,64 @@ Config::GetDBConfigArchiveDaysThreshold(int64_t& value) {
     return Status::OK();
 }
 
+Status
+Config::GetDBConfigCompactionPolicy(std::string& value) {
+    std::string str = GetConfigStr(CONFIG_DB, CONFIG_DB_COMPACTION_POLICY, CONFIG_DB_COMPACTION_POLICY_DEFAULT);
+    CONFIG_CHECK(CheckDBConfigCompactionPolicy(str));
+    value = str;
+    return Status::OK();
+}
+
+Status
+Config::GetDBConfigCompactionFanIn(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_DB, CONFIG_DB_COMPACTION_FAN_IN, CONFIG_DB_COMPACTION_FAN_IN_DEFAULT);
+    CONFIG_CHECK(CheckDBConfigCompactionFanIn(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetDBConfigCompactionWriteAmp(double& value) {
+    std::string str = GetConfigStr(CONFIG_DB, CONFIG_DB_COMPACTION_WRITE_AMP, CONFIG_DB_COMPACTION_WRITE_AMP_DEFAULT);
+    CONFIG_CHECK(CheckDBConfigCompactionWriteAmp(str));
+    value = std::stod(str);
+    return Status::OK();
+}
+
+Status
+Config::GetDBConfigCompactionThrottle(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_DB, CONFIG_DB_COMPACTION_THROTTLE, CONFIG_DB_COMPACTION_THROTTLE_DEFAULT);
+    CONFIG_CHECK(CheckDBConfigCompactionThrottle(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetDBConfigCompactionDeletedRatio(float& value) {
+    std::string str =
+        GetConfigStr(CONFIG_DB, CONFIG_DB_COMPACTION_DELETED_RATIO, CONFIG_DB_COMPACTION_DELETED_RATIO_DEFAULT);
+    CONFIG_CHECK(CheckDBConfigCompactionDeletedRatio(str));
+    value = std::stof(str);
+    return Status::OK();
+}
+
+Status
+Config::GetDBConfigMetaCacheEnable(bool& value) {
+    std::string str = GetConfigStr(CONFIG_DB, CONFIG_DB_META_CACHE_ENABLE, CONFIG_DB_META_CACHE_ENABLE_DEFAULT);
+    CONFIG_CHECK(CheckDBConfigMetaCacheEnable(str));
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
+Status
+Config::GetDBConfigMetaCommitDelay(int64_t& value) {
+    std::string str = GetConfigStr(CONFIG_DB, CONFIG_DB_META_COMMIT_DELAY, CONFIG_DB_META_COMMIT_DELAY_DEFAULT);
+    CONFIG_CHECK(CheckDBConfigMetaCommitDelay(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 Status
 Config::GetDBConfigPreloadTable(std::string& value) {
     value = GetConfigStr(CONFIG_DB, CONFIG_DB_PRELOAD_TABLE);
@@ -1025,6 +1500,16 @@ Config::GetStorageConfigSecondaryPath(std::string& value) {
     return CheckStorageConfigSecondaryPath(value);
 }
 
+Status
+Config::GetStorageConfigFileMmapEnable(bool& value) {
+    std::string str =
+        GetConfigStr(CONFIG_STORAGE, CONFIG_STORAGE_FILE_MMAP_ENABLE, CONFIG_STORAGE_FILE_MMAP_ENABLE_DEFAULT);
+    CONFIG_CHECK(CheckStorageConfigFileMmapEnable(str));
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
 Status
 Config::GetStorageConfigS3Enable(bool& value) {
     std::string str = GetConfigStr(CONFIG_STORAGE, CONFIG_STORAGE_S3_ENABLE, CONFIG_STORAGE_S3_ENABLE_DEFAULT);
@@ -1064,6 +1549,21 @@ Config::GetStorageConfigS3Bucket(std::string& value) {
     return Status::OK();
 }
 
+Status
+Config::GetStorageConfigS3CachePath(std::string& value) {
+    value = GetConfigStr(CONFIG_STORAGE, CONFIG_STORAGE_S3_CACHE_PATH, CONFIG_STORAGE_S3_CACHE_PATH_DEFAULT);
+    return CheckStorageConfigS3CachePath(value);
+}
+
+Status
+Config::GetStorageConfigS3CacheCapacity(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_STORAGE, CONFIG_STORAGE_S3_CACHE_CAPACITY, CONFIG_STORAGE_S3_CACHE_CAPACITY_DEFAULT);
+    CONFIG_CHECK(CheckStorageConfigS3CacheCapacity(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 /* metric config */
 Status
 Config::GetMetricConfigEnableMonitor(bool& value) {
@@ -1105,6 +1605,15 @@ Config::GetCacheConfigCpuCacheThreshold(float& value) {
     return Status::OK();
 }
 
+Status
+Config::GetCacheConfigCpuCachePolicy(std::string& value) {
+    std::string str =
+        GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_CPU_CACHE_POLICY, CONFIG_CACHE_CPU_CACHE_POLICY_DEFAULT);
+    CONFIG_CHECK(CheckCacheConfigCpuCachePolicy(str));
+    value = str;
+    return Status::OK();
+}
+
 Status
 Config::GetCacheConfigInsertBufferSize(int64_t& value) {
     std::string str =
@@ -1124,6 +1633,16 @@ Config::GetCacheConfigCacheInsertData(bool& value) {
     return Status::OK();
 }
 
+Status
+Config::GetCacheConfigWarmStartEnable(bool& value) {
+    std::string str =
+        GetConfigStr(CONFIG_CACHE, CONFIG_CACHE_WARM_START_ENABLE, CONFIG_CACHE_WARM_START_ENABLE_DEFAULT);
+    CONFIG_CHECK(CheckCacheConfigWarmStartEnable(str));
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
 /* engine config */
 Status
 Config::GetEngineConfigUseBlasThreshold(int64_t& value) {
@@ -1142,6 +1661,97 @@ Config::GetEngineConfigOmpThreadNum(int64_t& value) {
     return Status::OK();
 }
 
+Status
+Config::GetEngineConfigExecutorThreadNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_EXECUTOR_THREAD_NUM, CONFIG_ENGINE_EXECUTOR_THREAD_NUM_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigExecutorThreadNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigLoaderThreadNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_LOADER_THREAD_NUM, CONFIG_ENGINE_LOADER_THREAD_NUM_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigLoaderThreadNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigSearchBatchWait(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_BATCH_WAIT, CONFIG_ENGINE_SEARCH_BATCH_WAIT_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigSearchBatchWait(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigSearchBatchMaxNq(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_BATCH_MAX_NQ, CONFIG_ENGINE_SEARCH_BATCH_MAX_NQ_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigSearchBatchMaxNq(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigMaxRangeResults(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_MAX_RANGE_RESULTS, CONFIG_ENGINE_MAX_RANGE_RESULTS_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigMaxRangeResults(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigShareIvfQuantizer(bool& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_SHARE_IVF_QUANTIZER, CONFIG_ENGINE_SHARE_IVF_QUANTIZER_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigShareIvfQuantizer(str));
+    std::transform(str.begin(), str.end(), str.begin(), ::tolower);
+    value = (str == "true" || str == "on" || str == "yes" || str == "1");
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigPreloadThreadNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_PRELOAD_THREAD_NUM, CONFIG_ENGINE_PRELOAD_THREAD_NUM_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigPreloadThreadNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigBuildParallelNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_BUILD_PARALLEL_NUM, CONFIG_ENGINE_BUILD_PARALLEL_NUM_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigBuildParallelNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigBuildOmpThreadNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_BUILD_OMP_THREAD_NUM, CONFIG_ENGINE_BUILD_OMP_THREAD_NUM_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigBuildOmpThreadNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
+Status
+Config::GetEngineConfigFlushThreadNum(int64_t& value) {
+    std::string str =
+        GetConfigStr(CONFIG_ENGINE, CONFIG_ENGINE_FLUSH_THREAD_NUM, CONFIG_ENGINE_FLUSH_THREAD_NUM_DEFAULT);
+    CONFIG_CHECK(CheckEngineConfigFlushThreadNum(str));
+    value = std::stoll(str);
+    return Status::OK();
+}
+
 #ifdef MILVUS_GPU_VERSION
 
 Status
@@ -1309,6 +1919,48 @@ Config::SetDBConfigArchiveDaysThreshold(const std::string& value) {
     return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_ARCHIVE_DAYS_THRESHOLD, value);
 }
 
+Status
+Config::SetDBConfigCompactionPolicy(const std::string& value) {
+    CONFIG_CHECK(CheckDBConfigCompactionPolicy(value));
+    return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_COMPACTION_POLICY, value);
+}
+
+Status
+Config::SetDBConfigCompactionFanIn(const std::string& value) {
+    CONFIG_CHECK(CheckDBConfigCompactionFanIn(value));
+    return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_COMPACTION_FAN_IN, value);
+}
+
+Status
+Config::SetDBConfigCompactionWriteAmp(const std::string& value) {
+    CONFIG_CHECK(CheckDBConfigCompactionWriteAmp(value));
+    return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_COMPACTION_WRITE_AMP, value);
+}
+
+Status
+Config::SetDBConfigCompactionThrottle(const std::string& value) {
+    CONFIG_CHECK(CheckDBConfigCompactionThrottle(value));
+    return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_COMPACTION_THROTTLE, value);
+}
+
+Status
+Config::SetDBConfigCompactionDeletedRatio(const std::string& value) {
+    CONFIG_CHECK(CheckDBConfigCompactionDeletedRatio(value));
+    return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_COMPACTION_DELETED_RATIO, value);
+}
+
+Status
+Config::SetDBConfigMetaCacheEnable(const std::string& value) {
+    CONFIG_CHECK(CheckDBConfigMetaCacheEnable(value));
+    return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_META_CACHE_ENABLE, value);
+}
+
+Status
+Config::SetDBConfigMetaCommitDelay(const std::string& value) {
+    CONFIG_CHECK(CheckDBConfigMetaCommitDelay(value));
+    return SetConfigValueInMem(CONFIG_DB, CONFIG_DB_META_COMMIT_DELAY, value);
+}
+
 /* storage config */
 Status
 Config::SetStorageConfigPrimaryPath(const std::string& value) {
@@ -1322,6 +1974,12 @@ Config::SetStorageConfigSecondaryPath(const std::string& value) {
     return SetConfigValueInMem(CONFIG_STORAGE, CONFIG_STORAGE_SECONDARY_PATH, value);
 }
 
+Status
+Config::SetStorageConfigFileMmapEnable(const std::string& value) {
+    CONFIG_CHECK(CheckStorageConfigFileMmapEnable(value));
+    return SetConfigValueInMem(CONFIG_STORAGE, CONFIG_STORAGE_FILE_MMAP_ENABLE, value);
+}
+
 Status
 Config::SetStorageConfigS3Enable(const std::string& value) {
     CONFIG_CHECK(CheckStorageConfigS3Enable(value));
@@ -1358,6 +2016,18 @@ Config::SetStorageConfigS3Bucket(const std::string& value) {
     return SetConfigValueInMem(CONFIG_STORAGE, CONFIG_STORAGE_S3_BUCKET, value);
 }
 
+Status
+Config::SetStorageConfigS3CachePath(const std::string& value) {
+    CONFIG_CHECK(CheckStorageConfigS3CachePath(value));
+    return SetConfigValueInMem(CONFIG_STORAGE, CONFIG_STORAGE_S3_CACHE_PATH, value);
+}
+
+Status
+Config::SetStorageConfigS3CacheCapacity(const std::string& value) {
+    CONFIG_CHECK(CheckStorageConfigS3CacheCapacity(value));
+    return SetConfigValueInMem(CONFIG_STORAGE, CONFIG_STORAGE_S3_CACHE_CAPACITY, value);
+}
+
 /* metric config */
 Status
 Config::SetMetricConfigEnableMonitor(const std::string& value) {
@@ -1390,6 +2060,12 @@ Config::SetCacheConfigCpuCacheThreshold(const std::string& value) {
     return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_CPU_CACHE_THRESHOLD, value);
 }
 
+Status
+Config::SetCacheConfigCpuCachePolicy(const std::string& value) {
+    CONFIG_CHECK(CheckCacheConfigCpuCachePolicy(value));
+    return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_CPU_CACHE_POLICY, value);
+}
+
 Status
 Config::SetCacheConfigInsertBufferSize(const std::string& value) {
     CONFIG_CHECK(CheckCacheConfigInsertBufferSize(value));
@@ -1402,6 +2078,12 @@ Config::SetCacheConfigCacheInsertData(const std::string& value) {
     return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_CACHE_INSERT_DATA, value);
 }
 
+Status
+Config::SetCacheConfigWarmStartEnable(const std::string& value) {
+    CONFIG_CHECK(CheckCacheConfigWarmStartEnable(value));
+    return SetConfigValueInMem(CONFIG_CACHE, CONFIG_CACHE_WARM_START_ENABLE, value);
+}
+
 /* engine config */
 Status
 Config::SetEngineConfigUseBlasThreshold(const std::string& value) {
@@ -1415,6 +2097,66 @@ Config::SetEngineConfigOmpThreadNum(const std::string& value) {
     return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_OMP_THREAD_NUM, value);
 }
 
+Status
+Config::SetEngineConfigExecutorThreadNum(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigExecutorThreadNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_EXECUTOR_THREAD_NUM, value);
+}
+
+Status
+Config::SetEngineConfigLoaderThreadNum(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigLoaderThreadNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_LOADER_THREAD_NUM, value);
+}
+
+Status
+Config::SetEngineConfigSearchBatchWait(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigSearchBatchWait(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_BATCH_WAIT, value);
+}
+
+Status
+Config::SetEngineConfigSearchBatchMaxNq(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigSearchBatchMaxNq(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SEARCH_BATCH_MAX_NQ, value);
+}
+
+Status
+Config::SetEngineConfigMaxRangeResults(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigMaxRangeResults(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_MAX_RANGE_RESULTS, value);
+}
+
+Status
+Config::SetEngineConfigShareIvfQuantizer(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigShareIvfQuantizer(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_SHARE_IVF_QUANTIZER, value);
+}
+
+Status
+Config::SetEngineConfigPreloadThreadNum(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigPreloadThreadNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_PRELOAD_THREAD_NUM, value);
+}
+
+Status
+Config::SetEngineConfigBuildParallelNum(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigBuildParallelNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_BUILD_PARALLEL_NUM, value);
+}
+
+Status
+Config::SetEngineConfigBuildOmpThreadNum(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigBuildOmpThreadNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_BUILD_OMP_THREAD_NUM, value);
+}
+
+Status
+Config::SetEngineConfigFlushThreadNum(const std::string& value) {
+    CONFIG_CHECK(CheckEngineConfigFlushThreadNum(value));
+    return SetConfigValueInMem(CONFIG_ENGINE, CONFIG_ENGINE_FLUSH_THREAD_NUM, value);
+}
+
 #ifdef MILVUS_GPU_VERSION
 /* gpu resource config */
 Status
@@ -54,6 +54,20 @@ static const char* CONFIG_DB_ARCHIVE_DISK_THRESHOLD = "archive_disk_threshold";
 static const char* CONFIG_DB_ARCHIVE_DISK_THRESHOLD_DEFAULT = "0";
 static const char* CONFIG_DB_ARCHIVE_DAYS_THRESHOLD = "archive_days_threshold";
 static const char* CONFIG_DB_ARCHIVE_DAYS_THRESHOLD_DEFAULT = "0";
+static const char* CONFIG_DB_COMPACTION_POLICY = "compaction_policy";
+static const char* CONFIG_DB_COMPACTION_POLICY_DEFAULT = "simple";
+static const char* CONFIG_DB_COMPACTION_FAN_IN = "compaction_fan_in";
+static const char* CONFIG_DB_COMPACTION_FAN_IN_DEFAULT = "4";
+static const char* CONFIG_DB_COMPACTION_WRITE_AMP = "compaction_write_amp";
+static const char* CONFIG_DB_COMPACTION_WRITE_AMP_DEFAULT = "3.0";
+static const char* CONFIG_DB_COMPACTION_THROTTLE = "compaction_throttle";
+static const char* CONFIG_DB_COMPACTION_THROTTLE_DEFAULT = "64";
+static const char* CONFIG_DB_COMPACTION_DELETED_RATIO = "compaction_deleted_ratio";
+static const char* CONFIG_DB_COMPACTION_DELETED_RATIO_DEFAULT = "0.2";
+static const char* CONFIG_DB_META_CACHE_ENABLE = "meta_cache_enable";
+static const char* CONFIG_DB_META_CACHE_ENABLE_DEFAULT = "true";
+static const char* CONFIG_DB_META_COMMIT_DELAY = "meta_commit_delay";
+static const char* CONFIG_DB_META_COMMIT_DELAY_DEFAULT = "5";
 static const char* CONFIG_DB_PRELOAD_TABLE = "preload_table";
 static const char* CONFIG_DB_PRELOAD_TABLE_DEFAULT = "";
 
@@ -63,6 +77,8 @@ static const char* CONFIG_STORAGE_PRIMARY_PATH = "primary_path";
 static const char* CONFIG_STORAGE_PRIMARY_PATH_DEFAULT = "/tmp/milvus";
 static const char* CONFIG_STORAGE_SECONDARY_PATH = "secondary_path";
 static const char* CONFIG_STORAGE_SECONDARY_PATH_DEFAULT = "";
+static const char* CONFIG_STORAGE_FILE_MMAP_ENABLE = "file_mmap_enable";
+static const char* CONFIG_STORAGE_FILE_MMAP_ENABLE_DEFAULT = "false";
 static const char* CONFIG_STORAGE_S3_ENABLE = "s3_enable";
 static const char* CONFIG_STORAGE_S3_ENABLE_DEFAULT = "false";
 static const char* CONFIG_STORAGE_S3_ADDRESS = "s3_address";
@@ -75,6 +91,10 @@ static const char* CONFIG_STORAGE_S3_SECRET_KEY = "s3_secret_key";
 static const char* CONFIG_STORAGE_S3_SECRET_KEY_DEFAULT = "minioadmin";
 static const char* CONFIG_STORAGE_S3_BUCKET = "s3_bucket";
 static const char* CONFIG_STORAGE_S3_BUCKET_DEFAULT = "milvus-bucket";
+static const char* CONFIG_STORAGE_S3_CACHE_PATH = "s3_cache_path";
+static const char* CONFIG_STORAGE_S3_CACHE_PATH_DEFAULT = "";
+static const char* CONFIG_STORAGE_S3_CACHE_CAPACITY = "s3_cache_capacity";
+static const char* CONFIG_STORAGE_S3_CACHE_CAPACITY_DEFAULT = "16";
 
 /* cache config */
 static const char* CONFIG_CACHE = "cache_config";
@@ -82,10 +102,14 @@ static const char* CONFIG_CACHE_CPU_CACHE_CAPACITY = "cpu_cache_capacity";
 static const char* CONFIG_CACHE_CPU_CACHE_CAPACITY_DEFAULT = "4";
 static const char* CONFIG_CACHE_CPU_CACHE_THRESHOLD = "cpu_cache_threshold";
 static const char* CONFIG_CACHE_CPU_CACHE_THRESHOLD_DEFAULT = "0.85";
+static const char* CONFIG_CACHE_CPU_CACHE_POLICY = "cpu_cache_policy";
+static const char* CONFIG_CACHE_CPU_CACHE_POLICY_DEFAULT = "lru";
 static const char* CONFIG_CACHE_INSERT_BUFFER_SIZE = "insert_buffer_size";
 static const char* CONFIG_CACHE_INSERT_BUFFER_SIZE_DEFAULT = "1";
 static const char* CONFIG_CACHE_CACHE_INSERT_DATA = "cache_insert_data";
 static const char* CONFIG_CACHE_CACHE_INSERT_DATA_DEFAULT = "false";
+static const char* CONFIG_CACHE_WARM_START_ENABLE = "warm_start_enable";
+static const char* CONFIG_CACHE_WARM_START_ENABLE_DEFAULT = "false";
 
 /* metric config */
 static const char* CONFIG_METRIC = "metric_config";
@@ -102,6 +126,26 @@ static const char* CONFIG_ENGINE_USE_BLAS_THRESHOLD = "use_blas_threshold";
 static const char* CONFIG_ENGINE_USE_BLAS_THRESHOLD_DEFAULT = "1100";
 static const char* CONFIG_ENGINE_OMP_THREAD_NUM = "omp_thread_num";
 static const char* CONFIG_ENGINE_OMP_THREAD_NUM_DEFAULT = "0";
+static const char* CONFIG_ENGINE_EXECUTOR_THREAD_NUM = "executor_thread_num";
+static const char* CONFIG_ENGINE_EXECUTOR_THREAD_NUM_DEFAULT = "1";
+static const char* CONFIG_ENGINE_LOADER_THREAD_NUM = "loader_thread_num";
+static const char* CONFIG_ENGINE_LOADER_THREAD_NUM_DEFAULT = "1";
+static const char* CONFIG_ENGINE_SEARCH_BATCH_WAIT = "search_batch_wait";
+static const char* CONFIG_ENGINE_SEARCH_BATCH_WAIT_DEFAULT = "0";
+static const char* CONFIG_ENGINE_SEARCH_BATCH_MAX_NQ = "search_batch_max_nq";
+static const char* CONFIG_ENGINE_SEARCH_BATCH_MAX_NQ_DEFAULT = "1024";
+static const char* CONFIG_ENGINE_MAX_RANGE_RESULTS = "max_range_results";
+static const char* CONFIG_ENGINE_MAX_RANGE_RESULTS_DEFAULT = "1000000";
+static const char* CONFIG_ENGINE_SHARE_IVF_QUANTIZER = "share_ivf_quantizer";
+static const char* CONFIG_ENGINE_SHARE_IVF_QUANTIZER_DEFAULT = "false";
+static const char* CONFIG_ENGINE_PRELOAD_THREAD_NUM = "preload_thread_num";
+static const char* CONFIG_ENGINE_PRELOAD_THREAD_NUM_DEFAULT = "4";
+static const char* CONFIG_ENGINE_BUILD_PARALLEL_NUM = "build_parallel_num";
+static const char* CONFIG_ENGINE_BUILD_PARALLEL_NUM_DEFAULT = "1";
+static const char* CONFIG_ENGINE_BUILD_OMP_THREAD_NUM = "build_omp_thread_num";
+static const char* CONFIG_ENGINE_BUILD_OMP_THREAD_NUM_DEFAULT = "0";
+static const char* CONFIG_ENGINE_FLUSH_THREAD_NUM = "flush_thread_num";
+static const char* CONFIG_ENGINE_FLUSH_THREAD_NUM_DEFAULT = "4";
 static const char* CONFIG_ENGINE_GPU_SEARCH_THRESHOLD = "gpu_search_threshold";
 static const char* CONFIG_ENGINE_GPU_SEARCH_THRESHOLD_DEFAULT = "1000";
 
@@ -182,6 +226,20 @@ class Config {
     CheckDBConfigArchiveDiskThreshold(const std::string& value);
     Status
     CheckDBConfigArchiveDaysThreshold(const std::string& value);
+    Status
+    CheckDBConfigCompactionPolicy(const std::string& value);
+    Status
+    CheckDBConfigCompactionFanIn(const std::string& value);
+    Status
+    CheckDBConfigCompactionWriteAmp(const std::string& value);
+    Status
+    CheckDBConfigCompactionThrottle(const std::string& value);
+    Status
+    CheckDBConfigCompactionDeletedRatio(const std::string& value);
+    Status
+    CheckDBConfigMetaCacheEnable(const std::string& value);
+    Status
+    CheckDBConfigMetaCommitDelay(const std::string& value);
 
     /* storage config */
     Status
@@ -189,6 +247,8 @@ class Config {
     Status
     CheckStorageConfigSecondaryPath(const std::string& value);
     Status
+    CheckStorageConfigFileMmapEnable(const std::string& value);
+    Status
     CheckStorageConfigS3Enable(const std::string& value);
     Status
     CheckStorageConfigS3Address(const std::string& value);
@@ -200,6 +260,10 @@ class Config {
     CheckStorageConfigS3SecretKey(const std::string& value);
     Status
     CheckStorageConfigS3Bucket(const std::string& value);
+    Status
+    CheckStorageConfigS3CachePath(const std::string& value);
+    Status
+    CheckStorageConfigS3CacheCapacity(const std::string& value);
 
     /* metric config */
     Status
@@ -215,15 +279,39 @@ class Config {
     Status
     CheckCacheConfigCpuCacheThreshold(const std::string& value);
     Status
+    CheckCacheConfigCpuCachePolicy(const std::string& value);
+    Status
     CheckCacheConfigInsertBufferSize(const std::string& value);
     Status
     CheckCacheConfigCacheInsertData(const std::string& value);
+    Status
+    CheckCacheConfigWarmStartEnable(const std::string& value);
 
     /* engine config */
     Status
     CheckEngineConfigUseBlasThreshold(const std::string& value);
     Status
     CheckEngineConfigOmpThreadNum(const std::string& value);
+    Status
+    CheckEngineConfigExecutorThreadNum(const std::string& value);
+    Status
+    CheckEngineConfigLoaderThreadNum(const std::string& value);
+    Status
+    CheckEngineConfigSearchBatchWait(const std::string& value);
+    Status
+    CheckEngineConfigSearchBatchMaxNq(const std::string& value);
+    Status
+    CheckEngineConfigMaxRangeResults(const std::string& value);
+    Status
+    CheckEngineConfigShareIvfQuantizer(const std::string& value);
+    Status
+    CheckEngineConfigPreloadThreadNum(const std::string& value);
+    Status
+    CheckEngineConfigBuildParallelNum(const std::string& value);
+    Status
+    CheckEngineConfigBuildOmpThreadNum(const std::string& value);
+    Status
+    CheckEngineConfigFlushThreadNum(const std::string& value);
 
 #ifdef MILVUS_GPU_VERSION
     Status
@@ -271,6 +359,20 @@ class Config {
     Status
     GetDBConfigArchiveDaysThreshold(int64_t& value);
     Status
+    GetDBConfigCompactionPolicy(std::string& value);
+    Status
+    GetDBConfigCompactionFanIn(int64_t& value);
+    Status
+    GetDBConfigCompactionWriteAmp(double& value);
+    Status
+    GetDBConfigCompactionThrottle(int64_t& value);
+    Status
+    GetDBConfigCompactionDeletedRatio(float& value);
+    Status
+    GetDBConfigMetaCacheEnable(bool& value);
+    Status
+    GetDBConfigMetaCommitDelay(int64_t& value);
+    Status
     GetDBConfigPreloadTable(std::string& value);
 
     /* storage config */
@@ -279,6 +381,8 @@ class Config {
     Status
     GetStorageConfigSecondaryPath(std::string& value);
     Status
+    GetStorageConfigFileMmapEnable(bool& value);
+    Status
     GetStorageConfigS3Enable(bool& value);
     Status
     GetStorageConfigS3Address(std::string& value);
@@ -290,6 +394,10 @@ class Config {
     GetStorageConfigS3SecretKey(std::string& value);
     Status
     GetStorageConfigS3Bucket(std::string& value);
+    Status
+    GetStorageConfigS3CachePath(std::string& value);
+    Status
+    GetStorageConfigS3CacheCapacity(int64_t& value);
 
     /* metric config */
     Status
@@ -305,15 +413,39 @@ class Config {
     Status
     GetCacheConfigCpuCacheThreshold(float& value);
     Status
+    GetCacheConfigCpuCachePolicy(std::string& value);
+    Status
     GetCacheConfigInsertBufferSize(int64_t& value);
     Status
     GetCacheConfigCacheInsertData(bool& value);
+    Status
+    GetCacheConfigWarmStartEnable(bool& value);
 
     /* engine config */
     Status
     GetEngineConfigUseBlasThreshold(int64_t& value);
     Status
     GetEngineConfigOmpThreadNum(int64_t& value);
+    Status
+    GetEngineConfigExecutorThreadNum(int64_t& value);
+    Status
+    GetEngineConfigLoaderThreadNum(int64_t& value);
+    Status
+    GetEngineConfigSearchBatchWait(int64_t& value);
+    Status
+    GetEngineConfigSearchBatchMaxNq(int64_t& value);
+    Status
+    GetEngineConfigMaxRangeResults(int64_t& value);
+    Status
+    GetEngineConfigShareIvfQuantizer(bool& value);
+    Status
+    GetEngineConfigPreloadThreadNum(int64_t& value);
+    Status
+    GetEngineConfigBuildParallelNum(int64_t& value);
+    Status
+    GetEngineConfigBuildOmpThreadNum(int64_t& value);
+    Status
+    GetEngineConfigFlushThreadNum(int64_t& value);
 
 #ifdef MILVUS_GPU_VERSION
     Status
@@ -356,6 +488,20 @@ class Config {
     SetDBConfigArchiveDiskThreshold(const std::string& value);
     Status
     SetDBConfigArchiveDaysThreshold(const std::string& value);
+    Status
+    SetDBConfigCompactionPolicy(const std::string& value);
+    Status
+    SetDBConfigCompactionFanIn(const std::string& value);
+    Status
+    SetDBConfigCompactionWriteAmp(const std::string& value);
+    Status
+    SetDBConfigCompactionThrottle(const std::string& value);
+    Status
+    SetDBConfigCompactionDeletedRatio(const std::string& value);
+    Status
+    SetDBConfigMetaCacheEnable(const std::string& value);
+    Status
+    SetDBConfigMetaCommitDelay(const std::string& value);
 
     /* storage config */
     Status
@@ -363,6 +509,8 @@ class Config {
     Status
     SetStorageConfigSecondaryPath(const std::string& value);
     Status
+    SetStorageConfigFileMmapEnable(const std::string& value);
+    Status
     SetStorageConfigS3Enable(const std::string& value);
     Status
     SetStorageConfigS3Address(const std::string& value);
@@ -374,6 +522,10 @@ class Config {
     SetStorageConfigS3SecretKey(const std::string& value);
     Status
     SetStorageConfigS3Bucket(const std::string& value);
+    Status
+    SetStorageConfigS3CachePath(const std::string& value);
+    Status
+    SetStorageConfigS3CacheCapacity(const std::string& value);
 
     /* metric config */
     Status
@@ -389,15 +541,39 @@ class Config {
     Status
     SetCacheConfigCpuCacheThreshold(const std::string& value);
     Status
+    SetCacheConfigCpuCachePolicy(const std::string& value);
+    Status
     SetCacheConfigInsertBufferSize(const std::string& value);
     Status
     SetCacheConfigCacheInsertData(const std::string& value);
+    Status
+    SetCacheConfigWarmStartEnable(const std::string& value);
 
     /* engine config */
     Status
     SetEngineConfigUseBlasThreshold(const std::string& value);
     Status
     SetEngineConfigOmpThreadNum(const std::string& value);
+    Status
+    SetEngineConfigExecutorThreadNum(const std::string& value);
+    Status
+    SetEngineConfigLoaderThreadNum(const std::string& value);
+    Status
+    SetEngineConfigSearchBatchWait(const std::string& value);
+    Status
+    SetEngineConfigSearchBatchMaxNq(const std::string& value);
+    Status
+    SetEngineConfigMaxRangeResults(const std::string& value);
+    Status
+    SetEngineConfigShareIvfQuantizer(const std::string& value);
+    Status
+    SetEngineConfigPreloadThreadNum(const std::string& value);
+    Status
+    SetEngineConfigBuildParallelNum(const std::string& value);
+    Status
+    SetEngineConfigBuildOmpThreadNum(const std::string& value);
+    Status
+    SetEngineConfigFlushThreadNum(const std::string& value);
 
 #ifdef MILVUS_GPU_VERSION
     Status
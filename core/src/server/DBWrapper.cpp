@@ -63,6 +63,12 @@ DBWrapper::StartService() {
         return s;
     }
 
+    s = config.GetCacheConfigWarmStartEnable(opt.warm_start_enable_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
     std::string mode;
     s = config.GetServerConfigDeployMode(mode);
     if (!s.ok()) {
@@ -111,6 +117,79 @@ DBWrapper::StartService() {
 
     faiss::distance_compute_blas_threshold = use_blas_threshold;
 
+    s = config.GetEngineConfigSearchBatchWait(opt.search_batch_wait_ms_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetEngineConfigSearchBatchMaxNq(opt.search_batch_max_nq_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetEngineConfigMaxRangeResults(opt.max_range_results_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetEngineConfigPreloadThreadNum(opt.preload_thread_num_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetEngineConfigFlushThreadNum(opt.flush_thread_num_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    // compaction config
+    s = config.GetDBConfigCompactionPolicy(opt.compaction_policy_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetDBConfigCompactionFanIn(opt.compaction_fan_in_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetDBConfigCompactionWriteAmp(opt.compaction_write_amp_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetDBConfigCompactionThrottle(opt.compaction_throttle_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetDBConfigCompactionDeletedRatio(opt.compaction_deleted_ratio_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetDBConfigMetaCacheEnable(opt.meta_.cache_enable_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
+    s = config.GetDBConfigMetaCommitDelay(opt.meta_.commit_delay_);
+    if (!s.ok()) {
+        std::cerr << s.ToString() << std::endl;
+        return s;
+    }
+
     // set archive config
     engine::ArchiveConf::CriteriaT criterial;
     int64_t disk, days;
@@ -181,11 +260,24 @@ DBWrapper::StartService() {
         kill(0, SIGUSR1);
     }
 
+    // the hot set is best effort, a missing or stale manifest must not stop the server, nor delay it
+    warm_start_thread_ = std::thread([db = db_]() {
+        auto status = db->WarmStart();
+        if (!status.ok()) {
+            SERVER_LOG_WARNING << "Warm start incomplete: " << status.ToString();
+        }
+    });
+
     return Status::OK();
 }
 
 Status
 DBWrapper::StopService() {
+    // a warm start of a large hot set must not hold up the shutdown, only the files in flight are waited for
+    if (warm_start_thread_.joinable()) {
+        db_->StopWarmStart();
+        warm_start_thread_.join();
+    }
     if (db_) {
         db_->Stop();
     }
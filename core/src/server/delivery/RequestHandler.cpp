@@ -18,6 +18,7 @@
 #include "server/delivery/request/CreatePartitionRequest.h"
 #include "server/delivery/request/CreateTableRequest.h"
 #include "server/delivery/request/DeleteByDateRequest.h"
+#include "server/delivery/request/DeleteByIDRequest.h"
 #include "server/delivery/request/DescribeIndexRequest.h"
 #include "server/delivery/request/DescribeTableRequest.h"
 #include "server/delivery/request/DropIndexRequest.h"
@@ -26,6 +27,7 @@
 #include "server/delivery/request/HasTableRequest.h"
 #include "server/delivery/request/InsertRequest.h"
 #include "server/delivery/request/PreloadTableRequest.h"
+#include "server/delivery/request/RangeSearchRequest.h"
 #include "server/delivery/request/SearchRequest.h"
 #include "server/delivery/request/ShowPartitionsRequest.h"
 #include "server/delivery/request/ShowTablesRequest.h"
@@ -89,10 +91,21 @@ Status
 RequestHandler::Search(const std::shared_ptr<Context>& context, const std::string& table_name,
                        const engine::VectorsData& vectors,
                        const std::vector<std::pair<std::string, std::string>>& range_list, int64_t topk, int64_t nprobe,
-                       const std::vector<std::string>& partition_list, const std::vector<std::string>& file_id_list,
-                       TopKQueryResult& result) {
+                       int64_t refine_factor, const std::vector<std::string>& partition_list,
+                       const std::vector<std::string>& file_id_list, TopKQueryResult& result) {
     BaseRequestPtr request_ptr = SearchRequest::Create(context, table_name, vectors, range_list, topk, nprobe,
-                                                       partition_list, file_id_list, result);
+                                                       refine_factor, partition_list, file_id_list, result);
+    RequestScheduler::ExecRequest(request_ptr);
+
+    return request_ptr->status();
+}
+
+Status
+RequestHandler::RangeSearch(const std::shared_ptr<Context>& context, const std::string& table_name,
+                            const engine::VectorsData& vectors, float radius, int64_t nprobe,
+                            const std::vector<std::string>& partition_list, TopKQueryResult& result) {
+    BaseRequestPtr request_ptr =
+        RangeSearchRequest::Create(context, table_name, vectors, radius, nprobe, partition_list, result);
     RequestScheduler::ExecRequest(request_ptr);
 
     return request_ptr->status();
@@ -132,6 +145,15 @@ RequestHandler::DeleteByRange(const std::shared_ptr<Context>& context, const std
     return request_ptr->status();
 }
 
+Status
+RequestHandler::DeleteByID(const std::shared_ptr<Context>& context, const std::string& table_name,
+                           const std::vector<int64_t>& vector_ids) {
+    BaseRequestPtr request_ptr = DeleteByIDRequest::Create(context, table_name, vector_ids);
+    RequestScheduler::ExecRequest(request_ptr);
+
+    return request_ptr->status();
+}
+
 Status
 RequestHandler::PreloadTable(const std::shared_ptr<Context>& context, const std::string& table_name) {
     BaseRequestPtr request_ptr = PreloadTableRequest::Create(context, table_name);
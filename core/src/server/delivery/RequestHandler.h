@@ -49,10 +49,16 @@ class RequestHandler {
 
     Status
     Search(const std::shared_ptr<Context>& context, const std::string& table_name, const engine::VectorsData& vectors,
-           const std::vector<Range>& range_list, int64_t topk, int64_t nprobe,
+           const std::vector<Range>& range_list, int64_t topk, int64_t nprobe, int64_t refine_factor,
            const std::vector<std::string>& partition_list, const std::vector<std::string>& file_id_list,
            TopKQueryResult& result);
 
+    // all vectors within radius of each query, see TopKQueryResult::lims_
+    Status
+    RangeSearch(const std::shared_ptr<Context>& context, const std::string& table_name,
+                const engine::VectorsData& vectors, float radius, int64_t nprobe,
+                const std::vector<std::string>& partition_list, TopKQueryResult& result);
+
     Status
     DescribeTable(const std::shared_ptr<Context>& context, const std::string& table_name, TableSchema& table_schema);
 
@@ -65,6 +71,10 @@ class RequestHandler {
     Status
     DeleteByRange(const std::shared_ptr<Context>& context, const std::string& table_name, const Range& range);
 
+    Status
+    DeleteByID(const std::shared_ptr<Context>& context, const std::string& table_name,
+               const std::vector<int64_t>& vector_ids);
+
     Status
     PreloadTable(const std::shared_ptr<Context>& context, const std::string& table_name);
 
@@ -64,6 +64,8 @@ struct TopKQueryResult {
     int64_t row_num_;
     engine::ResultIds id_list_;
     engine::ResultDistances distance_list_;
+    // range search only, row_num_ + 1 offsets, the results of query i are in [lims_[i], lims_[i + 1])
+    std::vector<int64_t> lims_;
 
     TopKQueryResult() {
         row_num_ = 0;
@@ -12,10 +12,15 @@
 #include "server/delivery/request/CmdRequest.h"
 #include "metrics/SystemInfo.h"
 #include "scheduler/SchedInst.h"
+#include "server/DBWrapper.h"
+#include "utils/Json.h"
 #include "utils/Log.h"
 #include "utils/TimeRecorder.h"
 
+#include <faiss/FaissHook.h>
+
 #include <memory>
+#include <vector>
 
 namespace milvus {
 namespace server {
@@ -47,11 +52,33 @@ CmdRequest::OnExecute() {
 #else
         result_ = "CPU";
 #endif
+    } else if (cmd_ == "simd_level") {
+        result_ = faiss::simd_level_name(faiss::get_simd_level());
     } else if (cmd_ == "get_system_info") {
         server::SystemInfo& sys_info_inst = server::SystemInfo::GetInstance();
         sys_info_inst.GetSysInfoJsonStr(result_);
     } else if (cmd_ == "build_commit_id") {
         result_ = LAST_COMMIT_ID;
+    } else if (cmd_ == "preload_progress") {
+        std::vector<engine::PreloadProgress> progress_array;
+        stat = DBWrapper::DB()->GetPreloadProgress(progress_array);
+        milvus::json progress_json = milvus::json::array();
+        for (auto& progress : progress_array) {
+            double rate = 0.0;
+            if (progress.elapsed_ms_ > 0) {
+                rate = progress.loaded_bytes_ * 1000.0 / progress.elapsed_ms_ / 1024 / 1024;
+            }
+            progress_json.push_back({{"name", progress.name_},
+                                     {"total_files", progress.total_files_},
+                                     {"loaded_files", progress.loaded_files_},
+                                     {"failed_files", progress.failed_files_},
+                                     {"total_bytes", progress.total_bytes_},
+                                     {"loaded_bytes", progress.loaded_bytes_},
+                                     {"elapsed_ms", progress.elapsed_ms_},
+                                     {"rate_mb_per_sec", rate},
+                                     {"finished", progress.finished_}});
+        }
+        result_ = progress_json.dump();
     } else if (cmd_.substr(0, 10) == "set_config" || cmd_.substr(0, 10) == "get_config") {
         server::Config& config = server::Config::GetInstance();
         stat = config.ProcessConfigCli(result_, cmd_);
@@ -92,7 +92,9 @@ CreateIndexRequest::OnExecute() {
         fiu_do_on("CreateIndexRequest.OnExecute.ip_meteric",
                   table_info.metric_type_ = static_cast<int>(engine::MetricType::IP));
 
-        if (s.ok() && adapter_index_type == (int)engine::EngineType::FAISS_PQ &&
+        if (s.ok() &&
+            (adapter_index_type == (int)engine::EngineType::FAISS_PQ ||
+             adapter_index_type == (int)engine::EngineType::FAISS_PQ_REFINE) &&
             table_info.metric_type_ == (int)engine::MetricType::IP) {
             return Status(SERVER_UNEXPECTED_ERROR, "PQ not support IP in GPU version!");
         }
@@ -0,0 +1,97 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/delivery/request/DeleteByIDRequest.h"
+#include "server/DBWrapper.h"
+#include "utils/Log.h"
+#include "utils/TimeRecorder.h"
+#include "utils/ValidationUtil.h"
+
+#include <fiu-local.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace milvus {
+namespace server {
+
+DeleteByIDRequest::DeleteByIDRequest(const std::shared_ptr<Context>& context, const std::string& table_name,
+                                     const std::vector<int64_t>& vector_ids)
+    : BaseRequest(context, DDL_DML_REQUEST_GROUP), table_name_(table_name), vector_ids_(vector_ids) {
+}
+
+BaseRequestPtr
+DeleteByIDRequest::Create(const std::shared_ptr<Context>& context, const std::string& table_name,
+                          const std::vector<int64_t>& vector_ids) {
+    return std::shared_ptr<BaseRequest>(new DeleteByIDRequest(context, table_name, vector_ids));
+}
+
+Status
+DeleteByIDRequest::OnExecute() {
+    try {
+        TimeRecorderAuto rc("DeleteByIDRequest");
+
+        // step 1: check arguments
+        auto status = ValidationUtil::ValidateTableName(table_name_);
+        if (!status.ok()) {
+            return status;
+        }
+
+        if (vector_ids_.empty()) {
+            return Status(SERVER_ILLEGAL_VECTOR_ID, "No vector id array provided");
+        }
+
+        // step 2: check table existence
+        engine::meta::TableSchema table_info;
+        table_info.table_id_ = table_name_;
+        status = DBWrapper::DB()->DescribeTable(table_info);
+        fiu_do_on("DeleteByIDRequest.OnExecute.describe_table_fail",
+                  status = Status(milvus::SERVER_UNEXPECTED_ERROR, ""));
+        if (!status.ok()) {
+            if (status.code() == DB_NOT_FOUND) {
+                return Status(SERVER_TABLE_NOT_EXIST, TableNotExistMsg(table_name_));
+            } else {
+                return status;
+            }
+        }
+
+        // step 3: deletion is applied as a filter of float vector searches, other indexes can't skip vectors
+        if (ValidationUtil::IsBinaryMetricType(table_info.metric_type_)) {
+            return Status(SERVER_UNSUPPORTED_ERROR, "Delete by id is not supported for binary vectors");
+        }
+        auto engine_type = static_cast<engine::EngineType>(table_info.engine_type_);
+        if (engine_type == engine::EngineType::NSG_MIX || engine_type == engine::EngineType::FAISS_IVFSQ8H ||
+            engine_type == engine::EngineType::SPTAG_KDT || engine_type == engine::EngineType::SPTAG_BKT) {
+            return Status(SERVER_UNSUPPORTED_ERROR, "Delete by id is not supported for index type " +
+                                                        std::to_string(table_info.engine_type_));
+        }
+
+        rc.RecordSection("check validation");
+
+        // step 4: mark the vectors deleted
+        int64_t deleted_count = 0;
+        status = DBWrapper::DB()->DeleteVectors(table_name_, vector_ids_, deleted_count);
+        fiu_do_on("DeleteByIDRequest.OnExecute.delete_vectors_fail",
+                  status = Status(milvus::SERVER_UNEXPECTED_ERROR, ""));
+        if (!status.ok()) {
+            return status;
+        }
+        SERVER_LOG_DEBUG << "Deleted " << deleted_count << " of " << vector_ids_.size() << " vectors from table "
+                         << table_name_;
+    } catch (std::exception& ex) {
+        return Status(SERVER_UNEXPECTED_ERROR, ex.what());
+    }
+
+    return Status::OK();
+}
+
+}  // namespace server
+}  // namespace milvus
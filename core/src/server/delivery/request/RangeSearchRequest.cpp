@@ -0,0 +1,121 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "server/delivery/request/RangeSearchRequest.h"
+#include "server/DBWrapper.h"
+#include "utils/Log.h"
+#include "utils/TimeRecorder.h"
+#include "utils/ValidationUtil.h"
+
+#include <memory>
+
+namespace milvus {
+namespace server {
+
+RangeSearchRequest::RangeSearchRequest(const std::shared_ptr<Context>& context, const std::string& table_name,
+                                       const engine::VectorsData& vectors, float radius, int64_t nprobe,
+                                       const std::vector<std::string>& partition_list, TopKQueryResult& result)
+    : BaseRequest(context, DQL_REQUEST_GROUP),
+      table_name_(table_name),
+      vectors_data_(vectors),
+      radius_(radius),
+      nprobe_(nprobe),
+      partition_list_(partition_list),
+      result_(result) {
+}
+
+BaseRequestPtr
+RangeSearchRequest::Create(const std::shared_ptr<Context>& context, const std::string& table_name,
+                           const engine::VectorsData& vectors, float radius, int64_t nprobe,
+                           const std::vector<std::string>& partition_list, TopKQueryResult& result) {
+    return std::shared_ptr<BaseRequest>(
+        new RangeSearchRequest(context, table_name, vectors, radius, nprobe, partition_list, result));
+}
+
+Status
+RangeSearchRequest::OnExecute() {
+    try {
+        uint64_t vector_count = vectors_data_.vector_count_;
+        std::string hdr = "RangeSearchRequest(table=" + table_name_ + ", nq=" + std::to_string(vector_count) +
+                          ", radius=" + std::to_string(radius_) + ", nprob=" + std::to_string(nprobe_) + ")";
+
+        TimeRecorder rc(hdr);
+
+        // step 1: check table name
+        auto status = ValidationUtil::ValidateTableName(table_name_);
+        if (!status.ok()) {
+            return status;
+        }
+
+        // step 2: check table existence
+        engine::meta::TableSchema table_info;
+        table_info.table_id_ = table_name_;
+        status = DBWrapper::DB()->DescribeTable(table_info);
+        if (!status.ok()) {
+            if (status.code() == DB_NOT_FOUND) {
+                return Status(SERVER_TABLE_NOT_EXIST, TableNotExistMsg(table_name_));
+            } else {
+                return status;
+            }
+        }
+
+        // step 3: check search parameter, faiss range search is only implemented for float vectors
+        if (ValidationUtil::IsBinaryMetricType(table_info.metric_type_)) {
+            return Status(SERVER_INVALID_ARGUMENT, "Range search is not supported by binary tables.");
+        }
+
+        status = ValidationUtil::ValidateSearchRadius(radius_, table_info);
+        if (!status.ok()) {
+            return status;
+        }
+
+        status = ValidationUtil::ValidateSearchNprobe(nprobe_, table_info);
+        if (!status.ok()) {
+            return status;
+        }
+
+        status = ValidationUtil::ValidatePartitionTags(partition_list_);
+        if (!status.ok()) {
+            return status;
+        }
+
+        if (vectors_data_.float_data_.empty() || vector_count == 0) {
+            return Status(SERVER_INVALID_ROWRECORD_ARRAY,
+                          "The vector array is empty. Make sure you have entered vector records.");
+        }
+
+        if (vectors_data_.float_data_.size() % vector_count != 0 ||
+            vectors_data_.float_data_.size() / vector_count != table_info.dimension_) {
+            return Status(SERVER_INVALID_VECTOR_DIMENSION,
+                          "The vector dimension must be equal to the table dimension.");
+        }
+
+        rc.RecordSection("check validation");
+
+        // step 4: search vectors, the per query results are put one after another
+        status = DBWrapper::DB()->RangeQuery(context_, table_name_, partition_list_, radius_, nprobe_, vectors_data_,
+                                             result_.lims_, result_.id_list_, result_.distance_list_);
+        rc.RecordSection("search vectors from engine");
+        if (!status.ok()) {
+            return status;
+        }
+
+        result_.row_num_ = vector_count;
+        rc.ElapseFromBegin("totally cost");
+    } catch (std::exception& ex) {
+        return Status(SERVER_UNEXPECTED_ERROR, ex.what());
+    }
+
+    return Status::OK();
+}
+
+}  // namespace server
+}  // namespace milvus
@@ -27,7 +27,7 @@ namespace server {
 
 SearchRequest::SearchRequest(const std::shared_ptr<Context>& context, const std::string& table_name,
                              const engine::VectorsData& vectors, const std::vector<Range>& range_list, int64_t topk,
-                             int64_t nprobe, const std::vector<std::string>& partition_list,
+                             int64_t nprobe, int64_t refine_factor, const std::vector<std::string>& partition_list,
                              const std::vector<std::string>& file_id_list, TopKQueryResult& result)
     : BaseRequest(context, DQL_REQUEST_GROUP),
       table_name_(table_name),
@@ -35,6 +35,7 @@ SearchRequest::SearchRequest(const std::shared_ptr<Context>& context, const std:
       range_list_(range_list),
       topk_(topk),
       nprobe_(nprobe),
+      refine_factor_(refine_factor),
       partition_list_(partition_list),
       file_id_list_(file_id_list),
       result_(result) {
@@ -43,10 +44,10 @@ SearchRequest::SearchRequest(const std::shared_ptr<Context>& context, const std:
 BaseRequestPtr
 SearchRequest::Create(const std::shared_ptr<Context>& context, const std::string& table_name,
                       const engine::VectorsData& vectors, const std::vector<Range>& range_list, int64_t topk,
-                      int64_t nprobe, const std::vector<std::string>& partition_list,
+                      int64_t nprobe, int64_t refine_factor, const std::vector<std::string>& partition_list,
                       const std::vector<std::string>& file_id_list, TopKQueryResult& result) {
     return std::shared_ptr<BaseRequest>(new SearchRequest(context, table_name, vectors, range_list, topk, nprobe,
-                                                          partition_list, file_id_list, result));
+                                                          refine_factor, partition_list, file_id_list, result));
 }
 
 Status
@@ -91,6 +92,11 @@ SearchRequest::OnExecute() {
             return status;
         }
 
+        status = ValidationUtil::ValidateSearchRefineFactor(refine_factor_);
+        if (!status.ok()) {
+            return status;
+        }
+
         if (vectors_data_.float_data_.empty() && vectors_data_.binary_data_.empty()) {
             return Status(SERVER_INVALID_ROWRECORD_ARRAY,
                           "The vector array is empty. Make sure you have entered vector records.");
@@ -153,10 +159,11 @@ SearchRequest::OnExecute() {
             }
 
             status = DBWrapper::DB()->Query(context_, table_name_, partition_list_, (size_t)topk_, nprobe_,
-                                            vectors_data_, dates, result_ids, result_distances);
+                                            refine_factor_, vectors_data_, dates, result_ids, result_distances);
         } else {
             status = DBWrapper::DB()->QueryByFileID(context_, table_name_, file_id_list_, (size_t)topk_, nprobe_,
-                                                    vectors_data_, dates, result_ids, result_distances);
+                                                    refine_factor_, vectors_data_, dates, result_ids,
+                                                    result_distances);
         }
 
 #ifdef MILVUS_ENABLE_PROFILING
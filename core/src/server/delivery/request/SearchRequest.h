@@ -24,14 +24,14 @@ class SearchRequest : public BaseRequest {
  public:
     static BaseRequestPtr
     Create(const std::shared_ptr<Context>& context, const std::string& table_name, const engine::VectorsData& vectors,
-           const std::vector<Range>& range_list, int64_t topk, int64_t nprobe,
+           const std::vector<Range>& range_list, int64_t topk, int64_t nprobe, int64_t refine_factor,
            const std::vector<std::string>& partition_list, const std::vector<std::string>& file_id_list,
            TopKQueryResult& result);
 
  protected:
     SearchRequest(const std::shared_ptr<Context>& context, const std::string& table_name,
                   const engine::VectorsData& vectors, const std::vector<Range>& range_list, int64_t topk,
-                  int64_t nprobe, const std::vector<std::string>& partition_list,
+                  int64_t nprobe, int64_t refine_factor, const std::vector<std::string>& partition_list,
                   const std::vector<std::string>& file_id_list, TopKQueryResult& result);
 
     Status
@@ -43,6 +43,7 @@ class SearchRequest : public BaseRequest {
     const std::vector<Range> range_list_;
     int64_t topk_;
     int64_t nprobe_;
+    int64_t refine_factor_;
     const std::vector<std::string> partition_list_;
     const std::vector<std::string> file_id_list_;
 
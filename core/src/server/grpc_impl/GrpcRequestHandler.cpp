@@ -71,40 +71,77 @@ void
 CopyRowRecords(const google::protobuf::RepeatedPtrField<::milvus::grpc::RowRecord>& grpc_records,
                const google::protobuf::RepeatedField<google::protobuf::int64>& grpc_id_array,
                engine::VectorsData& vectors) {
-    // step 1: copy vector data
+    // step 1: copy vector data, append straight into the target arrays to avoid a zero-filled temporary
     int64_t float_data_size = 0, binary_data_size = 0;
     for (auto& record : grpc_records) {
         float_data_size += record.float_data_size();
         binary_data_size += record.binary_data().size();
     }
 
-    std::vector<float> float_array(float_data_size, 0.0f);
-    std::vector<uint8_t> binary_array(binary_data_size, 0);
-    int64_t float_offset = 0, binary_offset = 0;
+    vectors.float_data_.clear();
+    vectors.binary_data_.clear();
     if (float_data_size > 0) {
+        vectors.float_data_.reserve(float_data_size);
         for (auto& record : grpc_records) {
-            memcpy(&float_array[float_offset], record.float_data().data(), record.float_data_size() * sizeof(float));
-            float_offset += record.float_data_size();
+            vectors.float_data_.insert(vectors.float_data_.end(), record.float_data().begin(),
+                                       record.float_data().end());
         }
     } else if (binary_data_size > 0) {
+        vectors.binary_data_.reserve(binary_data_size);
         for (auto& record : grpc_records) {
-            memcpy(&binary_array[binary_offset], record.binary_data().data(), record.binary_data().size());
-            binary_offset += record.binary_data().size();
+            auto data = reinterpret_cast<const uint8_t*>(record.binary_data().data());
+            vectors.binary_data_.insert(vectors.binary_data_.end(), data, data + record.binary_data().size());
         }
     }
 
     // step 2: copy id array
-    std::vector<int64_t> id_array;
-    if (grpc_id_array.size() > 0) {
-        id_array.resize(grpc_id_array.size());
-        memcpy(id_array.data(), grpc_id_array.data(), grpc_id_array.size() * sizeof(int64_t));
-    }
+    vectors.id_array_.assign(grpc_id_array.begin(), grpc_id_array.end());
 
     // step 3: contruct vectors
     vectors.vector_count_ = grpc_records.size();
-    vectors.float_data_.swap(float_array);
-    vectors.binary_data_.swap(binary_array);
-    vectors.id_array_.swap(id_array);
+}
+
+/* Packed format: all vectors of the request are sent back to back in a single bytes field,
+ * so they are moved into VectorsData with one bulk copy instead of one copy per RowRecord.
+ * For binary vectors the dimension is counted in bits, each row takes dimension / 8 bytes.
+ */
+bool
+IsPacked(const std::string& packed_float_data, const std::string& packed_binary_data) {
+    return !packed_float_data.empty() || !packed_binary_data.empty();
+}
+
+Status
+CopyPackedRecords(const std::string& packed_float_data, const std::string& packed_binary_data, int64_t dimension,
+                  const google::protobuf::RepeatedField<google::protobuf::int64>& grpc_id_array,
+                  engine::VectorsData& vectors) {
+    if (dimension <= 0) {
+        return Status(SERVER_INVALID_VECTOR_DIMENSION, "Invalid packed dimension: " + std::to_string(dimension));
+    }
+
+    vectors.float_data_.clear();
+    vectors.binary_data_.clear();
+    if (!packed_float_data.empty()) {
+        int64_t row_size = dimension * sizeof(float);
+        if (packed_float_data.size() % row_size != 0) {
+            return Status(SERVER_INVALID_ROWRECORD_ARRAY, "Packed float data size doesn't match dimension");
+        }
+
+        auto data = reinterpret_cast<const float*>(packed_float_data.data());
+        vectors.float_data_.assign(data, data + packed_float_data.size() / sizeof(float));
+        vectors.vector_count_ = packed_float_data.size() / row_size;
+    } else {
+        int64_t row_size = dimension / 8;
+        if (dimension % 8 != 0 || packed_binary_data.size() % row_size != 0) {
+            return Status(SERVER_INVALID_ROWRECORD_ARRAY, "Packed binary data size doesn't match dimension");
+        }
+
+        auto data = reinterpret_cast<const uint8_t*>(packed_binary_data.data());
+        vectors.binary_data_.assign(data, data + packed_binary_data.size());
+        vectors.vector_count_ = packed_binary_data.size() / row_size;
+    }
+
+    vectors.id_array_.assign(grpc_id_array.begin(), grpc_id_array.end());
+    return Status::OK();
 }
 
 }  // namespace
@@ -245,11 +282,19 @@ GrpcRequestHandler::Insert(::grpc::ServerContext* context, const ::milvus::grpc:
 
     // step 1: copy vector data
     engine::VectorsData vectors;
-    CopyRowRecords(request->row_record_array(), request->row_id_array(), vectors);
+    Status status;
+    if (IsPacked(request->packed_float_data(), request->packed_binary_data())) {
+        status = CopyPackedRecords(request->packed_float_data(), request->packed_binary_data(),
+                                   request->packed_dimension(), request->row_id_array(), vectors);
+    } else {
+        CopyRowRecords(request->row_record_array(), request->row_id_array(), vectors);
+    }
 
     // step 2: insert vectors
-    Status status =
-        request_handler_.Insert(context_map_[context], request->table_name(), vectors, request->partition_tag());
+    if (status.ok()) {
+        status =
+            request_handler_.Insert(context_map_[context], request->table_name(), vectors, request->partition_tag());
+    }
 
     // step 3: return id array
     response->mutable_vector_id_array()->Resize(static_cast<int>(vectors.id_array_.size()), 0);
@@ -267,7 +312,18 @@ GrpcRequestHandler::Search(::grpc::ServerContext* context, const ::milvus::grpc:
 
     // step 1: copy vector data
     engine::VectorsData vectors;
-    CopyRowRecords(request->query_record_array(), google::protobuf::RepeatedField<google::protobuf::int64>(), vectors);
+    if (IsPacked(request->packed_float_data(), request->packed_binary_data())) {
+        Status status = CopyPackedRecords(request->packed_float_data(), request->packed_binary_data(),
+                                          request->packed_dimension(),
+                                          google::protobuf::RepeatedField<google::protobuf::int64>(), vectors);
+        if (!status.ok()) {
+            SET_RESPONSE(response->mutable_status(), status, context);
+            return ::grpc::Status::OK;
+        }
+    } else {
+        CopyRowRecords(request->query_record_array(), google::protobuf::RepeatedField<google::protobuf::int64>(),
+                       vectors);
+    }
 
     // deprecated
     std::vector<Range> ranges;
@@ -285,8 +341,9 @@ GrpcRequestHandler::Search(::grpc::ServerContext* context, const ::milvus::grpc:
     std::vector<std::string> file_ids;
     TopKQueryResult result;
     fiu_do_on("GrpcRequestHandler.Search.not_empty_file_ids", file_ids.emplace_back("test_file_id"));
-    Status status = request_handler_.Search(context_map_[context], request->table_name(), vectors, ranges,
-                                            request->topk(), request->nprobe(), partitions, file_ids, result);
+    Status status =
+        request_handler_.Search(context_map_[context], request->table_name(), vectors, ranges, request->topk(),
+                                request->nprobe(), request->refine_factor(), partitions, file_ids, result);
 
     // step 4: construct and return result
     response->set_row_num(result.row_num_);
@@ -312,8 +369,18 @@ GrpcRequestHandler::SearchInFiles(::grpc::ServerContext* context, const ::milvus
 
     // step 1: copy vector data
     engine::VectorsData vectors;
-    CopyRowRecords(search_request->query_record_array(), google::protobuf::RepeatedField<google::protobuf::int64>(),
-                   vectors);
+    if (IsPacked(search_request->packed_float_data(), search_request->packed_binary_data())) {
+        Status status = CopyPackedRecords(search_request->packed_float_data(), search_request->packed_binary_data(),
+                                          search_request->packed_dimension(),
+                                          google::protobuf::RepeatedField<google::protobuf::int64>(), vectors);
+        if (!status.ok()) {
+            SET_RESPONSE(response->mutable_status(), status, context);
+            return ::grpc::Status::OK;
+        }
+    } else {
+        CopyRowRecords(search_request->query_record_array(),
+                       google::protobuf::RepeatedField<google::protobuf::int64>(), vectors);
+    }
 
     // deprecated
     std::vector<Range> ranges;
@@ -337,7 +404,8 @@ GrpcRequestHandler::SearchInFiles(::grpc::ServerContext* context, const ::milvus
     TopKQueryResult result;
     Status status =
         request_handler_.Search(context_map_[context], search_request->table_name(), vectors, ranges,
-                                search_request->topk(), search_request->nprobe(), partitions, file_ids, result);
+                                search_request->topk(), search_request->nprobe(), search_request->refine_factor(),
+                                partitions, file_ids, result);
 
     // step 5: construct and return result
     response->set_row_num(result.row_num_);
@@ -432,6 +500,67 @@ GrpcRequestHandler::PreloadTable(::grpc::ServerContext* context, const ::milvus:
     return ::grpc::Status::OK;
 }
 
+::grpc::Status
+GrpcRequestHandler::RangeSearch(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
+                                ::milvus::grpc::TopKQueryResult* response) {
+    CHECK_NULLPTR_RETURN(request);
+
+    // step 1: copy vector data
+    engine::VectorsData vectors;
+    if (IsPacked(request->packed_float_data(), request->packed_binary_data())) {
+        Status status = CopyPackedRecords(request->packed_float_data(), request->packed_binary_data(),
+                                          request->packed_dimension(),
+                                          google::protobuf::RepeatedField<google::protobuf::int64>(), vectors);
+        if (!status.ok()) {
+            SET_RESPONSE(response->mutable_status(), status, context);
+            return ::grpc::Status::OK;
+        }
+    } else {
+        CopyRowRecords(request->query_record_array(), google::protobuf::RepeatedField<google::protobuf::int64>(),
+                       vectors);
+    }
+
+    // step 2: partition tags
+    std::vector<std::string> partitions;
+    for (auto& partition : request->partition_tag_array()) {
+        partitions.emplace_back(partition);
+    }
+
+    // step 3: search vectors
+    TopKQueryResult result;
+    Status status = request_handler_.RangeSearch(context_map_[context], request->table_name(), vectors,
+                                                 request->radius(), request->nprobe(), partitions, result);
+
+    // step 4: construct and return result, query i owns ids and distances in [lims[i], lims[i + 1])
+    response->set_row_num(result.row_num_);
+
+    response->mutable_lims()->Resize(static_cast<int>(result.lims_.size()), 0);
+    memcpy(response->mutable_lims()->mutable_data(), result.lims_.data(), result.lims_.size() * sizeof(int64_t));
+
+    response->mutable_ids()->Resize(static_cast<int>(result.id_list_.size()), 0);
+    memcpy(response->mutable_ids()->mutable_data(), result.id_list_.data(), result.id_list_.size() * sizeof(int64_t));
+
+    response->mutable_distances()->Resize(static_cast<int>(result.distance_list_.size()), 0.0);
+    memcpy(response->mutable_distances()->mutable_data(), result.distance_list_.data(),
+           result.distance_list_.size() * sizeof(float));
+
+    SET_RESPONSE(response->mutable_status(), status, context);
+
+    return ::grpc::Status::OK;
+}
+
+::grpc::Status
+GrpcRequestHandler::DeleteByID(::grpc::ServerContext* context, const ::milvus::grpc::DeleteByIDParam* request,
+                               ::milvus::grpc::Status* response) {
+    CHECK_NULLPTR_RETURN(request);
+
+    std::vector<int64_t> vector_ids(request->id_array().begin(), request->id_array().end());
+    Status status = request_handler_.DeleteByID(context_map_[context], request->table_name(), vector_ids);
+    SET_RESPONSE(response, status, context);
+
+    return ::grpc::Status::OK;
+}
+
 ::grpc::Status
 GrpcRequestHandler::DescribeIndex(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
                                   ::milvus::grpc::IndexParam* response) {
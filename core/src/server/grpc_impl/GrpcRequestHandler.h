@@ -241,6 +241,24 @@ class GrpcRequestHandler final : public ::milvus::grpc::MilvusService::Service,
     ::grpc::Status
     PreloadTable(::grpc::ServerContext* context, const ::milvus::grpc::TableName* request,
                  ::milvus::grpc::Status* response) override;
+    // *
+    // @brief This method is used to find all vectors within a radius of the query vectors.
+    //
+    // @param SearchParam, search parameters, radius is used instead of topk.
+    //
+    // @return TopKQueryResult, a variable number of results per query, delimited by lims
+    ::grpc::Status
+    RangeSearch(::grpc::ServerContext* context, const ::milvus::grpc::SearchParam* request,
+                ::milvus::grpc::TopKQueryResult* response) override;
+    // *
+    // @brief This method is used to delete vectors by id, they disappear from searches at once
+    //
+    // @param DeleteByIDParam, target table and vector ids.
+    //
+    // @return Status
+    ::grpc::Status
+    DeleteByID(::grpc::ServerContext* context, const ::milvus::grpc::DeleteByIDParam* request,
+               ::milvus::grpc::Status* response) override;
 
     GrpcRequestHandler&
     RegisterRequestHandler(const RequestHandler& handler) {
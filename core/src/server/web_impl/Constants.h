@@ -39,6 +39,11 @@ static const char* NAME_ENGINE_TYPE_IVFSQ8 = "IVFSQ8";
 static const char* NAME_ENGINE_TYPE_IVFSQ8H = "IVFSQ8H";
 static const char* NAME_ENGINE_TYPE_RNSG = "RNSG";
 static const char* NAME_ENGINE_TYPE_IVFPQ = "IVFPQ";
+static const char* NAME_ENGINE_TYPE_IVFFLAT_FP16 = "IVFFLAT_FP16";
+static const char* NAME_ENGINE_TYPE_IVFFLAT_BF16 = "IVFFLAT_BF16";
+static const char* NAME_ENGINE_TYPE_IVFPQ_FASTSCAN = "IVFPQ_FASTSCAN";
+static const char* NAME_ENGINE_TYPE_IVFSQ8_REFINE = "IVFSQ8_REFINE";
+static const char* NAME_ENGINE_TYPE_IVFPQ_REFINE = "IVFPQ_REFINE";
 
 static const char* NAME_METRIC_TYPE_L2 = "L2";
 static const char* NAME_METRIC_TYPE_IP = "IP";
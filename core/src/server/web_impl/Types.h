@@ -75,6 +75,11 @@ static const std::unordered_map<engine::EngineType, std::string> IndexMap = {
     {engine::EngineType::FAISS_IVFSQ8H, NAME_ENGINE_TYPE_IVFSQ8H},
     {engine::EngineType::NSG_MIX, NAME_ENGINE_TYPE_RNSG},
     {engine::EngineType::FAISS_PQ, NAME_ENGINE_TYPE_IVFPQ},
+    {engine::EngineType::FAISS_IVFFLAT_FP16, NAME_ENGINE_TYPE_IVFFLAT_FP16},
+    {engine::EngineType::FAISS_IVFFLAT_BF16, NAME_ENGINE_TYPE_IVFFLAT_BF16},
+    {engine::EngineType::FAISS_PQ_FASTSCAN, NAME_ENGINE_TYPE_IVFPQ_FASTSCAN},
+    {engine::EngineType::FAISS_IVFSQ8_REFINE, NAME_ENGINE_TYPE_IVFSQ8_REFINE},
+    {engine::EngineType::FAISS_PQ_REFINE, NAME_ENGINE_TYPE_IVFPQ_REFINE},
 };
 
 static const std::unordered_map<std::string, engine::EngineType> IndexNameMap = {
@@ -84,6 +89,11 @@ static const std::unordered_map<std::string, engine::EngineType> IndexNameMap =
     {NAME_ENGINE_TYPE_IVFSQ8H, engine::EngineType::FAISS_IVFSQ8H},
     {NAME_ENGINE_TYPE_RNSG, engine::EngineType::NSG_MIX},
     {NAME_ENGINE_TYPE_IVFPQ, engine::EngineType::FAISS_PQ},
+    {NAME_ENGINE_TYPE_IVFFLAT_FP16, engine::EngineType::FAISS_IVFFLAT_FP16},
+    {NAME_ENGINE_TYPE_IVFFLAT_BF16, engine::EngineType::FAISS_IVFFLAT_BF16},
+    {NAME_ENGINE_TYPE_IVFPQ_FASTSCAN, engine::EngineType::FAISS_PQ_FASTSCAN},
+    {NAME_ENGINE_TYPE_IVFSQ8_REFINE, engine::EngineType::FAISS_IVFSQ8_REFINE},
+    {NAME_ENGINE_TYPE_IVFPQ_REFINE, engine::EngineType::FAISS_PQ_REFINE},
 };
 
 static const std::unordered_map<engine::MetricType, std::string> MetricMap = {
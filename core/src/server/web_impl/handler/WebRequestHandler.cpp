@@ -670,6 +670,11 @@ WebRequestHandler::Search(const OString& table_name, const SearchRequestDto::Obj
     }
     int64_t nprobe_t = request->nprobe->getValue();
 
+    int64_t refine_factor_t = 0;
+    if (nullptr != request->refine_factor.get()) {
+        refine_factor_t = request->refine_factor->getValue();
+    }
+
     std::vector<std::string> tag_list;
     if (nullptr != request->tags.get()) {
         request->tags->forEach([&tag_list](const OString& tag) { tag_list.emplace_back(tag->std_str()); });
@@ -713,7 +718,7 @@ WebRequestHandler::Search(const OString& table_name, const SearchRequestDto::Obj
     TopKQueryResult result;
     auto context_ptr = GenContextPtr("Web Handler");
     status = request_handler_.Search(context_ptr, table_name->std_str(), vectors, range_list, topk_t, nprobe_t,
-                                     tag_list, file_id_list, result);
+                                     refine_factor_t, tag_list, file_id_list, result);
     if (!status.ok()) {
         ASSIGN_RETURN_STATUS_DTO(status)
     }
@@ -0,0 +1,82 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "storage/file/MmapIOReader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "utils/Log.h"
+
+namespace milvus {
+namespace storage {
+
+MmapIOReader::MmapIOReader(const std::string& name) : IOReader(name) {
+    int fd = open(name_.c_str(), O_RDONLY);
+    if (fd < 0) {
+        STORAGE_LOG_ERROR << "Failed to open " << name_ << ": " << strerror(errno);
+        return;
+    }
+
+    struct stat buf;
+    if (fstat(fd, &buf) != 0 || buf.st_size <= 0) {
+        close(fd);
+        return;
+    }
+
+    size_t length = buf.st_size;
+    void* ptr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        STORAGE_LOG_ERROR << "Failed to mmap " << name_ << ": " << strerror(errno);
+        return;
+    }
+
+    length_ = length;
+    data_ = std::shared_ptr<uint8_t>(static_cast<uint8_t*>(ptr), [length](uint8_t* p) { munmap(p, length); });
+}
+
+void
+MmapIOReader::read(void* ptr, size_t size) {
+    if (pos_ >= length_) {
+        return;
+    }
+    size = std::min(size, length_ - pos_);
+    memcpy(ptr, data_.get() + pos_, size);
+    pos_ += size;
+}
+
+void
+MmapIOReader::seekg(size_t pos) {
+    pos_ = pos;
+}
+
+size_t
+MmapIOReader::length() {
+    return length_;
+}
+
+std::shared_ptr<uint8_t>
+MmapIOReader::slice(size_t pos, size_t size) {
+    if (data_ == nullptr || pos + size > length_) {
+        return nullptr;
+    }
+    // aliasing constructor: shares ownership of the whole mapping
+    return std::shared_ptr<uint8_t>(data_, data_.get() + pos);
+}
+
+}  // namespace storage
+}  // namespace milvus
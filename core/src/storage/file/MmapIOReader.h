@@ -0,0 +1,51 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storage/IOReader.h"
+
+namespace milvus {
+namespace storage {
+
+/*
+ * Reads a local file through a read-only shared mapping;
+ * slice() hands out pointers into the mapped pages without copying, the
+ * mapping stays alive as long as any slice or the reader itself does;
+ */
+class MmapIOReader : public IOReader {
+ public:
+    explicit MmapIOReader(const std::string& name);
+    ~MmapIOReader() = default;
+
+    void
+    read(void* ptr, size_t size) override;
+
+    void
+    seekg(size_t pos) override;
+
+    size_t
+    length() override;
+
+    std::shared_ptr<uint8_t>
+    slice(size_t pos, size_t size);
+
+ private:
+    std::shared_ptr<uint8_t> data_ = nullptr;
+    size_t length_ = 0;
+    size_t pos_ = 0;
+};
+
+}  // namespace storage
+}  // namespace milvus
@@ -10,6 +10,8 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include <memory>
+#include <mutex>
+#include <string>
 #include <utility>
 
 #include <aws/core/Aws.h>
@@ -22,6 +24,7 @@
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/PutObjectRequest.h>
 
 namespace milvus {
@@ -30,7 +33,7 @@ namespace storage {
 /*
  * This is a class that represents a S3 Client which is used to mimic the put/get operations of a actual s3 client.
  * During a put object, the body of the request is stored as well as the metadata of the request. This data is then
- * populated into a get object result when a get operation is called.
+ * populated into a get object result when a get operation is called, honoring the byte range if one is set.
  */
 class S3ClientMock : public Aws::S3::S3Client {
  public:
@@ -52,9 +55,11 @@ class S3ClientMock : public Aws::S3::S3Client {
 
     Aws::S3::Model::PutObjectOutcome
     PutObject(const Aws::S3::Model::PutObjectRequest& request) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
         Aws::String key = request.GetKey();
         std::shared_ptr<Aws::IOStream> body = request.GetBody();
-        aws_map_[key] = body;
+        Aws::String body_str((Aws::IStreamBufIterator(*body)), Aws::IStreamBufIterator());
+        aws_map_[key] = body_str;
 
         Aws::S3::Model::PutObjectResult result;
         return Aws::S3::Model::PutObjectOutcome(std::move(result));
@@ -66,8 +71,19 @@ class S3ClientMock : public Aws::S3::S3Client {
         Aws::Utils::Stream::ResponseStream resp_stream(factory);
 
         try {
-            std::shared_ptr<Aws::IOStream> body = aws_map_.at(request.GetKey());
-            Aws::String body_str((Aws::IStreamBufIterator(*body)), Aws::IStreamBufIterator());
+            std::lock_guard<std::mutex> lock(mutex_);
+            Aws::String body_str = aws_map_.at(request.GetKey());
+            if (request.RangeHasBeenSet()) {
+                // "bytes=first-last"
+                std::string range = request.GetRange().c_str();
+                auto dash = range.find('-');
+                size_t first = std::stoull(range.substr(6, dash - 6));
+                size_t last = std::stoull(range.substr(dash + 1));
+                if (first >= body_str.length()) {
+                    return Aws::S3::Model::GetObjectOutcome();
+                }
+                body_str = body_str.substr(first, last - first + 1);
+            }
 
             resp_stream.GetUnderlyingStream().write(body_str.c_str(), body_str.length());
             resp_stream.GetUnderlyingStream().flush();
@@ -81,6 +97,18 @@ class S3ClientMock : public Aws::S3::S3Client {
         }
     }
 
+    Aws::S3::Model::HeadObjectOutcome
+    HeadObject(const Aws::S3::Model::HeadObjectRequest& request) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = aws_map_.find(request.GetKey());
+        if (iter == aws_map_.end()) {
+            return Aws::S3::Model::HeadObjectOutcome();
+        }
+        Aws::S3::Model::HeadObjectResult result;
+        result.SetContentLength(iter->second.length());
+        return Aws::S3::Model::HeadObjectOutcome(std::move(result));
+    }
+
     Aws::S3::Model::ListObjectsOutcome
     ListObjects(const Aws::S3::Model::ListObjectsRequest& request) const override {
         /* TODO: add object key list into ListObjectsOutcome */
@@ -91,6 +119,7 @@ class S3ClientMock : public Aws::S3::S3Client {
 
     Aws::S3::Model::DeleteObjectOutcome
     DeleteObject(const Aws::S3::Model::DeleteObjectRequest& request) const override {
+        std::lock_guard<std::mutex> lock(mutex_);
         Aws::String key = request.GetKey();
         aws_map_.erase(key);
         Aws::S3::Model::DeleteObjectResult result;
@@ -98,7 +127,8 @@ class S3ClientMock : public Aws::S3::S3Client {
         return result;
     }
 
-    mutable Aws::Map<Aws::String, std::shared_ptr<Aws::IOStream>> aws_map_;
+    mutable Aws::Map<Aws::String, Aws::String> aws_map_;
+    mutable std::mutex mutex_;
 };
 
 }  // namespace storage
@@ -14,6 +14,7 @@
 #include <aws/s3/model/DeleteBucketRequest.h>
 #include <aws/s3/model/DeleteObjectRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/ListObjectsRequest.h>
 #include <aws/s3/model/PutObjectRequest.h>
 #include <fiu-local.h>
@@ -25,12 +26,15 @@
 #include "server/Config.h"
 #include "storage/s3/S3ClientMock.h"
 #include "storage/s3/S3ClientWrapper.h"
+#include "storage/s3/S3DiskCache.h"
 #include "utils/Error.h"
 #include "utils/Log.h"
 
 namespace milvus {
 namespace storage {
 
+constexpr int64_t GB = 1UL << 30;
+
 Status
 S3ClientWrapper::StartService() {
     server::Config& config = server::Config::GetInstance();
@@ -48,6 +52,15 @@ S3ClientWrapper::StartService() {
     CONFIG_CHECK(config.GetStorageConfigS3SecretKey(s3_secret_key_));
     CONFIG_CHECK(config.GetStorageConfigS3Bucket(s3_bucket_));
 
+    std::string cache_path;
+    int64_t cache_capacity;
+    CONFIG_CHECK(config.GetStorageConfigS3CachePath(cache_path));
+    CONFIG_CHECK(config.GetStorageConfigS3CacheCapacity(cache_capacity));
+    auto status = S3DiskCache::GetInstance().Start(cache_path, cache_capacity * GB);
+    if (!status.ok()) {
+        return status;
+    }
+
     Aws::InitAPI(options_);
 
     Aws::Client::ClientConfiguration cfg;
@@ -69,6 +82,7 @@ S3ClientWrapper::StartService() {
 
 void
 S3ClientWrapper::StopService() {
+    S3DiskCache::GetInstance().Stop();
     if (client_ptr_ != nullptr) {
         client_ptr_ = nullptr;
     }
@@ -210,6 +224,53 @@ S3ClientWrapper::GetObjectStr(const std::string& object_name, std::string& conte
     return Status::OK();
 }
 
+Status
+S3ClientWrapper::GetObjectLength(const std::string& object_name, size_t& length) {
+    Aws::S3::Model::HeadObjectRequest request;
+    request.WithBucket(s3_bucket_).WithKey(object_name);
+
+    auto outcome = client_ptr_->HeadObject(request);
+
+    fiu_do_on("S3ClientWrapper.GetObjectLength.outcome.fail", outcome = Aws::S3::Model::HeadObjectOutcome());
+    if (!outcome.IsSuccess()) {
+        auto err = outcome.GetError();
+        STORAGE_LOG_ERROR << "ERROR: HeadObject: " << err.GetExceptionName() << ": " << err.GetMessage();
+        return Status(SERVER_UNEXPECTED_ERROR, err.GetMessage());
+    }
+
+    length = outcome.GetResult().GetContentLength();
+    return Status::OK();
+}
+
+Status
+S3ClientWrapper::GetObjectRange(const std::string& object_name, size_t offset, size_t size, char* buffer) {
+    if (size == 0) {
+        return Status::OK();
+    }
+
+    Aws::S3::Model::GetObjectRequest request;
+    request.WithBucket(s3_bucket_).WithKey(object_name);
+    request.SetRange("bytes=" + std::to_string(offset) + "-" + std::to_string(offset + size - 1));
+
+    auto outcome = client_ptr_->GetObject(request);
+
+    fiu_do_on("S3ClientWrapper.GetObjectRange.outcome.fail", outcome = Aws::S3::Model::GetObjectOutcome());
+    if (!outcome.IsSuccess()) {
+        auto err = outcome.GetError();
+        STORAGE_LOG_ERROR << "ERROR: GetObject: " << err.GetExceptionName() << ": " << err.GetMessage();
+        return Status(SERVER_UNEXPECTED_ERROR, err.GetMessage());
+    }
+
+    auto& body = outcome.GetResultWithOwnership().GetBody();
+    body.read(buffer, size);
+    if (static_cast<size_t>(body.gcount()) != size) {
+        std::string msg = "Short read of " + object_name + " at " + std::to_string(offset);
+        STORAGE_LOG_ERROR << "ERROR: GetObject: " << msg;
+        return Status(SERVER_UNEXPECTED_ERROR, msg);
+    }
+    return Status::OK();
+}
+
 Status
 S3ClientWrapper::ListObjects(std::vector<std::string>& object_list, const std::string& marker) {
     Aws::S3::Model::ListObjectsRequest request;
@@ -256,6 +317,7 @@ S3ClientWrapper::DeleteObject(const std::string& object_name) {
         return Status(SERVER_UNEXPECTED_ERROR, err.GetMessage());
     }
 
+    S3DiskCache::GetInstance().Erase(object_name);
     STORAGE_LOG_DEBUG << "DeleteObject '" << object_name << "' successfully!";
     return Status::OK();
 }
@@ -47,6 +47,10 @@ class S3ClientWrapper : public IStorage {
     Status
     GetObjectStr(const std::string& object_key, std::string& content) override;
     Status
+    GetObjectLength(const std::string& object_key, size_t& length) override;
+    Status
+    GetObjectRange(const std::string& object_key, size_t offset, size_t size, char* buffer) override;
+    Status
     ListObjects(std::vector<std::string>& object_list, const std::string& marker = "") override;
     Status
     DeleteObject(const std::string& object_key) override;
@@ -0,0 +1,179 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#include "storage/s3/S3DiskCache.h"
+
+#include <boost/filesystem.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "utils/CommonUtil.h"
+#include "utils/Error.h"
+#include "utils/Log.h"
+
+namespace milvus {
+namespace storage {
+
+namespace {
+constexpr const char* TEMP_SUFFIX = ".tmp";
+}
+
+Status
+S3DiskCache::Start(const std::string& path, int64_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_.clear();
+    lru_.clear();
+    usage_ = 0;
+    if (path.empty()) {
+        return Status::OK();
+    }
+
+    auto status = server::CommonUtil::CreateDirectory(path);
+    if (!status.ok()) {
+        STORAGE_LOG_ERROR << "Failed to create s3 cache directory " << path;
+        return status;
+    }
+
+    // reload cached files, oldest first so the newest end up most recently used
+    std::vector<std::pair<std::time_t, boost::filesystem::path>> files;
+    boost::filesystem::directory_iterator end_iter;
+    for (boost::filesystem::directory_iterator iter(path); iter != end_iter; ++iter) {
+        if (!boost::filesystem::is_regular_file(iter->status())) {
+            continue;
+        }
+        if (iter->path().extension() == TEMP_SUFFIX) {
+            // left over from an interrupted download
+            boost::filesystem::remove(iter->path());
+            continue;
+        }
+        files.emplace_back(boost::filesystem::last_write_time(iter->path()), iter->path());
+    }
+    std::sort(files.begin(), files.end());
+    for (auto& file : files) {
+        auto size = static_cast<int64_t>(boost::filesystem::file_size(file.second));
+        lru_.put(file.second.filename().string(), size);
+        usage_ += size;
+    }
+
+    path_ = path;
+    capacity_ = capacity;
+    Evict();
+    STORAGE_LOG_INFO << "S3 disk cache " << path_ << " holds " << lru_.size() << " files, " << usage_ << " bytes";
+    return Status::OK();
+}
+
+void
+S3DiskCache::Stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    path_.clear();
+    lru_.clear();
+    usage_ = 0;
+}
+
+bool
+S3DiskCache::Enabled() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !path_.empty();
+}
+
+bool
+S3DiskCache::Get(const std::string& object_key, std::string& file_path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (path_.empty()) {
+        return false;
+    }
+
+    auto name = FileName(object_key);
+    if (!lru_.exists(name)) {
+        return false;
+    }
+    lru_.get(name);  // touch
+    file_path = path_ + "/" + name;
+    return true;
+}
+
+std::string
+S3DiskCache::TempPath(const std::string& object_key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return path_ + "/" + FileName(object_key) + "." + std::to_string(temp_seq_++) + TEMP_SUFFIX;
+}
+
+Status
+S3DiskCache::Put(const std::string& object_key, const std::string& temp_path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (path_.empty()) {
+        std::remove(temp_path.c_str());
+        return Status::OK();
+    }
+
+    auto name = FileName(object_key);
+    auto file_path = path_ + "/" + name;
+    if (std::rename(temp_path.c_str(), file_path.c_str()) != 0) {
+        std::remove(temp_path.c_str());
+        std::string msg = "Failed to move " + temp_path + " into s3 cache";
+        STORAGE_LOG_ERROR << msg;
+        return Status(SERVER_UNEXPECTED_ERROR, msg);
+    }
+
+    if (lru_.exists(name)) {
+        usage_ -= lru_.get(name);
+    }
+    auto size = static_cast<int64_t>(server::CommonUtil::GetFileSize(file_path));
+    lru_.put(name, size);
+    usage_ += size;
+    Evict();
+    return Status::OK();
+}
+
+void
+S3DiskCache::Erase(const std::string& object_key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (path_.empty()) {
+        return;
+    }
+
+    auto name = FileName(object_key);
+    if (lru_.exists(name)) {
+        usage_ -= lru_.get(name);
+        lru_.erase(name);
+        std::remove((path_ + "/" + name).c_str());
+    }
+}
+
+int64_t
+S3DiskCache::Usage() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return usage_;
+}
+
+std::string
+S3DiskCache::FileName(const std::string& object_key) {
+    return std::to_string(std::hash<std::string>()(object_key));
+}
+
+void
+S3DiskCache::Evict() {
+    // called with mutex_ held; readers that already opened an evicted file keep reading it
+    while (usage_ > capacity_ && lru_.size() > 0) {
+        auto last = lru_.rbegin();
+        std::string name = last->first;
+        usage_ -= last->second;
+        lru_.erase(name);
+        std::remove((path_ + "/" + name).c_str());
+        STORAGE_LOG_DEBUG << "Evict " << name << " from s3 cache";
+    }
+}
+
+}  // namespace storage
+}  // namespace milvus
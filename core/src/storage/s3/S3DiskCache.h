@@ -0,0 +1,94 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License.
+
+#pragma once
+
+#include <limits>
+#include <mutex>
+#include <string>
+
+#include "cache/LRU.h"
+#include "utils/Status.h"
+
+namespace milvus {
+namespace storage {
+
+/*
+ * Local-disk tier in front of S3: objects are kept as files under one
+ * directory, named by the hash of their key, and evicted least recently
+ * used first once the directory grows beyond capacity.
+ */
+class S3DiskCache {
+ public:
+    static S3DiskCache&
+    GetInstance() {
+        static S3DiskCache cache;
+        return cache;
+    }
+
+    /*
+     * Empty path disables the cache; files already in the directory are
+     * picked up again, so cached objects survive restarts.
+     */
+    Status
+    Start(const std::string& path, int64_t capacity);
+
+    void
+    Stop();
+
+    bool
+    Enabled();
+
+    /*
+     * Return true and the local file of object_key if it is cached.
+     */
+    bool
+    Get(const std::string& object_key, std::string& file_path);
+
+    /*
+     * A unique file under the cache directory to stage object_key into.
+     */
+    std::string
+    TempPath(const std::string& object_key);
+
+    /*
+     * Move a fully staged temp file into the cache.
+     */
+    Status
+    Put(const std::string& object_key, const std::string& temp_path);
+
+    void
+    Erase(const std::string& object_key);
+
+    int64_t
+    Usage();
+
+ private:
+    S3DiskCache() : lru_(std::numeric_limits<size_t>::max()) {
+    }
+
+    std::string
+    FileName(const std::string& object_key);
+
+    void
+    Evict();
+
+ private:
+    std::mutex mutex_;
+    std::string path_;
+    int64_t capacity_ = 0;
+    int64_t usage_ = 0;
+    uint64_t temp_seq_ = 0;
+    cache::LRU<std::string, int64_t> lru_;  // file name -> file size
+};
+
+}  // namespace storage
+}  // namespace milvus
@@ -10,21 +10,98 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "storage/s3/S3IOReader.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
 #include "storage/s3/S3ClientWrapper.h"
+#include "storage/s3/S3DiskCache.h"
+#include "utils/Error.h"
+#include "utils/Exception.h"
+#include "utils/Log.h"
 
 namespace milvus {
 namespace storage {
 
-S3IOReader::S3IOReader(const std::string& name) : IOReader(name), pos_(0) {
-    S3ClientWrapper::GetInstance().GetObjectStr(name_, buffer_);
+namespace {
+constexpr size_t READ_BLOCK_SIZE = 4UL << 20;  // read-ahead for small reads
+constexpr size_t PART_SIZE = 8UL << 20;        // one ranged GET of a multipart download
+constexpr size_t MAX_PARALLEL_PARTS = 8;
+}  // namespace
+
+S3IOReader::S3IOReader(const std::string& name) : IOReader(name) {
+    auto& cache = S3DiskCache::GetInstance();
+    std::string cache_path;
+    if (cache.Get(name_, cache_path)) {
+        cache_in_.open(cache_path, std::ios::in | std::ios::binary);
+        if (cache_in_.is_open()) {
+            cache_in_.seekg(0, cache_in_.end);
+            length_ = cache_in_.tellg();
+            return;
+        }
+    }
+
+    auto status = S3ClientWrapper::GetInstance().GetObjectLength(name_, length_);
+    if (!status.ok()) {
+        length_ = 0;
+        return;
+    }
+
+    if (cache.Enabled()) {
+        cache_temp_path_ = cache.TempPath(name_);
+        cache_out_.open(cache_temp_path_, std::ios::out | std::ios::binary);
+    }
 }
 
 S3IOReader::~S3IOReader() {
+    if (cache_out_.is_open()) {
+        cache_out_.close();
+        if (cache_written_ == length_ && length_ > 0) {
+            S3DiskCache::GetInstance().Put(name_, cache_temp_path_);
+        } else {
+            std::remove(cache_temp_path_.c_str());
+        }
+    }
 }
 
 void
 S3IOReader::read(void* ptr, size_t size) {
-    memcpy(ptr, buffer_.data() + pos_, size);
+    if (pos_ >= length_) {
+        return;
+    }
+    size = std::min(size, length_ - pos_);
+    auto dst = reinterpret_cast<char*>(ptr);
+
+    if (cache_in_.is_open()) {
+        cache_in_.seekg(pos_);
+        cache_in_.read(dst, size);
+        pos_ += size;
+        return;
+    }
+
+    // the part already in the read-ahead block
+    if (pos_ >= block_offset_ && pos_ < block_offset_ + block_.size()) {
+        size_t n = std::min(size, block_offset_ + block_.size() - pos_);
+        memcpy(dst, block_.data() + (pos_ - block_offset_), n);
+        dst += n;
+        pos_ += n;
+        size -= n;
+    }
+    if (size == 0) {
+        return;
+    }
+
+    if (size >= READ_BLOCK_SIZE) {
+        FetchRange(pos_, size, dst);
+    } else {
+        block_offset_ = pos_;
+        block_.resize(std::min(READ_BLOCK_SIZE, length_ - pos_));
+        FetchRange(block_offset_, block_.size(), block_.data());
+        memcpy(dst, block_.data(), size);
+    }
+    pos_ += size;
 }
 
 void
@@ -34,7 +111,47 @@ S3IOReader::seekg(size_t pos) {
 
 size_t
 S3IOReader::length() {
-    return buffer_.length();
+    return length_;
+}
+
+void
+S3IOReader::FetchRange(size_t offset, size_t size, char* buffer) {
+    auto& client = S3ClientWrapper::GetInstance();
+    size_t part_num = (size + PART_SIZE - 1) / PART_SIZE;
+    if (part_num <= 1) {
+        auto status = client.GetObjectRange(name_, offset, size, buffer);
+        if (!status.ok()) {
+            throw Exception(status.code(), status.message());
+        }
+    } else {
+        std::vector<Status> part_status(part_num);
+        std::vector<std::thread> threads;
+        size_t thread_num = std::min(part_num, MAX_PARALLEL_PARTS);
+        for (size_t t = 0; t < thread_num; ++t) {
+            threads.emplace_back([&, t]() {
+                for (size_t i = t; i < part_num; i += thread_num) {
+                    size_t part_offset = i * PART_SIZE;
+                    size_t part_size = std::min(PART_SIZE, size - part_offset);
+                    part_status[i] =
+                        client.GetObjectRange(name_, offset + part_offset, part_size, buffer + part_offset);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto& status : part_status) {
+            if (!status.ok()) {
+                throw Exception(status.code(), status.message());
+            }
+        }
+    }
+
+    // stage into the disk cache as long as the object is read sequentially
+    if (cache_out_.is_open() && offset == cache_written_) {
+        cache_out_.write(buffer, size);
+        cache_written_ += size;
+    }
 }
 
 }  // namespace storage
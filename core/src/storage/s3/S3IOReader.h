@@ -11,12 +11,22 @@
 
 #pragma once
 
+#include <fstream>
 #include <string>
+#include <vector>
+
 #include "storage/IOReader.h"
 
 namespace milvus {
 namespace storage {
 
+/*
+ * Reads an S3 object by byte ranges instead of downloading it up front;
+ * small reads are served from a read-ahead block, large reads are fetched
+ * straight into the caller's buffer as parallel ranged GETs. When the local
+ * disk cache is enabled, cached objects are read from disk and objects read
+ * through from start to end are added to the cache.
+ */
 class S3IOReader : public IOReader {
  public:
     explicit S3IOReader(const std::string& name);
@@ -31,9 +41,25 @@ class S3IOReader : public IOReader {
     size_t
     length() override;
 
- public:
-    std::string buffer_;
-    size_t pos_;
+ private:
+    void
+    FetchRange(size_t offset, size_t size, char* buffer);
+
+ private:
+    size_t pos_ = 0;
+    size_t length_ = 0;
+
+    // read-ahead block, covers [block_offset_, block_offset_ + block_.size())
+    std::vector<char> block_;
+    size_t block_offset_ = 0;
+
+    // served from local disk cache
+    std::ifstream cache_in_;
+
+    // staging file filled while reading sequentially from S3
+    std::ofstream cache_out_;
+    std::string cache_temp_path_;
+    size_t cache_written_ = 0;
 };
 
 }  // namespace storage
@@ -10,22 +10,47 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include "storage/s3/S3IOWriter.h"
+
+#include <cstdio>
+
 #include "storage/s3/S3ClientWrapper.h"
+#include "storage/s3/S3DiskCache.h"
 
 namespace milvus {
 namespace storage {
 
 S3IOWriter::S3IOWriter(const std::string& name) : IOWriter(name) {
     buffer_ = "";
+    auto& cache = S3DiskCache::GetInstance();
+    if (cache.Enabled()) {
+        cache_temp_path_ = cache.TempPath(name_);
+        cache_out_.open(cache_temp_path_, std::ios::out | std::ios::binary);
+    }
 }
 
 S3IOWriter::~S3IOWriter() {
-    S3ClientWrapper::GetInstance().PutObjectStr(name_, buffer_);
+    auto& cache = S3DiskCache::GetInstance();
+    if (cache_out_.is_open()) {
+        cache_out_.close();
+        if (S3ClientWrapper::GetInstance().PutObjectFile(name_, cache_temp_path_).ok()) {
+            cache.Put(name_, cache_temp_path_);
+        } else {
+            std::remove(cache_temp_path_.c_str());
+            cache.Erase(name_);
+        }
+    } else {
+        S3ClientWrapper::GetInstance().PutObjectStr(name_, buffer_);
+        cache.Erase(name_);
+    }
 }
 
 void
 S3IOWriter::write(void* ptr, size_t size) {
-    buffer_ += std::string(reinterpret_cast<char*>(ptr), size);
+    if (cache_out_.is_open()) {
+        cache_out_.write(reinterpret_cast<char*>(ptr), size);
+    } else {
+        buffer_ += std::string(reinterpret_cast<char*>(ptr), size);
+    }
     len_ += size;
 }
 
@@ -11,12 +11,19 @@
 
 #pragma once
 
+#include <fstream>
 #include <string>
+
 #include "storage/IOWriter.h"
 
 namespace milvus {
 namespace storage {
 
+/*
+ * Collects the object and uploads it on destruction; with the local disk
+ * cache enabled it is staged in a cache file instead of memory, uploaded
+ * from there and kept in the cache afterwards.
+ */
 class S3IOWriter : public IOWriter {
  public:
     explicit S3IOWriter(const std::string& name);
@@ -30,6 +37,10 @@ class S3IOWriter : public IOWriter {
 
  public:
     std::string buffer_;
+
+ private:
+    std::ofstream cache_out_;
+    std::string cache_temp_path_;
 };
 
 }  // namespace storage
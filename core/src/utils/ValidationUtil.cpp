@@ -34,6 +34,7 @@ namespace server {
 constexpr size_t TABLE_NAME_SIZE_LIMIT = 255;
 constexpr int64_t TABLE_DIMENSION_LIMIT = 32768;
 constexpr int32_t INDEX_FILE_SIZE_LIMIT = 4096;  // index trigger size max = 4096 MB
+constexpr int64_t REFINE_FACTOR_LIMIT = 32;
 
 Status
 ValidationUtil::ValidateTableName(const std::string& table_name) {
@@ -181,6 +182,34 @@ ValidationUtil::ValidateSearchNprobe(int64_t nprobe, const engine::meta::TableSc
     return Status::OK();
 }
 
+Status
+ValidationUtil::ValidateSearchRefineFactor(int64_t refine_factor) {
+    // 0 leaves the default of the index
+    if (refine_factor < 0 || refine_factor > REFINE_FACTOR_LIMIT) {
+        std::string msg = "Invalid refine_factor: " + std::to_string(refine_factor) + ". " +
+                          "The refine_factor must be within the range of 0 ~ " + std::to_string(REFINE_FACTOR_LIMIT) +
+                          ".";
+        SERVER_LOG_ERROR << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    return Status::OK();
+}
+
+Status
+ValidationUtil::ValidateSearchRadius(float radius, const engine::meta::TableSchema& table_schema) {
+    // a distance radius must be positive, an inner product radius is a similarity and can be any finite value
+    if (!std::isfinite(radius) ||
+        (table_schema.metric_type_ != static_cast<int32_t>(engine::MetricType::IP) && radius <= 0)) {
+        std::string msg = "Invalid radius: " + std::to_string(radius) + ". " +
+                          "The radius must be a finite value, and greater than 0 for a distance metric.";
+        SERVER_LOG_ERROR << msg;
+        return Status(SERVER_INVALID_ARGUMENT, msg);
+    }
+
+    return Status::OK();
+}
+
 Status
 ValidationUtil::ValidatePartitionName(const std::string& partition_name) {
     if (partition_name.empty()) {
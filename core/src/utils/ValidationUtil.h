@@ -55,6 +55,12 @@ class ValidationUtil {
     static Status
     ValidateSearchNprobe(int64_t nprobe, const engine::meta::TableSchema& table_schema);
 
+    static Status
+    ValidateSearchRefineFactor(int64_t refine_factor);
+
+    static Status
+    ValidateSearchRadius(float radius, const engine::meta::TableSchema& table_schema);
+
     static Status
     ValidatePartitionName(const std::string& partition_name);
 
@@ -32,6 +32,12 @@ namespace engine {
 #define GPU_MAX_NRPOBE 1024
 #endif
 
+// candidates per result re-ranked by indexes keeping raw vectors, when the search doesn't ask for a factor
+constexpr int64_t DEFAULT_REFINE_FACTOR = 4;
+
+// below this nq the queries hardly share probed lists, scan query by query
+#define QUERY_MAJOR_MIN_NQ 64
+
 void
 ConfAdapter::MatchBase(knowhere::Config conf, knowhere::METRICTYPE default_metric) {
     if (conf->metric_type == knowhere::DEFAULT_TYPE)
@@ -45,6 +51,7 @@ ConfAdapter::Match(const TempMetaConf& metaconf) {
     conf->metric_type = metaconf.metric_type;
     conf->gpu_id = metaconf.gpu_id;
     conf->k = metaconf.k;
+    conf->storage_type = metaconf.storage_type;
     MatchBase(conf);
     return conf;
 }
@@ -53,6 +60,7 @@ knowhere::Config
 ConfAdapter::MatchSearch(const TempMetaConf& metaconf, const IndexType& type) {
     auto conf = std::make_shared<knowhere::Cfg>();
     conf->k = metaconf.k;
+    conf->distance_bound = metaconf.distance_bound;
     return conf;
 }
 
@@ -63,6 +71,7 @@ IVFConfAdapter::Match(const TempMetaConf& metaconf) {
     conf->d = metaconf.dim;
     conf->metric_type = metaconf.metric_type;
     conf->gpu_id = metaconf.gpu_id;
+    conf->storage_type = metaconf.storage_type;
     MatchBase(conf);
     return conf;
 }
@@ -85,12 +94,16 @@ knowhere::Config
 IVFConfAdapter::MatchSearch(const TempMetaConf& metaconf, const IndexType& type) {
     auto conf = std::make_shared<knowhere::IVFCfg>();
     conf->k = metaconf.k;
+    conf->distance_bound = metaconf.distance_bound;
 
     if (metaconf.nprobe <= 0)
         conf->nprobe = 16;  // hardcode here
     else
         conf->nprobe = metaconf.nprobe;
 
+    // indexes without raw vectors ignore it
+    conf->refine_factor = (metaconf.refine_factor > 0) ? metaconf.refine_factor : DEFAULT_REFINE_FACTOR;
+
     switch (type) {
         case IndexType::FAISS_IVFFLAT_GPU:
         case IndexType::FAISS_IVFSQ8_GPU:
@@ -101,6 +114,17 @@ IVFConfAdapter::MatchSearch(const TempMetaConf& metaconf, const IndexType& type)
                                     << " instead";
                 conf->nprobe = GPU_MAX_NRPOBE;
             }
+            break;
+        case IndexType::FAISS_IVFFLAT_CPU:
+        case IndexType::FAISS_IVFFLAT_MIX:
+        case IndexType::FAISS_IVFSQ8_CPU:
+        case IndexType::FAISS_IVFSQ8_MIX:
+        case IndexType::FAISS_IVFFLAT_FP16_CPU:
+        case IndexType::FAISS_IVFFLAT_BF16_CPU:
+            conf->query_major = (metaconf.nq >= QUERY_MAJOR_MIN_NQ);
+            break;
+        default:
+            break;
     }
     return conf;
 }
@@ -113,6 +137,7 @@ IVFSQConfAdapter::Match(const TempMetaConf& metaconf) {
     conf->metric_type = metaconf.metric_type;
     conf->gpu_id = metaconf.gpu_id;
     conf->nbits = 8;
+    conf->refine = metaconf.refine;
     MatchBase(conf);
     return conf;
 }
@@ -125,6 +150,7 @@ IVFPQConfAdapter::Match(const TempMetaConf& metaconf) {
     conf->metric_type = metaconf.metric_type;
     conf->gpu_id = metaconf.gpu_id;
     conf->nbits = 8;
+    conf->refine = metaconf.refine;
     MatchBase(conf);
 
 #ifdef MILVUS_GPU_VERSION
@@ -177,6 +203,7 @@ knowhere::Config
 IVFPQConfAdapter::MatchSearch(const TempMetaConf& metaconf, const IndexType& type) {
     auto conf = std::make_shared<knowhere::IVFPQCfg>();
     conf->k = metaconf.k;
+    conf->distance_bound = metaconf.distance_bound;
 
     if (metaconf.nprobe <= 0) {
         WRAPPER_LOG_ERROR << "The nprobe of PQ is wrong!";
@@ -185,6 +212,8 @@ IVFPQConfAdapter::MatchSearch(const TempMetaConf& metaconf, const IndexType& typ
         conf->nprobe = metaconf.nprobe;
     }
 
+    // indexes without raw vectors ignore it
+    conf->refine_factor = (metaconf.refine_factor > 0) ? metaconf.refine_factor : DEFAULT_REFINE_FACTOR;
     return conf;
 }
 
@@ -200,6 +229,37 @@ IVFPQConfAdapter::MatchNlist(const int64_t& size, const int64_t& nlist) {
     return nlist;
 }
 
+knowhere::Config
+IVFPQFastScanConfAdapter::Match(const TempMetaConf& metaconf) {
+    auto conf = std::make_shared<knowhere::IVFPQCfg>();
+    conf->nlist = MatchNlist(metaconf.size, metaconf.nlist);
+    conf->d = metaconf.dim;
+    conf->metric_type = metaconf.metric_type;
+    conf->gpu_id = metaconf.gpu_id;
+    conf->nbits = 4;
+    conf->refine = metaconf.refine;
+    MatchBase(conf);
+
+    // 4 dims per subquantizer first, the code size of IVF_PQ at half its 8-bit subquantizers
+    static std::vector<int64_t> support_dim_per_subquantizer{4, 2, 8, 16, 32};
+    for (const auto& dimperquantizer : support_dim_per_subquantizer) {
+        if (conf->d % dimperquantizer) {
+            continue;
+        }
+        auto subquantizer_num = conf->d / dimperquantizer;
+        if (subquantizer_num % 2 == 0 && subquantizer_num <= 256) {
+            conf->m = subquantizer_num;
+            WRAPPER_LOG_DEBUG << "PQ fast scan m = " << conf->m;
+            return conf;
+        }
+    }
+
+    WRAPPER_LOG_ERROR << "The dims of PQ fast scan is wrong : an even number of 2, 4, 8, 16 or 32 dims "
+                         "sub-quantizers is needed";
+    throw WrapperException(
+        "The dims of PQ fast scan is wrong : an even number of 2, 4, 8, 16 or 32 dims sub-quantizers is needed");
+}
+
 knowhere::Config
 NSGConfAdapter::Match(const TempMetaConf& metaconf) {
     auto conf = std::make_shared<knowhere::NSGCfg>();
@@ -28,8 +28,15 @@ struct TempMetaConf {
     int64_t gpu_id = TEMPMETA_DEFAULT_VALUE;
     int64_t k = TEMPMETA_DEFAULT_VALUE;
     int64_t nprobe = TEMPMETA_DEFAULT_VALUE;
+    int64_t nq = TEMPMETA_DEFAULT_VALUE;
+    const float* distance_bound = nullptr;
     int64_t search_length = TEMPMETA_DEFAULT_VALUE;
     knowhere::METRICTYPE metric_type = knowhere::DEFAULT_TYPE;
+    knowhere::StorageType storage_type = knowhere::StorageType::FP32;
+    // build: quantized indexes keep the raw vectors, search: candidates per result re-ranked with them, 0 for
+    // the default
+    bool refine = false;
+    int64_t refine_factor = TEMPMETA_DEFAULT_VALUE;
 };
 
 class ConfAdapter {
@@ -79,6 +86,13 @@ class IVFPQConfAdapter : public IVFConfAdapter {
     MatchNlist(const int64_t& size, const int64_t& nlist);
 };
 
+// 4-bit subquantizers, m has to be even
+class IVFPQFastScanConfAdapter : public IVFPQConfAdapter {
+ public:
+    knowhere::Config
+    Match(const TempMetaConf& metaconf) override;
+};
+
 class NSGConfAdapter : public IVFConfAdapter {
  public:
     knowhere::Config
@@ -16,7 +16,9 @@
 
 #include "scheduler/Utils.h"
 #include "server/Config.h"
+#include "utils/Log.h"
 
+#include <faiss/FaissHook.h>
 #include <fiu-local.h>
 #include <map>
 #include <set>
@@ -31,6 +33,9 @@ constexpr int64_t M_BYTE = 1024 * 1024;
 
 Status
 KnowhereResource::Initialize() {
+    // the distance kernels are routed when faiss is loaded
+    WRAPPER_LOG_INFO << "Distance kernels use SIMD level " << faiss::simd_level_name(faiss::get_simd_level());
+
 #ifdef MILVUS_GPU_VERSION
     Status s;
     bool enable_gpu = false;
@@ -14,6 +14,7 @@
 #include "knowhere/adapter/VectorAdapter.h"
 #include "knowhere/common/Exception.h"
 #include "knowhere/index/vector_index/IndexIDMAP.h"
+#include "knowhere/index/vector_index/IndexIVF.h"
 #include "utils/Log.h"
 #include "wrapper/WrapperException.h"
 #include "wrapper/gpu/GPUVecImpl.h"
@@ -46,7 +47,7 @@ VecIndexImpl::BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, c
 
         auto preprocessor = index_->BuildPreprocessor(dataset, cfg);
         index_->set_preprocessor(preprocessor);
-        auto model = index_->Train(dataset, cfg);
+        auto model = index_->Train((nt > 0 && xt != nullptr) ? GenDataset(nt, dim, xt) : dataset, cfg);
         index_->set_index_model(model);
         index_->Add(dataset, cfg);
     } catch (knowhere::KnowhereException& e) {
@@ -82,7 +83,11 @@ VecIndexImpl::Search(const int64_t& nq, const float* xq, float* dist, int64_t* i
         auto k = cfg->k;
         auto dataset = GenDataset(nq, dim, xq);
 
-        Config search_cfg = cfg;
+        // the caller's config may be shared by concurrent searches, the bitset goes to a copy of it
+        Config search_cfg = cfg->Clone();
+        // the bitset stays alive until the search returns
+        auto bitset = GetBitset();
+        search_cfg->bitset = bitset ? bitset->data() : nullptr;
 
         fiu_do_on("VecIndexImpl.Search.throw_knowhere_exception", throw knowhere::KnowhereException(""));
         fiu_do_on("VecIndexImpl.Search.throw_std_exception", throw std::exception());
@@ -125,6 +130,35 @@ VecIndexImpl::Search(const int64_t& nq, const float* xq, float* dist, int64_t* i
     return Status::OK();
 }
 
+Status
+VecIndexImpl::RangeSearch(const int64_t& nq, const float* xq, std::vector<int64_t>& lims, std::vector<int64_t>& ids,
+                          std::vector<float>& dist, const Config& cfg) {
+    try {
+        auto dataset = GenDataset(nq, dim, xq);
+        Config search_cfg = cfg->Clone();
+        auto bitset = GetBitset();
+        search_cfg->bitset = bitset ? bitset->data() : nullptr;
+        auto res = index_->RangeSearch(dataset, search_cfg);
+
+        auto res_lims = res->Get<int64_t*>(knowhere::meta::LIMS);
+        auto res_ids = res->Get<int64_t*>(knowhere::meta::IDS);
+        auto res_dist = res->Get<float*>(knowhere::meta::DISTANCE);
+        lims.assign(res_lims, res_lims + nq + 1);
+        ids.assign(res_ids, res_ids + res_lims[nq]);
+        dist.assign(res_dist, res_dist + res_lims[nq]);
+        free(res_lims);
+        free(res_ids);
+        free(res_dist);
+    } catch (knowhere::KnowhereException& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_UNEXPECTED_ERROR, e.what());
+    } catch (std::exception& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_ERROR, e.what());
+    }
+    return Status::OK();
+}
+
 knowhere::BinarySet
 VecIndexImpl::Serialize() {
     type = ConvertToCpuIndexType(type);
@@ -148,6 +182,25 @@ VecIndexImpl::Count() {
     return index_->Count();
 }
 
+int64_t
+VecIndexImpl::Size() {
+    return VecIndex::Size() + index_->AuxiliarySize();
+}
+
+Status
+VecIndexImpl::GetIds(std::vector<int64_t>& ids) {
+    try {
+        ids = index_->GetIds();
+    } catch (knowhere::KnowhereException& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_UNEXPECTED_ERROR, e.what());
+    } catch (std::exception& e) {
+        WRAPPER_LOG_ERROR << e.what();
+        return Status(KNOWHERE_ERROR, e.what());
+    }
+    return Status::OK();
+}
+
 IndexType
 VecIndexImpl::GetType() const {
     return type;
@@ -160,6 +213,8 @@ VecIndexImpl::CopyToGpu(const int64_t& device_id, const Config& cfg) {
     auto gpu_index = knowhere::cloner::CopyCpuToGpu(index_, device_id, cfg);
     auto new_index = std::make_shared<VecIndexImpl>(gpu_index, ConvertToGpuIndexType(type));
     new_index->dim = dim;
+    // the copy shares the raw vectors kept for refine, they are counted with it
+    new_index->set_size(Size());
     return new_index;
 #else
     WRAPPER_LOG_ERROR << "Calling VecIndexImpl::CopyToGpu when we are using CPU version";
@@ -174,6 +229,7 @@ VecIndexImpl::CopyToCpu(const Config& cfg) {
     auto cpu_index = knowhere::cloner::CopyGpuToCpu(index_, cfg);
     auto new_index = std::make_shared<VecIndexImpl>(cpu_index, ConvertToCpuIndexType(type));
     new_index->dim = dim;
+    new_index->set_size(Size());
     return new_index;
 #else
     WRAPPER_LOG_ERROR << "Calling VecIndexImpl::CopyToCpu when we are using CPU version";
@@ -201,11 +257,35 @@ VecIndexImpl::GetDeviceId() {
 #endif
 }
 
+knowhere::QuantizerPtr
+VecIndexImpl::GetCoarseQuantizer() {
+    if (type != IndexType::FAISS_IVFFLAT_CPU && type != IndexType::FAISS_IVFSQ8_CPU &&
+        type != IndexType::FAISS_IVFPQ_CPU) {
+        return nullptr;
+    }
+    if (auto ivf_index = std::dynamic_pointer_cast<knowhere::IVF>(index_)) {
+        return ivf_index->GetCoarseQuantizer();
+    }
+    return nullptr;
+}
+
+bool
+VecIndexImpl::SetCoarseQuantizer(const knowhere::QuantizerPtr& q) {
+    if (type != IndexType::FAISS_IVFFLAT_CPU && type != IndexType::FAISS_IVFSQ8_CPU &&
+        type != IndexType::FAISS_IVFPQ_CPU) {
+        return false;
+    }
+    if (auto ivf_index = std::dynamic_pointer_cast<knowhere::IVF>(index_)) {
+        return ivf_index->SetCoarseQuantizer(q);
+    }
+    return false;
+}
+
 const float*
-BFIndex::GetRawVectors() {
+BFIndex::GetRawVectors(std::vector<float>& buffer) {
     auto raw_index = std::dynamic_pointer_cast<knowhere::IDMAP>(index_);
     if (raw_index) {
-        return raw_index->GetRawVectors();
+        return raw_index->GetRawVectors(buffer);
     }
     return nullptr;
 }
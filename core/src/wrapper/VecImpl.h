@@ -13,6 +13,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "VecIndex.h"
 #include "knowhere/index/vector_index/VectorIndex.h"
@@ -45,6 +46,13 @@ class VecIndexImpl : public VecIndex {
     int64_t
     Count() override;
 
+    // the serialized size plus what the index rebuilds in memory
+    int64_t
+    Size() override;
+
+    Status
+    GetIds(std::vector<int64_t>& ids) override;
+
     Status
     Add(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg) override;
 
@@ -63,6 +71,16 @@ class VecIndexImpl : public VecIndex {
     Status
     Search(const int64_t& nq, const float* xq, float* dist, int64_t* ids, const Config& cfg) override;
 
+    Status
+    RangeSearch(const int64_t& nq, const float* xq, std::vector<int64_t>& lims, std::vector<int64_t>& ids,
+                std::vector<float>& dist, const Config& cfg) override;
+
+    knowhere::QuantizerPtr
+    GetCoarseQuantizer() override;
+
+    bool
+    SetCoarseQuantizer(const knowhere::QuantizerPtr& q) override;
+
  protected:
     int64_t dim = 0;
 
@@ -80,8 +98,9 @@ class BFIndex : public VecIndexImpl {
     ErrorCode
     Build(const Config& cfg);
 
+    // half precision vectors are decoded into buffer, which must outlive the returned pointer
     const float*
-    GetRawVectors();
+    GetRawVectors(std::vector<float>& buffer);
 
     Status
     BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg, const int64_t& nt,
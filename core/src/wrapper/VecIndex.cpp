@@ -19,12 +19,15 @@
 #include "knowhere/index/vector_index/IndexIDMAP.h"
 #include "knowhere/index/vector_index/IndexIVF.h"
 #include "knowhere/index/vector_index/IndexIVFPQ.h"
+#include "knowhere/index/vector_index/IndexIVFPQFastScan.h"
 #include "knowhere/index/vector_index/IndexIVFSQ.h"
 #include "knowhere/index/vector_index/IndexNSG.h"
 #include "knowhere/index/vector_index/IndexSPTAG.h"
 #include "server/Config.h"
 #include "storage/file/FileIOReader.h"
 #include "storage/file/FileIOWriter.h"
+#include "storage/file/MmapIOReader.h"
+#include "storage/s3/S3ClientWrapper.h"
 #include "storage/s3/S3IOReader.h"
 #include "storage/s3/S3IOWriter.h"
 #include "utils/Exception.h"
@@ -43,11 +46,19 @@
 #include "wrapper/gpu/GPUVecImpl.h"
 #endif
 
+#include <faiss/index_io.h>
 #include <fiu-local.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 
 namespace milvus {
 namespace engine {
 
+// every binary of an index file starts at a multiple of this offset, so that faiss can borrow it from a mapped file
+constexpr int64_t SECTION_ALIGNMENT = faiss::IO_ZERO_COPY_ALIGNMENT;
+
 int64_t
 VecIndex::Size() {
     if (size_ != 0) {
@@ -61,6 +72,37 @@ VecIndex::set_size(int64_t size) {
     size_ = size;
 }
 
+int64_t
+VecIndex::ReloadCost() {
+    if (reload_cost_ != 0) {
+        return reload_cost_;
+    }
+    return Size();
+}
+
+void
+VecIndex::set_reload_cost(int64_t cost) {
+    reload_cost_ = cost;
+}
+
+BitsetPtr
+VecIndex::GetBitset() const {
+    return std::atomic_load(&bitset_);
+}
+
+void
+VecIndex::SetBitset(const BitsetPtr& bitset) {
+    // a search reading both in between may split its empty results wrongly between deletions and pruning,
+    // which only skews the counters
+    deleted_count_ = bitset ? CountDeleted(*bitset) : 0;
+    std::atomic_store(&bitset_, bitset);
+}
+
+int64_t
+VecIndex::DeletedCount() const {
+    return deleted_count_;
+}
+
 VecIndexPtr
 GetVecIndexFactory(const IndexType& type, const Config& cfg) {
     std::shared_ptr<knowhere::VectorIndex> index;
@@ -74,7 +116,9 @@ GetVecIndexFactory(const IndexType& type, const Config& cfg) {
             index = std::make_shared<knowhere::BinaryIDMAP>();
             return std::make_shared<BinBFIndex>(index);
         }
-        case IndexType::FAISS_IVFFLAT_CPU: {
+        case IndexType::FAISS_IVFFLAT_CPU:
+        case IndexType::FAISS_IVFFLAT_FP16_CPU:
+        case IndexType::FAISS_IVFFLAT_BF16_CPU: {
             index = std::make_shared<knowhere::IVF>();
             break;
         }
@@ -86,6 +130,10 @@ GetVecIndexFactory(const IndexType& type, const Config& cfg) {
             index = std::make_shared<knowhere::IVFPQ>();
             break;
         }
+        case IndexType::FAISS_IVFPQ_FASTSCAN_CPU: {
+            index = std::make_shared<knowhere::IVFPQFastScan>();
+            break;
+        }
         case IndexType::SPTAG_KDT_RNT_CPU: {
             index = std::make_shared<knowhere::CPUSPTAGRNG>("KDT");
             break;
@@ -166,37 +214,42 @@ LoadVecIndex(const IndexType& index_type, const knowhere::BinarySet& index_binar
     return index;
 }
 
-VecIndexPtr
-read_index(const std::string& location) {
-    fiu_return_on("read_null_index", nullptr);
-    fiu_do_on("vecIndex.throw_read_exception", throw std::exception());
-    TimeRecorder recorder("read_index");
-    knowhere::BinarySet load_data_list;
+Status
+read_index_binary(const std::string& location, IndexType& index_type, knowhere::BinarySet& index_binary,
+                  int64_t& length) {
+    TimeRecorder recorder("read_index_binary");
 
     bool s3_enable = false;
     server::Config& config = server::Config::GetInstance();
     config.GetStorageConfigS3Enable(s3_enable);
 
+    bool mmap_enable = false;
+    config.GetStorageConfigFileMmapEnable(mmap_enable);
+
     std::shared_ptr<storage::IOReader> reader_ptr;
+    std::shared_ptr<storage::MmapIOReader> mmap_reader_ptr;
     if (s3_enable) {
         reader_ptr = std::make_shared<storage::S3IOReader>(location);
+    } else if (mmap_enable) {
+        mmap_reader_ptr = std::make_shared<storage::MmapIOReader>(location);
+        reader_ptr = mmap_reader_ptr;
     } else {
         reader_ptr = std::make_shared<storage::FileIOReader>(location);
     }
 
     recorder.RecordSection("Start");
 
-    size_t length = reader_ptr->length();
+    length = reader_ptr->length();
     if (length <= 0) {
-        return nullptr;
+        return Status(KNOWHERE_ERROR, "Empty index file: " + location);
     }
 
-    size_t rp = 0;
+    int64_t rp = 0;
     reader_ptr->seekg(0);
 
-    auto current_type = IndexType::INVALID;
-    reader_ptr->read(&current_type, sizeof(current_type));
-    rp += sizeof(current_type);
+    index_type = IndexType::INVALID;
+    reader_ptr->read(&index_type, sizeof(index_type));
+    rp += sizeof(index_type);
     reader_ptr->seekg(rp);
 
     while (rp < length) {
@@ -215,14 +268,30 @@ read_index(const std::string& location) {
         rp += sizeof(bin_length);
         reader_ptr->seekg(rp);
 
-        auto bin = new uint8_t[bin_length];
-        reader_ptr->read(bin, bin_length);
+        std::shared_ptr<uint8_t> binptr;
+        if (mmap_reader_ptr) {
+            // point into the mapped pages instead of copying them
+            binptr = mmap_reader_ptr->slice(rp, bin_length);
+            if (binptr == nullptr) {
+                delete[] meta;
+                return Status(KNOWHERE_ERROR, "Failed to map index file: " + location);
+            }
+        } else {
+            auto bin = new uint8_t[bin_length];
+            reader_ptr->read(bin, bin_length);
+            binptr.reset(bin, std::default_delete<uint8_t[]>());
+        }
         rp += bin_length;
         reader_ptr->seekg(rp);
 
-        auto binptr = std::make_shared<uint8_t>();
-        binptr.reset(bin);
-        load_data_list.Append(std::string(meta, meta_length), binptr, bin_length);
+        auto binary = std::make_shared<knowhere::Binary>();
+        binary->data = binptr;
+        binary->size = bin_length;
+        binary->mapped = (mmap_reader_ptr != nullptr);
+        // strip the '\0' padding written after the name, see write_index
+        std::string name(meta, meta_length);
+        name.erase(name.find_last_not_of('\0') + 1);
+        index_binary.Append(name, binary);
         delete[] meta;
     }
 
@@ -230,7 +299,22 @@ read_index(const std::string& location) {
     double rate = length * 1000000.0 / span / 1024 / 1024;
     STORAGE_LOG_DEBUG << "read_index(" << location << ") rate " << rate << "MB/s";
 
-    return LoadVecIndex(current_type, load_data_list, length);
+    return Status::OK();
+}
+
+VecIndexPtr
+read_index(const std::string& location) {
+    fiu_return_on("read_null_index", nullptr);
+    fiu_do_on("vecIndex.throw_read_exception", throw std::exception());
+
+    auto index_type = IndexType::INVALID;
+    knowhere::BinarySet index_binary;
+    int64_t length = 0;
+    if (!read_index_binary(location, index_type, index_binary, length).ok()) {
+        return nullptr;
+    }
+
+    return LoadVecIndex(index_type, index_binary, length);
 }
 
 Status
@@ -260,15 +344,22 @@ write_index(VecIndexPtr index, const std::string& location) {
         recorder.RecordSection("Start");
 
         writer_ptr->write(&index_type, sizeof(IndexType));
+        int64_t offset = sizeof(IndexType);
 
         for (auto& iter : binaryset.binary_map_) {
-            auto meta = iter.first.c_str();
-            size_t meta_length = iter.first.length();
-            writer_ptr->write(&meta_length, sizeof(meta_length));
-            writer_ptr->write((void*)meta, meta_length);
-
             auto binary = iter.second;
             int64_t binary_length = binary->size;
+
+            // pad the name with '\0' so that the binary starts at a multiple of SECTION_ALIGNMENT
+            std::string meta = iter.first;
+            offset += sizeof(size_t) + meta.length() + sizeof(binary_length);
+            meta.append((SECTION_ALIGNMENT - offset % SECTION_ALIGNMENT) % SECTION_ALIGNMENT, '\0');
+            offset += meta.length() - iter.first.length() + binary_length;
+
+            size_t meta_length = meta.length();
+            writer_ptr->write(&meta_length, sizeof(meta_length));
+            writer_ptr->write((void*)meta.data(), meta_length);
+
             writer_ptr->write(&binary_length, sizeof(binary_length));
             writer_ptr->write((void*)binary->data.get(), binary_length);
         }
@@ -292,6 +383,117 @@ write_index(VecIndexPtr index, const std::string& location) {
     return Status::OK();
 }
 
+namespace {
+
+Status
+WriteSidecar(const std::string& path, const char* data, size_t size) {
+    bool s3_enable = false;
+    server::Config& config = server::Config::GetInstance();
+    config.GetStorageConfigS3Enable(s3_enable);
+    if (s3_enable) {
+        std::string content(data, size);
+        return storage::S3ClientWrapper::GetInstance().PutObjectStr(path, content);
+    }
+
+    // replace the old file in one step, a crash never leaves a torn one behind
+    auto tmp_path = path + ".tmp";
+    {
+        std::ofstream fs(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+        fs.write(data, size);
+        if (!fs.good()) {
+            return Status(KNOWHERE_ERROR, "Failed to write " + tmp_path);
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        return Status(KNOWHERE_ERROR, "Failed to rename " + tmp_path);
+    }
+    return Status::OK();
+}
+
+// found is false if there is no file at path
+Status
+ReadSidecar(const std::string& path, std::string& content, bool& found) {
+    found = false;
+    bool s3_enable = false;
+    server::Config& config = server::Config::GetInstance();
+    config.GetStorageConfigS3Enable(s3_enable);
+    if (s3_enable) {
+        found = storage::S3ClientWrapper::GetInstance().GetObjectStr(path, content).ok();
+        return Status::OK();
+    }
+
+    std::ifstream fs(path, std::ios::in | std::ios::binary);
+    if (!fs.is_open()) {
+        return Status::OK();
+    }
+    content.assign(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+    if (fs.bad()) {
+        return Status(KNOWHERE_ERROR, "Failed to read " + path);
+    }
+    found = true;
+    return Status::OK();
+}
+
+}  // namespace
+
+std::string
+bitset_location(const std::string& location) {
+    return location + ".del";
+}
+
+Status
+write_bitset(const Bitset& bitset, const std::string& location) {
+    return WriteSidecar(bitset_location(location), reinterpret_cast<const char*>(bitset.data()), bitset.size());
+}
+
+Status
+read_bitset(const std::string& location, BitsetPtr& bitset) {
+    bitset = nullptr;
+    std::string content;
+    bool found = false;
+    auto status = ReadSidecar(bitset_location(location), content, found);
+    if (status.ok() && found) {
+        bitset = std::make_shared<Bitset>(content.begin(), content.end());
+    }
+    return status;
+}
+
+int64_t
+CountDeleted(const Bitset& bitset) {
+    int64_t count = 0;
+    for (auto byte : bitset) {
+        count += __builtin_popcount(byte);
+    }
+    return count;
+}
+
+std::string
+ids_location(const std::string& location) {
+    return location + ".ids";
+}
+
+Status
+write_ids(const std::vector<int64_t>& ids, const std::string& location) {
+    return WriteSidecar(ids_location(location), reinterpret_cast<const char*>(ids.data()),
+                        ids.size() * sizeof(int64_t));
+}
+
+Status
+read_ids(const std::string& location, std::vector<int64_t>& ids, bool& found) {
+    ids.clear();
+    std::string content;
+    auto status = ReadSidecar(ids_location(location), content, found);
+    if (!status.ok() || !found) {
+        return status;
+    }
+    if (content.size() % sizeof(int64_t) != 0) {
+        return Status(KNOWHERE_ERROR, "Corrupted id file: " + ids_location(location));
+    }
+    ids.resize(content.size() / sizeof(int64_t));
+    memcpy(ids.data(), content.data(), content.size());
+    return Status::OK();
+}
+
 IndexType
 ConvertToCpuIndexType(const IndexType& type) {
     // TODO(linxj): add IDMAP
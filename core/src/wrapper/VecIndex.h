@@ -11,9 +11,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cache/DataObj.h"
 #include "knowhere/common/BinarySet.h"
@@ -45,6 +47,9 @@ enum class IndexType {
     FAISS_IVFPQ_MIX,
     SPTAG_BKT_RNT_CPU,
     HNSW,
+    FAISS_IVFFLAT_FP16_CPU,  // vectors stored in half precision
+    FAISS_IVFFLAT_BF16_CPU,
+    FAISS_IVFPQ_FASTSCAN_CPU,  // 4-bit PQ codes in blocks of 32 vectors
     FAISS_BIN_IDMAP = 100,
     FAISS_BIN_IVFLAT_CPU = 101,
 };
@@ -53,8 +58,13 @@ class VecIndex;
 
 using VecIndexPtr = std::shared_ptr<VecIndex>;
 
+// deleted vectors of an index, bit i & 7 of byte i >> 3 is set when the i-th id of VecIndex::GetIds() is deleted
+using Bitset = std::vector<uint8_t>;
+using BitsetPtr = std::shared_ptr<const Bitset>;
+
 class VecIndex : public cache::DataObj {
  public:
+    // the index is trained on the nt vectors of xt when they are given, on the nb added vectors otherwise
     virtual Status
     BuildAll(const int64_t& nb, const float* xb, const int64_t* ids, const Config& cfg, const int64_t& nt = 0,
              const float* xt = nullptr) = 0;
@@ -84,6 +94,14 @@ class VecIndex : public cache::DataObj {
         return Status::OK();
     }
 
+    // all vectors within cfg->radius of each query, the results of query i are ids and dist in [lims[i], lims[i + 1])
+    virtual Status
+    RangeSearch(const int64_t& nq, const float* xq, std::vector<int64_t>& lims, std::vector<int64_t>& ids,
+                std::vector<float>& dist, const Config& cfg) {
+        ENGINE_LOG_ERROR << "RangeSearch not support";
+        return Status(KNOWHERE_ERROR, "range search is not supported by this index");
+    }
+
     virtual VecIndexPtr
     CopyToGpu(const int64_t& device_id, const Config& cfg = Config()) = 0;
 
@@ -106,12 +124,36 @@ class VecIndex : public cache::DataObj {
     virtual int64_t
     Count() = 0;
 
+    // ids in the order the deletion bitset refers to them
+    virtual Status
+    GetIds(std::vector<int64_t>& ids) {
+        return Status(KNOWHERE_ERROR, "deletion is not supported by this index");
+    }
+
+    // searches skip the vectors set in the bitset, nullptr when nothing is deleted.
+    // the bitset is replaced as a whole, searches in flight keep the one they started with
+    BitsetPtr
+    GetBitset() const;
+
+    void
+    SetBitset(const BitsetPtr& bitset);
+
+    // bits set in the bitset, counted once when it is set
+    int64_t
+    DeletedCount() const;
+
     int64_t
     Size() override;
 
     void
     set_size(int64_t size);
 
+    int64_t
+    ReloadCost() override;
+
+    void
+    set_reload_cost(int64_t cost);
+
     virtual knowhere::BinarySet
     Serialize() = 0;
 
@@ -145,9 +187,23 @@ class VecIndex : public cache::DataObj {
     CopyToGpuWithQuantizer(const int64_t& device_id, const Config& cfg = Config()) {
         return std::make_pair(nullptr, nullptr);
     }
+
+    // coarse quantizer shared by the ivf indexes of one table
+    virtual knowhere::QuantizerPtr
+    GetCoarseQuantizer() {
+        return nullptr;
+    }
+
+    virtual bool
+    SetCoarseQuantizer(const knowhere::QuantizerPtr& q) {
+        return false;
+    }
     ////////////////
  private:
     int64_t size_ = 0;
+    int64_t reload_cost_ = 0;
+    BitsetPtr bitset_ = nullptr;
+    std::atomic<int64_t> deleted_count_{0};
 };
 
 extern Status
@@ -156,9 +212,40 @@ write_index(VecIndexPtr index, const std::string& location);
 extern VecIndexPtr
 read_index(const std::string& location);
 
+// read the serialized index into memory without deserializing it, see LoadVecIndex
+extern Status
+read_index_binary(const std::string& location, IndexType& index_type, knowhere::BinarySet& index_binary,
+                  int64_t& length);
+
 VecIndexPtr
 read_index(const std::string& location, knowhere::BinarySet& index_binary);
 
+// the deletion bitset is stored next to the index file
+extern std::string
+bitset_location(const std::string& location);
+
+extern Status
+write_bitset(const Bitset& bitset, const std::string& location);
+
+// bitset is nullptr if nothing of the index at location was deleted
+extern Status
+read_bitset(const std::string& location, BitsetPtr& bitset);
+
+extern int64_t
+CountDeleted(const Bitset& bitset);
+
+// the ids of the index, in GetIds() order, are stored next to the index file too.
+// deletions read them instead of loading the whole index
+extern std::string
+ids_location(const std::string& location);
+
+extern Status
+write_ids(const std::vector<int64_t>& ids, const std::string& location);
+
+// found is false for files written before the ids were stored
+extern Status
+read_ids(const std::string& location, std::vector<int64_t>& ids, bool& found);
+
 extern VecIndexPtr
 GetVecIndexFactory(const IndexType& type, const Config& cfg = Config());
 
@@ -15,6 +15,7 @@
 
 #include <boost/filesystem.hpp>
 #include <random>
+#include <set>
 #include <thread>
 
 #include "cache/CpuCacheMgr.h"
@@ -196,7 +197,7 @@ TEST_F(DBTest, DB_TEST) {
             START_TIMER;
 
             std::vector<std::string> tags;
-            stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, qxb, result_ids, result_distances);
+            stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, qxb, result_ids, result_distances);
             ss << "Search " << j << " With Size " << count / milvus::engine::M << " M";
             STOP_TIMER(ss.str());
 
@@ -308,8 +309,35 @@ TEST_F(DBTest, SEARCH_TEST) {
         std::vector<std::string> tags;
         milvus::engine::ResultIds result_ids;
         milvus::engine::ResultDistances result_distances;
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
+
+        // brute force is exact, the range result must match the vectors within the radius
+        std::vector<int64_t> range_lims;
+        milvus::engine::ResultIds range_ids;
+        milvus::engine::ResultDistances range_distances;
+        float radius = result_distances[k - 1];
+        stat = db_->RangeQuery(dummy_context_, TABLE_NAME, tags, radius, 10, xq, range_lims, range_ids,
+                               range_distances);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(range_lims.size(), nq + 1);
+        for (size_t i = 0; i < nq; ++i) {
+            std::set<int64_t> expected, found(range_ids.begin() + range_lims[i], range_ids.begin() + range_lims[i + 1]);
+            for (size_t j = 0; j < nb; ++j) {
+                float distance = 0;
+                for (size_t d = 0; d < TABLE_DIM; ++d) {
+                    float diff = xq.float_data_[i * TABLE_DIM + d] - xb.float_data_[j * TABLE_DIM + d];
+                    distance += diff * diff;
+                }
+                // distances on the radius may round either way
+                if (distance < radius * (1 - 1e-4)) {
+                    expected.insert(xb.id_array_[j]);
+                } else if (distance < radius * (1 + 1e-4)) {
+                    found.erase(xb.id_array_[j]);
+                }
+            }
+            ASSERT_EQ(found, expected);
+        }
     }
 
     index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFFLAT;
@@ -319,8 +347,23 @@ TEST_F(DBTest, SEARCH_TEST) {
         std::vector<std::string> tags;
         milvus::engine::ResultIds result_ids;
         milvus::engine::ResultDistances result_distances;
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, result_ids, result_distances);
+        ASSERT_TRUE(stat.ok());
+
+        // everything closer than the k-th result of the first query
+        std::vector<int64_t> range_lims;
+        milvus::engine::ResultIds range_ids;
+        milvus::engine::ResultDistances range_distances;
+        float radius = result_distances[k - 1];
+        stat = db_->RangeQuery(dummy_context_, TABLE_NAME, tags, radius, 10, xq, range_lims, range_ids,
+                               range_distances);
         ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(range_lims.size(), nq + 1);
+        ASSERT_EQ(range_lims[nq], (int64_t)range_ids.size());
+        ASSERT_EQ(range_ids.size(), range_distances.size());
+        for (auto& distance : range_distances) {
+            ASSERT_LT(distance, radius);
+        }
     }
 
     index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFSQ8;
@@ -330,7 +373,7 @@ TEST_F(DBTest, SEARCH_TEST) {
         std::vector<std::string> tags;
         milvus::engine::ResultIds result_ids;
         milvus::engine::ResultDistances result_distances;
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
     }
 
@@ -342,7 +385,7 @@ TEST_F(DBTest, SEARCH_TEST) {
         std::vector<std::string> tags;
         milvus::engine::ResultIds result_ids;
         milvus::engine::ResultDistances result_distances;
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
     }
 #endif
@@ -358,18 +401,18 @@ TEST_F(DBTest, SEARCH_TEST) {
         }
         milvus::engine::ResultIds result_ids;
         milvus::engine::ResultDistances result_distances;
-        stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, xq, dates, result_ids,
+        stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, 0, xq, dates, result_ids,
                                   result_distances);
         ASSERT_TRUE(stat.ok());
 
         FIU_ENABLE_FIU("SqliteMetaImpl.FilesToSearch.throw_exception");
-        stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, xq, dates, result_ids,
+        stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, 0, xq, dates, result_ids,
                                   result_distances);
         ASSERT_FALSE(stat.ok());
         fiu_disable("SqliteMetaImpl.FilesToSearch.throw_exception");
 
         FIU_ENABLE_FIU("DBImpl.QueryByFileID.empty_files_array");
-        stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, xq, dates, result_ids,
+        stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, 0, xq, dates, result_ids,
                                   result_distances);
         ASSERT_FALSE(stat.ok());
         fiu_disable("DBImpl.QueryByFileID.empty_files_array");
@@ -382,13 +425,13 @@ TEST_F(DBTest, SEARCH_TEST) {
         std::vector<std::string> tags;
         milvus::engine::ResultIds result_ids;
         milvus::engine::ResultDistances result_distances;
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
 
         FIU_ENABLE_FIU("SqliteMetaImpl.FilesToSearch.throw_exception");
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, result_ids, result_distances);
         ASSERT_FALSE(stat.ok());
         fiu_disable("SqliteMetaImpl.FilesToSearch.throw_exception");
     }
@@ -404,7 +447,7 @@ TEST_F(DBTest, SEARCH_TEST) {
     {
         result_ids.clear();
         result_dists.clear();
-        stat = db_->Query(dummy_context_, TABLE_NAME, partition_tag, k, 10, xq, result_ids, result_dists);
+        stat = db_->Query(dummy_context_, TABLE_NAME, partition_tag, k, 10, 0, xq, result_ids, result_dists);
         ASSERT_TRUE(stat.ok());
     }
 
@@ -419,7 +462,7 @@ TEST_F(DBTest, SEARCH_TEST) {
         }
         result_ids.clear();
         result_dists.clear();
-        stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, xq, dates, result_ids,
+        stat = db_->QueryByFileID(dummy_context_, TABLE_NAME, file_ids, k, 10, 0, xq, dates, result_ids,
                                   result_dists);
         ASSERT_TRUE(stat.ok());
     }
@@ -427,6 +470,45 @@ TEST_F(DBTest, SEARCH_TEST) {
 #endif
 }
 
+TEST_F(RangeSearchTest, MAX_RANGE_RESULTS_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    const int64_t nb = 1000, nq = 10;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    stat = db_->InsertVectors(TABLE_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IDMAP;
+    db_->CreateIndex(TABLE_NAME, index);  // wait until build index finish
+
+    milvus::engine::VectorsData xq;
+    xq.vector_count_ = nq;
+    xq.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + nq * TABLE_DIM);
+
+    std::vector<std::string> tags;
+    std::vector<int64_t> range_lims;
+    milvus::engine::ResultIds range_ids;
+    milvus::engine::ResultDistances range_distances;
+
+    // every query matches only itself
+    stat = db_->RangeQuery(dummy_context_, TABLE_NAME, tags, 1e-3, 10, xq, range_lims, range_ids, range_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(range_lims.size(), nq + 1);
+    ASSERT_EQ(range_lims[nq], nq);
+
+    // every query matches the whole table, far over the limit of the options
+    range_lims.clear();
+    range_ids.clear();
+    range_distances.clear();
+    stat = db_->RangeQuery(dummy_context_, TABLE_NAME, tags, 1e9, 10, xq, range_lims, range_ids, range_distances);
+    ASSERT_FALSE(stat.ok());
+    ASSERT_EQ(stat.code(), milvus::SERVER_INVALID_ARGUMENT);
+    ASSERT_TRUE(range_ids.empty());
+}
+
 TEST_F(DBTest, PRELOADTABLE_TEST) {
     fiu_init(0);
 
@@ -460,6 +542,16 @@ TEST_F(DBTest, PRELOADTABLE_TEST) {
     int64_t cur_cache_usage = milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage();
     ASSERT_TRUE(prev_cache_usage < cur_cache_usage);
 
+    std::vector<milvus::engine::PreloadProgress> progress;
+    stat = db_->GetPreloadProgress(progress);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(progress.size(), 1);
+    ASSERT_EQ(progress[0].name_, TABLE_NAME);
+    ASSERT_TRUE(progress[0].finished_);
+    ASSERT_GT(progress[0].total_files_, 0);
+    ASSERT_EQ(progress[0].loaded_files_, progress[0].total_files_);
+    ASSERT_EQ(progress[0].failed_files_, 0);
+
     FIU_ENABLE_FIU("SqliteMetaImpl.FilesToSearch.throw_exception");
     stat = db_->PreloadTable(TABLE_NAME);
     ASSERT_FALSE(stat.ok());
@@ -487,6 +579,132 @@ TEST_F(DBTest, PRELOADTABLE_TEST) {
     fiu_disable("DBImpl.PreloadTable.engine_throw_exception");
 }
 
+TEST_F(DBTest, SHARED_QUANTIZER_DROP_TEST) {
+    milvus::server::Config& config = milvus::server::Config::GetInstance();
+    ASSERT_TRUE(config.SetEngineConfigShareIvfQuantizer("true").ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFFLAT;
+    index.nlist_ = 16;
+
+    // the quantizer is trained on a sample of the first three segments, each batch is indexed on its own
+    auto build_segments = [&](milvus::engine::meta::TableSchema& table_info) {
+        auto stat = db_->CreateTable(table_info);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->DescribeTable(table_info);
+        ASSERT_TRUE(stat.ok());
+
+        for (int i = 0; i < 3; ++i) {
+            milvus::engine::VectorsData xb;
+            BuildVectors(milvus::engine::meta::BUILD_INDEX_THRESHOLD, xb);
+            stat = db_->InsertVectors(table_info.table_id_, "", xb);
+            ASSERT_TRUE(stat.ok());
+            stat = db_->CreateIndex(table_info.table_id_, index);
+            ASSERT_TRUE(stat.ok());
+        }
+    };
+
+    // the quantizer of a table is named after its creation time and is in cache
+    auto quantizer_paths = [&](const milvus::engine::meta::TableSchema& table_info) {
+        std::vector<std::string> paths;
+        std::string table_path = GetOptions().meta_.path_ + "/tables/" + table_info.table_id_;
+        for (auto& entry : boost::filesystem::directory_iterator(table_path)) {
+            if (entry.path().extension() == ".quantizer") {
+                paths.push_back(entry.path().string());
+            }
+        }
+        return paths;
+    };
+
+    // dropping the index removes the quantizer
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    build_segments(table_info);
+    auto paths = quantizer_paths(table_info);
+    ASSERT_EQ(paths.size(), 1);
+    ASSERT_NE(paths[0].find(std::to_string(table_info.created_on_)), std::string::npos);
+    ASSERT_TRUE(milvus::cache::CpuCacheMgr::GetInstance()->ItemExists(paths[0]));
+
+    auto stat = db_->DropIndex(TABLE_NAME);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_TRUE(quantizer_paths(table_info).empty());
+    ASSERT_FALSE(milvus::cache::CpuCacheMgr::GetInstance()->ItemExists(paths[0]));
+
+    // dropping the table erases it from cache
+    milvus::engine::meta::TableSchema other_table_info = BuildTableSchema();
+    other_table_info.table_id_ = std::string(TABLE_NAME) + "_other";
+    build_segments(other_table_info);
+    paths = quantizer_paths(other_table_info);
+    ASSERT_EQ(paths.size(), 1);
+    ASSERT_TRUE(milvus::cache::CpuCacheMgr::GetInstance()->ItemExists(paths[0]));
+
+    milvus::engine::meta::DatesT dates;
+    stat = db_->DropTable(other_table_info.table_id_, dates);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_FALSE(milvus::cache::CpuCacheMgr::GetInstance()->ItemExists(paths[0]));
+
+    ASSERT_TRUE(config.SetEngineConfigShareIvfQuantizer("false").ok());
+}
+
+TEST_F(WarmStartTest, WARM_START_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = VECTOR_COUNT;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    for (auto i = 0; i < 5; ++i) {
+        xb.id_array_.clear();
+        db_->InsertVectors(TABLE_NAME, "", xb);
+        ASSERT_EQ(xb.id_array_.size(), nb);
+    }
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IDMAP;
+    db_->CreateIndex(TABLE_NAME, index);  // wait until build index finish
+
+    stat = db_->PreloadTable(TABLE_NAME);
+    ASSERT_TRUE(stat.ok());
+
+    // nothing recorded yet, warm start is a no-op
+    stat = db_->WarmStart();
+    ASSERT_TRUE(stat.ok());
+
+    // stopping records the hot set, a restarted db loads it back
+    db_->Stop();
+    milvus::cache::CpuCacheMgr::GetInstance()->ClearCache();
+    ASSERT_EQ(milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage(), 0);
+
+    auto db = milvus::engine::DBFactory::Build(GetOptions());
+    stat = db->WarmStart();
+    ASSERT_TRUE(stat.ok());
+    ASSERT_GT(milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage(), 0);
+
+    std::vector<milvus::engine::PreloadProgress> progress;
+    stat = db->GetPreloadProgress(progress);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(progress.size(), 1);
+    ASSERT_EQ(progress[0].name_, "warm_start");
+    ASSERT_TRUE(progress[0].finished_);
+    ASSERT_GT(progress[0].loaded_files_, 0);
+    db->Stop();
+
+    // a stopped warm start loads no more files
+    milvus::cache::CpuCacheMgr::GetInstance()->ClearCache();
+    auto stopped_db = milvus::engine::DBFactory::Build(GetOptions());
+    stopped_db->StopWarmStart();
+    stat = stopped_db->WarmStart();
+    ASSERT_FALSE(stat.ok());
+    ASSERT_EQ(milvus::cache::CpuCacheMgr::GetInstance()->CacheUsage(), 0);
+
+    stat = stopped_db->GetPreloadProgress(progress);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(progress.size(), 1);
+    ASSERT_TRUE(progress[0].finished_);
+    ASSERT_EQ(progress[0].loaded_files_, 0);
+    stopped_db->Stop();
+}
+
 TEST_F(DBTest, SHUTDOWN_TEST) {
     db_->Stop();
 
@@ -547,14 +765,14 @@ TEST_F(DBTest, SHUTDOWN_TEST) {
     milvus::engine::ResultIds result_ids;
     milvus::engine::ResultDistances result_distances;
     stat =
-        db_->Query(dummy_context_, table_info.table_id_, tags, 1, 1, xb, dates, result_ids, result_distances);
+        db_->Query(dummy_context_, table_info.table_id_, tags, 1, 1, 0, xb, dates, result_ids, result_distances);
     ASSERT_FALSE(stat.ok());
     std::vector<std::string> file_ids;
-    stat = db_->QueryByFileID(dummy_context_, table_info.table_id_, file_ids, 1, 1, xb, dates, result_ids,
+    stat = db_->QueryByFileID(dummy_context_, table_info.table_id_, file_ids, 1, 1, 0, xb, dates, result_ids,
                               result_distances);
     ASSERT_FALSE(stat.ok());
 
-    stat = db_->Query(dummy_context_, table_info.table_id_, tags, 1, 1,
+    stat = db_->Query(dummy_context_, table_info.table_id_, tags, 1, 1, 0,
                       milvus::engine::VectorsData(), result_ids, result_distances);
     ASSERT_FALSE(stat.ok());
 
@@ -824,7 +1042,7 @@ TEST_F(DBTest, PARTITION_TEST) {
         std::vector<std::string> tags = {"0", std::to_string(PARTITION_COUNT - 1)};
         milvus::engine::ResultIds result_ids;
         milvus::engine::ResultDistances result_distances;
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, topk, nprobe, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, topk, nprobe, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
         ASSERT_EQ(result_ids.size() / topk, nq);
 
@@ -832,7 +1050,7 @@ TEST_F(DBTest, PARTITION_TEST) {
         tags.clear();
         result_ids.clear();
         result_distances.clear();
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, topk, nprobe, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, topk, nprobe, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
         ASSERT_EQ(result_ids.size() / topk, nq);
 
@@ -840,7 +1058,7 @@ TEST_F(DBTest, PARTITION_TEST) {
         tags.push_back("\\d");
         result_ids.clear();
         result_distances.clear();
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, topk, nprobe, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, topk, nprobe, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
         ASSERT_EQ(result_ids.size() / topk, nq);
     }
@@ -999,3 +1217,414 @@ TEST_F(DBTest2, DELETE_BY_RANGE_TEST) {
     db_->GetTableRowCount(TABLE_NAME, row_count);
     ASSERT_EQ(row_count, 0UL);
 }
+
+TEST_F(DBTest, DELETE_BY_ID_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = VECTOR_COUNT;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    xb.id_array_.resize(nb);
+    for (uint64_t i = 0; i < nb; ++i) {
+        xb.id_array_[i] = i;
+    }
+    stat = db_->InsertVectors(TABLE_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+
+    // delete the first vectors and search with them, each must be gone from its own result
+    const uint64_t nq = 10, k = 5;
+    milvus::engine::IDNumbers delete_ids(xb.id_array_.begin(), xb.id_array_.begin() + nq);
+    int64_t deleted_count = 0;
+    stat = db_->DeleteVectors(TABLE_NAME, delete_ids, deleted_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(deleted_count, (int64_t)nq);
+
+    milvus::engine::VectorsData xq;
+    xq.vector_count_ = nq;
+    xq.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + nq * TABLE_DIM);
+
+    std::vector<std::string> tags;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), nq * k);
+    for (auto id : result_ids) {
+        ASSERT_TRUE(id < 0 || id >= (int64_t)nq);
+    }
+
+    // unknown ids are ignored
+    stat = db_->DeleteVectors(TABLE_NAME, {static_cast<int64_t>(nb) + 100}, deleted_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(deleted_count, 0);
+}
+
+TEST_F(DBTest, DELETE_BY_ID_INDEX_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = VECTOR_COUNT;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    xb.id_array_.resize(nb);
+    for (uint64_t i = 0; i < nb; ++i) {
+        xb.id_array_[i] = i;
+    }
+    stat = db_->InsertVectors(TABLE_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+
+    // the vectors deleted from the ivf index stay deleted in the sq8 index built from the raw backups
+    const int64_t nq = 10, k = 5, nlist = 128;
+    int64_t deleted_end = 0;
+    for (auto engine_type : {milvus::engine::EngineType::FAISS_IVFFLAT, milvus::engine::EngineType::FAISS_IVFSQ8}) {
+        milvus::engine::TableIndex index;
+        index.engine_type_ = (int)engine_type;
+        index.nlist_ = nlist;
+        stat = db_->CreateIndex(TABLE_NAME, index);
+        ASSERT_TRUE(stat.ok());
+
+        milvus::engine::IDNumbers delete_ids(xb.id_array_.begin() + deleted_end,
+                                             xb.id_array_.begin() + deleted_end + nq);
+        int64_t deleted_count = 0;
+        stat = db_->DeleteVectors(TABLE_NAME, delete_ids, deleted_count);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(deleted_count, nq);
+        deleted_end += nq;
+
+        milvus::engine::VectorsData xq;
+        xq.vector_count_ = deleted_end;
+        xq.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + deleted_end * TABLE_DIM);
+
+        std::vector<std::string> tags;
+        milvus::engine::ResultIds result_ids;
+        milvus::engine::ResultDistances result_distances;
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, nlist, 0, xq, result_ids, result_distances);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(result_ids.size(), (size_t)(deleted_end * k));
+        for (auto id : result_ids) {
+            ASSERT_TRUE(id < 0 || id >= deleted_end);
+        }
+    }
+}
+
+TEST_F(DBTest, DELETE_DURING_BUILD_INDEX_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = VECTOR_COUNT;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    xb.id_array_.resize(nb);
+    for (uint64_t i = 0; i < nb; ++i) {
+        xb.id_array_[i] = i;
+    }
+    stat = db_->InsertVectors(TABLE_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+
+    // deletions keep coming while the index is built, none of them may be lost when the index replaces the raw file
+    const int64_t nq = 100, k = 5, nlist = 128;
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFSQ8;
+    index.nlist_ = nlist;
+    milvus::Status index_stat;
+    std::thread build_thread([&]() { index_stat = db_->CreateIndex(TABLE_NAME, index); });
+
+    int64_t total_deleted = 0;
+    for (int64_t i = 0; i < nq; ++i) {
+        int64_t deleted_count = 0;
+        stat = db_->DeleteVectors(TABLE_NAME, {i}, deleted_count);
+        ASSERT_TRUE(stat.ok());
+        total_deleted += deleted_count;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    build_thread.join();
+    ASSERT_TRUE(index_stat.ok());
+    ASSERT_EQ(total_deleted, nq);
+
+    milvus::engine::VectorsData xq;
+    xq.vector_count_ = nq;
+    xq.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + nq * TABLE_DIM);
+
+    std::vector<std::string> tags;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, nlist, 0, xq, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    for (auto id : result_ids) {
+        ASSERT_TRUE(id < 0 || id >= nq);
+    }
+}
+
+TEST_F(DeleteTest, PURGE_DELETED_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    // several small raw files, each gets 20% of its vectors deleted
+    const int64_t batch = 2000, batch_count = 4, batch_deleted = 400, k = 5, nlist = 128;
+    milvus::engine::VectorsData xb;
+    BuildVectors(batch * batch_count, xb);
+    milvus::engine::IDNumbers delete_ids;
+    for (int64_t i = 0; i < batch_count; ++i) {
+        milvus::engine::VectorsData vectors;
+        vectors.vector_count_ = batch;
+        vectors.float_data_.assign(xb.float_data_.begin() + i * batch * TABLE_DIM,
+                                   xb.float_data_.begin() + (i + 1) * batch * TABLE_DIM);
+        for (int64_t j = 0; j < batch; ++j) {
+            vectors.id_array_.push_back(i * batch + j);
+        }
+        stat = db_->InsertVectors(TABLE_NAME, "", vectors);
+        ASSERT_TRUE(stat.ok());
+
+        milvus::engine::IDNumbers ids(vectors.id_array_.begin(), vectors.id_array_.begin() + batch_deleted);
+        int64_t deleted_count = 0;
+        stat = db_->DeleteVectors(TABLE_NAME, ids, deleted_count);
+        ASSERT_TRUE(stat.ok());
+        ASSERT_EQ(deleted_count, batch_deleted);
+        delete_ids.insert(delete_ids.end(), ids.begin(), ids.end());
+    }
+
+    auto wait_row_count = [&](uint64_t expected) {
+        uint64_t row_count = 0;
+        for (int i = 0; i < 30; ++i) {
+            ASSERT_TRUE(db_->GetTableRowCount(TABLE_NAME, row_count).ok());
+            if (row_count == expected) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+        ASSERT_EQ(row_count, expected);
+    };
+
+    auto check_deleted = [&]() {
+        milvus::engine::VectorsData xq;
+        xq.vector_count_ = batch_deleted;
+        xq.float_data_.assign(xb.float_data_.begin(), xb.float_data_.begin() + batch_deleted * TABLE_DIM);
+
+        std::vector<std::string> tags;
+        milvus::engine::ResultIds result_ids;
+        milvus::engine::ResultDistances result_distances;
+        auto status = db_->Query(dummy_context_, TABLE_NAME, tags, k, nlist, 0, xq, result_ids, result_distances);
+        ASSERT_TRUE(status.ok());
+        std::set<int64_t> deleted(delete_ids.begin(), delete_ids.end());
+        for (auto id : result_ids) {
+            ASSERT_TRUE(deleted.find(id) == deleted.end());
+        }
+    };
+
+    // merges and purges drop the deleted vectors from the raw files
+    uint64_t live_count = batch_count * (batch - batch_deleted);
+    wait_row_count(live_count);
+    check_deleted();
+
+    // an index file over the ratio is replaced by its raw backup, which is purged in turn
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFFLAT;
+    index.nlist_ = nlist;
+    stat = db_->CreateIndex(TABLE_NAME, index);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::IDNumbers ids;
+    for (int64_t i = 0; i < batch_count; ++i) {
+        for (int64_t j = batch_deleted; j < 2 * batch_deleted; ++j) {
+            ids.push_back(i * batch + j);
+        }
+    }
+    int64_t deleted_count = 0;
+    stat = db_->DeleteVectors(TABLE_NAME, ids, deleted_count);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(deleted_count, (int64_t)ids.size());
+    delete_ids.insert(delete_ids.end(), ids.begin(), ids.end());
+
+    wait_row_count(live_count - ids.size());
+    check_deleted();
+}
+
+TEST_F(RebuildIndexTest, REBUILD_INDEX_FILES_TEST) {
+    // every batch is indexed on its own, into an index file of a third of the index file size
+    const int64_t batch = milvus::engine::meta::BUILD_INDEX_THRESHOLD, batch_count = 4, k = 1, nlist = 64;
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    table_info.index_file_size_ = 3 * batch * TABLE_DIM * sizeof(float);
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IVFFLAT;
+    index.nlist_ = nlist;
+
+    milvus::engine::VectorsData xb;
+    BuildVectors(batch * batch_count, xb);
+    std::vector<int> index_types = {(int)milvus::engine::meta::TableFileSchema::INDEX};
+    std::vector<int> backup_types = {(int)milvus::engine::meta::TableFileSchema::BACKUP};
+    std::set<std::string> index_ids, backup_ids;
+    for (int64_t i = 0; i < batch_count; ++i) {
+        milvus::engine::VectorsData vectors;
+        vectors.vector_count_ = batch;
+        vectors.float_data_.assign(xb.float_data_.begin() + i * batch * TABLE_DIM,
+                                   xb.float_data_.begin() + (i + 1) * batch * TABLE_DIM);
+        for (int64_t j = 0; j < batch; ++j) {
+            vectors.id_array_.push_back(i * batch + j);
+        }
+        stat = db_->InsertVectors(TABLE_NAME, "", vectors);
+        ASSERT_TRUE(stat.ok());
+        stat = db_->CreateIndex(TABLE_NAME, index);
+        ASSERT_TRUE(stat.ok());
+
+        // the last index file may be rebuilt as soon as it is made, only the first ones are followed
+        if (i == batch_count - 2) {
+            milvus::engine::meta::TableFilesSchema files;
+            ASSERT_TRUE(meta_->FilesByType(TABLE_NAME, index_types, files).ok());
+            ASSERT_EQ(files.size(), batch_count - 1);
+            for (auto& file : files) {
+                index_ids.insert(file.file_id_);
+            }
+            ASSERT_TRUE(meta_->FilesByType(TABLE_NAME, backup_types, files).ok());
+            ASSERT_EQ(files.size(), batch_count - 1);
+            for (auto& file : files) {
+                backup_ids.insert(file.file_id_);
+            }
+        }
+    }
+
+    auto file_ids = [&](const std::vector<int>& file_types) {
+        std::set<std::string> ids;
+        milvus::engine::meta::TableFilesSchema files;
+        meta_->FilesByType(TABLE_NAME, file_types, files);
+        for (auto& file : files) {
+            ids.insert(file.file_id_);
+        }
+        return ids;
+    };
+    auto contains_any = [](const std::set<std::string>& ids, const std::set<std::string>& of) {
+        for (auto& id : of) {
+            if (ids.find(id) != ids.end()) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // the compaction drops the index files and puts their raw backups back
+    bool rebuilt = false;
+    for (int i = 0; i < 3000 && !rebuilt; ++i) {
+        rebuilt = !contains_any(file_ids(index_types), index_ids);
+        if (!rebuilt) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    ASSERT_TRUE(rebuilt);
+    auto deleted_ids = file_ids({(int)milvus::engine::meta::TableFileSchema::TO_DELETE});
+    for (auto& id : index_ids) {
+        ASSERT_TRUE(deleted_ids.find(id) != deleted_ids.end());
+    }
+    // restored backups are raw files until the next compaction round merges them
+    auto raw_ids = file_ids({(int)milvus::engine::meta::TableFileSchema::RAW});
+    for (auto& id : backup_ids) {
+        ASSERT_TRUE(raw_ids.find(id) != raw_ids.end());
+    }
+
+    auto check_search = [&]() {
+        const int64_t nq = 10;
+        for (int64_t i = 0; i < batch_count; ++i) {
+            milvus::engine::VectorsData xq;
+            xq.vector_count_ = nq;
+            xq.float_data_.assign(xb.float_data_.begin() + i * batch * TABLE_DIM,
+                                  xb.float_data_.begin() + (i * batch + nq) * TABLE_DIM);
+
+            std::vector<std::string> tags;
+            milvus::engine::ResultIds result_ids;
+            milvus::engine::ResultDistances result_distances;
+            auto status = db_->Query(dummy_context_, TABLE_NAME, tags, k, nlist, 0, xq, result_ids, result_distances);
+            ASSERT_TRUE(status.ok());
+            ASSERT_EQ(result_ids.size(), nq * k);
+            for (int64_t j = 0; j < nq; ++j) {
+                ASSERT_EQ(result_ids[j * k], i * batch + j);
+            }
+        }
+    };
+
+    uint64_t row_count = 0;
+    ASSERT_TRUE(db_->GetTableRowCount(TABLE_NAME, row_count).ok());
+    ASSERT_EQ(row_count, batch * batch_count);
+    check_search();
+
+    // the backups are merged into one file of full size, which is indexed again
+    std::vector<int> unindexed_types = {(int)milvus::engine::meta::TableFileSchema::RAW,
+                                        (int)milvus::engine::meta::TableFileSchema::TO_INDEX};
+    bool indexed = false;
+    for (int i = 0; i < 60 && !indexed; ++i) {
+        indexed = file_ids(unindexed_types).empty() && file_ids(index_types).size() == 1;
+        if (!indexed) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+    }
+    ASSERT_TRUE(indexed);
+    ASSERT_TRUE(db_->GetTableRowCount(TABLE_NAME, row_count).ok());
+    ASSERT_EQ(row_count, batch * batch_count);
+    check_search();
+}
+
+TEST_F(SearchBatchTest, BATCHED_SEARCH_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    uint64_t nb = VECTOR_COUNT;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    xb.id_array_.resize(nb);
+    for (uint64_t i = 0; i < nb; ++i) {
+        xb.id_array_[i] = i;
+    }
+    stat = db_->InsertVectors(TABLE_NAME, "", xb);
+    ASSERT_TRUE(stat.ok());
+
+    milvus::engine::TableIndex index;
+    index.engine_type_ = (int)milvus::engine::EngineType::FAISS_IDMAP;
+    stat = db_->CreateIndex(TABLE_NAME, index);
+    ASSERT_TRUE(stat.ok());
+
+    // concurrent searches are merged, each of them must still get its own results back
+    const int64_t thread_count = 20;
+    const uint64_t k = 5;
+    std::vector<milvus::Status> status_array(thread_count);
+    std::vector<milvus::engine::ResultIds> ids_array(thread_count);
+    std::vector<milvus::engine::ResultDistances> distances_array(thread_count);
+    std::vector<uint64_t> nq_array(thread_count);
+    std::vector<std::thread> threads;
+    for (int64_t t = 0; t < thread_count; ++t) {
+        nq_array[t] = (t % 3 == 0) ? 2 : 1;
+        threads.emplace_back([&, t]() {
+            milvus::engine::VectorsData xq;
+            xq.vector_count_ = nq_array[t];
+            for (uint64_t q = 0; q < nq_array[t]; ++q) {
+                auto begin = xb.float_data_.begin() + (t + q) * TABLE_DIM;
+                xq.float_data_.insert(xq.float_data_.end(), begin, begin + TABLE_DIM);
+            }
+            std::vector<std::string> tags;
+            status_array[t] = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, ids_array[t],
+                                         distances_array[t]);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (int64_t t = 0; t < thread_count; ++t) {
+        ASSERT_TRUE(status_array[t].ok());
+        ASSERT_EQ(ids_array[t].size(), nq_array[t] * k);
+        ASSERT_EQ(distances_array[t].size(), nq_array[t] * k);
+        for (uint64_t q = 0; q < nq_array[t]; ++q) {
+            ASSERT_EQ(ids_array[t][q * k], static_cast<int64_t>(t + q));
+        }
+    }
+    // every batch holds at most 8 vectors, so the 27 vectors of the 20 searches need no less than 4 queries
+    auto db_impl = std::static_pointer_cast<milvus::engine::DBImpl>(db_);
+    uint64_t batch_count = db_impl->SearchBatchCount();
+    ASSERT_GE(batch_count, 4);
+    ASSERT_LT(batch_count, static_cast<uint64_t>(thread_count));
+}
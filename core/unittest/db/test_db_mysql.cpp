@@ -91,7 +91,7 @@ TEST_F(MySqlDBTest, DB_TEST) {
 
             START_TIMER;
             std::vector<std::string> tags;
-            stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, qxb, result_ids, result_distances);
+            stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, qxb, result_ids, result_distances);
             ss << "Search " << j << " With Size " << count / milvus::engine::M << " M";
             STOP_TIMER(ss.str());
 
@@ -179,7 +179,7 @@ TEST_F(MySqlDBTest, SEARCH_TEST) {
     std::vector<std::string> tags;
     milvus::engine::ResultIds result_ids;
     milvus::engine::ResultDistances result_distances;
-    stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, xq, result_ids, result_distances);
+    stat = db_->Query(dummy_context_, TABLE_NAME, tags, k, 10, 0, xq, result_ids, result_distances);
     ASSERT_TRUE(stat.ok());
 }
 
@@ -366,7 +366,7 @@ TEST_F(MySqlDBTest, PARTITION_TEST) {
         std::vector<std::string> tags = {"0", std::to_string(PARTITION_COUNT - 1)};
         milvus::engine::ResultIds result_ids;
         milvus::engine::ResultDistances result_distances;
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, 10, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, 10, 10, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
         ASSERT_EQ(result_ids.size() / topk, nq);
 
@@ -374,7 +374,7 @@ TEST_F(MySqlDBTest, PARTITION_TEST) {
         tags.clear();
         result_ids.clear();
         result_distances.clear();
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, 10, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, 10, 10, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
         ASSERT_EQ(result_ids.size() / topk, nq);
 
@@ -382,7 +382,7 @@ TEST_F(MySqlDBTest, PARTITION_TEST) {
         tags.push_back("\\d");
         result_ids.clear();
         result_distances.clear();
-        stat = db_->Query(dummy_context_, TABLE_NAME, tags, 10, 10, xq, result_ids, result_distances);
+        stat = db_->Query(dummy_context_, TABLE_NAME, tags, 10, 10, 0, xq, result_ids, result_distances);
         ASSERT_TRUE(stat.ok());
         ASSERT_EQ(result_ids.size() / topk, nq);
     }
@@ -13,9 +13,11 @@
 #include <boost/filesystem.hpp>
 #include <vector>
 
+#include "cache/CpuCacheMgr.h"
 #include "db/engine/EngineFactory.h"
 #include "db/engine/ExecutionEngineImpl.h"
 #include "db/utils.h"
+#include "wrapper/VecIndex.h"
 #include <fiu-local.h>
 #include <fiu-control.h>
 
@@ -188,6 +190,148 @@ TEST_F(EngineTest, ENGINE_IMPL_TEST) {
 #endif
 }
 
+TEST_F(EngineTest, ENGINE_HALF_STORAGE_TEST) {
+    uint16_t dimension = 64;
+    const int64_t row_count = 1000;
+    std::vector<float> data(row_count * dimension);
+    std::vector<int64_t> ids(row_count);
+    for (int64_t i = 0; i < row_count; i++) {
+        ids[i] = i;
+        for (uint16_t k = 0; k < dimension; k++) {
+            data[i * dimension + k] = drand48();
+        }
+    }
+
+    auto float_engine = milvus::engine::EngineFactory::Build(dimension, "/tmp/milvus_index_float",
+                                                             milvus::engine::EngineType::FAISS_IVFFLAT,
+                                                             milvus::engine::MetricType::L2, 1024);
+    float_engine->AddWithIds(row_count, data.data(), ids.data());
+    ASSERT_TRUE(float_engine->Serialize().ok());
+
+    for (auto engine_type : {milvus::engine::EngineType::FAISS_IVFFLAT_FP16,
+                             milvus::engine::EngineType::FAISS_IVFFLAT_BF16}) {
+        std::string file_path = "/tmp/milvus_index_half";
+        auto engine_ptr = milvus::engine::EngineFactory::Build(dimension, file_path, engine_type,
+                                                               milvus::engine::MetricType::L2, 1024);
+        ASSERT_TRUE(engine_ptr != nullptr);
+        auto status = engine_ptr->AddWithIds(row_count, data.data(), ids.data());
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(engine_ptr->Count(), row_count);
+
+        // raw file keeps 2 bytes per dimension
+        ASSERT_TRUE(engine_ptr->Serialize().ok());
+        ASSERT_LT(engine_ptr->PhysicalSize(), float_engine->PhysicalSize() * 3 / 4);
+
+        int64_t k = 10;
+        std::vector<float> distances(k);
+        std::vector<int64_t> labels(k);
+        status = engine_ptr->Search(1, data.data() + 7 * dimension, k, 1, distances.data(), labels.data(), false);
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(labels[0], 7);
+
+        auto index_engine = engine_ptr->BuildIndex("/tmp/milvus_index_half_ivf", engine_type);
+        ASSERT_TRUE(index_engine != nullptr);
+        ASSERT_EQ(index_engine->Count(), row_count);
+        status = index_engine->Search(1, data.data() + 7 * dimension, k, 16, distances.data(), labels.data(), false);
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(labels[0], 7);
+    }
+}
+
+TEST_F(EngineTest, ENGINE_DELETE_IDS_TEST) {
+    uint16_t dimension = 64;
+    const int64_t row_count = 1000;
+    std::vector<float> data(row_count * dimension);
+    std::vector<int64_t> ids(row_count);
+    for (int64_t i = 0; i < row_count; i++) {
+        ids[i] = i;
+        for (uint16_t k = 0; k < dimension; k++) {
+            data[i * dimension + k] = drand48();
+        }
+    }
+
+    std::string file_path = "/tmp/milvus_index_delete";
+    auto engine_ptr = milvus::engine::EngineFactory::Build(dimension, file_path, milvus::engine::EngineType::FAISS_IDMAP,
+                                                           milvus::engine::MetricType::L2, 1024);
+    ASSERT_TRUE(engine_ptr->AddWithIds(row_count, data.data(), ids.data()).ok());
+    ASSERT_TRUE(engine_ptr->Serialize().ok());
+    ASSERT_TRUE(boost::filesystem::exists(milvus::engine::ids_location(file_path)));
+
+    // the file isn't loaded into the cache to be marked
+    auto file_engine = milvus::engine::EngineFactory::Build(
+        dimension, file_path, milvus::engine::EngineType::FAISS_IDMAP, milvus::engine::MetricType::L2, 1024);
+    int64_t deleted_count = 0;
+    ASSERT_TRUE(file_engine->DeleteIds({3, 5, 7, row_count + 1}, deleted_count).ok());
+    ASSERT_EQ(deleted_count, 3);
+    ASSERT_FALSE(milvus::cache::CpuCacheMgr::GetInstance()->ItemExists(file_path));
+
+    std::vector<int64_t> deleted_ids;
+    ASSERT_TRUE(file_engine->GetDeletedIds(deleted_ids).ok());
+    ASSERT_EQ(deleted_ids, std::vector<int64_t>({3, 5, 7}));
+
+    // a loaded file skips them
+    ASSERT_TRUE(file_engine->Load(true).ok());
+    ASSERT_EQ(file_engine->DeletedCount(), 3);
+    int64_t k = 10;
+    std::vector<float> distances(k);
+    std::vector<int64_t> labels(k);
+    ASSERT_TRUE(file_engine->Search(1, data.data() + 5 * dimension, k, 1, distances.data(), labels.data(), false).ok());
+    ASSERT_NE(labels[0], 5);
+
+    // and so does the cached index when more are marked
+    ASSERT_TRUE(file_engine->DeleteIds({9}, deleted_count).ok());
+    ASSERT_EQ(deleted_count, 1);
+    auto cached_engine = milvus::engine::EngineFactory::Build(
+        dimension, file_path, milvus::engine::EngineType::FAISS_IDMAP, milvus::engine::MetricType::L2, 1024);
+    ASSERT_TRUE(cached_engine->Load(true).ok());
+    ASSERT_EQ(cached_engine->DeletedCount(), 4);
+    milvus::cache::CpuCacheMgr::GetInstance()->EraseItem(file_path);
+}
+
+TEST_F(EngineTest, ENGINE_PQ_FASTSCAN_TEST) {
+    uint16_t dimension = 64;
+    const int64_t row_count = 2000;
+    std::vector<float> data(row_count * dimension);
+    std::vector<int64_t> ids(row_count);
+    for (int64_t i = 0; i < row_count; i++) {
+        ids[i] = i;
+        for (uint16_t k = 0; k < dimension; k++) {
+            data[i * dimension + k] = drand48();
+        }
+    }
+
+    auto engine_ptr = milvus::engine::EngineFactory::Build(dimension, "/tmp/milvus_index_fastscan",
+                                                           milvus::engine::EngineType::FAISS_PQ_FASTSCAN,
+                                                           milvus::engine::MetricType::L2, 1024);
+    ASSERT_TRUE(engine_ptr != nullptr);
+    auto status = engine_ptr->AddWithIds(row_count, data.data(), ids.data());
+    ASSERT_TRUE(status.ok());
+
+    std::string index_path = "/tmp/milvus_index_fastscan_ivf";
+    auto index_engine = engine_ptr->BuildIndex(index_path, milvus::engine::EngineType::FAISS_PQ_FASTSCAN);
+    ASSERT_TRUE(index_engine != nullptr);
+    ASSERT_EQ(index_engine->Count(), row_count);
+
+    int64_t k = 10;
+    int64_t nprobe = 32;  // all the lists of 2000 rows
+    std::vector<float> distances(k);
+    std::vector<int64_t> labels(k);
+    status = index_engine->Search(1, data.data() + 7 * dimension, k, nprobe, distances.data(), labels.data(), false);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(labels[0], 7);
+
+    // the serialized index loads back as a fast scan index
+    ASSERT_TRUE(index_engine->Serialize().ok());
+    auto loaded_engine = milvus::engine::EngineFactory::Build(dimension, index_path,
+                                                              milvus::engine::EngineType::FAISS_PQ_FASTSCAN,
+                                                              milvus::engine::MetricType::L2, 1024);
+    ASSERT_TRUE(loaded_engine->Load(false).ok());
+    ASSERT_EQ(loaded_engine->Count(), row_count);
+    status = loaded_engine->Search(1, data.data() + 7 * dimension, k, nprobe, distances.data(), labels.data(), false);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(labels[0], 7);
+}
+
 TEST_F(EngineTest, ENGINE_IMPL_NULL_INDEX_TEST) {
     uint16_t dimension = 64;
     std::string file_path = "/tmp/milvus_index_1";
@@ -10,11 +10,13 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include <boost/filesystem.hpp>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <fstream>
 #include <iostream>
 #include <random>
+#include <set>
 #include <thread>
 #include <fiu-control.h>
 #include <fiu-local.h>
@@ -22,6 +24,7 @@
 
 #include "db/Constants.h"
 #include "db/engine/EngineFactory.h"
+#include "db/insert/MemManagerImpl.h"
 #include "db/insert/MemTable.h"
 #include "db/insert/MemTableFile.h"
 #include "db/insert/VectorSource.h"
@@ -250,6 +253,178 @@ TEST_F(MemManagerTest, MEM_TABLE_TEST) {
     fiu_disable("SqliteMetaImpl.UpdateTableFile.throw_exception");
 }
 
+TEST_F(MemManagerTest, MEM_FILE_SEARCH_TEST) {
+    auto options = GetOptions();
+
+    milvus::engine::meta::TableSchema table_schema = BuildTableSchema();
+    auto status = impl_->CreateTable(table_schema);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::MemManagerImpl mem_mgr(impl_, options);
+
+    int64_t nb = 1000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    status = mem_mgr.InsertVectors(GetTableName(), xb);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(xb.id_array_.size(), nb);
+
+    std::vector<milvus::engine::MemTableFilePtr> mem_files;
+    status = mem_mgr.GetFilesToSearch(GetTableName(), mem_files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(mem_files.size(), 1);
+    ASSERT_EQ(mem_files[0]->RowCount(), nb);
+    ASSERT_EQ(mem_files[0]->GetTableFileSchema().file_type_, milvus::engine::meta::TableFileSchema::NEW);
+
+    int64_t topk = 10, index = 123;
+    std::vector<int64_t> result_ids(topk);
+    std::vector<float> result_distances(topk);
+    status = mem_files[0]->Search(1, xb.float_data_.data() + index * TABLE_DIM, topk, 1, result_distances.data(),
+                                  result_ids.data());
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(result_ids[0], xb.id_array_[index]);
+    ASSERT_LT(result_distances[0], 1e-4);
+
+    std::vector<milvus::engine::MemTableFilePtr> other_files;
+    status = mem_mgr.GetFilesToSearch("not_exist_table", other_files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(other_files.empty());
+
+    // serialized files leave the insert buffer
+    std::set<std::string> table_ids;
+    status = mem_mgr.Serialize(table_ids);
+    ASSERT_TRUE(status.ok());
+    mem_files.clear();
+    status = mem_mgr.GetFilesToSearch(GetTableName(), mem_files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(mem_files.empty());
+}
+
+TEST_F(MemManagerTest, PARALLEL_SERIALIZE_TEST) {
+    auto options = GetOptions();
+    options.flush_thread_num_ = 4;
+
+    milvus::engine::MemManagerImpl mem_mgr(impl_, options);
+
+    // several tables, the last one spans more than one file
+    const int64_t table_count = 4;
+    int64_t nb = 1000;
+    int64_t n_max = milvus::engine::MAX_TABLE_FILE_MEM / (sizeof(float) * TABLE_DIM);
+    std::vector<std::string> table_names;
+    for (int64_t i = 0; i < table_count; ++i) {
+        milvus::engine::meta::TableSchema table_schema = BuildTableSchema();
+        table_schema.table_id_ += "_" + std::to_string(i);
+        auto status = impl_->CreateTable(table_schema);
+        ASSERT_TRUE(status.ok());
+        table_names.push_back(table_schema.table_id_);
+
+        milvus::engine::VectorsData xb;
+        BuildVectors((i == table_count - 1) ? n_max + nb : nb, xb);
+        status = mem_mgr.InsertVectors(table_schema.table_id_, xb);
+        ASSERT_TRUE(status.ok());
+    }
+
+    std::set<std::string> table_ids;
+    auto status = mem_mgr.Serialize(table_ids);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(table_ids.size(), table_count);
+    ASSERT_EQ(mem_mgr.GetCurrentMem(), 0);
+
+    // every row is in meta once the flush returns
+    for (int64_t i = 0; i < table_count; ++i) {
+        uint64_t row_count = 0;
+        status = impl_->Count(table_names[i], row_count);
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(row_count, static_cast<uint64_t>((i == table_count - 1) ? n_max + nb : nb));
+
+        std::vector<milvus::engine::MemTableFilePtr> mem_files;
+        status = mem_mgr.GetFilesToSearch(table_names[i], mem_files);
+        ASSERT_TRUE(status.ok());
+        ASSERT_TRUE(mem_files.empty());
+    }
+}
+
+TEST_F(MemManagerTest, INSERT_BACK_PRESSURE_TEST) {
+    auto options = GetOptions();
+    options.insert_buffer_size_ = 1024 * 1024;
+
+    milvus::engine::meta::TableSchema table_schema = BuildTableSchema();
+    auto status = impl_->CreateTable(table_schema);
+    ASSERT_TRUE(status.ok());
+
+    milvus::engine::MemManagerImpl mem_mgr(impl_, options);
+
+    // exceed the insert buffer limit, the first insert is always accepted
+    int64_t nb = 2 * options.insert_buffer_size_ / (sizeof(float) * TABLE_DIM);
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    status = mem_mgr.InsertVectors(GetTableName(), xb);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(mem_mgr.GetCurrentMem(), nb * sizeof(float) * TABLE_DIM);
+    ASSERT_EQ(mem_mgr.GetCurrentMem(), mem_mgr.GetCurrentMutableMem());
+
+    // the next inserts block until serialize frees the buffer
+    const int64_t insert_threads = 4;
+    std::atomic<int64_t> inserted(0);
+    std::vector<std::thread> threads;
+    for (int64_t i = 0; i < insert_threads; i++) {
+        threads.emplace_back([&]() {
+            milvus::engine::VectorsData more;
+            BuildVectors(10, more);
+            mem_mgr.InsertVectors(GetTableName(), more);
+            inserted++;
+        });
+    }
+    for (int i = 0; i < 1000 && mem_mgr.GetWaitingInsertCount() < static_cast<size_t>(insert_threads); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(mem_mgr.GetWaitingInsertCount(), static_cast<size_t>(insert_threads));
+    ASSERT_EQ(inserted.load(), 0);
+
+    std::set<std::string> table_ids;
+    status = mem_mgr.Serialize(table_ids);
+    ASSERT_TRUE(status.ok());
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    // an insert admitted before serialize would have been flushed with the rest of the buffer
+    ASSERT_EQ(inserted.load(), insert_threads);
+    ASSERT_EQ(mem_mgr.GetCurrentMem(), insert_threads * 10 * sizeof(float) * TABLE_DIM);
+
+    status = mem_mgr.EraseMemVector(GetTableName());
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(mem_mgr.GetCurrentMem(), 0);
+}
+
+TEST_F(MemManagerTest2, INSERT_BUFFER_SEARCH_TEST) {
+    milvus::engine::meta::TableSchema table_info = BuildTableSchema();
+    auto stat = db_->CreateTable(table_info);
+    ASSERT_TRUE(stat.ok());
+
+    int64_t nb = 10000;
+    milvus::engine::VectorsData xb;
+    BuildVectors(nb, xb);
+    stat = db_->InsertVectors(GetTableName(), "", xb);
+    ASSERT_TRUE(stat.ok());
+
+    // search immediately, vectors are visible whether or not they are flushed yet
+    int64_t topk = 10, nprobe = 10, index = 4321;
+    milvus::engine::VectorsData search;
+    search.vector_count_ = 1;
+    for (int64_t j = 0; j < TABLE_DIM; j++) {
+        search.float_data_.push_back(xb.float_data_[index * TABLE_DIM + j]);
+    }
+
+    std::vector<std::string> tags;
+    milvus::engine::ResultIds result_ids;
+    milvus::engine::ResultDistances result_distances;
+    stat = db_->Query(dummy_context_, GetTableName(), tags, topk, nprobe, 0, search, result_ids, result_distances);
+    ASSERT_TRUE(stat.ok());
+    ASSERT_EQ(result_ids.size(), topk);
+    ASSERT_EQ(result_ids[0], xb.id_array_[index]);
+    ASSERT_LT(result_distances[0], 1e-4);
+}
+
 TEST_F(MemManagerTest2, SERIAL_INSERT_SEARCH_TEST) {
     milvus::engine::meta::TableSchema table_info = BuildTableSchema();
     auto stat = db_->CreateTable(table_info);
@@ -296,7 +471,7 @@ TEST_F(MemManagerTest2, SERIAL_INSERT_SEARCH_TEST) {
         std::vector<std::string> tags;
         milvus::engine::ResultIds result_ids;
         milvus::engine::ResultDistances result_distances;
-        stat = db_->Query(dummy_context_, GetTableName(), tags, topk, nprobe, search, result_ids,
+        stat = db_->Query(dummy_context_, GetTableName(), tags, topk, nprobe, 0, search, result_ids,
                           result_distances);
         ASSERT_EQ(result_ids[0], pair.first);
         ASSERT_LT(result_distances[0], 1e-4);
@@ -367,7 +542,7 @@ TEST_F(MemManagerTest2, CONCURRENT_INSERT_SEARCH_TEST) {
 
             std::vector<std::string> tags;
             stat =
-                db_->Query(dummy_context_, GetTableName(), tags, k, 10, qxb, result_ids, result_distances);
+                db_->Query(dummy_context_, GetTableName(), tags, k, 10, 0, qxb, result_ids, result_distances);
             ss << "Search " << j << " With Size " << count / milvus::engine::M << " M";
             STOP_TIMER(ss.str());
 
@@ -11,6 +11,7 @@
 
 #include "db/Constants.h"
 #include "db/Utils.h"
+#include "db/meta/CachedMetaImpl.h"
 #include "db/meta/MetaConsts.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "db/utils.h"
@@ -18,6 +19,7 @@
 #include <gtest/gtest.h>
 #include <stdlib.h>
 #include <time.h>
+#include <future>
 #include <thread>
 #include <fiu-local.h>
 #include <fiu-control.h>
@@ -58,6 +60,150 @@ TEST_F(MetaTest, TABLE_TEST) {
     ASSERT_TRUE(status.ok());
 }
 
+TEST_F(MetaTest, CACHED_META_TEST) {
+    fiu_init(0);
+    auto table_id = "meta_test_cached_table";
+    auto cached = std::make_shared<milvus::engine::meta::CachedMetaImpl>(impl_, 0);
+
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    auto status = cached->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    // once described, the schema is served without the backend
+    status = cached->DescribeTable(table);
+    ASSERT_TRUE(status.ok());
+    FIU_ENABLE_FIU("SqliteMetaImpl.DescribeTable.throw_exception");
+    status = cached->DescribeTable(table);
+    ASSERT_TRUE(status.ok());
+    bool has_table = false;
+    status = cached->HasTable(table_id, has_table);
+    ASSERT_TRUE(has_table);
+
+    // a write drops the cached schema
+    status = cached->UpdateTableFlag(table_id, 1);
+    ASSERT_TRUE(status.ok());
+    status = cached->DescribeTable(table);
+    ASSERT_FALSE(status.ok());
+    fiu_disable("SqliteMetaImpl.DescribeTable.throw_exception");
+    status = cached->DescribeTable(table);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(table.flag_, 1);
+
+    milvus::engine::meta::TableFileSchema file;
+    file.table_id_ = table_id;
+    file.file_type_ = milvus::engine::meta::TableFileSchema::NEW;
+    status = cached->CreateTableFile(file);
+    ASSERT_TRUE(status.ok());
+
+    std::vector<size_t> ids;
+    milvus::engine::meta::DatesT dates;
+    milvus::engine::meta::DatePartionedTableFilesSchema files;
+    status = cached->FilesToSearch(table_id, ids, dates, files);
+    ASSERT_TRUE(files.empty());
+
+    file.file_type_ = milvus::engine::meta::TableFileSchema::RAW;
+    status = cached->UpdateTableFile(file);
+    ASSERT_TRUE(status.ok());
+    status = cached->FilesToSearch(table_id, ids, dates, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files.size(), 1);
+
+    // queries by file id and date are answered from the cached file list
+    FIU_ENABLE_FIU("SqliteMetaImpl.FilesToSearch.throw_exception");
+    ids.push_back(file.id_);
+    status = cached->FilesToSearch(table_id, ids, dates, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(files.size(), 1);
+    ids[0] = file.id_ + 1;
+    status = cached->FilesToSearch(table_id, ids, dates, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(files.empty());
+    ids.clear();
+    dates.push_back(file.date_ + 1);
+    status = cached->FilesToSearch(table_id, ids, dates, files);
+    ASSERT_TRUE(files.empty());
+    dates.clear();
+
+    file.file_type_ = milvus::engine::meta::TableFileSchema::TO_DELETE;
+    milvus::engine::meta::TableFilesSchema update_files = {file};
+    status = cached->UpdateTableFiles(update_files);
+    ASSERT_TRUE(status.ok());
+    status = cached->FilesToSearch(table_id, ids, dates, files);
+    ASSERT_FALSE(status.ok());
+    fiu_disable("SqliteMetaImpl.FilesToSearch.throw_exception");
+    status = cached->FilesToSearch(table_id, ids, dates, files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(files.empty());
+
+    // partition lists follow partition creation and drop
+    std::vector<milvus::engine::meta::TableSchema> partitions;
+    status = cached->ShowPartitions(table_id, partitions);
+    ASSERT_TRUE(status.ok());
+    ASSERT_TRUE(partitions.empty());
+    status = cached->CreatePartition(table_id, "cached_part", "0");
+    ASSERT_TRUE(status.ok());
+    status = cached->ShowPartitions(table_id, partitions);
+    ASSERT_EQ(partitions.size(), 1);
+    status = cached->DropPartition("cached_part");
+    ASSERT_TRUE(status.ok());
+    partitions.clear();
+    status = cached->ShowPartitions(table_id, partitions);
+    ASSERT_TRUE(partitions.empty());
+
+    status = cached->DropTable(table_id);
+    ASSERT_TRUE(status.ok());
+    status = cached->DescribeTable(table);
+    ASSERT_FALSE(status.ok());
+}
+
+TEST_F(MetaTest, GROUP_COMMIT_TEST) {
+    auto table_id = "meta_test_group_commit";
+
+    milvus::engine::meta::TableSchema table;
+    table.table_id_ = table_id;
+    auto status = impl_->CreateTable(table);
+    ASSERT_TRUE(status.ok());
+
+    const size_t NUM = 8;
+    std::vector<milvus::engine::meta::TableFileSchema> files(NUM);
+    for (auto& file : files) {
+        file.table_id_ = table_id;
+        status = impl_->CreateTableFile(file);
+        ASSERT_TRUE(status.ok());
+    }
+
+    std::vector<std::future<milvus::Status>> futures;
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    for (auto& file : files) {
+        threads.emplace_back([&, file]() mutable {
+            file.file_type_ = milvus::engine::meta::TableFileSchema::RAW;
+            auto future = impl_->UpdateTableFilesAsync({file});
+            std::lock_guard<std::mutex> lock(mutex);
+            futures.emplace_back(std::move(future));
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& future : futures) {
+        ASSERT_TRUE(future.get().ok());
+    }
+
+    std::vector<int> file_types = {(int)milvus::engine::meta::TableFileSchema::RAW};
+    milvus::engine::meta::TableFilesSchema raw_files;
+    status = impl_->FilesByType(table_id, file_types, raw_files);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(raw_files.size(), NUM);
+
+    fiu_init(0);
+    FIU_ENABLE_FIU("SqliteMetaImpl.UpdateTableFiles.throw_exception");
+    status = impl_->UpdateTableFilesAsync({files[0]}).get();
+    ASSERT_FALSE(status.ok());
+    fiu_disable("SqliteMetaImpl.UpdateTableFiles.throw_exception");
+}
+
 TEST_F(MetaTest, FALID_TEST) {
     fiu_init(0);
     auto options = GetOptions();
@@ -9,17 +9,20 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
+#include "db/CompactionStrategy.h"
 #include "db/IndexFailedChecker.h"
 #include "db/OngoingFileChecker.h"
 #include "db/Options.h"
 #include "db/Utils.h"
 #include "db/engine/EngineFactory.h"
+#include "db/meta/MetaWriteQueue.h"
 #include "db/meta/SqliteMetaImpl.h"
 #include "utils/Exception.h"
 #include "utils/Status.h"
 
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
+#include <future>
 #include <thread>
 #include <vector>
 #include <fiu-local.h>
@@ -213,3 +216,107 @@ TEST(DBMiscTest, CHECKER_TEST) {
         ASSERT_FALSE(checker.IsIgnored(schema));
     }
 }
+
+TEST(DBMiscTest, COMPACTION_STRATEGY_TEST) {
+    auto make_file = [](int64_t size, int64_t rows) {
+        milvus::engine::meta::TableFileSchema file;
+        file.file_size_ = size;
+        file.row_count_ = rows;
+        file.index_file_size_ = 1000;
+        return file;
+    };
+
+    milvus::engine::DBOptions options;
+    options.merge_trigger_number_ = 3;
+    auto simple = milvus::engine::CompactionStrategyFactory::Build(options);
+    milvus::engine::meta::TableFilesSchema files = {make_file(10, 1), make_file(10, 1)};
+    std::vector<milvus::engine::meta::TableFilesSchema> groups;
+    simple->GroupRawFiles(files, groups);
+    ASSERT_TRUE(groups.empty());
+    files.push_back(make_file(500, 50));
+    simple->GroupRawFiles(files, groups);
+    ASSERT_EQ(groups.size(), 1);
+    ASSERT_EQ(groups[0].size(), 3);
+    ASSERT_FALSE(simple->RebuildIndexFiles(files, files, 1000));
+
+    options.compaction_policy_ = "size_tiered";
+    options.compaction_fan_in_ = 2;
+    options.compaction_write_amp_ = 3.0;
+    auto tiered = milvus::engine::CompactionStrategyFactory::Build(options);
+
+    // the two small files form one tier, the large one is left alone
+    groups.clear();
+    tiered->GroupRawFiles(files, groups);
+    ASSERT_EQ(groups.size(), 1);
+    ASSERT_EQ(groups[0].size(), 2);
+    ASSERT_EQ(groups[0][0].file_size_, 10);
+
+    // files of different tiers are not merged together
+    files = {make_file(100, 10), make_file(20, 2)};
+    groups.clear();
+    tiered->GroupRawFiles(files, groups);
+    ASSERT_TRUE(groups.empty());
+
+    // four quarter full index files are rebuilt into one
+    milvus::engine::meta::TableFilesSchema index_files, backup_files;
+    for (int i = 0; i < 4; ++i) {
+        index_files.push_back(make_file(50, 25));
+        backup_files.push_back(make_file(250, 25));
+    }
+    ASSERT_TRUE(tiered->RebuildIndexFiles(index_files, backup_files, 1000));
+    backup_files.pop_back();
+    ASSERT_FALSE(tiered->RebuildIndexFiles(index_files, backup_files, 1000));
+}
+
+TEST(DBMiscTest, META_WRITE_QUEUE_TEST) {
+    std::vector<size_t> batch_sizes;
+    milvus::Status commit_status;
+    {
+        milvus::engine::meta::MetaWriteQueue queue(
+            [&](milvus::engine::meta::TableFilesSchema& files) {
+                batch_sizes.push_back(files.size());
+                return commit_status;
+            },
+            100, 1000);
+
+        // updates queued within the delay go in one commit, each caller sees its status
+        milvus::engine::meta::TableFileSchema file;
+        auto future1 = queue.Put({file});
+        auto future2 = queue.Put({file, file});
+        ASSERT_TRUE(future1.get().ok());
+        ASSERT_TRUE(future2.get().ok());
+        ASSERT_EQ(batch_sizes.size(), 1);
+        ASSERT_EQ(batch_sizes[0], 3);
+
+        commit_status = milvus::Status(milvus::DB_ERROR, "commit failed");
+        auto future3 = queue.Put({file});
+        ASSERT_FALSE(future3.get().ok());
+        commit_status = milvus::Status::OK();
+
+        // still queued updates are committed when the queue goes away
+        future1 = queue.Put({file});
+    }
+    ASSERT_EQ(batch_sizes.size(), 3);
+
+    // more files than max_batch_size are split between updates, an update larger than that is committed whole
+    batch_sizes.clear();
+    {
+        milvus::engine::meta::MetaWriteQueue queue(
+            [&](milvus::engine::meta::TableFilesSchema& files) {
+                batch_sizes.push_back(files.size());
+                return commit_status;
+            },
+            100, 4);
+
+        milvus::engine::meta::TableFilesSchema two(2), three(3), six(6);
+        std::vector<std::future<milvus::Status>> futures;
+        futures.push_back(queue.Put(two));
+        futures.push_back(queue.Put(two));
+        futures.push_back(queue.Put(three));
+        futures.push_back(queue.Put(six));
+        for (auto& future : futures) {
+            ASSERT_TRUE(future.get().ok());
+        }
+    }
+    ASSERT_EQ(batch_sizes, std::vector<size_t>({4, 3, 6}));
+}
@@ -162,6 +162,49 @@ TEST(DBSearchTest, MERGE_RESULT_SET_TEST) {
     MergeTopkToResultSetTest(TOP_K / 2, TOP_K / 3, NQ, TOP_K, false);
 }
 
+void
+MergeTopkResultsTest(const std::vector<size_t>& topk_vec, size_t nq, size_t topk, bool ascending) {
+    ms::ResultIds merge_ids;
+    ms::ResultDistances merge_distances;
+    ms::ResultIds result_ids(nq * topk), buf_ids(nq * topk);
+    ms::ResultDistances result_distances(nq * topk), buf_distances(nq * topk);
+    size_t result_k = 0;
+    for (auto input_k : topk_vec) {
+        ms::ResultIds ids;
+        ms::ResultDistances distances;
+        BuildResult(ids, distances, input_k, topk, nq, ascending);
+        ms::XSearchTask::MergeTopkToResultSet(ids, distances, input_k, nq, topk, ascending, merge_ids,
+                                              merge_distances);
+        result_k = ms::XSearchTask::MergeTopkResults(ids, distances, input_k, nq, topk, ascending, result_k,
+                                                     result_ids, result_distances, buf_ids, buf_distances);
+        ASSERT_EQ(result_ids.size(), nq * topk);
+        ASSERT_EQ(buf_ids.size(), nq * topk);
+    }
+
+    ASSERT_EQ(nq * result_k, merge_ids.size());
+    for (size_t i = 0; i < nq; i++) {
+        for (size_t j = 0; j < result_k; j++) {
+            ASSERT_EQ(result_distances[i * topk + j], merge_distances[i * result_k + j]);
+        }
+    }
+}
+
+TEST(DBSearchTest, REDUCE_RESULT_TEST) {
+    size_t NQ = 15;
+    size_t TOP_K = 64;
+
+    MergeTopkResultsTest({TOP_K}, NQ, TOP_K, true);
+    MergeTopkResultsTest({TOP_K, 0}, NQ, TOP_K, false);
+    MergeTopkResultsTest({TOP_K / 2, TOP_K / 3}, NQ, TOP_K, true);
+    MergeTopkResultsTest({TOP_K / 2, TOP_K / 3, TOP_K / 4}, NQ, TOP_K, false);
+    MergeTopkResultsTest({TOP_K, TOP_K, TOP_K, TOP_K, TOP_K}, NQ, TOP_K, true);
+
+    /* large nq, reduced on the reduce thread pool */
+    NQ = 1000;
+    MergeTopkResultsTest({TOP_K, TOP_K / 2, TOP_K, 1, TOP_K}, NQ, TOP_K, true);
+    MergeTopkResultsTest({TOP_K, TOP_K / 2, TOP_K, 1, TOP_K}, NQ, TOP_K, false);
+}
+
 //void MergeTopkArrayTest(size_t topk_1, size_t topk_2, size_t nq, size_t topk, bool ascending) {
 //    std::vector<int64_t> ids1, ids2;
 //    std::vector<float> dist1, dist2;
@@ -205,6 +205,62 @@ DBTest2::GetOptions() {
     return options;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+milvus::engine::DBOptions
+SearchBatchTest::GetOptions() {
+    auto options = BaseTest::GetOptions();
+    options.search_batch_wait_ms_ = 20;
+    options.search_batch_max_nq_ = 8;
+    return options;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+milvus::engine::DBOptions
+RangeSearchTest::GetOptions() {
+    auto options = BaseTest::GetOptions();
+    options.max_range_results_ = 100;
+    return options;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+milvus::engine::DBOptions
+WarmStartTest::GetOptions() {
+    auto options = BaseTest::GetOptions();
+    options.preload_thread_num_ = 2;
+    options.warm_start_enable_ = true;
+    return options;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+milvus::engine::DBOptions
+DeleteTest::GetOptions() {
+    auto options = BaseTest::GetOptions();
+    options.compaction_deleted_ratio_ = 0.1;
+    return options;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+void
+RebuildIndexTest::SetUp() {
+    // sqlite meta instances share one connection, open it before the db starts its background threads
+    meta_ = std::make_shared<milvus::engine::meta::SqliteMetaImpl>(GetOptions().meta_);
+    DBTest::SetUp();
+}
+
+void
+RebuildIndexTest::TearDown() {
+    DBTest::TearDown();
+    meta_ = nullptr;
+}
+
+milvus::engine::DBOptions
+RebuildIndexTest::GetOptions() {
+    auto options = BaseTest::GetOptions();
+    options.compaction_policy_ = "size_tiered";
+    options.compaction_fan_in_ = 4;
+    return options;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 void
 MetaTest::SetUp() {
@@ -80,6 +80,47 @@ class DBTest2 : public DBTest {
     GetOptions() override;
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class SearchBatchTest : public DBTest {
+ protected:
+    milvus::engine::DBOptions
+    GetOptions() override;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class RangeSearchTest : public DBTest {
+ protected:
+    milvus::engine::DBOptions
+    GetOptions() override;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class WarmStartTest : public DBTest {
+ protected:
+    milvus::engine::DBOptions
+    GetOptions() override;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class DeleteTest : public DBTest {
+ protected:
+    milvus::engine::DBOptions
+    GetOptions() override;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class RebuildIndexTest : public DBTest {
+ protected:
+    std::shared_ptr<milvus::engine::meta::SqliteMetaImpl> meta_;
+
+    void
+    SetUp() override;
+    void
+    TearDown() override;
+    milvus::engine::DBOptions
+    GetOptions() override;
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 class EngineTest : public DBTest {};
 
@@ -32,6 +32,15 @@ TEST(MetricbaseTest, METRICBASE_TEST) {
     instance.FaissDiskLoadSizeBytesHistogramObserve(1.0);
     instance.FaissDiskLoadIOSpeedGaugeSet(1.0);
     instance.CacheAccessTotalIncrement();
+    instance.CpuCacheHitCounterIncrement("test_table");
+    instance.CpuCacheMissCounterIncrement("test_table");
+    instance.CpuCacheEvictCounterIncrement("test_table");
+    instance.LoadQueueDepthGaugeSet(1);
+    instance.LoadReservedBytesGaugeSet(1.0);
+    instance.LoadWaitDurationSecondsHistogramObserve(1.0);
+    instance.SearchTopkPrunedCounterIncrement(1.0);
+    instance.SegmentCountGaugeSet(1.0);
+    instance.CompactionDebtBytesGaugeSet(1.0);
     instance.MemTableMergeDurationSecondsHistogramObserve(1.0);
     instance.SearchIndexDataDurationSecondsHistogramObserve(1.0);
     instance.SearchRawDataDurationSecondsHistogramObserve(1.0);
@@ -57,6 +66,11 @@ TEST(MetricbaseTest, METRICBASE_TEST) {
     instance.ConnectionGaugeIncrement();
     instance.ConnectionGaugeDecrement();
     instance.KeepingAliveCounterIncrement();
+    instance.InsertRequestDurationHistogramObserve(1.0);
+    instance.InsertBufferWaitDurationHistogramObserve(1.0);
+    instance.FlushDurationHistogramObserve(1.0);
+    instance.FlushBytesPerSecondGaugeSet(1.0);
+    instance.SearchReduceDurationHistogramObserve(1.0);
     instance.PushToGateway();
     instance.OctetsSet();
 }
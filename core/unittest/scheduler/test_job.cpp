@@ -10,6 +10,7 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include <gtest/gtest.h>
+#include <limits>
 
 #include "scheduler/job/Job.h"
 #include "scheduler/job/BuildIndexJob.h"
@@ -41,5 +42,51 @@ TEST(JobTest, TestJob) {
     search_ptr->AddIndexFile(nullptr);
 }
 
+TEST(JobTest, SEARCH_DISTANCE_BOUND_TEST) {
+    engine::VectorsData vectors;
+    vectors.vector_count_ = 2;
+    auto search_job = std::make_shared<SearchJob>(nullptr, 2, 1, vectors);
+
+    std::vector<float> bound;
+    ASSERT_FALSE(search_job->GetDistanceBound(bound));
+
+    // partial results don't bound the search
+    ResultIds ids = {1, -1, 2, -1};
+    ResultDistances distances = {0.1, 0.0, 0.2, 0.0};
+    search_job->AddTaskResult(ids, distances, 1, true);
+    ASSERT_FALSE(search_job->GetDistanceBound(bound));
+
+    ids = {3, 4, 5, -1};
+    distances = {0.3, 0.4, 0.5, 0.0};
+    search_job->AddTaskResult(ids, distances, 2, true);
+    ASSERT_TRUE(search_job->GetDistanceBound(bound));
+    ASSERT_EQ(bound.size(), 2);
+    ASSERT_FLOAT_EQ(bound[0], 0.4);
+    ASSERT_EQ(bound[1], std::numeric_limits<float>::max());
+
+    ids = {6, 7, 8, 9};
+    distances = {0.2, 0.6, 0.1, 0.3};
+    search_job->AddTaskResult(ids, distances, 2, true);
+    ASSERT_TRUE(search_job->GetDistanceBound(bound));
+    ASSERT_FLOAT_EQ(bound[0], 0.4);
+    ASSERT_FLOAT_EQ(bound[1], 0.3);
+
+    search_job->AddPrunedCount(2, 1);
+    search_job->AddPrunedCount(3, 0);
+    ASSERT_EQ(search_job->pruned_count(), 5);
+    ASSERT_EQ(search_job->deleted_count(), 1);
+}
+
+TEST(JobTest, SEARCH_EMPTY_RESULT_TEST) {
+    engine::VectorsData vectors;
+    vectors.vector_count_ = 3;
+    auto search_job = std::make_shared<SearchJob>(nullptr, 4, 1, vectors);
+
+    // no file to search, no task ever returns a result
+    search_job->WaitResult();
+    ASSERT_TRUE(search_job->GetResultIds().empty());
+    ASSERT_TRUE(search_job->GetResultDistances().empty());
+}
+
 }  // namespace scheduler
 }  // namespace milvus
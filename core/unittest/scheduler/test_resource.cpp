@@ -10,7 +10,13 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 
+#include "scheduler/BuildMgr.h"
 #include "scheduler/ResourceFactory.h"
 #include "scheduler/resource/CpuResource.h"
 #include "scheduler/resource/DiskResource.h"
@@ -26,6 +32,64 @@ namespace scheduler {
 
 constexpr uint64_t max_once_load = 2;
 
+namespace {
+
+// start order of the tasks of a resource, and the number of builds running at once
+struct ExecuteLog {
+    std::mutex mutex;
+    std::vector<TaskType> started;
+    std::atomic<int64_t> running_build_num{0};
+    std::atomic<int64_t> max_running_build_num{0};
+
+    void
+    Start(TaskType type) {
+        std::lock_guard<std::mutex> lock(mutex);
+        started.push_back(type);
+    }
+};
+
+class LoggedSearchTask : public TestTask {
+ public:
+    LoggedSearchTask(TableFileSchemaPtr& file, TaskLabelPtr label, ExecuteLog& log)
+        : TestTask(std::make_shared<server::Context>("dummy_request_id"), file, std::move(label)), log_(log) {
+    }
+
+    void
+    Execute() override {
+        log_.Start(Type());
+        TestTask::Execute();
+    }
+
+ private:
+    ExecuteLog& log_;
+};
+
+class LoggedBuildTask : public Task {
+ public:
+    LoggedBuildTask(TaskLabelPtr label, ExecuteLog& log) : Task(TaskType::BuildIndexTask, std::move(label)), log_(log) {
+    }
+
+    void
+    Load(LoadType type, uint8_t device_id) override {
+    }
+
+    void
+    Execute() override {
+        log_.Start(Type());
+        auto running = ++log_.running_build_num;
+        auto max_running = log_.max_running_build_num.load();
+        while (running > max_running && !log_.max_running_build_num.compare_exchange_weak(max_running, running)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        --log_.running_build_num;
+    }
+
+ private:
+    ExecuteLog& log_;
+};
+
+}  // namespace
+
 /************ ResourceBaseTest ************/
 class ResourceBaseTest : public testing::Test {
  protected:
@@ -283,5 +347,171 @@ TEST(Connection_Test, CONNECTION_TEST) {
     std::cout << connection.Dump() << std::endl;
 }
 
+TEST(ResourceThreadTest, MULTI_THREAD_RESOURCE_TEST) {
+    const uint64_t NUM = 4;
+    auto resource = ResourceFactory::Create("cpu", "CPU", 0);
+    resource->SetThreadNum(2, NUM);
+    std::static_pointer_cast<CpuResource>(resource)->SetOmpThreadNum(NUM);
+    ASSERT_EQ(resource->ExecutorThreadNum(), NUM);
+
+    uint64_t load_count = 0;
+    uint64_t exec_count = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+    resource->RegisterSubscriber([&](EventPtr event) {
+        if (event->Type() == EventType::LOAD_COMPLETED || event->Type() == EventType::FINISH_TASK) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (event->Type() == EventType::LOAD_COMPLETED) {
+                    ++load_count;
+                } else {
+                    ++exec_count;
+                }
+            }
+            cv.notify_one();
+        }
+    });
+    resource->Start();
+
+    std::vector<std::shared_ptr<TestTask>> tasks;
+    TableFileSchemaPtr dummy = nullptr;
+    for (uint64_t i = 0; i < NUM; ++i) {
+        auto label = std::make_shared<SpecResLabel>(resource);
+        auto task = std::make_shared<TestTask>(std::make_shared<server::Context>("dummy_request_id"), dummy, label);
+        std::vector<std::string> path{resource->name()};
+        task->path() = Path(path, 0);
+        tasks.push_back(task);
+        resource->task_table().Put(task);
+    }
+
+    // a single wakeup is enough, siblings are woken as tasks get picked
+    resource->WakeupLoader();
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return load_count == NUM; });
+    }
+    resource->WakeupExecutor();
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return exec_count == NUM; });
+    }
+    resource->Stop();
+
+    for (uint64_t i = 0; i < NUM; ++i) {
+        ASSERT_EQ(tasks[i]->load_count_, 1);
+        ASSERT_EQ(tasks[i]->exec_count_, 1);
+    }
+    ASSERT_EQ(resource->TotalTasks(), NUM);
+}
+
+TEST(ResourceThreadTest, BUILD_THREAD_RESOURCE_TEST) {
+    BuildMgr build_mgr(4);
+    ASSERT_TRUE(build_mgr.Take());
+    build_mgr.SetConcurrentLimit(2);
+    ASSERT_EQ(build_mgr.NumOfAvailable(), 1);
+    ASSERT_TRUE(build_mgr.Take());
+    ASSERT_FALSE(build_mgr.Take());
+    build_mgr.Put();
+    ASSERT_EQ(build_mgr.NumOfAvailable(), 1);
+
+    // the executor thread reserved for builds must not keep other tasks from running
+    const uint64_t NUM = 4;
+    auto resource = ResourceFactory::Create("cpu", "CPU", 0);
+    resource->SetThreadNum(1, 2);
+    std::static_pointer_cast<CpuResource>(resource)->SetOmpThreadNum(NUM);
+    std::static_pointer_cast<CpuResource>(resource)->SetBuildThreadNum(1, 0);
+
+    uint64_t exec_count = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+    resource->RegisterSubscriber([&](EventPtr event) {
+        if (event->Type() == EventType::LOAD_COMPLETED) {
+            resource->WakeupExecutor();
+        } else if (event->Type() == EventType::FINISH_TASK) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++exec_count;
+            }
+            cv.notify_one();
+            resource->WakeupLoader();
+        }
+    });
+    resource->Start();
+
+    TableFileSchemaPtr dummy = nullptr;
+    for (uint64_t i = 0; i < NUM; ++i) {
+        auto label = std::make_shared<SpecResLabel>(resource);
+        auto task = std::make_shared<TestTask>(std::make_shared<server::Context>("dummy_request_id"), dummy, label);
+        std::vector<std::string> path{resource->name()};
+        task->path() = Path(path, 0);
+        resource->task_table().Put(task);
+    }
+    resource->WakeupLoader();
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return exec_count == NUM; });
+    }
+    resource->Stop();
+    ASSERT_EQ(resource->TotalTasks(), NUM);
+}
+
+TEST(ResourceThreadTest, BUILD_BEHIND_SEARCH_TEST) {
+    // builds queued ahead of searches are loaded and executed after them, and no more than build_parallel_num
+    // of them execute at once although more executor threads are idle
+    const uint64_t SEARCH_NUM = 4;
+    const uint64_t BUILD_NUM = 4;
+    const int64_t BUILD_PARALLEL_NUM = 1;
+    auto resource = ResourceFactory::Create("cpu", "CPU", 0);
+    resource->SetThreadNum(1, 3);
+    std::static_pointer_cast<CpuResource>(resource)->SetOmpThreadNum(4);
+    std::static_pointer_cast<CpuResource>(resource)->SetBuildThreadNum(BUILD_PARALLEL_NUM, 1);
+
+    uint64_t exec_count = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+    resource->RegisterSubscriber([&](EventPtr event) {
+        if (event->Type() == EventType::LOAD_COMPLETED) {
+            resource->WakeupExecutor();
+        } else if (event->Type() == EventType::FINISH_TASK) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++exec_count;
+            }
+            cv.notify_one();
+            resource->WakeupLoader();
+            resource->WakeupExecutor();
+        }
+    });
+
+    ExecuteLog log;
+    TableFileSchemaPtr dummy = nullptr;
+    std::vector<std::string> path{resource->name()};
+    for (uint64_t i = 0; i < BUILD_NUM; ++i) {
+        auto task = std::make_shared<LoggedBuildTask>(std::make_shared<SpecResLabel>(resource), log);
+        task->path() = Path(path, 0);
+        resource->task_table().Put(task);
+    }
+    for (uint64_t i = 0; i < SEARCH_NUM; ++i) {
+        auto task = std::make_shared<LoggedSearchTask>(dummy, std::make_shared<SpecResLabel>(resource), log);
+        task->path() = Path(path, 0);
+        resource->task_table().Put(task);
+    }
+
+    resource->Start();
+    resource->WakeupLoader();
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return exec_count == SEARCH_NUM + BUILD_NUM; });
+    }
+    resource->Stop();
+
+    ASSERT_EQ(log.started.size(), SEARCH_NUM + BUILD_NUM);
+    auto first_build = std::find(log.started.begin(), log.started.end(), TaskType::BuildIndexTask);
+    ASSERT_EQ(first_build - log.started.begin(), SEARCH_NUM);
+    ASSERT_EQ(std::count(first_build, log.started.end(), TaskType::BuildIndexTask), BUILD_NUM);
+    ASSERT_EQ(log.max_running_build_num, BUILD_PARALLEL_NUM);
+    ASSERT_EQ(log.running_build_num, 0);
+}
+
 }  // namespace scheduler
 }  // namespace milvus
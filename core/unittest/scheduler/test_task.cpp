@@ -15,6 +15,8 @@
 #include <opentracing/mocktracer/tracer.h>
 #include <src/scheduler/SchedInst.h>
 #include <src/scheduler/resource/CpuResource.h>
+#include <atomic>
+#include <thread>
 
 #include "db/meta/SqliteMetaImpl.h"
 #include "db/DBFactory.h"
@@ -180,6 +182,109 @@ TEST(TaskTest, TEST_TASK) {
     XSearchTask::MergeTopkToResultSet(ids, distances, 1, 1, 1, true, tar_ids, tar_distances);
 }
 
+TEST(TaskTest, LOAD_BUDGET_TEST) {
+    LoadMgr load_mgr(100);
+    ASSERT_TRUE(load_mgr.Reserve(60));
+    ASSERT_FALSE(load_mgr.Reserve(50));
+    ASSERT_TRUE(load_mgr.Reserve(0));
+    ASSERT_TRUE(load_mgr.Reserve(40));
+    ASSERT_EQ(load_mgr.Reserved(), 100);
+    load_mgr.Release(100);
+    // a file larger than the budget is admitted when nothing else is loaded
+    ASSERT_TRUE(load_mgr.Reserve(500));
+    ASSERT_FALSE(load_mgr.Reserve(1));
+    load_mgr.Release(500);
+
+    load_mgr.WaitBegin();
+    ASSERT_EQ(load_mgr.NumOfWaiting(), 1);
+    load_mgr.WaitEnd(10);
+    ASSERT_EQ(load_mgr.NumOfWaiting(), 0);
+
+    // search tasks share the global budget
+    auto dummy_context = std::make_shared<milvus::server::Context>("dummy_request_id");
+    auto label = std::make_shared<BroadcastLabel>();
+    auto global_mgr = LoadMgrInst::GetInstance();
+    int64_t capacity = global_mgr->Capacity();
+    global_mgr->SetCapacity(1000);
+
+    auto file1 = std::make_shared<TableFileSchema>();
+    file1->location_ = "/tmp/milvus_test/load_budget_1";
+    file1->file_size_ = 800;
+    auto file2 = std::make_shared<TableFileSchema>();
+    file2->location_ = "/tmp/milvus_test/load_budget_2";
+    file2->file_size_ = 800;
+
+    {
+        XSearchTask task1(dummy_context, file1, label);
+        XSearchTask task2(dummy_context, file2, label);
+        bool reserved = false;
+        ASSERT_TRUE(task1.AdmitLoad(reserved));
+        ASSERT_TRUE(reserved);
+        ASSERT_TRUE(task1.AdmitLoad(reserved));
+        ASSERT_FALSE(reserved);
+        ASSERT_FALSE(task2.AdmitLoad(reserved));
+        ASSERT_EQ(global_mgr->NumOfWaiting(), 1);
+
+        ASSERT_TRUE(task1.ReleaseLoad());
+        ASSERT_FALSE(task1.ReleaseLoad());
+        ASSERT_TRUE(task2.AdmitLoad(reserved));
+        ASSERT_EQ(global_mgr->NumOfWaiting(), 0);
+        ASSERT_EQ(global_mgr->Reserved(), 800);
+    }
+    // destroyed tasks give their budget back
+    ASSERT_EQ(global_mgr->Reserved(), 0);
+    global_mgr->SetCapacity(capacity);
+}
+
+TEST(TaskTest, LOAD_BUDGET_RACE_TEST) {
+    auto dummy_context = std::make_shared<milvus::server::Context>("dummy_request_id");
+    auto label = std::make_shared<BroadcastLabel>();
+    auto global_mgr = LoadMgrInst::GetInstance();
+    int64_t capacity = global_mgr->Capacity();
+    global_mgr->SetCapacity(1000);
+
+    auto file1 = std::make_shared<TableFileSchema>();
+    file1->location_ = "/tmp/milvus_test/load_race_1";
+    file1->file_size_ = 800;
+    auto file2 = std::make_shared<TableFileSchema>();
+    file2->location_ = "/tmp/milvus_test/load_race_2";
+    file2->file_size_ = 800;
+
+    for (int64_t round = 0; round < 100; ++round) {
+        XSearchTask task1(dummy_context, file1, label);
+        XSearchTask task2(dummy_context, file2, label);
+
+        // two loaders admit the same task, only one of them reserves; the other fails to load it
+        // and must not give back the reservation the first one still holds
+        std::atomic<int64_t> reservations(0);
+        auto loader = [&]() {
+            bool reserved = false;
+            if (task1.AdmitLoad(reserved) && reserved) {
+                ++reservations;
+            }
+        };
+        std::thread loader_a(loader);
+        std::thread loader_b(loader);
+        loader_a.join();
+        loader_b.join();
+        ASSERT_EQ(reservations, 1);
+        ASSERT_EQ(global_mgr->Reserved(), 800);
+
+        bool reserved = false;
+        ASSERT_FALSE(task2.AdmitLoad(reserved));
+
+        // once released the task goes through the budget again
+        ASSERT_TRUE(task1.ReleaseLoad());
+        ASSERT_TRUE(task2.AdmitLoad(reserved));
+        ASSERT_TRUE(reserved);
+        ASSERT_FALSE(task1.AdmitLoad(reserved));
+        ASSERT_TRUE(task2.ReleaseLoad());
+    }
+    ASSERT_EQ(global_mgr->Reserved(), 0);
+    ASSERT_EQ(global_mgr->NumOfWaiting(), 0);
+    global_mgr->SetCapacity(capacity);
+}
+
 TEST(TaskTest, TEST_PATH) {
     Path path;
     auto empty_path = path.Current();
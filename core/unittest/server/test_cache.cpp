@@ -270,3 +270,93 @@ TEST(CacheTest, PARTIAL_LRU_TEST) {
 
     ASSERT_ANY_THROW(lru.get(-1));
 }
+
+TEST(CacheTest, SLRU_TEST) {
+    // each item takes 100KB, about 10 items fit
+    constexpr int64_t CAPACITY = 1UL << 20;
+    auto make_item = []() { return std::make_shared<MockVecIndex>(256, 100); };
+
+    for (auto& policy : {milvus::cache::CACHE_POLICY_LRU, milvus::cache::CACHE_POLICY_SLRU}) {
+        milvus::cache::Cache<milvus::cache::DataObjPtr> cache(CAPACITY, 1UL << 32, policy);
+        int64_t evict_count = 0;
+        cache.set_evict_callback([&](const std::string& key) { ++evict_count; });
+
+        // hot items are accessed again after insertion
+        for (int i = 0; i < 4; ++i) {
+            cache.insert("hot_" + std::to_string(i), make_item());
+        }
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_NE(cache.get("hot_" + std::to_string(i)), nullptr);
+        }
+
+        // a scan over cold items, each read once
+        for (int i = 0; i < 20; ++i) {
+            cache.insert("cold_" + std::to_string(i), make_item());
+        }
+        ASSERT_LE(cache.usage(), CAPACITY);
+        ASSERT_EQ(evict_count + cache.size(), 24);
+
+        bool hot_kept = true;
+        for (int i = 0; i < 4; ++i) {
+            hot_kept = hot_kept && cache.exists("hot_" + std::to_string(i));
+        }
+        ASSERT_EQ(hot_kept, std::string(policy) == milvus::cache::CACHE_POLICY_SLRU);
+        ASSERT_TRUE(cache.exists("cold_19"));
+    }
+}
+
+TEST(CacheTest, SLRU_RELOAD_COST_TEST) {
+    milvus::cache::SLRUPolicy<milvus::cache::DataObjPtr> policy(1UL << 20);
+
+    auto expensive = std::make_shared<MockVecIndex>(256, 100);
+    expensive->set_reload_cost(expensive->Size() * 4);
+    auto cheap = std::make_shared<MockVecIndex>(256, 100);
+
+    // the expensive item is older but the cheap one goes first
+    policy.put("expensive", expensive);
+    policy.put("cheap", cheap);
+    std::vector<std::string> keys;
+    policy.victims(1, keys);
+    ASSERT_EQ(keys.size(), 1);
+    ASSERT_EQ(keys[0], "cheap");
+
+    keys.clear();
+    policy.victims(cheap->Size() + 1, keys);
+    ASSERT_EQ(keys.size(), 2);
+    ASSERT_EQ(keys[1], "expensive");
+
+    // promoted on the second access, evicted after probation items
+    policy.get("expensive");
+    keys.clear();
+    policy.victims(cheap->Size() + 1, keys);
+    ASSERT_EQ(keys.size(), 2);
+    ASSERT_EQ(keys[0], "cheap");
+
+    policy.erase("cheap");
+    ASSERT_FALSE(policy.exists("cheap"));
+    ASSERT_EQ(policy.size(), 1);
+    ASSERT_ANY_THROW(policy.get("cheap"));
+    policy.clear();
+    ASSERT_EQ(policy.size(), 0);
+}
+
+TEST(CacheTest, LRU_PEEK_TEST) {
+    milvus::cache::LRUPolicy<milvus::cache::DataObjPtr> policy(10);
+    policy.put("first", std::make_shared<MockVecIndex>(256, 100));
+    policy.put("second", std::make_shared<MockVecIndex>(256, 100));
+
+    // a peek keeps the oldest item first in line, a get moves it to the back
+    ASSERT_NE(policy.peek("first"), nullptr);
+    std::vector<std::string> keys;
+    policy.victims(1, keys);
+    ASSERT_EQ(keys.size(), 1);
+    ASSERT_EQ(keys[0], "first");
+
+    policy.get("first");
+    keys.clear();
+    policy.victims(1, keys);
+    ASSERT_EQ(keys.size(), 1);
+    ASSERT_EQ(keys[0], "second");
+
+    ASSERT_ANY_THROW(policy.peek("third"));
+}
@@ -181,6 +181,42 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetDBConfigArchiveDaysThreshold(int64_val).ok());
     ASSERT_TRUE(int64_val == db_archive_days_threshold);
 
+    std::string db_compaction_policy = "size_tiered";
+    ASSERT_TRUE(config.SetDBConfigCompactionPolicy(db_compaction_policy).ok());
+    ASSERT_TRUE(config.GetDBConfigCompactionPolicy(str_val).ok());
+    ASSERT_TRUE(str_val == db_compaction_policy);
+
+    int64_t db_compaction_fan_in = 8;
+    ASSERT_TRUE(config.SetDBConfigCompactionFanIn(std::to_string(db_compaction_fan_in)).ok());
+    ASSERT_TRUE(config.GetDBConfigCompactionFanIn(int64_val).ok());
+    ASSERT_TRUE(int64_val == db_compaction_fan_in);
+
+    double db_compaction_write_amp = 2.0;
+    double double_val;
+    ASSERT_TRUE(config.SetDBConfigCompactionWriteAmp(std::to_string(db_compaction_write_amp)).ok());
+    ASSERT_TRUE(config.GetDBConfigCompactionWriteAmp(double_val).ok());
+    ASSERT_TRUE(double_val == db_compaction_write_amp);
+
+    int64_t db_compaction_throttle = 128;
+    ASSERT_TRUE(config.SetDBConfigCompactionThrottle(std::to_string(db_compaction_throttle)).ok());
+    ASSERT_TRUE(config.GetDBConfigCompactionThrottle(int64_val).ok());
+    ASSERT_TRUE(int64_val == db_compaction_throttle);
+
+    float db_compaction_deleted_ratio = 0.5;
+    ASSERT_TRUE(config.SetDBConfigCompactionDeletedRatio(std::to_string(db_compaction_deleted_ratio)).ok());
+    ASSERT_TRUE(config.GetDBConfigCompactionDeletedRatio(float_val).ok());
+    ASSERT_TRUE(float_val == db_compaction_deleted_ratio);
+
+    bool db_meta_cache_enable = false;
+    ASSERT_TRUE(config.SetDBConfigMetaCacheEnable(std::to_string(db_meta_cache_enable)).ok());
+    ASSERT_TRUE(config.GetDBConfigMetaCacheEnable(bool_val).ok());
+    ASSERT_TRUE(bool_val == db_meta_cache_enable);
+
+    int64_t db_meta_commit_delay = 20;
+    ASSERT_TRUE(config.SetDBConfigMetaCommitDelay(std::to_string(db_meta_commit_delay)).ok());
+    ASSERT_TRUE(config.GetDBConfigMetaCommitDelay(int64_val).ok());
+    ASSERT_TRUE(int64_val == db_meta_commit_delay);
+
     /* storage config */
     std::string storage_primary_path = "/home/zilliz";
     ASSERT_TRUE(config.SetStorageConfigPrimaryPath(storage_primary_path).ok());
@@ -192,6 +228,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetStorageConfigSecondaryPath(str_val).ok());
     ASSERT_TRUE(str_val == storage_secondary_path);
 
+    bool storage_file_mmap_enable = true;
+    ASSERT_TRUE(config.SetStorageConfigFileMmapEnable(std::to_string(storage_file_mmap_enable)).ok());
+    ASSERT_TRUE(config.GetStorageConfigFileMmapEnable(bool_val).ok());
+    ASSERT_TRUE(bool_val == storage_file_mmap_enable);
+
     bool storage_s3_enable = true;
     ASSERT_TRUE(config.SetStorageConfigS3Enable(std::to_string(storage_s3_enable)).ok());
     ASSERT_TRUE(config.GetStorageConfigS3Enable(bool_val).ok());
@@ -222,6 +263,16 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetStorageConfigS3Bucket(str_val).ok());
     ASSERT_TRUE(str_val == storage_s3_bucket);
 
+    std::string storage_s3_cache_path = "/tmp/milvus_s3_cache";
+    ASSERT_TRUE(config.SetStorageConfigS3CachePath(storage_s3_cache_path).ok());
+    ASSERT_TRUE(config.GetStorageConfigS3CachePath(str_val).ok());
+    ASSERT_TRUE(str_val == storage_s3_cache_path);
+
+    int64_t storage_s3_cache_capacity = 8;
+    ASSERT_TRUE(config.SetStorageConfigS3CacheCapacity(std::to_string(storage_s3_cache_capacity)).ok());
+    ASSERT_TRUE(config.GetStorageConfigS3CacheCapacity(int64_val).ok());
+    ASSERT_TRUE(int64_val == storage_s3_cache_capacity);
+
     /* metric config */
     bool metric_enable_monitor = false;
     ASSERT_TRUE(config.SetMetricConfigEnableMonitor(std::to_string(metric_enable_monitor)).ok());
@@ -249,6 +300,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetCacheConfigCpuCacheThreshold(float_val).ok());
     ASSERT_TRUE(float_val == cache_cpu_cache_threshold);
 
+    std::string cache_cpu_cache_policy = "slru";
+    ASSERT_TRUE(config.SetCacheConfigCpuCachePolicy(cache_cpu_cache_policy).ok());
+    ASSERT_TRUE(config.GetCacheConfigCpuCachePolicy(str_val).ok());
+    ASSERT_TRUE(str_val == cache_cpu_cache_policy);
+
     int64_t cache_insert_buffer_size = 2;
     ASSERT_TRUE(config.SetCacheConfigInsertBufferSize(std::to_string(cache_insert_buffer_size)).ok());
     ASSERT_TRUE(config.GetCacheConfigInsertBufferSize(int64_val).ok());
@@ -259,6 +315,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetCacheConfigCacheInsertData(bool_val).ok());
     ASSERT_TRUE(bool_val == cache_insert_data);
 
+    bool cache_warm_start_enable = true;
+    ASSERT_TRUE(config.SetCacheConfigWarmStartEnable(std::to_string(cache_warm_start_enable)).ok());
+    ASSERT_TRUE(config.GetCacheConfigWarmStartEnable(bool_val).ok());
+    ASSERT_TRUE(bool_val == cache_warm_start_enable);
+
     /* engine config */
     int64_t engine_use_blas_threshold = 50;
     ASSERT_TRUE(config.SetEngineConfigUseBlasThreshold(std::to_string(engine_use_blas_threshold)).ok());
@@ -270,6 +331,56 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_TEST) {
     ASSERT_TRUE(config.GetEngineConfigOmpThreadNum(int64_val).ok());
     ASSERT_TRUE(int64_val == engine_omp_thread_num);
 
+    int64_t engine_executor_thread_num = 1;
+    ASSERT_TRUE(config.SetEngineConfigExecutorThreadNum(std::to_string(engine_executor_thread_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigExecutorThreadNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_executor_thread_num);
+
+    int64_t engine_loader_thread_num = 1;
+    ASSERT_TRUE(config.SetEngineConfigLoaderThreadNum(std::to_string(engine_loader_thread_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigLoaderThreadNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_loader_thread_num);
+
+    int64_t engine_search_batch_wait = 5;
+    ASSERT_TRUE(config.SetEngineConfigSearchBatchWait(std::to_string(engine_search_batch_wait)).ok());
+    ASSERT_TRUE(config.GetEngineConfigSearchBatchWait(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_search_batch_wait);
+
+    int64_t engine_search_batch_max_nq = 256;
+    ASSERT_TRUE(config.SetEngineConfigSearchBatchMaxNq(std::to_string(engine_search_batch_max_nq)).ok());
+    ASSERT_TRUE(config.GetEngineConfigSearchBatchMaxNq(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_search_batch_max_nq);
+
+    int64_t engine_max_range_results = 10000;
+    ASSERT_TRUE(config.SetEngineConfigMaxRangeResults(std::to_string(engine_max_range_results)).ok());
+    ASSERT_TRUE(config.GetEngineConfigMaxRangeResults(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_max_range_results);
+
+    bool engine_share_ivf_quantizer = true;
+    ASSERT_TRUE(config.SetEngineConfigShareIvfQuantizer(std::to_string(engine_share_ivf_quantizer)).ok());
+    ASSERT_TRUE(config.GetEngineConfigShareIvfQuantizer(bool_val).ok());
+    ASSERT_TRUE(bool_val == engine_share_ivf_quantizer);
+
+    int64_t engine_preload_thread_num = 8;
+    ASSERT_TRUE(config.SetEngineConfigPreloadThreadNum(std::to_string(engine_preload_thread_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigPreloadThreadNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_preload_thread_num);
+
+    int64_t engine_build_parallel_num = 2;
+    ASSERT_TRUE(config.SetEngineConfigBuildParallelNum(std::to_string(engine_build_parallel_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigBuildParallelNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_build_parallel_num);
+
+    int64_t engine_build_omp_thread_num = 1;
+    ASSERT_TRUE(config.SetEngineConfigBuildOmpThreadNum(std::to_string(engine_build_omp_thread_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigBuildOmpThreadNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_build_omp_thread_num);
+
+    int64_t engine_flush_thread_num = 8;
+    ASSERT_TRUE(config.SetEngineConfigFlushThreadNum(std::to_string(engine_flush_thread_num)).ok());
+    ASSERT_TRUE(config.GetEngineConfigFlushThreadNum(int64_val).ok());
+    ASSERT_TRUE(int64_val == engine_flush_thread_num);
+
 #ifdef MILVUS_GPU_VERSION
     int64_t engine_gpu_search_threshold = 800;
     ASSERT_TRUE(config.SetEngineConfigGpuSearchThreshold(std::to_string(engine_gpu_search_threshold)).ok());
@@ -396,6 +507,15 @@ TEST_F(ConfigTest, SERVER_CONFIG_CLI_TEST) {
     ASSERT_TRUE(s.ok());
     ASSERT_TRUE(result == cache_cpu_cache_threshold);
 
+    std::string cache_cpu_cache_policy = "slru";
+    get_cmd = gen_get_command(ms::CONFIG_CACHE, ms::CONFIG_CACHE_CPU_CACHE_POLICY);
+    set_cmd = gen_set_command(ms::CONFIG_CACHE, ms::CONFIG_CACHE_CPU_CACHE_POLICY, cache_cpu_cache_policy);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == cache_cpu_cache_policy);
+
     std::string cache_insert_buffer_size = "1";
     get_cmd = gen_get_command(ms::CONFIG_CACHE, ms::CONFIG_CACHE_INSERT_BUFFER_SIZE);
     set_cmd = gen_set_command(ms::CONFIG_CACHE, ms::CONFIG_CACHE_INSERT_BUFFER_SIZE, cache_insert_buffer_size);
@@ -412,6 +532,15 @@ TEST_F(ConfigTest, SERVER_CONFIG_CLI_TEST) {
     s = config.ProcessConfigCli(result, get_cmd);
     ASSERT_TRUE(result == cache_insert_data);
 
+    std::string cache_warm_start_enable = "true";
+    get_cmd = gen_get_command(ms::CONFIG_CACHE, ms::CONFIG_CACHE_WARM_START_ENABLE);
+    set_cmd = gen_set_command(ms::CONFIG_CACHE, ms::CONFIG_CACHE_WARM_START_ENABLE, cache_warm_start_enable);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == cache_warm_start_enable);
+
     /* engine config */
     std::string engine_use_blas_threshold = "50";
     get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_USE_BLAS_THRESHOLD);
@@ -431,6 +560,96 @@ TEST_F(ConfigTest, SERVER_CONFIG_CLI_TEST) {
     ASSERT_TRUE(s.ok());
     ASSERT_TRUE(result == engine_omp_thread_num);
 
+    std::string engine_executor_thread_num = "1";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_EXECUTOR_THREAD_NUM);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_EXECUTOR_THREAD_NUM, engine_executor_thread_num);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_executor_thread_num);
+
+    std::string engine_loader_thread_num = "1";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_LOADER_THREAD_NUM);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_LOADER_THREAD_NUM, engine_loader_thread_num);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_loader_thread_num);
+
+    std::string engine_search_batch_wait = "5";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_SEARCH_BATCH_WAIT);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_SEARCH_BATCH_WAIT, engine_search_batch_wait);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_search_batch_wait);
+
+    std::string engine_search_batch_max_nq = "256";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_SEARCH_BATCH_MAX_NQ);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_SEARCH_BATCH_MAX_NQ, engine_search_batch_max_nq);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_search_batch_max_nq);
+
+    std::string engine_max_range_results = "10000";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_MAX_RANGE_RESULTS);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_MAX_RANGE_RESULTS, engine_max_range_results);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_max_range_results);
+
+    std::string engine_share_ivf_quantizer = "true";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_SHARE_IVF_QUANTIZER);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_SHARE_IVF_QUANTIZER, engine_share_ivf_quantizer);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_share_ivf_quantizer);
+
+    std::string engine_preload_thread_num = "8";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_PRELOAD_THREAD_NUM);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_PRELOAD_THREAD_NUM, engine_preload_thread_num);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_preload_thread_num);
+
+    std::string engine_build_parallel_num = "2";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_BUILD_PARALLEL_NUM);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_BUILD_PARALLEL_NUM, engine_build_parallel_num);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_build_parallel_num);
+
+    std::string engine_build_omp_thread_num = "1";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_BUILD_OMP_THREAD_NUM);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_BUILD_OMP_THREAD_NUM, engine_build_omp_thread_num);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_build_omp_thread_num);
+
+    std::string engine_flush_thread_num = "8";
+    get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_FLUSH_THREAD_NUM);
+    set_cmd = gen_set_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_FLUSH_THREAD_NUM, engine_flush_thread_num);
+    s = config.ProcessConfigCli(dummy, set_cmd);
+    ASSERT_TRUE(s.ok());
+    s = config.ProcessConfigCli(result, get_cmd);
+    ASSERT_TRUE(s.ok());
+    ASSERT_TRUE(result == engine_flush_thread_num);
+
 #ifdef MILVUS_GPU_VERSION
     std::string engine_gpu_search_threshold = "800";
     get_cmd = gen_get_command(ms::CONFIG_ENGINE, ms::CONFIG_ENGINE_GPU_SEARCH_THRESHOLD);
@@ -527,6 +746,27 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetDBConfigArchiveDaysThreshold("0x10").ok());
 
+    ASSERT_FALSE(config.SetDBConfigCompactionPolicy("leveled").ok());
+
+    ASSERT_FALSE(config.SetDBConfigCompactionFanIn("a").ok());
+    ASSERT_FALSE(config.SetDBConfigCompactionFanIn("1").ok());
+
+    ASSERT_FALSE(config.SetDBConfigCompactionWriteAmp("a").ok());
+    ASSERT_FALSE(config.SetDBConfigCompactionWriteAmp("1.0").ok());
+
+    ASSERT_FALSE(config.SetDBConfigCompactionThrottle("a").ok());
+    ASSERT_FALSE(config.SetDBConfigCompactionThrottle("-1").ok());
+
+    ASSERT_FALSE(config.SetDBConfigCompactionDeletedRatio("a").ok());
+    ASSERT_FALSE(config.SetDBConfigCompactionDeletedRatio("0").ok());
+    ASSERT_FALSE(config.SetDBConfigCompactionDeletedRatio("1.5").ok());
+
+    ASSERT_FALSE(config.SetDBConfigMetaCacheEnable("10").ok());
+
+    ASSERT_FALSE(config.SetDBConfigMetaCommitDelay("a").ok());
+    ASSERT_FALSE(config.SetDBConfigMetaCommitDelay("-1").ok());
+    ASSERT_FALSE(config.SetDBConfigMetaCommitDelay("2000").ok());
+
     /* storage config */
     ASSERT_FALSE(config.SetStorageConfigPrimaryPath("").ok());
 
@@ -534,6 +774,8 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetStorageConfigS3Enable("10").ok());
 
+    ASSERT_FALSE(config.SetStorageConfigFileMmapEnable("10").ok());
+
     ASSERT_FALSE(config.SetStorageConfigS3Address("127.0.0").ok());
 
     ASSERT_FALSE(config.SetStorageConfigS3Port("100").ok());
@@ -545,6 +787,11 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetStorageConfigS3Bucket("").ok());
 
+    ASSERT_FALSE(config.SetStorageConfigS3CachePath("relative/path").ok());
+
+    ASSERT_FALSE(config.SetStorageConfigS3CacheCapacity("a").ok());
+    ASSERT_FALSE(config.SetStorageConfigS3CacheCapacity("0").ok());
+
     /* metric config */
     ASSERT_FALSE(config.SetMetricConfigEnableMonitor("Y").ok());
 
@@ -562,6 +809,8 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetCacheConfigCpuCacheThreshold("1.0").ok());
     ASSERT_FALSE(config.SetCacheConfigCpuCacheThreshold("-0.1").ok());
 
+    ASSERT_FALSE(config.SetCacheConfigCpuCachePolicy("lfu").ok());
+
     ASSERT_FALSE(config.SetCacheConfigInsertBufferSize("a").ok());
     ASSERT_FALSE(config.SetCacheConfigInsertBufferSize("0").ok());
     ASSERT_FALSE(config.SetCacheConfigInsertBufferSize("2048").ok());
@@ -569,6 +818,8 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
 
     ASSERT_FALSE(config.SetCacheConfigCacheInsertData("N").ok());
 
+    ASSERT_FALSE(config.SetCacheConfigWarmStartEnable("10").ok());
+
     /* engine config */
     ASSERT_FALSE(config.SetEngineConfigUseBlasThreshold("0xff").ok());
 
@@ -576,6 +827,40 @@ TEST_F(ConfigTest, SERVER_CONFIG_INVALID_TEST) {
     ASSERT_FALSE(config.SetEngineConfigOmpThreadNum("10000").ok());
     ASSERT_FALSE(config.SetEngineConfigOmpThreadNum("-10").ok());
 
+    ASSERT_FALSE(config.SetEngineConfigExecutorThreadNum("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigExecutorThreadNum("0").ok());
+    ASSERT_FALSE(config.SetEngineConfigExecutorThreadNum("10000").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigLoaderThreadNum("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigLoaderThreadNum("0").ok());
+    ASSERT_FALSE(config.SetEngineConfigLoaderThreadNum("10000").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigSearchBatchWait("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigSearchBatchWait("-1").ok());
+    ASSERT_FALSE(config.SetEngineConfigSearchBatchWait("1000").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigSearchBatchMaxNq("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigSearchBatchMaxNq("0").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigMaxRangeResults("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigMaxRangeResults("0").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigShareIvfQuantizer("10").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigPreloadThreadNum("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigPreloadThreadNum("0").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigBuildParallelNum("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigBuildParallelNum("0").ok());
+    ASSERT_FALSE(config.SetEngineConfigBuildParallelNum("10000").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigBuildOmpThreadNum("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigBuildOmpThreadNum("-1").ok());
+    ASSERT_FALSE(config.SetEngineConfigBuildOmpThreadNum("10000").ok());
+
+    ASSERT_FALSE(config.SetEngineConfigFlushThreadNum("a").ok());
+    ASSERT_FALSE(config.SetEngineConfigFlushThreadNum("0").ok());
+
 #ifdef MILVUS_GPU_VERSION
     ASSERT_FALSE(config.SetEngineConfigGpuSearchThreshold("-1").ok());
 #endif
@@ -676,6 +961,41 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_archive_days_threshold_fail");
 
+    fiu_enable("check_config_compaction_policy_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_policy_fail");
+
+    fiu_enable("check_config_compaction_fan_in_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_fan_in_fail");
+
+    fiu_enable("check_config_compaction_write_amp_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_write_amp_fail");
+
+    fiu_enable("check_config_compaction_throttle_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_throttle_fail");
+
+    fiu_enable("check_config_compaction_deleted_ratio_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_deleted_ratio_fail");
+
+    fiu_enable("check_config_meta_cache_enable_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_meta_cache_enable_fail");
+
+    fiu_enable("check_config_meta_commit_delay_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_meta_commit_delay_fail");
+
     fiu_enable("check_config_insert_buffer_size_fail", 1, NULL, 0);
     s = config.ValidateConfig();
     ASSERT_FALSE(s.ok());
@@ -699,11 +1019,21 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_cpu_cache_threshold_fail");
 
+    fiu_enable("check_config_cpu_cache_policy_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_cpu_cache_policy_fail");
+
     fiu_enable("check_config_cache_insert_data_fail", 1, NULL, 0);
     s = config.ValidateConfig();
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_cache_insert_data_fail");
 
+    fiu_enable("check_config_warm_start_enable_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_warm_start_enable_fail");
+
     /* engine config */
     fiu_enable("check_config_use_blas_threshold_fail", 1, NULL, 0);
     s = config.ValidateConfig();
@@ -715,6 +1045,56 @@ TEST_F(ConfigTest, SERVER_CONFIG_VALID_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_omp_thread_num_fail");
 
+    fiu_enable("check_config_executor_thread_num_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_executor_thread_num_fail");
+
+    fiu_enable("check_config_loader_thread_num_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_loader_thread_num_fail");
+
+    fiu_enable("check_config_search_batch_wait_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_search_batch_wait_fail");
+
+    fiu_enable("check_config_search_batch_max_nq_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_search_batch_max_nq_fail");
+
+    fiu_enable("check_config_max_range_results_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_max_range_results_fail");
+
+    fiu_enable("check_config_share_ivf_quantizer_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_share_ivf_quantizer_fail");
+
+    fiu_enable("check_config_preload_thread_num_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_preload_thread_num_fail");
+
+    fiu_enable("check_config_build_parallel_num_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_build_parallel_num_fail");
+
+    fiu_enable("check_config_build_omp_thread_num_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_build_omp_thread_num_fail");
+
+    fiu_enable("check_config_flush_thread_num_fail", 1, NULL, 0);
+    s = config.ValidateConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_flush_thread_num_fail");
+
 #ifdef MILVUS_GPU_VERSION
     fiu_enable("check_config_gpu_search_threshold_fail", 1, NULL, 0);
     s = config.ValidateConfig();
@@ -878,6 +1258,41 @@ TEST_F(ConfigTest, SERVER_CONFIG_RESET_DEFAULT_CONFIG_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_archive_days_threshold_fail");
 
+    fiu_enable("check_config_compaction_policy_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_policy_fail");
+
+    fiu_enable("check_config_compaction_fan_in_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_fan_in_fail");
+
+    fiu_enable("check_config_compaction_write_amp_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_write_amp_fail");
+
+    fiu_enable("check_config_compaction_throttle_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_throttle_fail");
+
+    fiu_enable("check_config_compaction_deleted_ratio_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_compaction_deleted_ratio_fail");
+
+    fiu_enable("check_config_meta_cache_enable_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_meta_cache_enable_fail");
+
+    fiu_enable("check_config_meta_commit_delay_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_meta_commit_delay_fail");
+
     fiu_enable("check_config_insert_buffer_size_fail", 1, NULL, 0);
     s = config.ResetDefaultConfig();
     ASSERT_FALSE(s.ok());
@@ -901,11 +1316,21 @@ TEST_F(ConfigTest, SERVER_CONFIG_RESET_DEFAULT_CONFIG_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_cpu_cache_threshold_fail");
 
+    fiu_enable("check_config_cpu_cache_policy_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_cpu_cache_policy_fail");
+
     fiu_enable("check_config_cache_insert_data_fail", 1, NULL, 0);
     s = config.ResetDefaultConfig();
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_cache_insert_data_fail");
 
+    fiu_enable("check_config_warm_start_enable_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_warm_start_enable_fail");
+
     /* engine config */
     fiu_enable("check_config_use_blas_threshold_fail", 1, NULL, 0);
     s = config.ResetDefaultConfig();
@@ -917,6 +1342,56 @@ TEST_F(ConfigTest, SERVER_CONFIG_RESET_DEFAULT_CONFIG_FAIL_TEST) {
     ASSERT_FALSE(s.ok());
     fiu_disable("check_config_omp_thread_num_fail");
 
+    fiu_enable("check_config_executor_thread_num_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_executor_thread_num_fail");
+
+    fiu_enable("check_config_loader_thread_num_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_loader_thread_num_fail");
+
+    fiu_enable("check_config_search_batch_wait_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_search_batch_wait_fail");
+
+    fiu_enable("check_config_search_batch_max_nq_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_search_batch_max_nq_fail");
+
+    fiu_enable("check_config_max_range_results_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_max_range_results_fail");
+
+    fiu_enable("check_config_share_ivf_quantizer_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_share_ivf_quantizer_fail");
+
+    fiu_enable("check_config_preload_thread_num_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_preload_thread_num_fail");
+
+    fiu_enable("check_config_build_parallel_num_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_build_parallel_num_fail");
+
+    fiu_enable("check_config_build_omp_thread_num_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_build_omp_thread_num_fail");
+
+    fiu_enable("check_config_flush_thread_num_fail", 1, NULL, 0);
+    s = config.ResetDefaultConfig();
+    ASSERT_FALSE(s.ok());
+    fiu_disable("check_config_flush_thread_num_fail");
+
 #ifdef MILVUS_GPU_VERSION
     fiu_enable("check_config_gpu_search_threshold_fail", 1, NULL, 0);
     s = config.ResetDefaultConfig();
@@ -31,6 +31,7 @@
 #include "utils/CommonUtil.h"
 #include "server/grpc_impl/GrpcServer.h"
 
+#include <faiss/FaissHook.h>
 #include <fiu-local.h>
 #include <fiu-control.h>
 
@@ -434,6 +435,62 @@ TEST_F(RpcHandlerTest, SEARCH_TEST) {
     handler->SearchInFiles(&context, &search_in_files_param, &response);
 }
 
+TEST_F(RpcHandlerTest, PACKED_VECTORS_TEST) {
+    ::grpc::ServerContext context;
+    handler->SetContext(&context, dummy_context);
+    handler->RegisterRequestHandler(milvus::server::RequestHandler());
+
+    std::vector<std::vector<float>> record_array;
+    BuildVectors(0, VECTOR_COUNT, record_array);
+    std::string packed;
+    for (auto& record : record_array) {
+        packed.append(reinterpret_cast<const char*>(record.data()), record.size() * sizeof(float));
+    }
+
+    // insert packed vectors
+    ::milvus::grpc::InsertParam insert_param;
+    ::milvus::grpc::VectorIds vector_ids;
+    insert_param.set_table_name(TABLE_NAME);
+    insert_param.set_packed_float_data(packed);
+    insert_param.set_packed_dimension(TABLE_DIM);
+    handler->Insert(&context, &insert_param, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::SUCCESS);
+    ASSERT_EQ(vector_ids.vector_id_array_size(), VECTOR_COUNT);
+
+    // missing dimension
+    insert_param.set_packed_dimension(0);
+    handler->Insert(&context, &insert_param, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_DIMENSION);
+
+    // blob size is not a multiple of the row size
+    insert_param.set_packed_dimension(TABLE_DIM);
+    insert_param.set_packed_float_data(packed.substr(0, packed.size() - sizeof(float)));
+    handler->Insert(&context, &insert_param, &vector_ids);
+    ASSERT_EQ(vector_ids.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
+
+    // wrong dimension for the table
+    insert_param.set_packed_float_data(packed);
+    insert_param.set_packed_dimension(TABLE_DIM / 2);
+    handler->Insert(&context, &insert_param, &vector_ids);
+    ASSERT_NE(vector_ids.status().error_code(), ::milvus::grpc::SUCCESS);
+
+    // search with packed query vectors
+    ::milvus::grpc::SearchParam request;
+    ::milvus::grpc::TopKQueryResult response;
+    int64_t nq = 10;
+    request.set_table_name(TABLE_NAME);
+    request.set_topk(10);
+    request.set_nprobe(32);
+    request.set_packed_float_data(packed.substr(0, nq * TABLE_DIM * sizeof(float)));
+    request.set_packed_dimension(TABLE_DIM);
+    handler->Search(&context, &request, &response);
+    ASSERT_NE(response.status().error_code(), ::milvus::grpc::ILLEGAL_ROWRECORD);
+
+    request.set_packed_dimension(0);
+    handler->Search(&context, &request, &response);
+    ASSERT_EQ(response.status().error_code(), ::milvus::grpc::ILLEGAL_DIMENSION);
+}
+
 TEST_F(RpcHandlerTest, TABLES_TEST) {
     ::grpc::ServerContext context;
     handler->SetContext(&context, dummy_context);
@@ -757,6 +814,10 @@ TEST_F(RpcHandlerTest, CMD_TEST) {
     command.set_cmd("build_commit_id");
     handler->Cmd(&context, &command, &reply);
 
+    command.set_cmd("simd_level");
+    handler->Cmd(&context, &command, &reply);
+    ASSERT_EQ(reply.string_reply(), faiss::simd_level_name(faiss::get_simd_level()));
+
     command.set_cmd("set_config");
     handler->Cmd(&context, &command, &reply);
     command.set_cmd("get_config");
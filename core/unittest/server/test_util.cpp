@@ -24,6 +24,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <boost/filesystem.hpp>
+#include <cmath>
 #include <thread>
 #include <src/utils/Exception.h>
 
@@ -413,6 +414,25 @@ TEST(ValidationUtilTest, VALIDATE_NPROBE_TEST) {
     ASSERT_NE(milvus::server::ValidationUtil::ValidateSearchNprobe(101, schema).code(), milvus::SERVER_SUCCESS);
 }
 
+TEST(ValidationUtilTest, VALIDATE_REFINE_FACTOR_TEST) {
+    ASSERT_EQ(milvus::server::ValidationUtil::ValidateSearchRefineFactor(0).code(), milvus::SERVER_SUCCESS);
+    ASSERT_EQ(milvus::server::ValidationUtil::ValidateSearchRefineFactor(8).code(), milvus::SERVER_SUCCESS);
+    ASSERT_NE(milvus::server::ValidationUtil::ValidateSearchRefineFactor(-1).code(), milvus::SERVER_SUCCESS);
+    ASSERT_NE(milvus::server::ValidationUtil::ValidateSearchRefineFactor(33).code(), milvus::SERVER_SUCCESS);
+}
+
+TEST(ValidationUtilTest, VALIDATE_RADIUS_TEST) {
+    milvus::engine::meta::TableSchema schema;
+    schema.metric_type_ = (int32_t)milvus::engine::MetricType::L2;
+    ASSERT_EQ(milvus::server::ValidationUtil::ValidateSearchRadius(0.5, schema).code(), milvus::SERVER_SUCCESS);
+    ASSERT_NE(milvus::server::ValidationUtil::ValidateSearchRadius(0, schema).code(), milvus::SERVER_SUCCESS);
+    ASSERT_NE(milvus::server::ValidationUtil::ValidateSearchRadius(NAN, schema).code(), milvus::SERVER_SUCCESS);
+
+    schema.metric_type_ = (int32_t)milvus::engine::MetricType::IP;
+    ASSERT_EQ(milvus::server::ValidationUtil::ValidateSearchRadius(-0.5, schema).code(), milvus::SERVER_SUCCESS);
+    ASSERT_NE(milvus::server::ValidationUtil::ValidateSearchRadius(INFINITY, schema).code(), milvus::SERVER_SUCCESS);
+}
+
 TEST(ValidationUtilTest, VALIDATE_PARTITION_TAGS) {
     std::vector<std::string> partition_tags = {"abc"};
     ASSERT_EQ(milvus::server::ValidationUtil::ValidatePartitionTags(partition_tags).code(), milvus::SERVER_SUCCESS);
@@ -11,14 +11,18 @@
 
 
 #include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <cstdio>
 #include <fstream>
 #include <memory>
+#include <string>
 #include <fiu-local.h>
 #include <fiu-control.h>
 
 #include "easyloggingpp/easylogging++.h"
 #include "server/Config.h"
 #include "storage/s3/S3ClientWrapper.h"
+#include "storage/s3/S3DiskCache.h"
 #include "storage/s3/S3IOReader.h"
 #include "storage/s3/S3IOWriter.h"
 #include "storage/IStorage.h"
@@ -126,6 +130,109 @@ TEST_F(StorageTest, S3_RW_TEST) {
     storage_inst.StopService();
 }
 
+TEST_F(StorageTest, S3_RANGE_READ_TEST) {
+    fiu_init(0);
+
+    const std::string index_name = "/tmp/test_range_index";
+
+    // larger than one ranged GET part, so the reader splits it up
+    std::string content(20 * 1024 * 1024 + 17, '\0');
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<char>(i % 251);
+    }
+
+    auto& storage_inst = milvus::storage::S3ClientWrapper::GetInstance();
+    fiu_enable("S3ClientWrapper.StartService.mock_enable", 1, NULL, 0);
+    ASSERT_TRUE(storage_inst.StartService().ok());
+    ASSERT_TRUE(storage_inst.PutObjectStr(index_name, content).ok());
+
+    size_t length = 0;
+    ASSERT_TRUE(storage_inst.GetObjectLength(index_name, length).ok());
+    ASSERT_EQ(length, content.size());
+
+    std::string part(10, '\0');
+    ASSERT_TRUE(storage_inst.GetObjectRange(index_name, 100, part.size(), &part[0]).ok());
+    ASSERT_EQ(part, content.substr(100, part.size()));
+
+    {
+        milvus::storage::S3IOReader reader(index_name);
+        ASSERT_EQ(reader.length(), content.size());
+
+        // small read served from the read-ahead block
+        char small[16];
+        reader.seekg(1000);
+        reader.read(small, sizeof(small));
+        ASSERT_EQ(std::string(small, sizeof(small)), content.substr(1000, sizeof(small)));
+
+        // large read fetched in parallel parts
+        std::string large(content.size() - 3, '\0');
+        reader.seekg(3);
+        reader.read(&large[0], large.size());
+        ASSERT_EQ(large, content.substr(3));
+    }
+
+    fiu_enable("S3ClientWrapper.GetObjectLength.outcome.fail", 1, NULL, 0);
+    ASSERT_FALSE(storage_inst.GetObjectLength(index_name, length).ok());
+    fiu_disable("S3ClientWrapper.GetObjectLength.outcome.fail");
+
+    fiu_enable("S3ClientWrapper.GetObjectRange.outcome.fail", 1, NULL, 0);
+    ASSERT_FALSE(storage_inst.GetObjectRange(index_name, 0, part.size(), &part[0]).ok());
+    fiu_disable("S3ClientWrapper.GetObjectRange.outcome.fail");
+
+    ASSERT_TRUE(storage_inst.DeleteObject(index_name).ok());
+    ASSERT_FALSE(storage_inst.GetObjectLength(index_name, length).ok());
+
+    storage_inst.StopService();
+}
+
+TEST_F(StorageTest, S3_DISK_CACHE_TEST) {
+    const std::string cache_path = "/tmp/milvus_test/s3_cache";
+    boost::filesystem::remove_all(cache_path);
+    auto& cache = milvus::storage::S3DiskCache::GetInstance();
+
+    ASSERT_TRUE(cache.Start("", 1024).ok());
+    ASSERT_FALSE(cache.Enabled());
+
+    ASSERT_TRUE(cache.Start(cache_path, 1024).ok());
+    ASSERT_TRUE(cache.Enabled());
+
+    auto stage = [&](const std::string& key, size_t size) {
+        std::string temp_path = cache.TempPath(key);
+        std::ofstream out(temp_path, std::ios::binary);
+        out << std::string(size, 'x');
+        out.close();
+        return cache.Put(key, temp_path);
+    };
+
+    std::string file_path;
+    ASSERT_FALSE(cache.Get("obj_a", file_path));
+    ASSERT_TRUE(stage("obj_a", 400).ok());
+    ASSERT_TRUE(stage("obj_b", 400).ok());
+    ASSERT_TRUE(cache.Get("obj_a", file_path));
+    ASSERT_EQ(cache.Usage(), 800);
+
+    // obj_b is least recently used and gets evicted
+    ASSERT_TRUE(stage("obj_c", 400).ok());
+    ASSERT_FALSE(cache.Get("obj_b", file_path));
+    ASSERT_TRUE(cache.Get("obj_a", file_path));
+    ASSERT_TRUE(cache.Get("obj_c", file_path));
+    ASSERT_EQ(cache.Usage(), 800);
+
+    // cached files are picked up again after restart
+    cache.Stop();
+    ASSERT_TRUE(cache.Start(cache_path, 1024).ok());
+    ASSERT_TRUE(cache.Get("obj_c", file_path));
+    ASSERT_EQ(cache.Usage(), 800);
+
+    cache.Erase("obj_a");
+    cache.Erase("obj_c");
+    ASSERT_FALSE(cache.Get("obj_a", file_path));
+    ASSERT_EQ(cache.Usage(), 0);
+
+    cache.Stop();
+    ASSERT_FALSE(cache.Enabled());
+}
+
 TEST_F(StorageTest, S3_FAIL_TEST) {
     fiu_init(0);
 
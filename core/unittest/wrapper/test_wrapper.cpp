@@ -18,10 +18,14 @@
 
 #endif
 
+#include "knowhere/index/vector_index/helpers/FaissIO.h"
 #include "knowhere/index/vector_index/helpers/IndexParameter.h"
+#include "server/Config.h"
 #include "wrapper/VecIndex.h"
 #include "wrapper/utils.h"
 
+#include <faiss/IndexIVF.h>
+#include <faiss/index_io.h>
 #include <fiu-control.h>
 #include <fiu-local.h>
 #include <gtest/gtest.h>
@@ -226,6 +230,60 @@ TEST_P(KnowhereWrapperTest, SERIALIZE_TEST) {
         AssertResult(res_ids, res_dis);
     }
 
+    {
+        milvus::server::Config& config = milvus::server::Config::GetInstance();
+        ASSERT_TRUE(config.SetStorageConfigFileMmapEnable("true").ok());
+
+        std::string file_location = "/tmp/knowhere_mmap";
+        write_index(index_, file_location);
+        auto new_index = milvus::engine::read_index(file_location);
+        ASSERT_NE(new_index, nullptr);
+        EXPECT_EQ(new_index->GetType(), ConvertToCpuIndexType(index_type));
+        EXPECT_EQ(new_index->Count(), index_->Count());
+
+        std::vector<int64_t> res_ids(elems);
+        std::vector<float> res_dis(elems);
+        new_index->Search(nq, xq.data(), res_dis.data(), res_ids.data(), searchconf);
+        AssertResult(res_ids, res_dis);
+
+        // an index that points into the mapping must serialize back unchanged
+        std::string copy_location = "/tmp/knowhere_mmap_copy";
+        ASSERT_TRUE(write_index(new_index, copy_location).ok());
+        auto copy_index = milvus::engine::read_index(copy_location);
+        ASSERT_NE(copy_index, nullptr);
+        EXPECT_EQ(copy_index->Count(), index_->Count());
+        copy_index->Search(nq, xq.data(), res_dis.data(), res_ids.data(), searchconf);
+        AssertResult(res_ids, res_dis);
+
+        // every section is aligned in the file, the read-only lists of the copy are borrowed from the mapping
+        auto type = milvus::engine::IndexType::INVALID;
+        knowhere::BinarySet binary_set;
+        int64_t length = 0;
+        ASSERT_TRUE(milvus::engine::read_index_binary(copy_location, type, binary_set, length).ok());
+        for (auto& pair : binary_set.binary_map_) {
+            ASSERT_TRUE(pair.second->mapped);
+            ASSERT_EQ(reinterpret_cast<uintptr_t>(pair.second->data.get()) % faiss::IO_ZERO_COPY_ALIGNMENT, 0);
+        }
+#ifndef MILVUS_GPU_VERSION
+        auto iter = binary_set.binary_map_.find("IVF");
+        if (iter != binary_set.binary_map_.end()) {
+            knowhere::MemoryIOReader reader;
+            reader.total = iter->second->size;
+            reader.data_ = iter->second->data.get();
+            std::unique_ptr<faiss::Index> faiss_index(faiss::read_index(&reader, faiss::IO_FLAG_ZERO_COPY));
+            auto ivf_index = dynamic_cast<faiss::IndexIVF*>(faiss_index.get());
+            if (ivf_index != nullptr) {
+                auto lists = dynamic_cast<faiss::ReadOnlyArrayInvertedLists*>(ivf_index->invlists);
+                ASSERT_NE(lists, nullptr);
+                ASSERT_NE(lists->borrowed_ids, nullptr);
+                ASSERT_TRUE(reader.borrowed);
+            }
+        }
+#endif
+
+        ASSERT_TRUE(config.SetStorageConfigFileMmapEnable("false").ok());
+    }
+
     {
         std::string file_location = "/tmp/knowhere_gpu_file";
         fiu_init(0);
@@ -314,7 +372,8 @@ TEST(whatever, test_config) {
 
 TEST(BFIndex, test_bf_index_fail) {
     auto bf_ptr = std::make_shared<milvus::engine::BFIndex>(nullptr);
-    auto float_vec = bf_ptr->GetRawVectors();
+    std::vector<float> buffer;
+    auto float_vec = bf_ptr->GetRawVectors(buffer);
     ASSERT_EQ(float_vec, nullptr);
     milvus::engine::Config config;
 